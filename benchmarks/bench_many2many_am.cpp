@@ -26,6 +26,7 @@ struct config_t {
   int ndevices = -1;
   bool use_upacket = false;
   bool touch_buffers = false;
+  size_t aggregation_threshold = 0;
 } g_config;
 
 static std::atomic<uint64_t> g_pending{0};
@@ -82,6 +83,10 @@ int main(int argc, char** argv)
       "b,touch-buffers",
       "Read and write AM message buffers to stress the memory system",
       cxxopts::value<bool>()->default_value("false"))(
+      "a,aggregation-threshold",
+      "Aggregate AMs no larger than this size per target rank (0 => off)",
+      cxxopts::value<size_t>()->default_value(
+          std::to_string(g_config.aggregation_threshold)))(
       "h,help", "Print help");
 
   const auto result = options.parse(argc, argv);
@@ -98,6 +103,8 @@ int main(int argc, char** argv)
   g_config.ndevices = result["ndevices"].as<int>();
   g_config.use_upacket = result["use-upacket"].as<bool>();
   g_config.touch_buffers = result["touch-buffers"].as<bool>();
+  g_config.aggregation_threshold =
+      result["aggregation-threshold"].as<size_t>();
   if (g_config.ndevices == -1) {
     g_config.ndevices = g_config.nthreads;
   }
@@ -123,6 +130,11 @@ int main(int argc, char** argv)
     }
   }
 
+  // The default endpoints of the devices aggregate small AMs
+  auto attr = lci::get_g_default_attr();
+  attr.am_aggregation_threshold = g_config.aggregation_threshold;
+  lci::set_g_default_attr(attr);
+
   // Allocate devices
   std::vector<lci::device_t> devices(g_config.ndevices);
   for (auto& dev : devices) {
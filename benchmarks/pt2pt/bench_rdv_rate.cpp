@@ -0,0 +1,169 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+// Message rate of rendezvous send/recv under many concurrent senders.
+// Every thread pairs with the same thread on the peer rank and exchanges
+// `window` messages per iteration using its own tag.
+
+#include <iostream>
+#include <thread>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include <omp.h>
+#include <cxxopts.hpp>
+#include "lci.hpp"
+
+struct config_t {
+  int nthreads = 1;
+  int ndevices = -1;
+  size_t msg_size = 65536;
+  size_t window = 64;
+  size_t niters = 100;
+} g_config;
+
+void worker(int peer_rank, lci::device_t device, bool is_sender, char* buffer)
+{
+  int thread_id = omp_get_thread_num();
+  lci::comp_t comp = lci::alloc_counter();
+
+  for (size_t i = 0; i < g_config.niters; i++) {
+    for (size_t j = 0; j < g_config.window; j++) {
+      char* address = buffer + j * g_config.msg_size;
+      lci::status_t status;
+      do {
+        if (is_sender) {
+          status = lci::post_send_x(peer_rank, address, g_config.msg_size,
+                                    thread_id, comp)
+                       .device(device)
+                       .allow_done(false)();
+        } else {
+          status = lci::post_recv_x(peer_rank, address, g_config.msg_size,
+                                    thread_id, comp)
+                       .device(device)
+                       .allow_done(false)();
+        }
+        lci::progress_x().device(device)();
+      } while (status.is_retry());
+    }
+    size_t expected = (i + 1) * g_config.window;
+    while (lci::counter_get(comp) < static_cast<int64_t>(expected)) {
+      lci::progress_x().device(device)();
+    }
+  }
+  lci::free_comp(&comp);
+}
+
+int main(int argc, char** argv)
+{
+  cxxopts::Options options("lci_bench_rdv_rate", "Rendezvous message rate test");
+  options.add_options()
+      ("t,nthreads", "Number of threads", cxxopts::value<int>()->default_value(std::to_string(g_config.nthreads)))
+      ("d,ndevices", "Number of devices", cxxopts::value<int>()->default_value(std::to_string(g_config.ndevices)))
+      ("s,msg-size", "Message size (bytes)", cxxopts::value<size_t>()->default_value(std::to_string(g_config.msg_size)))
+      ("w,window", "Number of messages in flight per thread", cxxopts::value<size_t>()->default_value(std::to_string(g_config.window)))
+      ("n,niters", "Number of iterations", cxxopts::value<size_t>()->default_value(std::to_string(g_config.niters)))
+      ("h,help", "Print help")
+      ;
+  auto result = options.parse(argc, argv);
+
+  if (result.count("help")) {
+      std::cout << options.help() << std::endl;
+      return 0;
+  }
+
+  g_config.nthreads = result["nthreads"].as<int>();
+  g_config.ndevices = result["ndevices"].as<int>();
+  g_config.msg_size = result["msg-size"].as<size_t>();
+  g_config.window = result["window"].as<size_t>();
+  g_config.niters = result["niters"].as<size_t>();
+
+  if (g_config.ndevices == -1) {
+    g_config.ndevices = g_config.nthreads;
+  }
+
+  // Adjust the packet number based on the number of devices
+  lci::global_initialize();
+  auto attr = lci::get_g_default_attr();
+  attr.npackets = attr.npackets * g_config.ndevices;
+  lci::set_g_default_attr(attr);
+
+  lci::g_runtime_init_x().alloc_default_device(false)();
+  int rank = lci::get_rank_me();
+  int nranks = lci::get_rank_n();
+  assert(nranks % 2 == 0);
+  int peer_rank = (rank + nranks / 2) % nranks;
+  bool is_sender = rank < nranks / 2;
+
+  if (g_config.msg_size <= lci::get_max_bcopy_size() && rank == 0) {
+    std::cout << "Warning: message size " << g_config.msg_size
+              << " may not go through the rendezvous protocol" << std::endl;
+  }
+  if (rank == 0) {
+    std::cout << "Running with " << g_config.nthreads << " threads, "
+              << g_config.ndevices << " devices, "
+              << g_config.msg_size << " bytes per message, "
+              << g_config.window << " messages per window, "
+              << g_config.niters << " iterations" << std::endl;
+  }
+
+  // allocate devices
+  std::vector<lci::device_t> devices(g_config.ndevices);
+  for (int i = 0; i < g_config.ndevices; i++) {
+    devices[i] = lci::alloc_device();
+  }
+
+  // allocate memory
+  std::vector<char*> buffers(g_config.nthreads);
+  for (auto& buffer : buffers) {
+    buffer = static_cast<char*>(malloc(g_config.window * g_config.msg_size));
+    memset(buffer, is_sender ? 's' : 'r', g_config.window * g_config.msg_size);
+  }
+
+  lci::barrier_x().device(devices[0])();
+  auto start = std::chrono::high_resolution_clock::now();
+  #pragma omp parallel num_threads(g_config.nthreads)
+  {
+    int thread_id = omp_get_thread_num();
+    lci::device_t device = devices[thread_id % g_config.ndevices];
+    worker(peer_rank, device, is_sender, buffers[thread_id]);
+    lci::wait_drained_x().device(device)();
+  }
+  lci::barrier_x().device(devices[0])();
+  auto end = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> elapsed = end - start;
+  double total_msgs = static_cast<double>(g_config.niters) * g_config.window *
+                      g_config.nthreads * (nranks / 2);
+  if (rank == 0) {
+    double message_rate = total_msgs / elapsed.count();
+    std::cout << "Elapsed time: " << elapsed.count() << " seconds; "
+              << "Message rate: " << message_rate / 1e6 << " Mmsgs/sec; "
+              << "Payload bandwidth: "
+              << message_rate * g_config.msg_size / 1e9 << " GB/s"
+              << std::endl;
+  }
+  // verify data
+  if (!is_sender) {
+    for (auto buffer : buffers) {
+      for (size_t i = 0; i < g_config.window * g_config.msg_size; ++i) {
+        if (buffer[i] != 's') {
+          fprintf(stderr, "Data mismatch at byte %zu: %d\n", i, buffer[i]);
+          abort();
+        }
+      }
+    }
+  }
+
+  // cleanup
+  for (auto buffer : buffers) {
+    free(buffer);
+  }
+  for (auto& dev : devices) {
+    lci::free_device(&dev);
+  }
+  lci::g_runtime_fina();
+  lci::global_finalize();
+  return 0;
+}
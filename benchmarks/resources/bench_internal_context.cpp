@@ -0,0 +1,116 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+// Compare the per-thread object pool used for internal contexts against the
+// plain aligned operator new/delete they used to go through.
+// --remote 1 lets every thread free the contexts allocated by its neighbor,
+// which mimics completions being handled by another progress thread.
+
+#include <getopt.h>
+#include <thread>
+#include <chrono>
+#include <new>
+
+#include "lct.h"
+#include "lci.hpp"
+#include "lci_internal.hpp"
+
+#include "util.hpp"
+
+struct config_t {
+  int nthreads = 16;
+  int niters = 1000;
+  int window = 1;
+  int use_pool = 1;
+  int remote = 0;
+} config;
+
+LCT_tbarrier_t g_tbarrier;
+std::vector<std::vector<lci::internal_context_t*>> g_windows;
+
+lci::internal_context_t* alloc_ctx() {
+  if (config.use_pool) {
+    return new lci::internal_context_t;
+  } else {
+    void* ptr = ::operator new(sizeof(lci::internal_context_t),
+                               std::align_val_t(alignof(lci::internal_context_t)));
+    return ::new (ptr) lci::internal_context_t;
+  }
+}
+
+void free_ctx(lci::internal_context_t* ctx) {
+  if (config.use_pool) {
+    delete ctx;
+  } else {
+    ctx->~internal_context_t();
+    ::operator delete(ctx, std::align_val_t(alignof(lci::internal_context_t)));
+  }
+}
+
+void worker(int id) {
+  util::pin_thread_to_cpu(id);
+  auto& window = g_windows[id];
+  auto& to_free = g_windows[config.remote ? (id + 1) % config.nthreads : id];
+  LCT_tbarrier_arrive_and_wait(g_tbarrier);
+  auto start = std::chrono::high_resolution_clock::now();
+  for (int i = 0; i < config.niters; i++) {
+    for (int j = 0; j < config.window; j++) {
+      window[j] = alloc_ctx();
+    }
+    if (config.remote) LCT_tbarrier_arrive_and_wait(g_tbarrier);
+    for (int j = config.window - 1; j >= 0; j--) {
+      free_ctx(to_free[j]);
+    }
+    if (config.remote) LCT_tbarrier_arrive_and_wait(g_tbarrier);
+  }
+  LCT_tbarrier_arrive_and_wait(g_tbarrier);
+  auto end = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> elapsed = end - start;
+  double elapsed_s = elapsed.count();
+  if (id == 0) {
+    printf("Elapsed time: %.2f s\n", elapsed_s);
+    printf("Per-operation time: %.2f us\n",
+           (elapsed_s * 1e6) / (config.niters * config.window));
+    double throughput_per_thread = (static_cast<double>(config.niters) * config.window) / (elapsed_s * 1e6);
+    printf("Throughput per thread: %.2f Mops/s\n",
+           throughput_per_thread);
+    printf("Throughput: %.2f Mops/s\n", throughput_per_thread * config.nthreads);
+  }
+}
+
+int main(int argc, char** argv) {
+  LCT_args_parser_t argsParser = LCT_args_parser_alloc();
+  LCT_args_parser_add(argsParser, "nthreads", required_argument,
+    &config.nthreads);
+  LCT_args_parser_add(argsParser, "niters", required_argument,
+      &config.niters);
+  LCT_args_parser_add(argsParser, "window", required_argument,
+      &config.window);
+  LCT_args_parser_add(argsParser, "use-pool", required_argument,
+      &config.use_pool);
+  LCT_args_parser_add(argsParser, "remote", required_argument,
+      &config.remote);
+  LCT_args_parser_parse(argsParser, argc, argv);
+  LCT_args_parser_print(argsParser, true);
+  LCT_args_parser_free(argsParser);
+
+  g_tbarrier = LCT_tbarrier_alloc(config.nthreads);
+  g_windows.resize(config.nthreads,
+                   std::vector<lci::internal_context_t*>(config.window));
+
+  lci::g_runtime_init();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < config.nthreads; i++) {
+    std::thread t(worker, i);
+    threads.push_back(std::move(t));
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  lci::g_runtime_fina();
+
+  LCT_tbarrier_free(&g_tbarrier);
+  return 0;
+}
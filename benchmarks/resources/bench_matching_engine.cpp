@@ -14,12 +14,26 @@ struct config_t {
   int nthreads = 16;
   int niters = 1000;
   int window = 1;
+  // the number of buckets the matching engine starts with
+  int nbuckets = 256;
+  // sweep the number of pending entries per thread from 0 to this value
+  int max_occupancy = 0;
 } config;
 
 LCT_tbarrier_t g_tbarrier;
 
-void worker(int id, lci::matching_engine_t& matching_engine) {
+// The keys of the pending entries have the highest bit set so that they never
+// match the keys of the timed loop.
+const uint64_t PENDING_KEY_BASE = 1ULL << 63;
+
+void worker(int id, lci::matching_engine_t& matching_engine, int occupancy) {
   util::pin_thread_to_cpu(id);
+  for (int i = 0; i < occupancy; i++) {
+    uint64_t key = PENDING_KEY_BASE + (uint64_t)id * occupancy + i;
+    lci::matching_engine_insert(matching_engine, key,
+                                reinterpret_cast<void*>(key + 1),
+                                lci::matching_entry_type_t::send);
+  }
   LCT_tbarrier_arrive_and_wait(g_tbarrier);
   auto start = std::chrono::high_resolution_clock::now();
   for (int i = 0; i < config.niters; i++) {
@@ -40,10 +54,17 @@ void worker(int id, lci::matching_engine_t& matching_engine) {
   std::chrono::duration<double> elapsed = end - start;
   double elapsed_s = elapsed.count();
   if (id == 0) {
+    printf("Occupancy: %d\n", occupancy * config.nthreads);
     printf("Elapsed time: %.2f s\n", elapsed_s);
     printf("Throughput: %.2f Mops/s\n",
            (config.nthreads * config.niters * config.window) / (elapsed_s * 1e6));
   }
+  for (int i = 0; i < occupancy; i++) {
+    uint64_t key = PENDING_KEY_BASE + (uint64_t)id * occupancy + i;
+    lci::matching_engine_insert(matching_engine, key,
+                                reinterpret_cast<void*>(key + 1),
+                                lci::matching_entry_type_t::recv);
+  }
 }
 
 int main(int argc, char** argv) {
@@ -54,6 +75,10 @@ int main(int argc, char** argv) {
       &config.niters);
       LCT_args_parser_add(argsParser, "window", required_argument,
           &config.window);
+  LCT_args_parser_add(argsParser, "nbuckets", required_argument,
+                      &config.nbuckets);
+  LCT_args_parser_add(argsParser, "max-occupancy", required_argument,
+                      &config.max_occupancy);
   LCT_args_parser_parse(argsParser, argc, argv);
   LCT_args_parser_print(argsParser, true);
   LCT_args_parser_free(argsParser);
@@ -61,17 +86,24 @@ int main(int argc, char** argv) {
   g_tbarrier = LCT_tbarrier_alloc(config.nthreads);
 
   lci::g_runtime_init();
-  lci::matching_engine_t matching_engine = lci::get_default_matching_engine();
+  lci::matching_engine_t matching_engine =
+      lci::alloc_matching_engine_x().nbuckets(config.nbuckets)();
 
-  std::vector<std::thread> threads;
-  for (int i = 0; i < config.nthreads; i++) {
-    std::thread t(worker, i, std::ref(matching_engine));
-    threads.push_back(std::move(t));
-  }
-  for (auto& t : threads) {
-    t.join();
+  // 0, 1, 4, 16, ... pending entries per thread
+  int occupancy = 0;
+  while (occupancy <= config.max_occupancy) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < config.nthreads; i++) {
+      std::thread t(worker, i, std::ref(matching_engine), occupancy);
+      threads.push_back(std::move(t));
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    occupancy = occupancy == 0 ? 1 : occupancy * 4;
   }
 
+  lci::free_matching_engine(&matching_engine);
   lci::g_runtime_fina();
 
   LCT_tbarrier_free(&g_tbarrier);
@@ -4,6 +4,7 @@
 #include <getopt.h>
 #include <thread>
 #include <chrono>
+#include <cstring>
 
 #include "lct.h"
 #include "lci.hpp"
@@ -15,6 +16,8 @@ struct config_t {
   int niters = 1000;
   int window = 1;
   int nbytes = 64;
+  // back the buffers with huge pages
+  int huge_page = 0;
 } config;
 
 LCT_tbarrier_t g_tbarrier;
@@ -23,7 +26,9 @@ void worker(int id) {
   util::pin_thread_to_cpu(id);
   std::vector<void*> buffers(config.window);
   for (int i = 0; i < config.window; i++) {
-    buffers[i] = malloc(config.nbytes);
+    buffers[i] = util::alloc_buffer(config.nbytes, config.huge_page);
+    // fault the pages in so that we only measure the registration
+    memset(buffers[i], 0, config.nbytes);
   }
   std::vector<lci::mr_t> mrs(config.window);
   LCT_tbarrier_arrive_and_wait(g_tbarrier);
@@ -49,6 +54,9 @@ void worker(int id) {
            throughput_per_thread);
     printf("Throughput: %.2f Mops/s\n", throughput_per_thread * config.nthreads);
   }
+  for (int i = 0; i < config.window; i++) {
+    util::free_buffer(buffers[i], config.nbytes, config.huge_page);
+  }
 }
 
 int main(int argc, char** argv) {
@@ -61,6 +69,8 @@ int main(int argc, char** argv) {
       &config.window);
   LCT_args_parser_add(argsParser, "nbytes", required_argument,
       &config.nbytes);
+  LCT_args_parser_add(argsParser, "huge_page", required_argument,
+      &config.huge_page);
   LCT_args_parser_parse(argsParser, argc, argv);
   LCT_args_parser_print(argsParser, true);
   LCT_args_parser_free(argsParser);
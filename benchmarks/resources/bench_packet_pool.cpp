@@ -4,46 +4,135 @@
 #include <getopt.h>
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <cstring>
+#include <memory>
 
 #include "lct.h"
 #include "lci.hpp"
 
 #include "util.hpp"
 
+// Modes:
+// - 0: every thread gets and puts its own packets.
+// - 1: threads form producer/consumer pairs. The producer gets a packet and
+//      writes its payload; the consumer reads it and puts it back, as a
+//      receive thread does with the packets of the progress thread. With
+//      --cross_node=1, the two threads of a pair run on different NUMA nodes.
+// --numa_aware toggles the NUMA sub-heaps of the packet pool and --huge_page
+// its huge pages. The time to allocate and register the pool is reported too.
+// With --scaling=1, both modes run with 1, 2, 4, ... up to nthreads threads
+// and one line is reported per run. Mode 0 measures the owner get/put path of
+// the per-thread deques; in mode 1 the packets pile up in the deques of the
+// consumers and the producers have to steal them back.
 struct config_t {
   int nthreads = 16;
   int niters = 1000;
   int window = 1;
+  int mode = 0;
+  int cross_node = 0;
+  int numa_aware = 0;
+  int huge_page = 0;
+  int payload_size = 4096;
+  int scaling = 0;
 } config;
 
 LCT_tbarrier_t g_tbarrier;
+double g_elapsed_s;
+lci::packet_pool_t g_pool;
+std::vector<std::vector<int>> g_numa_cpus;
+// one handoff slot per window entry for every producer/consumer pair
+std::unique_ptr<std::atomic<void*>[]> g_slots;
+
+int get_cpu(int id) {
+  if (config.mode == 1 && g_numa_cpus.size() > 1) {
+    // the producers on node 0; the consumers on node 0 or node 1
+    int pair = id / 2;
+    int node = (id % 2 == 1 && config.cross_node) ? 1 : 0;
+    const auto& cpus = g_numa_cpus[node];
+    int offset = (id % 2 == 1 && !config.cross_node) ? 1 : 0;
+    return cpus[(pair * (config.cross_node ? 1 : 2) + offset) % cpus.size()];
+  }
+  return id;
+}
+
+void* get_packet() {
+  void* ret;
+  do {
+    ret = lci::get_upacket_x().packet_pool(g_pool)();
+  } while (ret == nullptr);
+  return ret;
+}
+
+void producer(int pair) {
+  std::atomic<void*>* slots = &g_slots[pair * config.window];
+  for (int i = 0; i < config.niters; i++) {
+    for (int j = 0; j < config.window; j++) {
+      void* packet = get_packet();
+      memset(packet, 'a' + i % 26, config.payload_size);
+      while (slots[j].load(std::memory_order_relaxed) != nullptr) continue;
+      slots[j].store(packet, std::memory_order_release);
+    }
+  }
+}
+
+void consumer(int pair) {
+  std::atomic<void*>* slots = &g_slots[pair * config.window];
+  volatile uint64_t sum = 0;
+  for (int i = 0; i < config.niters; i++) {
+    for (int j = 0; j < config.window; j++) {
+      void* packet;
+      while ((packet = slots[j].load(std::memory_order_acquire)) == nullptr)
+        continue;
+      slots[j].store(nullptr, std::memory_order_relaxed);
+      const uint64_t* p = static_cast<const uint64_t*>(packet);
+      for (size_t k = 0; k < config.payload_size / sizeof(uint64_t); k++)
+        sum = sum + p[k];
+      lci::put_upacket(packet);
+    }
+  }
+}
 
 void worker(int id) {
-  util::pin_thread_to_cpu(id);
+  util::pin_thread_to_cpu(get_cpu(id));
   std::vector<void*> packets(config.window);
   LCT_tbarrier_arrive_and_wait(g_tbarrier);
   auto start = std::chrono::high_resolution_clock::now();
-  for (int i = 0; i < config.niters; i++) {
-    for (int j = 0; j < config.window; j++) {
-      void *ret;
-      do {
-        ret = lci::get_upacket();
-      } while (ret == nullptr);
-      packets[j] = ret;
-    }
-    for (int j = config.window - 1; j >= 0; j--) {
-      lci::put_upacket(packets[j]);
+  if (config.mode == 1) {
+    if (id % 2 == 0)
+      producer(id / 2);
+    else
+      consumer(id / 2);
+  } else {
+    for (int i = 0; i < config.niters; i++) {
+      for (int j = 0; j < config.window; j++) {
+        packets[j] = get_packet();
+      }
+      for (int j = config.window - 1; j >= 0; j--) {
+        lci::put_upacket(packets[j]);
+      }
     }
   }
   LCT_tbarrier_arrive_and_wait(g_tbarrier);
   auto end = std::chrono::high_resolution_clock::now();
   std::chrono::duration<double> elapsed = end - start;
-  double elapsed_s = elapsed.count();
-  if (id == 0) {
-    printf("Elapsed time: %.2f s\n", elapsed_s);
-    printf("Throughput: %.2f Mops/s\n",
-           (config.nthreads * config.niters * config.window) / (elapsed_s * 1e6));
+  if (id == 0) g_elapsed_s = elapsed.count();
+}
+
+// Run the current mode with nthreads threads. Return the throughput in Mops/s.
+double run(int nthreads) {
+  g_tbarrier = LCT_tbarrier_alloc(nthreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < nthreads; i++) {
+    std::thread t(worker, i);
+    threads.push_back(std::move(t));
   }
+  for (auto& t : threads) {
+    t.join();
+  }
+  LCT_tbarrier_free(&g_tbarrier);
+  int nops = config.mode == 1 ? nthreads / 2 : nthreads;
+  return (1.0 * nops * config.niters * config.window) / (g_elapsed_s * 1e6);
 }
 
 int main(int argc, char** argv) {
@@ -52,27 +141,68 @@ int main(int argc, char** argv) {
     &config.nthreads);
   LCT_args_parser_add(argsParser, "niters", required_argument,
       &config.niters);
-      LCT_args_parser_add(argsParser, "window", required_argument,
-          &config.window);
+  LCT_args_parser_add(argsParser, "window", required_argument,
+      &config.window);
+  LCT_args_parser_add(argsParser, "mode", required_argument, &config.mode);
+  LCT_args_parser_add(argsParser, "cross_node", required_argument,
+      &config.cross_node);
+  LCT_args_parser_add(argsParser, "numa_aware", required_argument,
+      &config.numa_aware);
+  LCT_args_parser_add(argsParser, "huge_page", required_argument,
+      &config.huge_page);
+  LCT_args_parser_add(argsParser, "payload_size", required_argument,
+      &config.payload_size);
+  LCT_args_parser_add(argsParser, "scaling", required_argument,
+      &config.scaling);
   LCT_args_parser_parse(argsParser, argc, argv);
   LCT_args_parser_print(argsParser, true);
   LCT_args_parser_free(argsParser);
 
-  g_tbarrier = LCT_tbarrier_alloc(config.nthreads);
+  if (!config.scaling && config.mode == 1 && config.nthreads % 2 != 0) {
+    fprintf(stderr, "The producer/consumer mode needs an even nthreads\n");
+    return 1;
+  }
+  g_numa_cpus = util::get_numa_cpus();
+  if (config.mode == 1 && config.cross_node && g_numa_cpus.size() < 2) {
+    fprintf(stderr, "Only one NUMA node; cross_node has no effect\n");
+  }
+  g_slots.reset(new std::atomic<void*>[config.nthreads * config.window]);
+  for (int i = 0; i < config.nthreads * config.window; i++)
+    g_slots[i] = nullptr;
 
   lci::g_runtime_init();
+  auto start = std::chrono::high_resolution_clock::now();
+  g_pool = lci::alloc_packet_pool_x()
+               .numa_aware(config.numa_aware)
+               .huge_page(config.huge_page)();
+  auto allocated = std::chrono::high_resolution_clock::now();
+  lci::register_packet_pool(g_pool, lci::get_default_device());
+  auto registered = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> alloc_time = allocated - start;
+  std::chrono::duration<double> reg_time = registered - allocated;
+  printf("Packet pool allocation time: %.2f ms\n", alloc_time.count() * 1e3);
+  printf("Packet pool registration time: %.2f ms\n", reg_time.count() * 1e3);
+  size_t max_payload_size = lci::get_max_bcopy_size();
+  if (config.payload_size < 0 ||
+      static_cast<size_t>(config.payload_size) > max_payload_size)
+    config.payload_size = max_payload_size;
 
-  std::vector<std::thread> threads;
-  for (int i = 0; i < config.nthreads; i++) {
-    std::thread t(worker, i);
-    threads.push_back(std::move(t));
-  }
-  for (auto& t : threads) {
-    t.join();
+  if (config.scaling) {
+    printf("%-6s %-10s %-10s\n", "mode", "nthreads", "Mops/s");
+    for (int mode : {0, 1}) {
+      config.mode = mode;
+      for (int n = mode == 1 ? 2 : 1; n <= config.nthreads; n *= 2) {
+        printf("%-6d %-10d %-10.2f\n", mode, n, run(n));
+      }
+    }
+  } else {
+    double throughput = run(config.nthreads);
+    printf("Elapsed time: %.2f s\n", g_elapsed_s);
+    printf("Throughput: %.2f Mops/s\n", throughput);
   }
 
+  lci::deregister_packet_pool(g_pool, lci::get_default_device());
+  lci::free_packet_pool(&g_pool);
   lci::g_runtime_fina();
-
-  LCT_tbarrier_free(&g_tbarrier);
   return 0;
-}
\ No newline at end of file
+}
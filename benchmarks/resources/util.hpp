@@ -8,6 +8,10 @@
 #define _GNU_SOURCE
 #endif
 #include <pthread.h>
+#include <sys/mman.h>
+#include <cstdio>
+#include <thread>
+#include <vector>
 
 namespace util {
 // TODO: Simplify the thread spawning and pinning
@@ -24,6 +28,78 @@ void pin_thread_to_cpu(size_t cpu_id) {
   }
 #endif
 }
+
+// The CPUs of every NUMA node, read from sysfs. Without it, all CPUs are
+// reported as a single node.
+std::vector<std::vector<int>> get_numa_cpus() {
+  std::vector<std::vector<int>> nodes;
+  for (int node = 0;; ++node) {
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+             node);
+    FILE* file = fopen(path, "r");
+    if (!file) break;
+    std::vector<int> cpus;
+    int first, last, c;
+    while (fscanf(file, "%d", &first) == 1) {
+      last = first;
+      c = fgetc(file);
+      if (c == '-') {
+        if (fscanf(file, "%d", &last) != 1) break;
+        c = fgetc(file);
+      }
+      for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+      if (c != ',') break;
+    }
+    fclose(file);
+    // skip memory-only nodes
+    if (!cpus.empty()) nodes.push_back(cpus);
+  }
+  if (nodes.empty()) {
+    nodes.emplace_back();
+    for (unsigned i = 0; i < std::thread::hardware_concurrency(); ++i)
+      nodes[0].push_back(i);
+  }
+  return nodes;
+}
+
+// Allocate a buffer backed by huge pages if possible (explicit ones first,
+// then transparent ones). Free it with free_buffer.
+void* alloc_buffer(size_t size, bool huge_page) {
+  if (!huge_page) return malloc(size);
+  const size_t huge_page_size = 2 * 1024 * 1024;
+  size = (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+#ifdef MAP_HUGETLB
+  void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (address != MAP_FAILED) return address;
+  fprintf(stderr, "No explicit huge pages; trying transparent ones\n");
+#endif
+  // align the mapping to the huge page size and trim the rest
+  char* p = static_cast<char*>(mmap(nullptr, size + huge_page_size,
+                                    PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  if (p == MAP_FAILED) return nullptr;
+  uintptr_t start = reinterpret_cast<uintptr_t>(p);
+  size_t head = (huge_page_size - start % huge_page_size) % huge_page_size;
+  if (head > 0) munmap(p, head);
+  if (huge_page_size - head > 0)
+    munmap(p + head + size, huge_page_size - head);
+#ifdef MADV_HUGEPAGE
+  madvise(p + head, size, MADV_HUGEPAGE);
+#endif
+  return p + head;
+}
+
+void free_buffer(void* address, size_t size, bool huge_page) {
+  if (!huge_page) {
+    free(address);
+    return;
+  }
+  const size_t huge_page_size = 2 * 1024 * 1024;
+  size = (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+  munmap(address, size);
+}
 } // namespace util
 
 #endif // LCI_BENCHMARKS_UTIL_HPP
\ No newline at end of file
@@ -246,6 +246,8 @@ enum class net_opcode_t {
   WRITE,        /**< write */
   REMOTE_WRITE, /**< remote write */
   READ,         /**< read */
+  ATOMIC,       /**< remote atomic operation */
+  TAGGED_RECV,  /**< receive of a tagged message */
   ERROR,        /**< asynchronous completion error */
 };
 
@@ -324,7 +326,8 @@ using net_imm_data_t = uint32_t;
  * communication operation. For @ref net_opcode_t::ERROR, @c rank is the
  * backend-reported peer rank when available and @c user_context is the
  * outgoing operation context when available. Receive errors report rank -1 and
- * a null user context.
+ * a null user context. For @ref net_opcode_t::TAGGED_RECV, @c imm_data is the
+ * lower 32 bits of the network tag of the message.
  */
 struct net_status_t {
   net_opcode_t opcode;
@@ -381,6 +384,121 @@ struct rmr_t {
  */
 const rmr_t RMR_NULL = rmr_t();
 
+/**
+ * @ingroup LCI_BASIC
+ * @brief An entry of a local io vector.
+ * @details Used by the vectored communication operations (e.g.,
+ * @ref post_sendv) to describe one contiguous piece of a message. @c mr is the
+ * registered memory region of the piece, or MR_HOST to let LCI handle it.
+ */
+struct iovec_t {
+  void* buffer;
+  size_t size;
+  mr_t mr;
+  iovec_t() : buffer(nullptr), size(0), mr(MR_HOST) {}
+  iovec_t(void* buffer_, size_t size_, mr_t mr_ = MR_HOST)
+      : buffer(buffer_), size(size_), mr(mr_)
+  {
+  }
+};
+
+/**
+ * @ingroup LCI_BASIC
+ * @brief A lightweight descriptor of a non-contiguous local buffer layout.
+ * @details Used by the communication operations (e.g., @ref post_send) to
+ * send or receive strided data without a user-side pack pass. The buffer
+ * argument of the operation is the base address of the layout and the
+ * message is the packed (contiguous) data. All counts and offsets are in
+ * elements of @c elem_size bytes. The displacement array of an indexed-block
+ * datatype is not copied and must stay valid until the operation completes.
+ */
+struct datatype_t {
+  enum class type_t {
+    contiguous,
+    vector,
+    subarray,
+    indexed_block,
+  };
+  static const int MAX_NDIMS = 3;
+
+  type_t type;
+  size_t elem_size;
+  // vector/indexed_block: count blocks of blocklength elements
+  size_t count;
+  size_t blocklength;
+  // vector: the distance between the starts of two consecutive blocks
+  size_t stride;
+  // indexed_block: the displacement of each block
+  const size_t* displacements;
+  // subarray: an array of ndims dimensions in row-major (C) order
+  int ndims;
+  size_t sizes[MAX_NDIMS];
+  size_t subsizes[MAX_NDIMS];
+  size_t starts[MAX_NDIMS];
+
+  datatype_t()
+      : type(type_t::contiguous),
+        elem_size(1),
+        count(0),
+        blocklength(0),
+        stride(0),
+        displacements(nullptr),
+        ndims(0),
+        sizes{},
+        subsizes{},
+        starts{}
+  {
+  }
+  // count contiguous elements
+  static datatype_t contiguous(size_t count, size_t elem_size = 1)
+  {
+    datatype_t ret;
+    ret.elem_size = elem_size;
+    ret.count = 1;
+    ret.blocklength = count;
+    return ret;
+  }
+  // count blocks of blocklength elements, the starts of two consecutive
+  // blocks are stride elements apart
+  static datatype_t vector(size_t count, size_t blocklength, size_t stride,
+                           size_t elem_size = 1)
+  {
+    datatype_t ret = contiguous(blocklength, elem_size);
+    ret.type = type_t::vector;
+    ret.count = count;
+    ret.stride = stride;
+    return ret;
+  }
+  // the subsizes[0] x ... x subsizes[ndims - 1] block starting at starts of
+  // a sizes[0] x ... x sizes[ndims - 1] array
+  static datatype_t subarray(int ndims, const size_t* sizes,
+                             const size_t* subsizes, const size_t* starts,
+                             size_t elem_size = 1)
+  {
+    datatype_t ret;
+    ret.type = type_t::subarray;
+    ret.elem_size = elem_size;
+    ret.ndims = ndims;
+    for (int i = 0; i < ndims && i < MAX_NDIMS; i++) {
+      ret.sizes[i] = sizes[i];
+      ret.subsizes[i] = subsizes[i];
+      ret.starts[i] = starts[i];
+    }
+    return ret;
+  }
+  // count blocks of blocklength elements starting at displacements
+  static datatype_t indexed_block(size_t count, size_t blocklength,
+                                  const size_t* displacements,
+                                  size_t elem_size = 1)
+  {
+    datatype_t ret = contiguous(blocklength, elem_size);
+    ret.type = type_t::indexed_block;
+    ret.count = count;
+    ret.displacements = displacements;
+    return ret;
+  }
+};
+
 /**
  * @ingroup LCI_BASIC
  * @brief The type of tag.
@@ -396,6 +514,30 @@ enum class direction_t {
   IN,  /**< pull data in, such as receive/get */
 };
 
+/**
+ * @ingroup LCI_BASIC
+ * @brief The enum class of remote atomic operations.
+ * @details All operations are executed on an integer in a remote memory region.
+ * The fetching operations return the old value of the integer.
+ */
+enum class atomic_op_t {
+  add,       /**< add the operand, without fetching */
+  fetch_add, /**< add the operand and fetch the old value */
+  swap,      /**< replace with the operand and fetch the old value */
+  cas, /**< replace with the operand if equal to compare; fetch the old value */
+};
+
+/**
+ * @ingroup LCI_BASIC
+ * @brief The integer type of a remote atomic operation.
+ */
+enum class atomic_type_t {
+  int32,  /**< int32_t */
+  uint32, /**< uint32_t */
+  int64,  /**< int64_t */
+  uint64, /**< uint64_t */
+};
+
 /**
  * @ingroup LCI_BASIC
  * @brief The type of remote completion handler.
@@ -554,6 +696,7 @@ class comp_impl_t
   {
     attr.comp_type = attr_comp_type_t::custom;
     attr.zero_copy_am = false;
+    attr.blocking = false;
     attr.name = DEFAULT_NAME;
     attr.user_context = nullptr;
   }
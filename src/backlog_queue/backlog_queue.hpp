@@ -7,6 +7,8 @@
 namespace lci
 {
 class endpoint_impl_t;
+struct net_atomic_buffer_t;
+struct net_batch_op_t;
 class backlog_queue_t
 {
  public:
@@ -44,6 +46,32 @@ class backlog_queue_t
   inline void push_get(endpoint_impl_t* endpoint, int rank, void* buffer,
                        size_t size, mr_t mr, uint64_t offset, rmr_t rmr,
                        void* user_context);
+  // The io vector (but not the data it points to) is copied.
+  inline void push_sendv(endpoint_impl_t* endpoint, int rank,
+                         const iovec_t* iov, size_t count,
+                         net_imm_data_t imm_data, void* user_context);
+  inline void push_putv(endpoint_impl_t* endpoint, int rank, const iovec_t* iov,
+                        size_t count, uint64_t offset, rmr_t rmr,
+                        void* user_context);
+  inline void push_putImmv(endpoint_impl_t* endpoint, int rank,
+                           const iovec_t* iov, size_t count, uint64_t offset,
+                           rmr_t rmr, net_imm_data_t imm_data,
+                           void* user_context);
+  inline void push_getv(endpoint_impl_t* endpoint, int rank, const iovec_t* iov,
+                        size_t count, uint64_t offset, rmr_t rmr,
+                        void* user_context);
+  inline void push_atomic(endpoint_impl_t* endpoint, int rank, atomic_op_t op,
+                          atomic_type_t type, net_atomic_buffer_t* buffer,
+                          mr_t mr, uint64_t offset, rmr_t rmr,
+                          void* user_context);
+  inline void push_tsends(endpoint_impl_t* endpoint, int rank, void* buffer,
+                          size_t size, uint64_t tag, void* user_context);
+  inline void push_tsend(endpoint_impl_t* endpoint, int rank, void* buffer,
+                         size_t size, mr_t mr, uint64_t tag,
+                         void* user_context);
+  // The operations of a batch are pushed under one lock.
+  inline void push_batch(endpoint_impl_t* endpoint, const net_batch_op_t* ops,
+                         size_t count);
   inline bool progress();
   inline void set_empty(bool empty_)
   {
@@ -69,11 +97,21 @@ class backlog_queue_t
     putImms,
     putImm,
     get,
+    sendv,
+    putv,
+    putImmv,
+    getv,
+    atomic,
+    tsends,
+    tsend,
   };
   struct backlog_queue_entry_t {
     backlog_op_t op;
     endpoint_impl_t* endpoint;
     int rank;
+    // for io vector operations: the copied io vector and its length
+    // for atomic operations: the atomic buffer and (op << 8 | type) as imm_data
+    // for tagged sends: the network tag as offset
     void* buffer;
     size_t size;
     mr_t mr;
@@ -82,6 +120,9 @@ class backlog_queue_t
     net_imm_data_t imm_data;
     void* user_context;
   };
+  inline void push_iov(backlog_op_t op, endpoint_impl_t* endpoint, int rank,
+                       const iovec_t* iov, size_t count, uint64_t offset,
+                       rmr_t rmr, net_imm_data_t imm_data, void* user_context);
   // we use a lock-based queue instead of a atomic-based queue for two reasons:
   // 1. we assume that the backlog queue is not used frequently.
   // 2. we would like to ensure the operations are executed in the order they
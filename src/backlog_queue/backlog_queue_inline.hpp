@@ -179,6 +179,187 @@ inline void backlog_queue_t::push_get(endpoint_impl_t* endpoint, int rank,
   lock.unlock();
 }
 
+inline void backlog_queue_t::push_iov(backlog_op_t op,
+                                      endpoint_impl_t* endpoint, int rank,
+                                      const iovec_t* iov, size_t count,
+                                      uint64_t offset, rmr_t rmr,
+                                      net_imm_data_t imm_data,
+                                      void* user_context)
+{
+  LCI_PCOUNTER_ADD(backlog_queue_push, 1);
+  backlog_queue_entry_t entry;
+  entry.op = op;
+  entry.endpoint = endpoint;
+  entry.rank = rank;
+  iovec_t* iov_copy = new iovec_t[count];
+  std::copy(iov, iov + count, iov_copy);
+  entry.buffer = iov_copy;
+  entry.size = count;
+  entry.offset = offset;
+  entry.rmr = rmr;
+  entry.imm_data = imm_data;
+  entry.user_context = user_context;
+
+  nentries_per_rank[rank].val.fetch_add(1, std::memory_order_relaxed);
+  lock.lock();
+  backlog_queue.push(entry);
+  set_empty(false);
+  lock.unlock();
+}
+
+inline void backlog_queue_t::push_sendv(endpoint_impl_t* endpoint, int rank,
+                                        const iovec_t* iov, size_t count,
+                                        net_imm_data_t imm_data,
+                                        void* user_context)
+{
+  push_iov(backlog_op_t::sendv, endpoint, rank, iov, count, 0, RMR_NULL,
+           imm_data, user_context);
+}
+
+inline void backlog_queue_t::push_putv(endpoint_impl_t* endpoint, int rank,
+                                       const iovec_t* iov, size_t count,
+                                       uint64_t offset, rmr_t rmr,
+                                       void* user_context)
+{
+  push_iov(backlog_op_t::putv, endpoint, rank, iov, count, offset, rmr, 0,
+           user_context);
+}
+
+inline void backlog_queue_t::push_putImmv(endpoint_impl_t* endpoint, int rank,
+                                          const iovec_t* iov, size_t count,
+                                          uint64_t offset, rmr_t rmr,
+                                          net_imm_data_t imm_data,
+                                          void* user_context)
+{
+  push_iov(backlog_op_t::putImmv, endpoint, rank, iov, count, offset, rmr,
+           imm_data, user_context);
+}
+
+inline void backlog_queue_t::push_getv(endpoint_impl_t* endpoint, int rank,
+                                       const iovec_t* iov, size_t count,
+                                       uint64_t offset, rmr_t rmr,
+                                       void* user_context)
+{
+  push_iov(backlog_op_t::getv, endpoint, rank, iov, count, offset, rmr, 0,
+           user_context);
+}
+
+inline void backlog_queue_t::push_atomic(endpoint_impl_t* endpoint, int rank,
+                                         atomic_op_t op, atomic_type_t type,
+                                         net_atomic_buffer_t* buffer, mr_t mr,
+                                         uint64_t offset, rmr_t rmr,
+                                         void* user_context)
+{
+  LCI_PCOUNTER_ADD(backlog_queue_push, 1);
+  backlog_queue_entry_t entry;
+  entry.op = backlog_op_t::atomic;
+  entry.endpoint = endpoint;
+  entry.rank = rank;
+  entry.buffer = buffer;
+  entry.size = 0;
+  entry.mr = mr;
+  entry.offset = offset;
+  entry.rmr = rmr;
+  entry.imm_data = static_cast<net_imm_data_t>(op) << 8 |
+                   static_cast<net_imm_data_t>(type);
+  entry.user_context = user_context;
+
+  nentries_per_rank[rank].val.fetch_add(1, std::memory_order_relaxed);
+  lock.lock();
+  backlog_queue.push(entry);
+  set_empty(false);
+  lock.unlock();
+}
+
+inline void backlog_queue_t::push_tsends(endpoint_impl_t* endpoint, int rank,
+                                         void* buffer, size_t size,
+                                         uint64_t tag, void* user_context)
+{
+  LCI_PCOUNTER_ADD(backlog_queue_push, 1);
+  backlog_queue_entry_t entry;
+  entry.op = backlog_op_t::tsends;
+  entry.endpoint = endpoint;
+  entry.rank = rank;
+  if (size) {
+    entry.buffer = malloc(size);
+    memcpy(entry.buffer, buffer, size);
+  } else {
+    entry.buffer = nullptr;
+  }
+  entry.size = size;
+  entry.offset = tag;
+  entry.user_context = user_context;
+
+  nentries_per_rank[rank].val.fetch_add(1, std::memory_order_relaxed);
+  lock.lock();
+  backlog_queue.push(entry);
+  set_empty(false);
+  lock.unlock();
+}
+
+inline void backlog_queue_t::push_tsend(endpoint_impl_t* endpoint, int rank,
+                                        void* buffer, size_t size, mr_t mr,
+                                        uint64_t tag, void* user_context)
+{
+  LCI_PCOUNTER_ADD(backlog_queue_push, 1);
+  backlog_queue_entry_t entry;
+  entry.op = backlog_op_t::tsend;
+  entry.endpoint = endpoint;
+  entry.rank = rank;
+  entry.buffer = buffer;
+  entry.size = size;
+  entry.mr = mr;
+  entry.offset = tag;
+  entry.user_context = user_context;
+
+  nentries_per_rank[rank].val.fetch_add(1, std::memory_order_relaxed);
+  lock.lock();
+  backlog_queue.push(entry);
+  set_empty(false);
+  lock.unlock();
+}
+
+inline void backlog_queue_t::push_batch(endpoint_impl_t* endpoint,
+                                        const net_batch_op_t* ops,
+                                        size_t count)
+{
+  LCI_PCOUNTER_ADD(backlog_queue_push, count);
+  for (size_t i = 0; i < count; i++) {
+    nentries_per_rank[ops[i].rank].val.fetch_add(1, std::memory_order_relaxed);
+  }
+  lock.lock();
+  for (size_t i = 0; i < count; i++) {
+    const net_batch_op_t& op = ops[i];
+    backlog_queue_entry_t entry;
+    switch (op.type) {
+      case net_batch_op_t::type_t::send:
+        entry.op = backlog_op_t::send;
+        break;
+      case net_batch_op_t::type_t::put:
+        entry.op = backlog_op_t::put;
+        break;
+      case net_batch_op_t::type_t::putImm:
+        entry.op = backlog_op_t::putImm;
+        break;
+      case net_batch_op_t::type_t::get:
+        entry.op = backlog_op_t::get;
+        break;
+    }
+    entry.endpoint = endpoint;
+    entry.rank = op.rank;
+    entry.buffer = op.buffer;
+    entry.size = op.size;
+    entry.mr = op.mr;
+    entry.offset = op.offset;
+    entry.rmr = op.rmr;
+    entry.imm_data = op.imm_data;
+    entry.user_context = op.user_context;
+    backlog_queue.push(entry);
+  }
+  set_empty(false);
+  lock.unlock();
+}
+
 inline bool backlog_queue_t::progress()
 {
   if (is_empty()) {
@@ -231,6 +412,44 @@ inline bool backlog_queue_t::progress()
                                        entry.mr, entry.offset, entry.rmr,
                                        entry.user_context, true, true);
       break;
+    case backlog_op_t::sendv:
+      error = entry.endpoint->post_sendv(
+          entry.rank, static_cast<iovec_t*>(entry.buffer), entry.size,
+          entry.imm_data, entry.user_context, true, true);
+      break;
+    case backlog_op_t::putv:
+      error = entry.endpoint->post_putv(
+          entry.rank, static_cast<iovec_t*>(entry.buffer), entry.size,
+          entry.offset, entry.rmr, entry.user_context, true, true);
+      break;
+    case backlog_op_t::putImmv:
+      error = entry.endpoint->post_putImmv(
+          entry.rank, static_cast<iovec_t*>(entry.buffer), entry.size,
+          entry.offset, entry.rmr, entry.imm_data, entry.user_context, true,
+          true);
+      break;
+    case backlog_op_t::getv:
+      error = entry.endpoint->post_getv(
+          entry.rank, static_cast<iovec_t*>(entry.buffer), entry.size,
+          entry.offset, entry.rmr, entry.user_context, true, true);
+      break;
+    case backlog_op_t::atomic:
+      error = entry.endpoint->post_atomic(
+          entry.rank, static_cast<atomic_op_t>(entry.imm_data >> 8),
+          static_cast<atomic_type_t>(entry.imm_data & 0xff),
+          static_cast<net_atomic_buffer_t*>(entry.buffer), entry.mr,
+          entry.offset, entry.rmr, entry.user_context, true, true);
+      break;
+    case backlog_op_t::tsends:
+      error = entry.endpoint->post_tsends(entry.rank, entry.buffer, entry.size,
+                                          entry.offset, entry.user_context,
+                                          true, true);
+      break;
+    case backlog_op_t::tsend:
+      error = entry.endpoint->post_tsend(entry.rank, entry.buffer, entry.size,
+                                         entry.mr, entry.offset,
+                                         entry.user_context, true, true);
+      break;
     default:
       LCI_Assert(false, "Unknown operation %d\n", entry.op);
   }
@@ -246,8 +465,13 @@ inline bool backlog_queue_t::progress()
     nentries_per_rank[entry.rank].val.fetch_sub(1, std::memory_order_relaxed);
     did_something = true;
     if (entry.op == backlog_op_t::sends || entry.op == backlog_op_t::puts ||
-        entry.op == backlog_op_t::putImms) {
+        entry.op == backlog_op_t::putImms || entry.op == backlog_op_t::tsends) {
       free(entry.buffer);
+    } else if (entry.op == backlog_op_t::sendv ||
+               entry.op == backlog_op_t::putv ||
+               entry.op == backlog_op_t::putImmv ||
+               entry.op == backlog_op_t::getv) {
+      delete[] static_cast<iovec_t*>(entry.buffer);
     }
     LCI_PCOUNTER_ADD(backlog_queue_pop, 1);
   } else {
@@ -0,0 +1,1313 @@
+
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+// clang-format off
+// This file is generated by generate_binding.py
+
+#include "lci_internal.hpp"
+
+namespace lci {
+
+global_attr_t g_default_attr;
+
+void init_global_attr() {
+  g_default_attr.packet_return_threshold = get_env_or("LCI_ATTR_PACKET_RETURN_THRESHOLD", 4096);
+  LCI_Log(LOG_INFO, "env", "set packet_return_threshold to be %d\n", static_cast<int>(g_default_attr.packet_return_threshold));
+  g_default_attr.imm_nbits_tag = get_env_or("LCI_ATTR_IMM_NBITS_TAG", 16);
+  LCI_Log(LOG_INFO, "env", "set imm_nbits_tag to be %d\n", static_cast<int>(g_default_attr.imm_nbits_tag));
+  g_default_attr.imm_nbits_rcomp = get_env_or("LCI_ATTR_IMM_NBITS_RCOMP", 15);
+  LCI_Log(LOG_INFO, "env", "set imm_nbits_rcomp to be %d\n", static_cast<int>(g_default_attr.imm_nbits_rcomp));
+
+  {
+    // default value
+    g_default_attr.rdv_protocol = attr_rdv_protocol_t::auto_select;
+    // if users explicitly set the value
+    char* p = getenv("LCI_ATTR_RDV_PROTOCOL");
+    if (p) {
+      LCT_dict_str_int_t dict[] = {
+         {"auto_select", static_cast<int>(attr_rdv_protocol_t::auto_select)},
+         {"write", static_cast<int>(attr_rdv_protocol_t::write)},
+         {"writeimm", static_cast<int>(attr_rdv_protocol_t::writeimm)},
+         {"read", static_cast<int>(attr_rdv_protocol_t::read)},
+
+      };
+      g_default_attr.rdv_protocol =
+          static_cast<attr_rdv_protocol_t>(LCT_parse_arg(dict, sizeof(dict) / sizeof(dict[0]), p, ","));
+    }
+    LCI_Log(LOG_INFO, "env", "set rdv_protocol to be %d\n",
+              static_cast<int>(g_default_attr.rdv_protocol));
+  }
+  g_default_attr.rdv_read_threshold = get_env_or("LCI_ATTR_RDV_READ_THRESHOLD", 262144);
+  LCI_Log(LOG_INFO, "env", "set rdv_read_threshold to be %d\n", static_cast<int>(g_default_attr.rdv_read_threshold));
+  g_default_attr.rdv_pipeline = get_env_or("LCI_ATTR_RDV_PIPELINE", 0);
+  LCI_Log(LOG_INFO, "env", "set rdv_pipeline to be %d\n", static_cast<int>(g_default_attr.rdv_pipeline));
+  g_default_attr.rdv_pipeline_chunk_size = get_env_or("LCI_ATTR_RDV_PIPELINE_CHUNK_SIZE", 1048576);
+  LCI_Log(LOG_INFO, "env", "set rdv_pipeline_chunk_size to be %d\n", static_cast<int>(g_default_attr.rdv_pipeline_chunk_size));
+  g_default_attr.inject_threshold = get_env_or("LCI_ATTR_INJECT_THRESHOLD", SIZE_MAX);
+  LCI_Log(LOG_INFO, "env", "set inject_threshold to be %d\n", static_cast<int>(g_default_attr.inject_threshold));
+  g_default_attr.eager_threshold = get_env_or("LCI_ATTR_EAGER_THRESHOLD", SIZE_MAX);
+  LCI_Log(LOG_INFO, "env", "set eager_threshold to be %d\n", static_cast<int>(g_default_attr.eager_threshold));
+  g_default_attr.zcopy_threshold = get_env_or("LCI_ATTR_ZCOPY_THRESHOLD", 0);
+  LCI_Log(LOG_INFO, "env", "set zcopy_threshold to be %d\n", static_cast<int>(g_default_attr.zcopy_threshold));
+  g_default_attr.tuning_profile = get_env_or("LCI_ATTR_TUNING_PROFILE", "");
+  LCI_Log(LOG_INFO, "env", "set tuning_profile to be %s\n", g_default_attr.tuning_profile.c_str());
+  g_default_attr.alloc_default_device = get_env_or("LCI_ATTR_ALLOC_DEFAULT_DEVICE", 1);
+  LCI_Log(LOG_INFO, "env", "set alloc_default_device to be %d\n", static_cast<int>(g_default_attr.alloc_default_device));
+  g_default_attr.alloc_default_packet_pool = get_env_or("LCI_ATTR_ALLOC_DEFAULT_PACKET_POOL", 1);
+  LCI_Log(LOG_INFO, "env", "set alloc_default_packet_pool to be %d\n", static_cast<int>(g_default_attr.alloc_default_packet_pool));
+  g_default_attr.alloc_default_matching_engine = get_env_or("LCI_ATTR_ALLOC_DEFAULT_MATCHING_ENGINE", 1);
+  LCI_Log(LOG_INFO, "env", "set alloc_default_matching_engine to be %d\n", static_cast<int>(g_default_attr.alloc_default_matching_engine));
+  g_default_attr.packet_size = get_env_or("LCI_ATTR_PACKET_SIZE", LCI_PACKET_SIZE_DEFAULT);
+  LCI_Log(LOG_INFO, "env", "set packet_size to be %d\n", static_cast<int>(g_default_attr.packet_size));
+  g_default_attr.npackets = get_env_or("LCI_ATTR_NPACKETS", LCI_PACKET_NUM_DEFAULT);
+  LCI_Log(LOG_INFO, "env", "set npackets to be %d\n", static_cast<int>(g_default_attr.npackets));
+  g_default_attr.min_packet_size = get_env_or("LCI_ATTR_MIN_PACKET_SIZE", 0);
+  LCI_Log(LOG_INFO, "env", "set min_packet_size to be %d\n", static_cast<int>(g_default_attr.min_packet_size));
+  g_default_attr.numa_aware = get_env_or("LCI_ATTR_NUMA_AWARE", 0);
+  LCI_Log(LOG_INFO, "env", "set numa_aware to be %d\n", static_cast<int>(g_default_attr.numa_aware));
+  g_default_attr.huge_page = get_env_or("LCI_ATTR_HUGE_PAGE", 0);
+  LCI_Log(LOG_INFO, "env", "set huge_page to be %d\n", static_cast<int>(g_default_attr.huge_page));
+  g_default_attr.npackets_max = get_env_or("LCI_ATTR_NPACKETS_MAX", 0);
+  LCI_Log(LOG_INFO, "env", "set npackets_max to be %d\n", static_cast<int>(g_default_attr.npackets_max));
+  g_default_attr.slab_cooldown = get_env_or("LCI_ATTR_SLAB_COOLDOWN", 1000);
+  LCI_Log(LOG_INFO, "env", "set slab_cooldown to be %d\n", static_cast<int>(g_default_attr.slab_cooldown));
+
+  {
+    // default value
+    g_default_attr.matching_engine_type = attr_matching_engine_type_t::map;
+    // if users explicitly set the value
+    char* p = getenv("LCI_ATTR_MATCHING_ENGINE_TYPE");
+    if (p) {
+      LCT_dict_str_int_t dict[] = {
+         {"queue", static_cast<int>(attr_matching_engine_type_t::queue)},
+         {"map", static_cast<int>(attr_matching_engine_type_t::map)},
+         {"offload", static_cast<int>(attr_matching_engine_type_t::offload)},
+
+      };
+      g_default_attr.matching_engine_type =
+          static_cast<attr_matching_engine_type_t>(LCT_parse_arg(dict, sizeof(dict) / sizeof(dict[0]), p, ","));
+    }
+    LCI_Log(LOG_INFO, "env", "set matching_engine_type to be %d\n",
+              static_cast<int>(g_default_attr.matching_engine_type));
+  }
+  g_default_attr.nbuckets = get_env_or("LCI_ATTR_NBUCKETS", 256);
+  LCI_Log(LOG_INFO, "env", "set nbuckets to be %d\n", static_cast<int>(g_default_attr.nbuckets));
+  g_default_attr.sync_threshold = get_env_or("LCI_ATTR_SYNC_THRESHOLD", 1);
+  LCI_Log(LOG_INFO, "env", "set sync_threshold to be %d\n", static_cast<int>(g_default_attr.sync_threshold));
+  g_default_attr.zero_copy_am = get_env_or("LCI_ATTR_ZERO_COPY_AM", false);
+  LCI_Log(LOG_INFO, "env", "set zero_copy_am to be %d\n", static_cast<int>(g_default_attr.zero_copy_am));
+
+  {
+    // default value
+    g_default_attr.cq_type = attr_cq_type_t::lcrq;
+    // if users explicitly set the value
+    char* p = getenv("LCI_ATTR_CQ_TYPE");
+    if (p) {
+      LCT_dict_str_int_t dict[] = {
+         {"array_atomic", static_cast<int>(attr_cq_type_t::array_atomic)},
+         {"lcrq", static_cast<int>(attr_cq_type_t::lcrq)},
+
+      };
+      g_default_attr.cq_type =
+          static_cast<attr_cq_type_t>(LCT_parse_arg(dict, sizeof(dict) / sizeof(dict[0]), p, ","));
+    }
+    LCI_Log(LOG_INFO, "env", "set cq_type to be %d\n",
+              static_cast<int>(g_default_attr.cq_type));
+  }
+  g_default_attr.cq_default_length = get_env_or("LCI_ATTR_CQ_DEFAULT_LENGTH", 65536);
+  LCI_Log(LOG_INFO, "env", "set cq_default_length to be %d\n", static_cast<int>(g_default_attr.cq_default_length));
+  g_default_attr.blocking = get_env_or("LCI_ATTR_BLOCKING", false);
+  LCI_Log(LOG_INFO, "env", "set blocking to be %d\n", static_cast<int>(g_default_attr.blocking));
+  g_default_attr.ofi_provider_name = get_env_or("LCI_ATTR_OFI_PROVIDER_NAME", LCI_OFI_PROVIDER_HINT_DEFAULT);
+  LCI_Log(LOG_INFO, "env", "set ofi_provider_name to be %s\n", g_default_attr.ofi_provider_name.c_str());
+  g_default_attr.max_msg_size = get_env_or("LCI_ATTR_MAX_MSG_SIZE", LCI_USE_MAX_SINGLE_MESSAGE_SIZE_DEFAULT);
+  LCI_Log(LOG_INFO, "env", "set max_msg_size to be %d\n", static_cast<int>(g_default_attr.max_msg_size));
+  g_default_attr.max_inject_size = get_env_or("LCI_ATTR_MAX_INJECT_SIZE", 64);
+  LCI_Log(LOG_INFO, "env", "set max_inject_size to be %d\n", static_cast<int>(g_default_attr.max_inject_size));
+  g_default_attr.max_iov = get_env_or("LCI_ATTR_MAX_IOV", LCI_BACKEND_MAX_IOV);
+  LCI_Log(LOG_INFO, "env", "set max_iov to be %d\n", static_cast<int>(g_default_attr.max_iov));
+  g_default_attr.ibv_gid_idx = get_env_or("LCI_ATTR_IBV_GID_IDX", -1);
+  LCI_Log(LOG_INFO, "env", "set ibv_gid_idx to be %d\n", static_cast<int>(g_default_attr.ibv_gid_idx));
+  g_default_attr.ibv_force_gid_auto_select = get_env_or("LCI_ATTR_IBV_FORCE_GID_AUTO_SELECT", 0);
+  LCI_Log(LOG_INFO, "env", "set ibv_force_gid_auto_select to be %d\n", static_cast<int>(g_default_attr.ibv_force_gid_auto_select));
+  g_default_attr.device_name = get_env_or("LCI_ATTR_DEVICE_NAME", "");
+  LCI_Log(LOG_INFO, "env", "set device_name to be %s\n", g_default_attr.device_name.c_str());
+
+  {
+    // default value
+    g_default_attr.ibv_odp_strategy = attr_ibv_odp_strategy_t::none;
+    // if users explicitly set the value
+    char* p = getenv("LCI_ATTR_IBV_ODP_STRATEGY");
+    if (p) {
+      LCT_dict_str_int_t dict[] = {
+         {"none", static_cast<int>(attr_ibv_odp_strategy_t::none)},
+         {"explicit_odp", static_cast<int>(attr_ibv_odp_strategy_t::explicit_odp)},
+         {"implicit_odp", static_cast<int>(attr_ibv_odp_strategy_t::implicit_odp)},
+
+      };
+      g_default_attr.ibv_odp_strategy =
+          static_cast<attr_ibv_odp_strategy_t>(LCT_parse_arg(dict, sizeof(dict) / sizeof(dict[0]), p, ","));
+    }
+    LCI_Log(LOG_INFO, "env", "set ibv_odp_strategy to be %d\n",
+              static_cast<int>(g_default_attr.ibv_odp_strategy));
+  }
+
+  {
+    // default value
+    g_default_attr.ibv_prefetch_strategy = attr_ibv_prefetch_strategy_t::none;
+    // if users explicitly set the value
+    char* p = getenv("LCI_ATTR_IBV_PREFETCH_STRATEGY");
+    if (p) {
+      LCT_dict_str_int_t dict[] = {
+         {"none", static_cast<int>(attr_ibv_prefetch_strategy_t::none)},
+         {"prefetch", static_cast<int>(attr_ibv_prefetch_strategy_t::prefetch)},
+         {"prefetch_write", static_cast<int>(attr_ibv_prefetch_strategy_t::prefetch_write)},
+         {"prefetch_no_fault", static_cast<int>(attr_ibv_prefetch_strategy_t::prefetch_no_fault)},
+
+      };
+      g_default_attr.ibv_prefetch_strategy =
+          static_cast<attr_ibv_prefetch_strategy_t>(LCT_parse_arg(dict, sizeof(dict) / sizeof(dict[0]), p, ","));
+    }
+    LCI_Log(LOG_INFO, "env", "set ibv_prefetch_strategy to be %d\n",
+              static_cast<int>(g_default_attr.ibv_prefetch_strategy));
+  }
+  g_default_attr.use_dmabuf = get_env_or("LCI_ATTR_USE_DMABUF", 1);
+  LCI_Log(LOG_INFO, "env", "set use_dmabuf to be %d\n", static_cast<int>(g_default_attr.use_dmabuf));
+  g_default_attr.net_max_sends = get_env_or("LCI_ATTR_NET_MAX_SENDS", LCI_BACKEND_MAX_SENDS_DEFAULT);
+  LCI_Log(LOG_INFO, "env", "set net_max_sends to be %d\n", static_cast<int>(g_default_attr.net_max_sends));
+  g_default_attr.net_max_recvs = get_env_or("LCI_ATTR_NET_MAX_RECVS", LCI_BACKEND_MAX_RECVS_DEFAULT);
+  LCI_Log(LOG_INFO, "env", "set net_max_recvs to be %d\n", static_cast<int>(g_default_attr.net_max_recvs));
+  g_default_attr.net_max_cqes = get_env_or("LCI_ATTR_NET_MAX_CQES", LCI_BACKEND_MAX_CQES_DEFAULT);
+  LCI_Log(LOG_INFO, "env", "set net_max_cqes to be %d\n", static_cast<int>(g_default_attr.net_max_cqes));
+  g_default_attr.net_send_reserved_pct = get_env_or("LCI_ATTR_NET_SEND_RESERVED_PCT", 0.25);
+  LCI_Log(LOG_INFO, "env", "set net_send_reserved_pct to be %f\n", static_cast<double>(g_default_attr.net_send_reserved_pct));
+  g_default_attr.alloc_default_endpoint = get_env_or("LCI_ATTR_ALLOC_DEFAULT_ENDPOINT", 1);
+  LCI_Log(LOG_INFO, "env", "set alloc_default_endpoint to be %d\n", static_cast<int>(g_default_attr.alloc_default_endpoint));
+  g_default_attr.alloc_progress_endpoint = get_env_or("LCI_ATTR_ALLOC_PROGRESS_ENDPOINT", 0);
+  LCI_Log(LOG_INFO, "env", "set alloc_progress_endpoint to be %d\n", static_cast<int>(g_default_attr.alloc_progress_endpoint));
+  g_default_attr.net_comp_channel = get_env_or("LCI_ATTR_NET_COMP_CHANNEL", 0);
+  LCI_Log(LOG_INFO, "env", "set net_comp_channel to be %d\n", static_cast<int>(g_default_attr.net_comp_channel));
+  g_default_attr.use_reg_cache = get_env_or("LCI_ATTR_USE_REG_CACHE", LCI_USE_REG_CACHE);
+  LCI_Log(LOG_INFO, "env", "set use_reg_cache to be %d\n", static_cast<int>(g_default_attr.use_reg_cache));
+  g_default_attr.shm_enable = get_env_or("LCI_ATTR_SHM_ENABLE", LCI_WITH_SHM);
+  LCI_Log(LOG_INFO, "env", "set shm_enable to be %d\n", static_cast<int>(g_default_attr.shm_enable));
+  g_default_attr.shm_ring_size = get_env_or("LCI_ATTR_SHM_RING_SIZE", 64 * 1024);
+  LCI_Log(LOG_INFO, "env", "set shm_ring_size to be %d\n", static_cast<int>(g_default_attr.shm_ring_size));
+  g_default_attr.shm_slot_size = get_env_or("LCI_ATTR_SHM_SLOT_SIZE", 128);
+  LCI_Log(LOG_INFO, "env", "set shm_slot_size to be %d\n", static_cast<int>(g_default_attr.shm_slot_size));
+  g_default_attr.shm_producer_cas_attempts = get_env_or("LCI_ATTR_SHM_PRODUCER_CAS_ATTEMPTS", 4);
+  LCI_Log(LOG_INFO, "env", "set shm_producer_cas_attempts to be %d\n", static_cast<int>(g_default_attr.shm_producer_cas_attempts));
+  g_default_attr.shm_consumer_cas_attempts = get_env_or("LCI_ATTR_SHM_CONSUMER_CAS_ATTEMPTS", 1);
+  LCI_Log(LOG_INFO, "env", "set shm_consumer_cas_attempts to be %d\n", static_cast<int>(g_default_attr.shm_consumer_cas_attempts));
+  g_default_attr.shm_huge_page = get_env_or("LCI_ATTR_SHM_HUGE_PAGE", 0);
+  LCI_Log(LOG_INFO, "env", "set shm_huge_page to be %d\n", static_cast<int>(g_default_attr.shm_huge_page));
+  g_default_attr.shm_max_polls = get_env_or("LCI_ATTR_SHM_MAX_POLLS", LCI_BACKEND_MAX_POLLS);
+  LCI_Log(LOG_INFO, "env", "set shm_max_polls to be %d\n", static_cast<int>(g_default_attr.shm_max_polls));
+  g_default_attr.eager_rdma_threshold = get_env_or("LCI_ATTR_EAGER_RDMA_THRESHOLD", 0);
+  LCI_Log(LOG_INFO, "env", "set eager_rdma_threshold to be %d\n", static_cast<int>(g_default_attr.eager_rdma_threshold));
+  g_default_attr.eager_rdma_nslots = get_env_or("LCI_ATTR_EAGER_RDMA_NSLOTS", 64);
+  LCI_Log(LOG_INFO, "env", "set eager_rdma_nslots to be %d\n", static_cast<int>(g_default_attr.eager_rdma_nslots));
+  g_default_attr.eager_rdma_slot_size = get_env_or("LCI_ATTR_EAGER_RDMA_SLOT_SIZE", 1024);
+  LCI_Log(LOG_INFO, "env", "set eager_rdma_slot_size to be %d\n", static_cast<int>(g_default_attr.eager_rdma_slot_size));
+
+  {
+    // default value
+    g_default_attr.ibv_td_strategy = attr_ibv_td_strategy_t::per_qp;
+    // if users explicitly set the value
+    char* p = getenv("LCI_ATTR_IBV_TD_STRATEGY");
+    if (p) {
+      LCT_dict_str_int_t dict[] = {
+         {"none", static_cast<int>(attr_ibv_td_strategy_t::none)},
+         {"all_qp", static_cast<int>(attr_ibv_td_strategy_t::all_qp)},
+         {"per_qp", static_cast<int>(attr_ibv_td_strategy_t::per_qp)},
+
+      };
+      g_default_attr.ibv_td_strategy =
+          static_cast<attr_ibv_td_strategy_t>(LCT_parse_arg(dict, sizeof(dict) / sizeof(dict[0]), p, ","));
+    }
+    LCI_Log(LOG_INFO, "env", "set ibv_td_strategy to be %d\n",
+              static_cast<int>(g_default_attr.ibv_td_strategy));
+  }
+  g_default_attr.am_aggregation_threshold = get_env_or("LCI_ATTR_AM_AGGREGATION_THRESHOLD", 0);
+  LCI_Log(LOG_INFO, "env", "set am_aggregation_threshold to be %d\n", static_cast<int>(g_default_attr.am_aggregation_threshold));
+}
+
+void barrier_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_coll_matching_engine);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto comp = m_comp.get_value_or(COMP_NULL);
+  return call_impl(runtime, device, endpoint, matching_engine, comp_semantic, comp);
+}
+
+void broadcast_x::call() const {
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto root = m_root;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_coll_matching_engine);
+  auto comp = m_comp.get_value_or(COMP_NULL);
+  auto algorithm = m_algorithm.get_value_or(broadcast_algorithm_t::none);
+  auto ring_nsteps = m_ring_nsteps.get_value_or(get_rank_n() - 1);
+  return call_impl(buffer, size, root, runtime, device, endpoint, matching_engine, comp, algorithm, ring_nsteps);
+}
+
+void reduce_x::call() const {
+  auto sendbuf = m_sendbuf;
+  auto recvbuf = m_recvbuf;
+  auto count = m_count;
+  auto item_size = m_item_size;
+  auto op = m_op;
+  auto root = m_root;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_coll_matching_engine);
+  return call_impl(sendbuf, recvbuf, count, item_size, op, root, runtime, device, endpoint, matching_engine);
+}
+
+void reduce_scatter_x::call() const {
+  auto sendbuf = m_sendbuf;
+  auto recvbuf = m_recvbuf;
+  auto recvcount = m_recvcount;
+  auto item_size = m_item_size;
+  auto op = m_op;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_coll_matching_engine);
+  auto comp = m_comp.get_value_or(COMP_NULL);
+  auto algorithm = m_algorithm.get_value_or(reduce_scatter_algorithm_t::none);
+  auto ring_nsteps = m_ring_nsteps.get_value_or(get_rank_n() - 1);
+  return call_impl(sendbuf, recvbuf, recvcount, item_size, op, runtime, device, endpoint, matching_engine, comp, algorithm, ring_nsteps);
+}
+
+void allreduce_x::call() const {
+  auto sendbuf = m_sendbuf;
+  auto recvbuf = m_recvbuf;
+  auto count = m_count;
+  auto item_size = m_item_size;
+  auto op = m_op;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_coll_matching_engine);
+  auto comp = m_comp.get_value_or(COMP_NULL);
+  auto algorithm = m_algorithm.get_value_or(allreduce_algorithm_t::none);
+  auto ring_nsteps = m_ring_nsteps.get_value_or(get_rank_n() - 1);
+  return call_impl(sendbuf, recvbuf, count, item_size, op, runtime, device, endpoint, matching_engine, comp, algorithm, ring_nsteps);
+}
+
+void allgather_x::call() const {
+  auto sendbuf = m_sendbuf;
+  auto recvbuf = m_recvbuf;
+  auto size = m_size;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_coll_matching_engine);
+  return call_impl(sendbuf, recvbuf, size, runtime, device, endpoint, matching_engine);
+}
+
+void alltoall_x::call() const {
+  auto sendbuf = m_sendbuf;
+  auto recvbuf = m_recvbuf;
+  auto size = m_size;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_coll_matching_engine);
+  auto comp = m_comp.get_value_or(COMP_NULL);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  return call_impl(sendbuf, recvbuf, size, runtime, device, endpoint, matching_engine, comp, comp_semantic);
+}
+
+status_t post_comm_x::call() const {
+  auto direction = m_direction;
+  auto rank = m_rank;
+  auto local_buffer = m_local_buffer;
+  auto size = m_size;
+  auto local_comp = m_local_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_matching_engine);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto mr = m_mr.get_value_or(MR_HOST);
+  auto remote_disp = m_remote_disp.get_value_or(0);
+  auto rmr = m_rmr.get_value_or(RMR_NULL);
+  auto tag = m_tag.get_value_or(0);
+  auto remote_comp = m_remote_comp.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto matching_policy = m_matching_policy.get_value_or(matching_policy_t::rank_tag);
+  auto iov = m_iov.get_value_or(nullptr);
+  auto iov_count = m_iov_count.get_value_or(0);
+  auto datatype = m_datatype.get_value_or(nullptr);
+  auto zero_copy = m_zero_copy.get_value_or(false);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(direction, rank, local_buffer, size, local_comp, runtime, device, endpoint, packet_pool, matching_engine, comp_semantic, mr, remote_disp, rmr, tag, remote_comp, user_context, matching_policy, iov, iov_count, datatype, zero_copy, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_am_x::call() const {
+  auto rank = m_rank;
+  auto local_buffer = m_local_buffer;
+  auto size = m_size;
+  auto local_comp = m_local_comp;
+  auto remote_comp = m_remote_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto mr = m_mr.get_value_or(MR_HOST);
+  auto tag = m_tag.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto datatype = m_datatype.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, local_buffer, size, local_comp, remote_comp, runtime, device, endpoint, packet_pool, comp_semantic, mr, tag, user_context, datatype, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_send_x::call() const {
+  auto rank = m_rank;
+  auto local_buffer = m_local_buffer;
+  auto size = m_size;
+  auto tag = m_tag;
+  auto local_comp = m_local_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_matching_engine);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto mr = m_mr.get_value_or(MR_HOST);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto matching_policy = m_matching_policy.get_value_or(matching_policy_t::rank_tag);
+  auto datatype = m_datatype.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, local_buffer, size, tag, local_comp, runtime, device, endpoint, packet_pool, matching_engine, comp_semantic, mr, user_context, matching_policy, datatype, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_amv_x::call() const {
+  auto rank = m_rank;
+  auto iov = m_iov;
+  auto iov_count = m_iov_count;
+  auto local_comp = m_local_comp;
+  auto remote_comp = m_remote_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto tag = m_tag.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, iov, iov_count, local_comp, remote_comp, runtime, device, endpoint, packet_pool, comp_semantic, tag, user_context, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_sendv_x::call() const {
+  auto rank = m_rank;
+  auto iov = m_iov;
+  auto iov_count = m_iov_count;
+  auto tag = m_tag;
+  auto local_comp = m_local_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_matching_engine);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto matching_policy = m_matching_policy.get_value_or(matching_policy_t::rank_tag);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, iov, iov_count, tag, local_comp, runtime, device, endpoint, packet_pool, matching_engine, comp_semantic, user_context, matching_policy, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_recv_x::call() const {
+  auto rank = m_rank;
+  auto local_buffer = m_local_buffer;
+  auto size = m_size;
+  auto tag = m_tag;
+  auto local_comp = m_local_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_matching_engine);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto mr = m_mr.get_value_or(MR_HOST);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto matching_policy = m_matching_policy.get_value_or(matching_policy_t::rank_tag);
+  auto zero_copy = m_zero_copy.get_value_or(false);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, local_buffer, size, tag, local_comp, runtime, device, endpoint, packet_pool, matching_engine, comp_semantic, mr, user_context, matching_policy, zero_copy, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_put_x::call() const {
+  auto rank = m_rank;
+  auto local_buffer = m_local_buffer;
+  auto size = m_size;
+  auto local_comp = m_local_comp;
+  auto remote_disp = m_remote_disp;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto mr = m_mr.get_value_or(MR_HOST);
+  auto tag = m_tag.get_value_or(0);
+  auto remote_comp = m_remote_comp.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto datatype = m_datatype.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, local_buffer, size, local_comp, remote_disp, rmr, runtime, device, endpoint, packet_pool, comp_semantic, mr, tag, remote_comp, user_context, datatype, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_putv_x::call() const {
+  auto rank = m_rank;
+  auto iov = m_iov;
+  auto iov_count = m_iov_count;
+  auto local_comp = m_local_comp;
+  auto remote_disp = m_remote_disp;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto tag = m_tag.get_value_or(0);
+  auto remote_comp = m_remote_comp.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, iov, iov_count, local_comp, remote_disp, rmr, runtime, device, endpoint, packet_pool, comp_semantic, tag, remote_comp, user_context, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_get_x::call() const {
+  auto rank = m_rank;
+  auto local_buffer = m_local_buffer;
+  auto size = m_size;
+  auto local_comp = m_local_comp;
+  auto remote_disp = m_remote_disp;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto mr = m_mr.get_value_or(MR_HOST);
+  auto tag = m_tag.get_value_or(0);
+  auto remote_comp = m_remote_comp.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto datatype = m_datatype.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, local_buffer, size, local_comp, remote_disp, rmr, runtime, device, endpoint, packet_pool, comp_semantic, mr, tag, remote_comp, user_context, datatype, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_getv_x::call() const {
+  auto rank = m_rank;
+  auto iov = m_iov;
+  auto iov_count = m_iov_count;
+  auto local_comp = m_local_comp;
+  auto remote_disp = m_remote_disp;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto tag = m_tag.get_value_or(0);
+  auto remote_comp = m_remote_comp.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, iov, iov_count, local_comp, remote_disp, rmr, runtime, device, endpoint, packet_pool, tag, remote_comp, user_context, allow_done, allow_posted, allow_retry);
+}
+
+status_t post_atomic_x::call() const {
+  auto rank = m_rank;
+  auto op = m_op;
+  auto operand = m_operand;
+  auto result = m_result;
+  auto local_comp = m_local_comp;
+  auto remote_disp = m_remote_disp;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto compare = m_compare.get_value_or(0);
+  auto type = m_type.get_value_or(atomic_type_t::uint64);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(rank, op, operand, result, local_comp, remote_disp, rmr, runtime, compare, type, device, endpoint, packet_pool, user_context, allow_done, allow_posted, allow_retry);
+}
+const char* persistent_comm_t::get_attr_name() const { return p_impl->attr.name; }
+void* persistent_comm_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+persistent_comm_t::attr_t persistent_comm_t::get_attr() const { return p_impl->attr; }
+
+persistent_comm_t alloc_persistent_comm_x::call() const {
+  auto direction = m_direction;
+  auto rank = m_rank;
+  auto local_buffer = m_local_buffer;
+  auto size = m_size;
+  auto local_comp = m_local_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto packet_pool = m_packet_pool.get_value_or(device.get_impl()->packet_pool);
+  auto matching_engine = m_matching_engine.get_value_or(runtime.get_impl()->default_matching_engine);
+  auto comp_semantic = m_comp_semantic.get_value_or(comp_semantic_t::memory);
+  auto mr = m_mr.get_value_or(MR_HOST);
+  auto remote_disp = m_remote_disp.get_value_or(0);
+  auto rmr = m_rmr.get_value_or(RMR_NULL);
+  auto tag = m_tag.get_value_or(0);
+  auto remote_comp = m_remote_comp.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto matching_policy = m_matching_policy.get_value_or(matching_policy_t::rank_tag);
+  auto iov = m_iov.get_value_or(nullptr);
+  auto iov_count = m_iov_count.get_value_or(0);
+  auto datatype = m_datatype.get_value_or(nullptr);
+  auto zero_copy = m_zero_copy.get_value_or(false);
+  auto allow_done = m_allow_done.get_value_or(true);
+  auto allow_posted = m_allow_posted.get_value_or(true);
+  auto allow_retry = m_allow_retry.get_value_or(true);
+  return call_impl(direction, rank, local_buffer, size, local_comp, runtime, device, endpoint, packet_pool, matching_engine, comp_semantic, mr, remote_disp, rmr, tag, remote_comp, user_context, matching_policy, iov, iov_count, datatype, zero_copy, allow_done, allow_posted, allow_retry);
+}
+
+void free_persistent_comm_x::call() const {
+  auto persistent_comm = m_persistent_comm;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(persistent_comm, runtime);
+}
+
+status_t start_x::call() const {
+  auto persistent_comm = m_persistent_comm;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(persistent_comm, runtime);
+}
+
+void begin_batch_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  return call_impl(runtime, device, endpoint);
+}
+
+void flush_batch_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(runtime);
+}
+
+error_t progress_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->progress_endpoint);
+  return call_impl(runtime, device, endpoint);
+}
+
+error_t test_drained_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(runtime, device);
+}
+
+void wait_drained_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(runtime, device);
+}
+
+error_t flush_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  return call_impl(runtime, device, endpoint);
+}
+size_t runtime_t::get_attr_packet_return_threshold() const { return p_impl->attr.packet_return_threshold; }
+int runtime_t::get_attr_imm_nbits_tag() const { return p_impl->attr.imm_nbits_tag; }
+int runtime_t::get_attr_imm_nbits_rcomp() const { return p_impl->attr.imm_nbits_rcomp; }
+attr_rdv_protocol_t runtime_t::get_attr_rdv_protocol() const { return p_impl->attr.rdv_protocol; }
+size_t runtime_t::get_attr_rdv_read_threshold() const { return p_impl->attr.rdv_read_threshold; }
+bool runtime_t::get_attr_rdv_pipeline() const { return p_impl->attr.rdv_pipeline; }
+size_t runtime_t::get_attr_rdv_pipeline_chunk_size() const { return p_impl->attr.rdv_pipeline_chunk_size; }
+size_t runtime_t::get_attr_inject_threshold() const { return p_impl->attr.inject_threshold; }
+size_t runtime_t::get_attr_eager_threshold() const { return p_impl->attr.eager_threshold; }
+size_t runtime_t::get_attr_zcopy_threshold() const { return p_impl->attr.zcopy_threshold; }
+std::string runtime_t::get_attr_tuning_profile() const { return p_impl->attr.tuning_profile; }
+uint64_t runtime_t::get_attr_max_imm_tag() const { return p_impl->attr.max_imm_tag; }
+uint64_t runtime_t::get_attr_max_imm_rcomp() const { return p_impl->attr.max_imm_rcomp; }
+uint64_t runtime_t::get_attr_max_tag() const { return p_impl->attr.max_tag; }
+uint64_t runtime_t::get_attr_max_rcomp() const { return p_impl->attr.max_rcomp; }
+bool runtime_t::get_attr_alloc_default_device() const { return p_impl->attr.alloc_default_device; }
+bool runtime_t::get_attr_alloc_default_packet_pool() const { return p_impl->attr.alloc_default_packet_pool; }
+bool runtime_t::get_attr_alloc_default_matching_engine() const { return p_impl->attr.alloc_default_matching_engine; }
+const char* runtime_t::get_attr_name() const { return p_impl->attr.name; }
+void* runtime_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+runtime_t::attr_t runtime_t::get_attr() const { return p_impl->attr; }
+
+runtime_t alloc_runtime_x::call() const {
+  global_initialize();
+  auto packet_return_threshold = m_packet_return_threshold.get_value_or(g_default_attr.packet_return_threshold);
+  auto imm_nbits_tag = m_imm_nbits_tag.get_value_or(g_default_attr.imm_nbits_tag);
+  auto imm_nbits_rcomp = m_imm_nbits_rcomp.get_value_or(g_default_attr.imm_nbits_rcomp);
+  auto rdv_protocol = m_rdv_protocol.get_value_or(g_default_attr.rdv_protocol);
+  auto rdv_read_threshold = m_rdv_read_threshold.get_value_or(g_default_attr.rdv_read_threshold);
+  auto rdv_pipeline = m_rdv_pipeline.get_value_or(g_default_attr.rdv_pipeline);
+  auto rdv_pipeline_chunk_size = m_rdv_pipeline_chunk_size.get_value_or(g_default_attr.rdv_pipeline_chunk_size);
+  auto inject_threshold = m_inject_threshold.get_value_or(g_default_attr.inject_threshold);
+  auto eager_threshold = m_eager_threshold.get_value_or(g_default_attr.eager_threshold);
+  auto zcopy_threshold = m_zcopy_threshold.get_value_or(g_default_attr.zcopy_threshold);
+  auto tuning_profile = m_tuning_profile.get_value_or(g_default_attr.tuning_profile);
+  auto alloc_default_device = m_alloc_default_device.get_value_or(g_default_attr.alloc_default_device);
+  auto alloc_default_packet_pool = m_alloc_default_packet_pool.get_value_or(g_default_attr.alloc_default_packet_pool);
+  auto alloc_default_matching_engine = m_alloc_default_matching_engine.get_value_or(g_default_attr.alloc_default_matching_engine);
+  auto name = m_name.get_value_or(DEFAULT_NAME);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto device_name = m_device_name.get_value_or(g_default_attr.device_name);
+  return call_impl(packet_return_threshold, imm_nbits_tag, imm_nbits_rcomp, rdv_protocol, rdv_read_threshold, rdv_pipeline, rdv_pipeline_chunk_size, inject_threshold, eager_threshold, zcopy_threshold, tuning_profile, alloc_default_device, alloc_default_packet_pool, alloc_default_matching_engine, name, user_context, device_name);
+}
+
+void free_runtime_x::call() const {
+  auto runtime = m_runtime;
+  call_impl(runtime);
+  global_finalize();
+}
+
+runtime_t g_runtime_init_x::call() const {
+  global_initialize();
+  auto packet_return_threshold = m_packet_return_threshold.get_value_or(g_default_attr.packet_return_threshold);
+  auto imm_nbits_tag = m_imm_nbits_tag.get_value_or(g_default_attr.imm_nbits_tag);
+  auto imm_nbits_rcomp = m_imm_nbits_rcomp.get_value_or(g_default_attr.imm_nbits_rcomp);
+  auto rdv_protocol = m_rdv_protocol.get_value_or(g_default_attr.rdv_protocol);
+  auto rdv_read_threshold = m_rdv_read_threshold.get_value_or(g_default_attr.rdv_read_threshold);
+  auto rdv_pipeline = m_rdv_pipeline.get_value_or(g_default_attr.rdv_pipeline);
+  auto rdv_pipeline_chunk_size = m_rdv_pipeline_chunk_size.get_value_or(g_default_attr.rdv_pipeline_chunk_size);
+  auto inject_threshold = m_inject_threshold.get_value_or(g_default_attr.inject_threshold);
+  auto eager_threshold = m_eager_threshold.get_value_or(g_default_attr.eager_threshold);
+  auto zcopy_threshold = m_zcopy_threshold.get_value_or(g_default_attr.zcopy_threshold);
+  auto tuning_profile = m_tuning_profile.get_value_or(g_default_attr.tuning_profile);
+  auto alloc_default_device = m_alloc_default_device.get_value_or(g_default_attr.alloc_default_device);
+  auto alloc_default_packet_pool = m_alloc_default_packet_pool.get_value_or(g_default_attr.alloc_default_packet_pool);
+  auto alloc_default_matching_engine = m_alloc_default_matching_engine.get_value_or(g_default_attr.alloc_default_matching_engine);
+  auto name = m_name.get_value_or(DEFAULT_NAME);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto device_name = m_device_name.get_value_or(g_default_attr.device_name);
+  return call_impl(packet_return_threshold, imm_nbits_tag, imm_nbits_rcomp, rdv_protocol, rdv_read_threshold, rdv_pipeline, rdv_pipeline_chunk_size, inject_threshold, eager_threshold, zcopy_threshold, tuning_profile, alloc_default_device, alloc_default_packet_pool, alloc_default_matching_engine, name, user_context, device_name);
+}
+
+void g_runtime_fina_x::call() const {
+  call_impl();
+  global_finalize();
+}
+
+runtime_t get_g_runtime_x::call() const {
+  return call_impl();
+}
+size_t packet_pool_t::get_attr_packet_size() const { return p_impl->attr.packet_size; }
+size_t packet_pool_t::get_attr_npackets() const { return p_impl->attr.npackets; }
+size_t packet_pool_t::get_attr_min_packet_size() const { return p_impl->attr.min_packet_size; }
+bool packet_pool_t::get_attr_numa_aware() const { return p_impl->attr.numa_aware; }
+bool packet_pool_t::get_attr_huge_page() const { return p_impl->attr.huge_page; }
+size_t packet_pool_t::get_attr_npackets_max() const { return p_impl->attr.npackets_max; }
+int packet_pool_t::get_attr_slab_cooldown() const { return p_impl->attr.slab_cooldown; }
+const char* packet_pool_t::get_attr_name() const { return p_impl->attr.name; }
+void* packet_pool_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+packet_pool_t::attr_t packet_pool_t::get_attr() const { return p_impl->attr; }
+
+packet_pool_t alloc_packet_pool_x::call() const {
+  auto packet_size = m_packet_size.get_value_or(g_default_attr.packet_size);
+  auto npackets = m_npackets.get_value_or(g_default_attr.npackets);
+  auto min_packet_size = m_min_packet_size.get_value_or(g_default_attr.min_packet_size);
+  auto numa_aware = m_numa_aware.get_value_or(g_default_attr.numa_aware);
+  auto huge_page = m_huge_page.get_value_or(g_default_attr.huge_page);
+  auto npackets_max = m_npackets_max.get_value_or(g_default_attr.npackets_max);
+  auto slab_cooldown = m_slab_cooldown.get_value_or(g_default_attr.slab_cooldown);
+  auto name = m_name.get_value_or(DEFAULT_NAME);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(packet_size, npackets, min_packet_size, numa_aware, huge_page, npackets_max, slab_cooldown, name, user_context, runtime);
+}
+
+void free_packet_pool_x::call() const {
+  auto packet_pool = m_packet_pool;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(packet_pool, runtime);
+}
+
+void register_packet_pool_x::call() const {
+  auto packet_pool = m_packet_pool;
+  auto device = m_device;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(packet_pool, device, runtime);
+}
+
+void deregister_packet_pool_x::call() const {
+  auto packet_pool = m_packet_pool;
+  auto device = m_device;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(packet_pool, device, runtime);
+}
+
+void* get_upacket_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto packet_pool = m_packet_pool.get_value_or(runtime.get_impl()->default_packet_pool);
+  return call_impl(runtime, packet_pool);
+}
+
+void put_upacket_x::call() const {
+  auto packet = m_packet;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(packet, runtime);
+}
+attr_matching_engine_type_t matching_engine_t::get_attr_matching_engine_type() const { return p_impl->attr.matching_engine_type; }
+size_t matching_engine_t::get_attr_nbuckets() const { return p_impl->attr.nbuckets; }
+const char* matching_engine_t::get_attr_name() const { return p_impl->attr.name; }
+void* matching_engine_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+matching_engine_t::attr_t matching_engine_t::get_attr() const { return p_impl->attr; }
+
+matching_engine_t alloc_matching_engine_x::call() const {
+  auto matching_engine_type = m_matching_engine_type.get_value_or(g_default_attr.matching_engine_type);
+  auto nbuckets = m_nbuckets.get_value_or(g_default_attr.nbuckets);
+  auto name = m_name.get_value_or(DEFAULT_NAME);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(matching_engine_type, nbuckets, name, user_context, runtime);
+}
+
+void free_matching_engine_x::call() const {
+  auto matching_engine = m_matching_engine;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(matching_engine, runtime);
+}
+
+matching_entry_val_t matching_engine_insert_x::call() const {
+  auto matching_engine = m_matching_engine;
+  auto key = m_key;
+  auto value = m_value;
+  auto entry_type = m_entry_type;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(matching_engine, key, value, entry_type, runtime);
+}
+
+void set_allocator_x::call() const {
+  auto allocator = m_allocator;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(allocator, runtime);
+}
+
+allocator_base_t* get_allocator_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(runtime);
+}
+
+net_context_t get_default_net_context_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(runtime);
+}
+
+device_t get_default_device_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(runtime);
+}
+
+endpoint_t get_default_endpoint_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(runtime, device);
+}
+
+packet_pool_t get_default_packet_pool_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(runtime);
+}
+
+matching_engine_t get_default_matching_engine_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(runtime);
+}
+
+size_t get_max_bcopy_size_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto packet_pool = m_packet_pool.get_value_or(runtime.get_impl()->default_packet_pool);
+  return call_impl(runtime, packet_pool);
+}
+attr_comp_type_t comp_t::get_attr_comp_type() const { return p_impl->attr.comp_type; }
+int comp_t::get_attr_sync_threshold() const { return p_impl->attr.sync_threshold; }
+bool comp_t::get_attr_zero_copy_am() const { return p_impl->attr.zero_copy_am; }
+attr_cq_type_t comp_t::get_attr_cq_type() const { return p_impl->attr.cq_type; }
+int comp_t::get_attr_cq_default_length() const { return p_impl->attr.cq_default_length; }
+bool comp_t::get_attr_blocking() const { return p_impl->attr.blocking; }
+const char* comp_t::get_attr_name() const { return p_impl->attr.name; }
+void* comp_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+comp_t::attr_t comp_t::get_attr() const { return p_impl->attr; }
+
+void free_comp_x::call() const {
+  auto comp = m_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, runtime);
+}
+
+void comp_signal_x::call() const {
+  auto comp = m_comp;
+  auto status = m_status;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, status, runtime);
+}
+
+rcomp_t reserve_rcomps_x::call() const {
+  auto n = m_n;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(n, runtime);
+}
+
+rcomp_t register_rcomp_x::call() const {
+  auto comp = m_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto rcomp = m_rcomp.get_value_or(0);
+  return call_impl(comp, runtime, rcomp);
+}
+
+void deregister_rcomp_x::call() const {
+  auto rcomp = m_rcomp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(rcomp, runtime);
+}
+
+comp_t alloc_sync_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto threshold = m_threshold.get_value_or(g_default_attr.sync_threshold);
+  auto zero_copy_am = m_zero_copy_am.get_value_or(g_default_attr.zero_copy_am);
+  auto blocking = m_blocking.get_value_or(g_default_attr.blocking);
+  auto name = m_name.get_value_or("DEFAULT_NAME");
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(runtime, threshold, zero_copy_am, blocking, name, user_context);
+}
+
+bool sync_test_x::call() const {
+  auto comp = m_comp;
+  auto p_out = m_p_out;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, p_out, runtime);
+}
+
+void sync_wait_x::call() const {
+  auto comp = m_comp;
+  auto p_out = m_p_out;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto do_progress = m_do_progress.get_value_or(true);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(comp, p_out, runtime, do_progress, device);
+}
+
+comp_t alloc_counter_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto blocking = m_blocking.get_value_or(g_default_attr.blocking);
+  auto name = m_name.get_value_or("DEFAULT_NAME");
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(runtime, blocking, name, user_context);
+}
+
+int64_t counter_get_x::call() const {
+  auto comp = m_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, runtime);
+}
+
+void counter_set_x::call() const {
+  auto comp = m_comp;
+  auto value = m_value;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, value, runtime);
+}
+
+void counter_wait_x::call() const {
+  auto comp = m_comp;
+  auto target = m_target;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto do_progress = m_do_progress.get_value_or(true);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(comp, target, runtime, do_progress, device);
+}
+
+comp_t alloc_cq_x::call() const {
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto default_length = m_default_length.get_value_or(g_default_attr.cq_default_length);
+  auto zero_copy_am = m_zero_copy_am.get_value_or(g_default_attr.zero_copy_am);
+  auto cq_type = m_cq_type.get_value_or(g_default_attr.cq_type);
+  auto blocking = m_blocking.get_value_or(g_default_attr.blocking);
+  auto name = m_name.get_value_or("DEFAULT_NAME");
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(runtime, default_length, zero_copy_am, cq_type, blocking, name, user_context);
+}
+
+status_t cq_pop_x::call() const {
+  auto comp = m_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, runtime);
+}
+
+size_t cq_pop_n_x::call() const {
+  auto comp = m_comp;
+  auto n = m_n;
+  auto p_out = m_p_out;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, n, p_out, runtime);
+}
+
+status_t cq_wait_x::call() const {
+  auto comp = m_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto do_progress = m_do_progress.get_value_or(true);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(comp, runtime, do_progress, device);
+}
+
+comp_t alloc_handler_x::call() const {
+  auto handler = m_handler;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto zero_copy_am = m_zero_copy_am.get_value_or(g_default_attr.zero_copy_am);
+  auto name = m_name.get_value_or("DEFAULT_NAME");
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(handler, runtime, zero_copy_am, name, user_context);
+}
+
+comp_t alloc_graph_x::call() const {
+  auto comp = m_comp.get_value_or(COMP_NULL);
+  auto name = m_name.get_value_or("DEFAULT_NAME");
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, name, user_context, runtime);
+}
+
+graph_node_t graph_add_node_x::call() const {
+  auto comp = m_comp;
+  auto fn = m_fn;
+  auto value = m_value.get_value_or(nullptr);
+  auto free_cb = m_free_cb.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, fn, value, free_cb, runtime);
+}
+
+void graph_add_edge_x::call() const {
+  auto comp = m_comp;
+  auto src = m_src;
+  auto dst = m_dst;
+  auto fn = m_fn.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, src, dst, fn, runtime);
+}
+
+void graph_node_mark_complete_x::call() const {
+  auto node = m_node;
+  auto status = m_status.get_value_or(status_t());
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(node, status, runtime);
+}
+
+void graph_start_x::call() const {
+  auto comp = m_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, runtime);
+}
+
+status_t graph_test_x::call() const {
+  auto comp = m_comp;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(comp, runtime);
+}
+attr_backend_t net_context_t::get_attr_backend() const { return p_impl->attr.backend; }
+std::string net_context_t::get_attr_ofi_provider_name() const { return p_impl->attr.ofi_provider_name; }
+size_t net_context_t::get_attr_max_msg_size() const { return p_impl->attr.max_msg_size; }
+size_t net_context_t::get_attr_max_inject_size() const { return p_impl->attr.max_inject_size; }
+size_t net_context_t::get_attr_max_iov() const { return p_impl->attr.max_iov; }
+int net_context_t::get_attr_ibv_gid_idx() const { return p_impl->attr.ibv_gid_idx; }
+bool net_context_t::get_attr_ibv_force_gid_auto_select() const { return p_impl->attr.ibv_force_gid_auto_select; }
+std::string net_context_t::get_attr_device_name() const { return p_impl->attr.device_name; }
+attr_ibv_odp_strategy_t net_context_t::get_attr_ibv_odp_strategy() const { return p_impl->attr.ibv_odp_strategy; }
+attr_ibv_prefetch_strategy_t net_context_t::get_attr_ibv_prefetch_strategy() const { return p_impl->attr.ibv_prefetch_strategy; }
+bool net_context_t::get_attr_support_putimm() const { return p_impl->attr.support_putimm; }
+bool net_context_t::get_attr_support_atomic32() const { return p_impl->attr.support_atomic32; }
+bool net_context_t::get_attr_support_atomic64() const { return p_impl->attr.support_atomic64; }
+bool net_context_t::get_attr_support_tagged() const { return p_impl->attr.support_tagged; }
+bool net_context_t::get_attr_use_dmabuf() const { return p_impl->attr.use_dmabuf; }
+const char* net_context_t::get_attr_name() const { return p_impl->attr.name; }
+void* net_context_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+net_context_t::attr_t net_context_t::get_attr() const { return p_impl->attr; }
+
+net_context_t alloc_net_context_x::call() const {
+  auto backend = m_backend.get_value_or(g_default_attr.backend);
+  auto ofi_provider_name = m_ofi_provider_name.get_value_or(g_default_attr.ofi_provider_name);
+  auto max_msg_size = m_max_msg_size.get_value_or(g_default_attr.max_msg_size);
+  auto max_inject_size = m_max_inject_size.get_value_or(g_default_attr.max_inject_size);
+  auto max_iov = m_max_iov.get_value_or(g_default_attr.max_iov);
+  auto ibv_gid_idx = m_ibv_gid_idx.get_value_or(g_default_attr.ibv_gid_idx);
+  auto ibv_force_gid_auto_select = m_ibv_force_gid_auto_select.get_value_or(g_default_attr.ibv_force_gid_auto_select);
+  auto device_name = m_device_name.get_value_or(g_default_attr.device_name);
+  auto ibv_odp_strategy = m_ibv_odp_strategy.get_value_or(g_default_attr.ibv_odp_strategy);
+  auto ibv_prefetch_strategy = m_ibv_prefetch_strategy.get_value_or(g_default_attr.ibv_prefetch_strategy);
+  auto use_dmabuf = m_use_dmabuf.get_value_or(g_default_attr.use_dmabuf);
+  auto name = m_name.get_value_or(DEFAULT_NAME);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(backend, ofi_provider_name, max_msg_size, max_inject_size, max_iov, ibv_gid_idx, ibv_force_gid_auto_select, device_name, ibv_odp_strategy, ibv_prefetch_strategy, use_dmabuf, name, user_context, runtime);
+}
+
+void free_net_context_x::call() const {
+  auto net_context = m_net_context;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(net_context, runtime);
+}
+size_t device_t::get_attr_net_max_sends() const { return p_impl->attr.net_max_sends; }
+size_t device_t::get_attr_net_max_recvs() const { return p_impl->attr.net_max_recvs; }
+size_t device_t::get_attr_net_max_cqes() const { return p_impl->attr.net_max_cqes; }
+double device_t::get_attr_net_send_reserved_pct() const { return p_impl->attr.net_send_reserved_pct; }
+uint64_t device_t::get_attr_ofi_lock_mode() const { return p_impl->attr.ofi_lock_mode; }
+bool device_t::get_attr_alloc_default_endpoint() const { return p_impl->attr.alloc_default_endpoint; }
+bool device_t::get_attr_alloc_progress_endpoint() const { return p_impl->attr.alloc_progress_endpoint; }
+size_t device_t::get_attr_am_aggregation_threshold() const { return p_impl->attr.am_aggregation_threshold; }
+bool device_t::get_attr_net_comp_channel() const { return p_impl->attr.net_comp_channel; }
+bool device_t::get_attr_use_reg_cache() const { return p_impl->attr.use_reg_cache; }
+bool device_t::get_attr_shm_enable() const { return p_impl->attr.shm_enable; }
+size_t device_t::get_attr_shm_ring_size() const { return p_impl->attr.shm_ring_size; }
+size_t device_t::get_attr_shm_slot_size() const { return p_impl->attr.shm_slot_size; }
+size_t device_t::get_attr_shm_producer_cas_attempts() const { return p_impl->attr.shm_producer_cas_attempts; }
+size_t device_t::get_attr_shm_consumer_cas_attempts() const { return p_impl->attr.shm_consumer_cas_attempts; }
+bool device_t::get_attr_shm_huge_page() const { return p_impl->attr.shm_huge_page; }
+size_t device_t::get_attr_shm_max_polls() const { return p_impl->attr.shm_max_polls; }
+size_t device_t::get_attr_eager_rdma_threshold() const { return p_impl->attr.eager_rdma_threshold; }
+size_t device_t::get_attr_eager_rdma_nslots() const { return p_impl->attr.eager_rdma_nslots; }
+size_t device_t::get_attr_eager_rdma_slot_size() const { return p_impl->attr.eager_rdma_slot_size; }
+int device_t::get_attr_uid() const { return p_impl->attr.uid; }
+attr_ibv_td_strategy_t device_t::get_attr_ibv_td_strategy() const { return p_impl->attr.ibv_td_strategy; }
+const char* device_t::get_attr_name() const { return p_impl->attr.name; }
+void* device_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+device_t::attr_t device_t::get_attr() const { return p_impl->attr; }
+
+device_t alloc_device_x::call() const {
+  auto net_max_sends = m_net_max_sends.get_value_or(g_default_attr.net_max_sends);
+  auto net_max_recvs = m_net_max_recvs.get_value_or(g_default_attr.net_max_recvs);
+  auto net_max_cqes = m_net_max_cqes.get_value_or(g_default_attr.net_max_cqes);
+  auto net_send_reserved_pct = m_net_send_reserved_pct.get_value_or(g_default_attr.net_send_reserved_pct);
+  auto ofi_lock_mode = m_ofi_lock_mode.get_value_or(g_default_attr.ofi_lock_mode);
+  auto alloc_default_endpoint = m_alloc_default_endpoint.get_value_or(g_default_attr.alloc_default_endpoint);
+  auto alloc_progress_endpoint = m_alloc_progress_endpoint.get_value_or(g_default_attr.alloc_progress_endpoint);
+  auto am_aggregation_threshold = m_am_aggregation_threshold.get_value_or(g_default_attr.am_aggregation_threshold);
+  auto net_comp_channel = m_net_comp_channel.get_value_or(g_default_attr.net_comp_channel);
+  auto use_reg_cache = m_use_reg_cache.get_value_or(g_default_attr.use_reg_cache);
+  auto shm_enable = m_shm_enable.get_value_or(g_default_attr.shm_enable);
+  auto shm_ring_size = m_shm_ring_size.get_value_or(g_default_attr.shm_ring_size);
+  auto shm_slot_size = m_shm_slot_size.get_value_or(g_default_attr.shm_slot_size);
+  auto shm_producer_cas_attempts = m_shm_producer_cas_attempts.get_value_or(g_default_attr.shm_producer_cas_attempts);
+  auto shm_consumer_cas_attempts = m_shm_consumer_cas_attempts.get_value_or(g_default_attr.shm_consumer_cas_attempts);
+  auto shm_huge_page = m_shm_huge_page.get_value_or(g_default_attr.shm_huge_page);
+  auto shm_max_polls = m_shm_max_polls.get_value_or(g_default_attr.shm_max_polls);
+  auto eager_rdma_threshold = m_eager_rdma_threshold.get_value_or(g_default_attr.eager_rdma_threshold);
+  auto eager_rdma_nslots = m_eager_rdma_nslots.get_value_or(g_default_attr.eager_rdma_nslots);
+  auto eager_rdma_slot_size = m_eager_rdma_slot_size.get_value_or(g_default_attr.eager_rdma_slot_size);
+  auto ibv_td_strategy = m_ibv_td_strategy.get_value_or(g_default_attr.ibv_td_strategy);
+  auto name = m_name.get_value_or(DEFAULT_NAME);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto net_context = m_net_context.get_value_or(runtime.get_impl()->default_net_context);
+  auto packet_pool = m_packet_pool.get_value_or(runtime.get_impl()->default_packet_pool);
+  return call_impl(net_max_sends, net_max_recvs, net_max_cqes, net_send_reserved_pct, ofi_lock_mode, alloc_default_endpoint, alloc_progress_endpoint, am_aggregation_threshold, net_comp_channel, use_reg_cache, shm_enable, shm_ring_size, shm_slot_size, shm_producer_cas_attempts, shm_consumer_cas_attempts, shm_huge_page, shm_max_polls, eager_rdma_threshold, eager_rdma_nslots, eager_rdma_slot_size, ibv_td_strategy, name, user_context, runtime, net_context, packet_pool);
+}
+
+void free_device_x::call() const {
+  auto device = m_device;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(device, runtime);
+}
+const char* mr_t::get_attr_name() const { return p_impl->attr.name; }
+void* mr_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+mr_t::attr_t mr_t::get_attr() const { return p_impl->attr; }
+
+mr_t register_memory_x::call() const {
+  auto address = m_address;
+  auto size = m_size;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(address, size, runtime, device);
+}
+
+void deregister_memory_x::call() const {
+  auto mr = m_mr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(mr, runtime);
+}
+
+rmr_t get_rmr_x::call() const {
+  auto mr = m_mr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(mr, runtime);
+}
+int endpoint_t::get_attr_uid() const { return p_impl->attr.uid; }
+size_t endpoint_t::get_attr_am_aggregation_threshold() const { return p_impl->attr.am_aggregation_threshold; }
+const char* endpoint_t::get_attr_name() const { return p_impl->attr.name; }
+void* endpoint_t::get_attr_user_context() const { return p_impl->attr.user_context; }
+
+endpoint_t::attr_t endpoint_t::get_attr() const { return p_impl->attr; }
+
+endpoint_t alloc_endpoint_x::call() const {
+  auto am_aggregation_threshold = m_am_aggregation_threshold.get_value_or(g_default_attr.am_aggregation_threshold);
+  auto name = m_name.get_value_or(DEFAULT_NAME);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(am_aggregation_threshold, name, user_context, runtime, device);
+}
+
+void free_endpoint_x::call() const {
+  auto endpoint = m_endpoint;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  return call_impl(endpoint, runtime);
+}
+
+size_t net_poll_cq_x::call() const {
+  auto max_polls = m_max_polls;
+  auto statuses = m_statuses;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  return call_impl(max_polls, statuses, runtime, device);
+}
+
+error_t net_post_recv_x::call() const {
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto mr = m_mr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(buffer, size, mr, runtime, device, user_context);
+}
+
+error_t net_post_sends_x::call() const {
+  auto rank = m_rank;
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto imm_data = m_imm_data.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(rank, buffer, size, runtime, device, endpoint, imm_data, user_context);
+}
+
+error_t net_post_send_x::call() const {
+  auto rank = m_rank;
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto mr = m_mr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto imm_data = m_imm_data.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(rank, buffer, size, mr, runtime, device, endpoint, imm_data, user_context);
+}
+
+error_t net_post_puts_x::call() const {
+  auto rank = m_rank;
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto offset = m_offset;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(rank, buffer, size, offset, rmr, runtime, device, endpoint, user_context);
+}
+
+error_t net_post_put_x::call() const {
+  auto rank = m_rank;
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto mr = m_mr;
+  auto offset = m_offset;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(rank, buffer, size, mr, offset, rmr, runtime, device, endpoint, user_context);
+}
+
+error_t net_post_putImms_x::call() const {
+  auto rank = m_rank;
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto offset = m_offset;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto imm_data = m_imm_data.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(rank, buffer, size, offset, rmr, runtime, device, endpoint, imm_data, user_context);
+}
+
+error_t net_post_putImm_x::call() const {
+  auto rank = m_rank;
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto mr = m_mr;
+  auto offset = m_offset;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto imm_data = m_imm_data.get_value_or(0);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(rank, buffer, size, mr, offset, rmr, runtime, device, endpoint, imm_data, user_context);
+}
+
+error_t net_post_get_x::call() const {
+  auto rank = m_rank;
+  auto buffer = m_buffer;
+  auto size = m_size;
+  auto mr = m_mr;
+  auto offset = m_offset;
+  auto rmr = m_rmr;
+  auto runtime = m_runtime.get_value_or(g_default_runtime);
+  auto device = m_device.get_value_or(runtime.get_impl()->default_device);
+  auto endpoint = m_endpoint.get_value_or(device.get_impl()->default_endpoint);
+  auto user_context = m_user_context.get_value_or(nullptr);
+  return call_impl(rank, buffer, size, mr, offset, rmr, runtime, device, endpoint, user_context);
+}
+
+} // namespace lci
@@ -0,0 +1,4622 @@
+
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+// clang-format off
+// This file is generated by generate_binding.py
+#ifndef LCI_BINDING_POST_HPP_
+#define LCI_BINDING_POST_HPP_
+
+namespace lci {
+
+
+/**
+ * @defgroup LCI_BARRIER barrier
+ * @ingroup LCI_COLL
+ * @brief A barrier operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] comp of type __comp_t__; optional argument; The completion to signal when the operation completes.
+
+ */
+ 
+ /**
+  * @ingroup LCI_BARRIER
+  * @brief The actual implementation for barrier.
+  */
+class barrier_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<comp_t> m_comp ;
+
+  // constructor
+  barrier_x() {}
+
+  // setter
+  inline barrier_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline barrier_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline barrier_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline barrier_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline barrier_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline barrier_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+
+  void call_impl(runtime_t runtime, device_t device, endpoint_t endpoint, matching_engine_t matching_engine, comp_semantic_t comp_semantic, comp_t comp) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void barrier() {
+  return barrier_x().call();
+}
+
+
+/**
+ * @defgroup LCI_BROADCAST broadcast
+ * @ingroup LCI_COLL
+ * @brief A broadcast operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] root of type __int__; positional argument; The rank of the broadcast root.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp of type __comp_t__; optional argument; The completion to signal when the operation completes.
+ * @param[in] algorithm of type __broadcast_algorithm_t__; optional argument; The collective algorithm to use.
+ * @param[in] ring_nsteps of type __int__; optional argument; The number of steps in the ring algorithm.
+
+ */
+ 
+ /**
+  * @ingroup LCI_BROADCAST
+  * @brief The actual implementation for broadcast.
+  */
+class broadcast_x {
+ public:
+  // args declaration
+  void* m_buffer;
+  size_t m_size;
+  int m_root;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_t> m_comp ;
+  option_t<broadcast_algorithm_t> m_algorithm ;
+  option_t<int> m_ring_nsteps ;
+
+  // constructor
+  broadcast_x(void* buffer_in, size_t size_in, int root_in) : m_buffer(buffer_in), m_size(size_in), m_root(root_in) {}
+
+  // setter
+  inline broadcast_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline broadcast_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline broadcast_x&& root(int root_in) { m_root = root_in; return std::move(*this); }
+  inline broadcast_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline broadcast_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline broadcast_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline broadcast_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline broadcast_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline broadcast_x&& algorithm(broadcast_algorithm_t algorithm_in) { m_algorithm = algorithm_in; return std::move(*this); }
+  inline broadcast_x&& ring_nsteps(int ring_nsteps_in) { m_ring_nsteps = ring_nsteps_in; return std::move(*this); }
+
+  void call_impl(void* buffer, size_t size, int root, runtime_t runtime, device_t device, endpoint_t endpoint, matching_engine_t matching_engine, comp_t comp, broadcast_algorithm_t algorithm, int ring_nsteps) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void broadcast(void* buffer_in, size_t size_in, int root_in) {
+  return broadcast_x(buffer_in, size_in, root_in).call();
+}
+
+
+/**
+ * @defgroup LCI_REDUCE reduce
+ * @ingroup LCI_COLL
+ * @brief A blocking reduce operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] sendbuf of type __const void*__; positional argument; The local buffer base address to send.
+ * @param[in] recvbuf of type __void*__; positional argument; The local buffer base address to recv.
+ * @param[in] count of type __size_t__; positional argument; The number of data items in the buffer.
+ * @param[in] item_size of type __size_t__; positional argument; The size of each data item.
+ * @param[in] op of type __reduce_op_t__; positional argument; The reduction operation.
+ * @param[in] root of type __int__; positional argument; The rank of the broadcast root.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+
+ */
+ 
+ /**
+  * @ingroup LCI_REDUCE
+  * @brief The actual implementation for reduce.
+  */
+class reduce_x {
+ public:
+  // args declaration
+  const void* m_sendbuf;
+  void* m_recvbuf;
+  size_t m_count;
+  size_t m_item_size;
+  reduce_op_t m_op;
+  int m_root;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<matching_engine_t> m_matching_engine ;
+
+  // constructor
+  reduce_x(const void* sendbuf_in, void* recvbuf_in, size_t count_in, size_t item_size_in, reduce_op_t op_in, int root_in) : m_sendbuf(sendbuf_in), m_recvbuf(recvbuf_in), m_count(count_in), m_item_size(item_size_in), m_op(op_in), m_root(root_in) {}
+
+  // setter
+  inline reduce_x&& sendbuf(const void* sendbuf_in) { m_sendbuf = sendbuf_in; return std::move(*this); }
+  inline reduce_x&& recvbuf(void* recvbuf_in) { m_recvbuf = recvbuf_in; return std::move(*this); }
+  inline reduce_x&& count(size_t count_in) { m_count = count_in; return std::move(*this); }
+  inline reduce_x&& item_size(size_t item_size_in) { m_item_size = item_size_in; return std::move(*this); }
+  inline reduce_x&& op(reduce_op_t op_in) { m_op = op_in; return std::move(*this); }
+  inline reduce_x&& root(int root_in) { m_root = root_in; return std::move(*this); }
+  inline reduce_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline reduce_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline reduce_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline reduce_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+
+  void call_impl(const void* sendbuf, void* recvbuf, size_t count, size_t item_size, reduce_op_t op, int root, runtime_t runtime, device_t device, endpoint_t endpoint, matching_engine_t matching_engine) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void reduce(const void* sendbuf_in, void* recvbuf_in, size_t count_in, size_t item_size_in, reduce_op_t op_in, int root_in) {
+  return reduce_x(sendbuf_in, recvbuf_in, count_in, item_size_in, op_in, root_in).call();
+}
+
+
+/**
+ * @defgroup LCI_REDUCE_SCATTER reduce_scatter
+ * @ingroup LCI_COLL
+ * @brief A reduce scatter operation.
+ * @details This operation assumes the send count is equal to `recvcount * item_size` and `sendbuf` is of size at least `recvcount * item_size * get_rank_n()`.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] sendbuf of type __const void*__; positional argument; The local buffer base address to send.
+ * @param[in] recvbuf of type __void*__; positional argument; The local buffer base address to recv.
+ * @param[in] recvcount of type __size_t__; positional argument; The number of data items to receive one each rank.
+ * @param[in] item_size of type __size_t__; positional argument; The size of each data item.
+ * @param[in] op of type __reduce_op_t__; positional argument; The reduction operation.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp of type __comp_t__; optional argument; The completion to signal when the operation completes.
+ * @param[in] algorithm of type __reduce_scatter_algorithm_t__; optional argument; The collective algorithm to use.
+ * @param[in] ring_nsteps of type __int__; optional argument; The number of steps in the ring algorithm.
+
+ */
+ 
+ /**
+  * @ingroup LCI_REDUCE_SCATTER
+  * @brief The actual implementation for reduce_scatter.
+  */
+class reduce_scatter_x {
+ public:
+  // args declaration
+  const void* m_sendbuf;
+  void* m_recvbuf;
+  size_t m_recvcount;
+  size_t m_item_size;
+  reduce_op_t m_op;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_t> m_comp ;
+  option_t<reduce_scatter_algorithm_t> m_algorithm ;
+  option_t<int> m_ring_nsteps ;
+
+  // constructor
+  reduce_scatter_x(const void* sendbuf_in, void* recvbuf_in, size_t recvcount_in, size_t item_size_in, reduce_op_t op_in) : m_sendbuf(sendbuf_in), m_recvbuf(recvbuf_in), m_recvcount(recvcount_in), m_item_size(item_size_in), m_op(op_in) {}
+
+  // setter
+  inline reduce_scatter_x&& sendbuf(const void* sendbuf_in) { m_sendbuf = sendbuf_in; return std::move(*this); }
+  inline reduce_scatter_x&& recvbuf(void* recvbuf_in) { m_recvbuf = recvbuf_in; return std::move(*this); }
+  inline reduce_scatter_x&& recvcount(size_t recvcount_in) { m_recvcount = recvcount_in; return std::move(*this); }
+  inline reduce_scatter_x&& item_size(size_t item_size_in) { m_item_size = item_size_in; return std::move(*this); }
+  inline reduce_scatter_x&& op(reduce_op_t op_in) { m_op = op_in; return std::move(*this); }
+  inline reduce_scatter_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline reduce_scatter_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline reduce_scatter_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline reduce_scatter_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline reduce_scatter_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline reduce_scatter_x&& algorithm(reduce_scatter_algorithm_t algorithm_in) { m_algorithm = algorithm_in; return std::move(*this); }
+  inline reduce_scatter_x&& ring_nsteps(int ring_nsteps_in) { m_ring_nsteps = ring_nsteps_in; return std::move(*this); }
+
+  void call_impl(const void* sendbuf, void* recvbuf, size_t recvcount, size_t item_size, reduce_op_t op, runtime_t runtime, device_t device, endpoint_t endpoint, matching_engine_t matching_engine, comp_t comp, reduce_scatter_algorithm_t algorithm, int ring_nsteps) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void reduce_scatter(const void* sendbuf_in, void* recvbuf_in, size_t recvcount_in, size_t item_size_in, reduce_op_t op_in) {
+  return reduce_scatter_x(sendbuf_in, recvbuf_in, recvcount_in, item_size_in, op_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLREDUCE allreduce
+ * @ingroup LCI_COLL
+ * @brief An allreduce operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] sendbuf of type __const void*__; positional argument; The local buffer base address to send.
+ * @param[in] recvbuf of type __void*__; positional argument; The local buffer base address to recv.
+ * @param[in] count of type __size_t__; positional argument; The number of data items in the buffer.
+ * @param[in] item_size of type __size_t__; positional argument; The size of each data item.
+ * @param[in] op of type __reduce_op_t__; positional argument; The reduction operation.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp of type __comp_t__; optional argument; The completion to signal when the operation completes.
+ * @param[in] algorithm of type __allreduce_algorithm_t__; optional argument; The collective algorithm to use.
+ * @param[in] ring_nsteps of type __int__; optional argument; The number of steps in the ring algorithm.
+
+ */
+ 
+ /**
+  * @ingroup LCI_ALLREDUCE
+  * @brief The actual implementation for allreduce.
+  */
+class allreduce_x {
+ public:
+  // args declaration
+  const void* m_sendbuf;
+  void* m_recvbuf;
+  size_t m_count;
+  size_t m_item_size;
+  reduce_op_t m_op;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_t> m_comp ;
+  option_t<allreduce_algorithm_t> m_algorithm ;
+  option_t<int> m_ring_nsteps ;
+
+  // constructor
+  allreduce_x(const void* sendbuf_in, void* recvbuf_in, size_t count_in, size_t item_size_in, reduce_op_t op_in) : m_sendbuf(sendbuf_in), m_recvbuf(recvbuf_in), m_count(count_in), m_item_size(item_size_in), m_op(op_in) {}
+
+  // setter
+  inline allreduce_x&& sendbuf(const void* sendbuf_in) { m_sendbuf = sendbuf_in; return std::move(*this); }
+  inline allreduce_x&& recvbuf(void* recvbuf_in) { m_recvbuf = recvbuf_in; return std::move(*this); }
+  inline allreduce_x&& count(size_t count_in) { m_count = count_in; return std::move(*this); }
+  inline allreduce_x&& item_size(size_t item_size_in) { m_item_size = item_size_in; return std::move(*this); }
+  inline allreduce_x&& op(reduce_op_t op_in) { m_op = op_in; return std::move(*this); }
+  inline allreduce_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline allreduce_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline allreduce_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline allreduce_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline allreduce_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline allreduce_x&& algorithm(allreduce_algorithm_t algorithm_in) { m_algorithm = algorithm_in; return std::move(*this); }
+  inline allreduce_x&& ring_nsteps(int ring_nsteps_in) { m_ring_nsteps = ring_nsteps_in; return std::move(*this); }
+
+  void call_impl(const void* sendbuf, void* recvbuf, size_t count, size_t item_size, reduce_op_t op, runtime_t runtime, device_t device, endpoint_t endpoint, matching_engine_t matching_engine, comp_t comp, allreduce_algorithm_t algorithm, int ring_nsteps) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void allreduce(const void* sendbuf_in, void* recvbuf_in, size_t count_in, size_t item_size_in, reduce_op_t op_in) {
+  return allreduce_x(sendbuf_in, recvbuf_in, count_in, item_size_in, op_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLGATHER allgather
+ * @ingroup LCI_COLL
+ * @brief An allgather operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] sendbuf of type __const void*__; positional argument; The local buffer base address to send.
+ * @param[in] recvbuf of type __void*__; positional argument; The local buffer base address to recv.
+ * @param[in] size of type __size_t__; positional argument; The message size per rank.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+
+ */
+ 
+ /**
+  * @ingroup LCI_ALLGATHER
+  * @brief The actual implementation for allgather.
+  */
+class allgather_x {
+ public:
+  // args declaration
+  const void* m_sendbuf;
+  void* m_recvbuf;
+  size_t m_size;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<matching_engine_t> m_matching_engine ;
+
+  // constructor
+  allgather_x(const void* sendbuf_in, void* recvbuf_in, size_t size_in) : m_sendbuf(sendbuf_in), m_recvbuf(recvbuf_in), m_size(size_in) {}
+
+  // setter
+  inline allgather_x&& sendbuf(const void* sendbuf_in) { m_sendbuf = sendbuf_in; return std::move(*this); }
+  inline allgather_x&& recvbuf(void* recvbuf_in) { m_recvbuf = recvbuf_in; return std::move(*this); }
+  inline allgather_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline allgather_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline allgather_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline allgather_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline allgather_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+
+  void call_impl(const void* sendbuf, void* recvbuf, size_t size, runtime_t runtime, device_t device, endpoint_t endpoint, matching_engine_t matching_engine) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void allgather(const void* sendbuf_in, void* recvbuf_in, size_t size_in) {
+  return allgather_x(sendbuf_in, recvbuf_in, size_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLTOALL alltoall
+ * @ingroup LCI_COLL
+ * @brief An alltoall operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] sendbuf of type __const void*__; positional argument; The local buffer base address to send.
+ * @param[in] recvbuf of type __void*__; positional argument; The local buffer base address to recv.
+ * @param[in] size of type __size_t__; positional argument; The message size per rank.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp of type __comp_t__; optional argument; The completion to signal when the operation completes.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+
+ */
+ 
+ /**
+  * @ingroup LCI_ALLTOALL
+  * @brief The actual implementation for alltoall.
+  */
+class alltoall_x {
+ public:
+  // args declaration
+  const void* m_sendbuf;
+  void* m_recvbuf;
+  size_t m_size;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_t> m_comp ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+
+  // constructor
+  alltoall_x(const void* sendbuf_in, void* recvbuf_in, size_t size_in) : m_sendbuf(sendbuf_in), m_recvbuf(recvbuf_in), m_size(size_in) {}
+
+  // setter
+  inline alltoall_x&& sendbuf(const void* sendbuf_in) { m_sendbuf = sendbuf_in; return std::move(*this); }
+  inline alltoall_x&& recvbuf(void* recvbuf_in) { m_recvbuf = recvbuf_in; return std::move(*this); }
+  inline alltoall_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline alltoall_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alltoall_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline alltoall_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline alltoall_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline alltoall_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline alltoall_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+
+  void call_impl(const void* sendbuf, void* recvbuf, size_t size, runtime_t runtime, device_t device, endpoint_t endpoint, matching_engine_t matching_engine, comp_t comp, comp_semantic_t comp_semantic) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void alltoall(const void* sendbuf_in, void* recvbuf_in, size_t size_in) {
+  return alltoall_x(sendbuf_in, recvbuf_in, size_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_COMM post_comm
+ * @ingroup LCI_COMM
+ * @brief Post a generic communication operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] direction of type __direction_t__; positional argument; The communication direction.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] local_buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic (only valid when `direction == direction_t::OUT`).
+ * @param[in] mr of type __mr_t__; optional argument; The registered memory region for the local buffer.
+ * @param[in] remote_disp of type __uintptr_t__; optional argument; The displacement from the remote buffer base address.
+ * @param[in] rmr of type __rmr_t__; optional argument; The remote memory region handle of the remote buffer.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] remote_comp of type __rcomp_t__; optional argument; The remote completion handler to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] matching_policy of type __matching_policy_t__; optional argument; The matching policy to use.
+ * @param[in] iov of type __const iovec_t*__; optional argument; The local io vector. If set, it replaces `local_buffer`, `size`, and `mr`. Only read during the call.
+ * @param[in] iov_count of type __size_t__; optional argument; The number of entries in `iov`.
+ * @param[in] datatype of type __const datatype_t*__; optional argument; The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call.
+ * @param[in] zero_copy of type __bool__; optional argument; Only valid for recv. Whether to deliver an eager message in the internal packet instead of copying it into `local_buffer` (see @ref post_recv).
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_COMM
+  * @brief The actual implementation for post_comm.
+  */
+class post_comm_x {
+ public:
+  // args declaration
+  direction_t m_direction;
+  int m_rank;
+  void* m_local_buffer;
+  size_t m_size;
+  comp_t m_local_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<mr_t> m_mr ;
+  option_t<uintptr_t> m_remote_disp ;
+  option_t<rmr_t> m_rmr ;
+  option_t<tag_t> m_tag ;
+  option_t<rcomp_t> m_remote_comp ;
+  option_t<void*> m_user_context ;
+  option_t<matching_policy_t> m_matching_policy ;
+  option_t<const iovec_t*> m_iov ;
+  option_t<size_t> m_iov_count ;
+  option_t<const datatype_t*> m_datatype ;
+  option_t<bool> m_zero_copy ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_comm_x(direction_t direction_in, int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in) : m_direction(direction_in), m_rank(rank_in), m_local_buffer(local_buffer_in), m_size(size_in), m_local_comp(local_comp_in) {}
+
+  // setter
+  inline post_comm_x&& direction(direction_t direction_in) { m_direction = direction_in; return std::move(*this); }
+  inline post_comm_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_comm_x&& local_buffer(void* local_buffer_in) { m_local_buffer = local_buffer_in; return std::move(*this); }
+  inline post_comm_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline post_comm_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_comm_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_comm_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_comm_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_comm_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_comm_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline post_comm_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_comm_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline post_comm_x&& remote_disp(uintptr_t remote_disp_in) { m_remote_disp = remote_disp_in; return std::move(*this); }
+  inline post_comm_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline post_comm_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_comm_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline post_comm_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_comm_x&& matching_policy(matching_policy_t matching_policy_in) { m_matching_policy = matching_policy_in; return std::move(*this); }
+  inline post_comm_x&& iov(const iovec_t* iov_in) { m_iov = iov_in; return std::move(*this); }
+  inline post_comm_x&& iov_count(size_t iov_count_in) { m_iov_count = iov_count_in; return std::move(*this); }
+  inline post_comm_x&& datatype(const datatype_t* datatype_in) { m_datatype = datatype_in; return std::move(*this); }
+  inline post_comm_x&& zero_copy(bool zero_copy_in) { m_zero_copy = zero_copy_in; return std::move(*this); }
+  inline post_comm_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_comm_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_comm_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(direction_t direction, int rank, void* local_buffer, size_t size, comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, matching_engine_t matching_engine, comp_semantic_t comp_semantic, mr_t mr, uintptr_t remote_disp, rmr_t rmr, tag_t tag, rcomp_t remote_comp, void* user_context, matching_policy_t matching_policy, const iovec_t* iov, size_t iov_count, const datatype_t* datatype, bool zero_copy, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_comm(direction_t direction_in, int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in) {
+  return post_comm_x(direction_in, rank_in, local_buffer_in, size_in, local_comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_AM post_am
+ * @ingroup LCI_COMM
+ * @brief Post an active message communication operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] local_buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] remote_comp of type __rcomp_t__; positional argument; The remote completion handler to use.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] mr of type __mr_t__; optional argument; The registered memory region for the local buffer.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] datatype of type __const datatype_t*__; optional argument; The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_AM
+  * @brief The actual implementation for post_am.
+  */
+class post_am_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_local_buffer;
+  size_t m_size;
+  comp_t m_local_comp;
+  rcomp_t m_remote_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<mr_t> m_mr ;
+  option_t<tag_t> m_tag ;
+  option_t<void*> m_user_context ;
+  option_t<const datatype_t*> m_datatype ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_am_x(int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in, rcomp_t remote_comp_in) : m_rank(rank_in), m_local_buffer(local_buffer_in), m_size(size_in), m_local_comp(local_comp_in), m_remote_comp(remote_comp_in) {}
+
+  // setter
+  inline post_am_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_am_x&& local_buffer(void* local_buffer_in) { m_local_buffer = local_buffer_in; return std::move(*this); }
+  inline post_am_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline post_am_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_am_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline post_am_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_am_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_am_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_am_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_am_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_am_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline post_am_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_am_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_am_x&& datatype(const datatype_t* datatype_in) { m_datatype = datatype_in; return std::move(*this); }
+  inline post_am_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_am_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_am_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, void* local_buffer, size_t size, comp_t local_comp, rcomp_t remote_comp, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, comp_semantic_t comp_semantic, mr_t mr, tag_t tag, void* user_context, const datatype_t* datatype, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_am(int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in, rcomp_t remote_comp_in) {
+  return post_am_x(rank_in, local_buffer_in, size_in, local_comp_in, remote_comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_SEND post_send
+ * @ingroup LCI_COMM
+ * @brief Post a send communication operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] local_buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] tag of type __tag_t__; positional argument; The tag to use.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] mr of type __mr_t__; optional argument; The registered memory region for the local buffer.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] matching_policy of type __matching_policy_t__; optional argument; The matching policy to use.
+ * @param[in] datatype of type __const datatype_t*__; optional argument; The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_SEND
+  * @brief The actual implementation for post_send.
+  */
+class post_send_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_local_buffer;
+  size_t m_size;
+  tag_t m_tag;
+  comp_t m_local_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<mr_t> m_mr ;
+  option_t<void*> m_user_context ;
+  option_t<matching_policy_t> m_matching_policy ;
+  option_t<const datatype_t*> m_datatype ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_send_x(int rank_in, void* local_buffer_in, size_t size_in, tag_t tag_in, comp_t local_comp_in) : m_rank(rank_in), m_local_buffer(local_buffer_in), m_size(size_in), m_tag(tag_in), m_local_comp(local_comp_in) {}
+
+  // setter
+  inline post_send_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_send_x&& local_buffer(void* local_buffer_in) { m_local_buffer = local_buffer_in; return std::move(*this); }
+  inline post_send_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline post_send_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_send_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_send_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_send_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_send_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_send_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_send_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline post_send_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_send_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline post_send_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_send_x&& matching_policy(matching_policy_t matching_policy_in) { m_matching_policy = matching_policy_in; return std::move(*this); }
+  inline post_send_x&& datatype(const datatype_t* datatype_in) { m_datatype = datatype_in; return std::move(*this); }
+  inline post_send_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_send_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_send_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, void* local_buffer, size_t size, tag_t tag, comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, matching_engine_t matching_engine, comp_semantic_t comp_semantic, mr_t mr, void* user_context, matching_policy_t matching_policy, const datatype_t* datatype, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_send(int rank_in, void* local_buffer_in, size_t size_in, tag_t tag_in, comp_t local_comp_in) {
+  return post_send_x(rank_in, local_buffer_in, size_in, tag_in, local_comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_AMV post_amv
+ * @ingroup LCI_COMM
+ * @brief Post an active message communication operation with a local io vector.
+ * @details The io vector is sent as one contiguous message. The status has a null `buffer` and the total message size as `size`.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] iov of type __const iovec_t*__; positional argument; The local io vector. Only read during the call.
+ * @param[in] iov_count of type __size_t__; positional argument; The number of entries in the io vector.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] remote_comp of type __rcomp_t__; positional argument; The remote completion handler to use.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_AMV
+  * @brief The actual implementation for post_amv.
+  */
+class post_amv_x {
+ public:
+  // args declaration
+  int m_rank;
+  const iovec_t* m_iov;
+  size_t m_iov_count;
+  comp_t m_local_comp;
+  rcomp_t m_remote_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<tag_t> m_tag ;
+  option_t<void*> m_user_context ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_amv_x(int rank_in, const iovec_t* iov_in, size_t iov_count_in, comp_t local_comp_in, rcomp_t remote_comp_in) : m_rank(rank_in), m_iov(iov_in), m_iov_count(iov_count_in), m_local_comp(local_comp_in), m_remote_comp(remote_comp_in) {}
+
+  // setter
+  inline post_amv_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_amv_x&& iov(const iovec_t* iov_in) { m_iov = iov_in; return std::move(*this); }
+  inline post_amv_x&& iov_count(size_t iov_count_in) { m_iov_count = iov_count_in; return std::move(*this); }
+  inline post_amv_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_amv_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline post_amv_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_amv_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_amv_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_amv_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_amv_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_amv_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_amv_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_amv_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_amv_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_amv_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, const iovec_t* iov, size_t iov_count, comp_t local_comp, rcomp_t remote_comp, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, comp_semantic_t comp_semantic, tag_t tag, void* user_context, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_amv(int rank_in, const iovec_t* iov_in, size_t iov_count_in, comp_t local_comp_in, rcomp_t remote_comp_in) {
+  return post_amv_x(rank_in, iov_in, iov_count_in, local_comp_in, remote_comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_SENDV post_sendv
+ * @ingroup LCI_COMM
+ * @brief Post a send communication operation with a local io vector.
+ * @details The io vector is sent as one contiguous message and can be received by a regular receive. The status has a null `buffer` and the total message size as `size`.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] iov of type __const iovec_t*__; positional argument; The local io vector. Only read during the call.
+ * @param[in] iov_count of type __size_t__; positional argument; The number of entries in the io vector.
+ * @param[in] tag of type __tag_t__; positional argument; The tag to use.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] matching_policy of type __matching_policy_t__; optional argument; The matching policy to use.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_SENDV
+  * @brief The actual implementation for post_sendv.
+  */
+class post_sendv_x {
+ public:
+  // args declaration
+  int m_rank;
+  const iovec_t* m_iov;
+  size_t m_iov_count;
+  tag_t m_tag;
+  comp_t m_local_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<void*> m_user_context ;
+  option_t<matching_policy_t> m_matching_policy ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_sendv_x(int rank_in, const iovec_t* iov_in, size_t iov_count_in, tag_t tag_in, comp_t local_comp_in) : m_rank(rank_in), m_iov(iov_in), m_iov_count(iov_count_in), m_tag(tag_in), m_local_comp(local_comp_in) {}
+
+  // setter
+  inline post_sendv_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_sendv_x&& iov(const iovec_t* iov_in) { m_iov = iov_in; return std::move(*this); }
+  inline post_sendv_x&& iov_count(size_t iov_count_in) { m_iov_count = iov_count_in; return std::move(*this); }
+  inline post_sendv_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_sendv_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_sendv_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_sendv_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_sendv_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_sendv_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_sendv_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline post_sendv_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_sendv_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_sendv_x&& matching_policy(matching_policy_t matching_policy_in) { m_matching_policy = matching_policy_in; return std::move(*this); }
+  inline post_sendv_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_sendv_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_sendv_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, const iovec_t* iov, size_t iov_count, tag_t tag, comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, matching_engine_t matching_engine, comp_semantic_t comp_semantic, void* user_context, matching_policy_t matching_policy, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_sendv(int rank_in, const iovec_t* iov_in, size_t iov_count_in, tag_t tag_in, comp_t local_comp_in) {
+  return post_sendv_x(rank_in, iov_in, iov_count_in, tag_in, local_comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_RECV post_recv
+ * @ingroup LCI_COMM
+ * @brief Post a receive communication operation.
+ * @details With `zero_copy`, an eager message is not copied: the buffer of the completion status points to the payload of the internal packet, and the user has to return it with @ref put_upacket once done. A message too large for a packet is still received into `local_buffer`, so the two cases can be told apart by comparing the buffer of the status with `local_buffer`. `local_buffer` can be null if the messages are known to be eager.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The source rank.
+ * @param[in] local_buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] tag of type __tag_t__; positional argument; The tag to use.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] mr of type __mr_t__; optional argument; The registered memory region for the local buffer.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] matching_policy of type __matching_policy_t__; optional argument; The matching policy to use.
+ * @param[in] zero_copy of type __bool__; optional argument; Whether to deliver an eager message in the internal packet instead of copying it into `local_buffer`.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_RECV
+  * @brief The actual implementation for post_recv.
+  */
+class post_recv_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_local_buffer;
+  size_t m_size;
+  tag_t m_tag;
+  comp_t m_local_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<mr_t> m_mr ;
+  option_t<void*> m_user_context ;
+  option_t<matching_policy_t> m_matching_policy ;
+  option_t<bool> m_zero_copy ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_recv_x(int rank_in, void* local_buffer_in, size_t size_in, tag_t tag_in, comp_t local_comp_in) : m_rank(rank_in), m_local_buffer(local_buffer_in), m_size(size_in), m_tag(tag_in), m_local_comp(local_comp_in) {}
+
+  // setter
+  inline post_recv_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_recv_x&& local_buffer(void* local_buffer_in) { m_local_buffer = local_buffer_in; return std::move(*this); }
+  inline post_recv_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline post_recv_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_recv_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_recv_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_recv_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_recv_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_recv_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_recv_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline post_recv_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_recv_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline post_recv_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_recv_x&& matching_policy(matching_policy_t matching_policy_in) { m_matching_policy = matching_policy_in; return std::move(*this); }
+  inline post_recv_x&& zero_copy(bool zero_copy_in) { m_zero_copy = zero_copy_in; return std::move(*this); }
+  inline post_recv_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_recv_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_recv_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, void* local_buffer, size_t size, tag_t tag, comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, matching_engine_t matching_engine, comp_semantic_t comp_semantic, mr_t mr, void* user_context, matching_policy_t matching_policy, bool zero_copy, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_recv(int rank_in, void* local_buffer_in, size_t size_in, tag_t tag_in, comp_t local_comp_in) {
+  return post_recv_x(rank_in, local_buffer_in, size_in, tag_in, local_comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_PUT post_put
+ * @ingroup LCI_COMM
+ * @brief Post a put (one-sided write) communication operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] local_buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param remote_disp of type __uintptr_t__; positional argument; The displacement from the remote buffer base address.
+ * @param rmr of type __rmr_t__; positional argument; The remote memory region handle of the remote buffer.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] mr of type __mr_t__; optional argument; The registered memory region for the local buffer.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] remote_comp of type __rcomp_t__; optional argument; The remote completion handler to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] datatype of type __const datatype_t*__; optional argument; The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_PUT
+  * @brief The actual implementation for post_put.
+  */
+class post_put_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_local_buffer;
+  size_t m_size;
+  comp_t m_local_comp;
+  uintptr_t m_remote_disp;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<mr_t> m_mr ;
+  option_t<tag_t> m_tag ;
+  option_t<rcomp_t> m_remote_comp ;
+  option_t<void*> m_user_context ;
+  option_t<const datatype_t*> m_datatype ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_put_x(int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) : m_rank(rank_in), m_local_buffer(local_buffer_in), m_size(size_in), m_local_comp(local_comp_in), m_remote_disp(remote_disp_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline post_put_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_put_x&& local_buffer(void* local_buffer_in) { m_local_buffer = local_buffer_in; return std::move(*this); }
+  inline post_put_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline post_put_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_put_x&& remote_disp(uintptr_t remote_disp_in) { m_remote_disp = remote_disp_in; return std::move(*this); }
+  inline post_put_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline post_put_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_put_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_put_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_put_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_put_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_put_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline post_put_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_put_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline post_put_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_put_x&& datatype(const datatype_t* datatype_in) { m_datatype = datatype_in; return std::move(*this); }
+  inline post_put_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_put_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_put_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, void* local_buffer, size_t size, comp_t local_comp, uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, comp_semantic_t comp_semantic, mr_t mr, tag_t tag, rcomp_t remote_comp, void* user_context, const datatype_t* datatype, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_put(int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) {
+  return post_put_x(rank_in, local_buffer_in, size_in, local_comp_in, remote_disp_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_PUTV post_putv
+ * @ingroup LCI_COMM
+ * @brief Post a put (one-sided write) communication operation with a local io vector.
+ * @details The io vector is written to a contiguous remote buffer.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] iov of type __const iovec_t*__; positional argument; The local io vector. Only read during the call.
+ * @param[in] iov_count of type __size_t__; positional argument; The number of entries in the io vector.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] remote_disp of type __uintptr_t__; positional argument; The displacement from the remote buffer base address.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle of the remote buffer.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] remote_comp of type __rcomp_t__; optional argument; The remote completion handler to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_PUTV
+  * @brief The actual implementation for post_putv.
+  */
+class post_putv_x {
+ public:
+  // args declaration
+  int m_rank;
+  const iovec_t* m_iov;
+  size_t m_iov_count;
+  comp_t m_local_comp;
+  uintptr_t m_remote_disp;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<tag_t> m_tag ;
+  option_t<rcomp_t> m_remote_comp ;
+  option_t<void*> m_user_context ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_putv_x(int rank_in, const iovec_t* iov_in, size_t iov_count_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) : m_rank(rank_in), m_iov(iov_in), m_iov_count(iov_count_in), m_local_comp(local_comp_in), m_remote_disp(remote_disp_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline post_putv_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_putv_x&& iov(const iovec_t* iov_in) { m_iov = iov_in; return std::move(*this); }
+  inline post_putv_x&& iov_count(size_t iov_count_in) { m_iov_count = iov_count_in; return std::move(*this); }
+  inline post_putv_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_putv_x&& remote_disp(uintptr_t remote_disp_in) { m_remote_disp = remote_disp_in; return std::move(*this); }
+  inline post_putv_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline post_putv_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_putv_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_putv_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_putv_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_putv_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_putv_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_putv_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline post_putv_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_putv_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_putv_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_putv_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, const iovec_t* iov, size_t iov_count, comp_t local_comp, uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, comp_semantic_t comp_semantic, tag_t tag, rcomp_t remote_comp, void* user_context, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_putv(int rank_in, const iovec_t* iov_in, size_t iov_count_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) {
+  return post_putv_x(rank_in, iov_in, iov_count_in, local_comp_in, remote_disp_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_GET post_get
+ * @ingroup LCI_COMM
+ * @brief Post a get (one-sided read) communication operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] local_buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param remote_disp of type __uintptr_t__; positional argument; The displacement from the remote buffer base address.
+ * @param rmr of type __rmr_t__; positional argument; The remote memory region handle of the remote buffer.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic.
+ * @param[in] mr of type __mr_t__; optional argument; The registered memory region for the local buffer.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] remote_comp of type __rcomp_t__; optional argument; The remote completion handler to signal at the target once the data has been read. The target receives it as an active message of size 0.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] datatype of type __const datatype_t*__; optional argument; The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_GET
+  * @brief The actual implementation for post_get.
+  */
+class post_get_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_local_buffer;
+  size_t m_size;
+  comp_t m_local_comp;
+  uintptr_t m_remote_disp;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<mr_t> m_mr ;
+  option_t<tag_t> m_tag ;
+  option_t<rcomp_t> m_remote_comp ;
+  option_t<void*> m_user_context ;
+  option_t<const datatype_t*> m_datatype ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_get_x(int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) : m_rank(rank_in), m_local_buffer(local_buffer_in), m_size(size_in), m_local_comp(local_comp_in), m_remote_disp(remote_disp_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline post_get_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_get_x&& local_buffer(void* local_buffer_in) { m_local_buffer = local_buffer_in; return std::move(*this); }
+  inline post_get_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline post_get_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_get_x&& remote_disp(uintptr_t remote_disp_in) { m_remote_disp = remote_disp_in; return std::move(*this); }
+  inline post_get_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline post_get_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_get_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_get_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_get_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_get_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline post_get_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline post_get_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_get_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline post_get_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_get_x&& datatype(const datatype_t* datatype_in) { m_datatype = datatype_in; return std::move(*this); }
+  inline post_get_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_get_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_get_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, void* local_buffer, size_t size, comp_t local_comp, uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, comp_semantic_t comp_semantic, mr_t mr, tag_t tag, rcomp_t remote_comp, void* user_context, const datatype_t* datatype, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_get(int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) {
+  return post_get_x(rank_in, local_buffer_in, size_in, local_comp_in, remote_disp_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_GETV post_getv
+ * @ingroup LCI_COMM
+ * @brief Post a get (one-sided read) communication operation with a local io vector.
+ * @details A contiguous remote buffer is read into the io vector.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] iov of type __const iovec_t*__; positional argument; The local io vector. Only read during the call.
+ * @param[in] iov_count of type __size_t__; positional argument; The number of entries in the io vector.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] remote_disp of type __uintptr_t__; positional argument; The displacement from the remote buffer base address.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle of the remote buffer.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] remote_comp of type __rcomp_t__; optional argument; The remote completion handler to signal at the target once the data has been read. The target receives it as an active message of size 0.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_GETV
+  * @brief The actual implementation for post_getv.
+  */
+class post_getv_x {
+ public:
+  // args declaration
+  int m_rank;
+  const iovec_t* m_iov;
+  size_t m_iov_count;
+  comp_t m_local_comp;
+  uintptr_t m_remote_disp;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<tag_t> m_tag ;
+  option_t<rcomp_t> m_remote_comp ;
+  option_t<void*> m_user_context ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_getv_x(int rank_in, const iovec_t* iov_in, size_t iov_count_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) : m_rank(rank_in), m_iov(iov_in), m_iov_count(iov_count_in), m_local_comp(local_comp_in), m_remote_disp(remote_disp_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline post_getv_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_getv_x&& iov(const iovec_t* iov_in) { m_iov = iov_in; return std::move(*this); }
+  inline post_getv_x&& iov_count(size_t iov_count_in) { m_iov_count = iov_count_in; return std::move(*this); }
+  inline post_getv_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_getv_x&& remote_disp(uintptr_t remote_disp_in) { m_remote_disp = remote_disp_in; return std::move(*this); }
+  inline post_getv_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline post_getv_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_getv_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_getv_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_getv_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_getv_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline post_getv_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline post_getv_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_getv_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_getv_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_getv_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, const iovec_t* iov, size_t iov_count, comp_t local_comp, uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, tag_t tag, rcomp_t remote_comp, void* user_context, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_getv(int rank_in, const iovec_t* iov_in, size_t iov_count_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) {
+  return post_getv_x(rank_in, iov_in, iov_count_in, local_comp_in, remote_disp_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_POST_ATOMIC post_atomic
+ * @ingroup LCI_COMM
+ * @brief Post a remote atomic operation on an integer in a remote memory region.
+ * @details The operation is executed by the network if the net context supports atomics on this type (see the `support_atomic32` and `support_atomic64` attributes), and by the progress engine of the target otherwise. It completes once the old value has been fetched (or, for add, once it has been executed). The remote atomic operations are atomic with respect to each other, but not with respect to other accesses to the remote integer.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] op of type __atomic_op_t__; positional argument; The atomic operation.
+ * @param[in] operand of type __uint64_t__; positional argument; The operand. For 32-bit types, only the low 32 bits are used.
+ * @param[in] result of type __void*__; positional argument; The local buffer (of the size of `type`) to store the old value of the remote integer. Not used by add and can be nullptr then.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] remote_disp of type __uintptr_t__; positional argument; The displacement from the remote buffer base address. The remote address has to be aligned to the size of `type`.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle of the remote buffer.
+ * @param[in] compare of type __uint64_t__; optional argument; For cas: the value to compare the remote integer with.
+ * @param[in] type of type __atomic_type_t__; optional argument; The integer type.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_POST_ATOMIC
+  * @brief The actual implementation for post_atomic.
+  */
+class post_atomic_x {
+ public:
+  // args declaration
+  int m_rank;
+  atomic_op_t m_op;
+  uint64_t m_operand;
+  void* m_result;
+  comp_t m_local_comp;
+  uintptr_t m_remote_disp;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<uint64_t> m_compare ;
+  option_t<atomic_type_t> m_type ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<void*> m_user_context ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  post_atomic_x(int rank_in, atomic_op_t op_in, uint64_t operand_in, void* result_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) : m_rank(rank_in), m_op(op_in), m_operand(operand_in), m_result(result_in), m_local_comp(local_comp_in), m_remote_disp(remote_disp_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline post_atomic_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline post_atomic_x&& op(atomic_op_t op_in) { m_op = op_in; return std::move(*this); }
+  inline post_atomic_x&& operand(uint64_t operand_in) { m_operand = operand_in; return std::move(*this); }
+  inline post_atomic_x&& result(void* result_in) { m_result = result_in; return std::move(*this); }
+  inline post_atomic_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline post_atomic_x&& remote_disp(uintptr_t remote_disp_in) { m_remote_disp = remote_disp_in; return std::move(*this); }
+  inline post_atomic_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline post_atomic_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline post_atomic_x&& compare(uint64_t compare_in) { m_compare = compare_in; return std::move(*this); }
+  inline post_atomic_x&& type(atomic_type_t type_in) { m_type = type_in; return std::move(*this); }
+  inline post_atomic_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline post_atomic_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline post_atomic_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline post_atomic_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline post_atomic_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline post_atomic_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline post_atomic_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  status_t call_impl(int rank, atomic_op_t op, uint64_t operand, void* result, comp_t local_comp, uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, uint64_t compare, atomic_type_t type, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, void* user_context, bool allow_done, bool allow_posted, bool allow_retry) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t post_atomic(int rank_in, atomic_op_t op_in, uint64_t operand_in, void* result_in, comp_t local_comp_in, uintptr_t remote_disp_in, rmr_t rmr_in) {
+  return post_atomic_x(rank_in, op_in, operand_in, result_in, local_comp_in, remote_disp_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_PERSISTENT_COMM alloc_persistent_comm
+ * @ingroup LCI_COMM
+ * @brief Plan a generic communication operation to be posted later by @ref start.
+ * @details The arguments are the same as the ones of @ref post_comm. The argument checks, the remote handler, the protocol, and the immediate data are computed once here, and the local buffer is registered if the protocol needs it. The local buffer and the message size are therefore fixed.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] direction of type __direction_t__; positional argument; The communication direction.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] local_buffer of type __void*__; positional argument; The local buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The message size.
+ * @param[in] local_comp of type __comp_t__; positional argument; The local completion object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to use.
+ * @param[in] matching_engine of type __matching_engine_t__; optional argument; The matching engine to use.
+ * @param[in] comp_semantic of type __comp_semantic_t__; optional argument; The completion semantic (only valid when `direction == direction_t::OUT`).
+ * @param[in] mr of type __mr_t__; optional argument; The registered memory region for the local buffer. If not set, the local buffer is registered by the allocation when the chosen protocol needs it.
+ * @param[in] remote_disp of type __uintptr_t__; optional argument; The displacement from the remote buffer base address.
+ * @param[in] rmr of type __rmr_t__; optional argument; The remote memory region handle of the remote buffer.
+ * @param[in] tag of type __tag_t__; optional argument; The tag to use.
+ * @param[in] remote_comp of type __rcomp_t__; optional argument; The remote completion handler to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this operation.
+ * @param[in] matching_policy of type __matching_policy_t__; optional argument; The matching policy to use.
+ * @param[in] iov of type __const iovec_t*__; optional argument; The local io vector. If set, it replaces `local_buffer`, `size`, and `mr`. Copied by the allocation.
+ * @param[in] iov_count of type __size_t__; optional argument; The number of entries in `iov`.
+ * @param[in] datatype of type __const datatype_t*__; optional argument; The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Copied by the allocation, but the displacements of an indexed block have to stay valid until the object is freed.
+ * @param[in] zero_copy of type __bool__; optional argument; Only valid for recv. Whether to deliver an eager message in the internal packet instead of copying it into `local_buffer` (see @ref post_recv).
+ * @param[in] allow_done of type __bool__; optional argument; Whether to allow the *done* error code.
+ * @param[in] allow_posted of type __bool__; optional argument; Whether to allow the *posted* error code.
+ * @param[in] allow_retry of type __bool__; optional argument; Whether to allow the *retry* error code.
+ * @return of type __persistent_comm_t__; The allocated persistent communication operation.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_PERSISTENT_COMM
+  * @brief The actual implementation for alloc_persistent_comm.
+  */
+class alloc_persistent_comm_x {
+ public:
+  // args declaration
+  direction_t m_direction;
+  int m_rank;
+  void* m_local_buffer;
+  size_t m_size;
+  comp_t m_local_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<packet_pool_t> m_packet_pool ;
+  option_t<matching_engine_t> m_matching_engine ;
+  option_t<comp_semantic_t> m_comp_semantic ;
+  option_t<mr_t> m_mr ;
+  option_t<uintptr_t> m_remote_disp ;
+  option_t<rmr_t> m_rmr ;
+  option_t<tag_t> m_tag ;
+  option_t<rcomp_t> m_remote_comp ;
+  option_t<void*> m_user_context ;
+  option_t<matching_policy_t> m_matching_policy ;
+  option_t<const iovec_t*> m_iov ;
+  option_t<size_t> m_iov_count ;
+  option_t<const datatype_t*> m_datatype ;
+  option_t<bool> m_zero_copy ;
+  option_t<bool> m_allow_done ;
+  option_t<bool> m_allow_posted ;
+  option_t<bool> m_allow_retry ;
+
+  // constructor
+  alloc_persistent_comm_x(direction_t direction_in, int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in) : m_direction(direction_in), m_rank(rank_in), m_local_buffer(local_buffer_in), m_size(size_in), m_local_comp(local_comp_in) {}
+
+  // setter
+  inline alloc_persistent_comm_x&& direction(direction_t direction_in) { m_direction = direction_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& local_buffer(void* local_buffer_in) { m_local_buffer = local_buffer_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& local_comp(comp_t local_comp_in) { m_local_comp = local_comp_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& comp_semantic(comp_semantic_t comp_semantic_in) { m_comp_semantic = comp_semantic_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& remote_disp(uintptr_t remote_disp_in) { m_remote_disp = remote_disp_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& tag(tag_t tag_in) { m_tag = tag_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& remote_comp(rcomp_t remote_comp_in) { m_remote_comp = remote_comp_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& matching_policy(matching_policy_t matching_policy_in) { m_matching_policy = matching_policy_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& iov(const iovec_t* iov_in) { m_iov = iov_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& iov_count(size_t iov_count_in) { m_iov_count = iov_count_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& datatype(const datatype_t* datatype_in) { m_datatype = datatype_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& zero_copy(bool zero_copy_in) { m_zero_copy = zero_copy_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& allow_done(bool allow_done_in) { m_allow_done = allow_done_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& allow_posted(bool allow_posted_in) { m_allow_posted = allow_posted_in; return std::move(*this); }
+  inline alloc_persistent_comm_x&& allow_retry(bool allow_retry_in) { m_allow_retry = allow_retry_in; return std::move(*this); }
+
+  persistent_comm_t call_impl(direction_t direction, int rank, void* local_buffer, size_t size, comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint, packet_pool_t packet_pool, matching_engine_t matching_engine, comp_semantic_t comp_semantic, mr_t mr, uintptr_t remote_disp, rmr_t rmr, tag_t tag, rcomp_t remote_comp, void* user_context, matching_policy_t matching_policy, const iovec_t* iov, size_t iov_count, const datatype_t* datatype, bool zero_copy, bool allow_done, bool allow_posted, bool allow_retry) const;
+  persistent_comm_t call() const;
+  inline persistent_comm_t operator()() const { return call(); }
+};
+
+inline persistent_comm_t alloc_persistent_comm(direction_t direction_in, int rank_in, void* local_buffer_in, size_t size_in, comp_t local_comp_in) {
+  return alloc_persistent_comm_x(direction_in, rank_in, local_buffer_in, size_in, local_comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_PERSISTENT_COMM free_persistent_comm
+ * @ingroup LCI_COMM
+ * @brief Free a new persistent_comm object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] persistent_comm of type __persistent_comm_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_PERSISTENT_COMM
+  * @brief The actual implementation for free_persistent_comm.
+  */
+class free_persistent_comm_x {
+ public:
+  // args declaration
+  persistent_comm_t* m_persistent_comm;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  free_persistent_comm_x(persistent_comm_t* persistent_comm_in) : m_persistent_comm(persistent_comm_in) {}
+
+  // setter
+  inline free_persistent_comm_x&& persistent_comm(persistent_comm_t* persistent_comm_in) { m_persistent_comm = persistent_comm_in; return std::move(*this); }
+  inline free_persistent_comm_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(persistent_comm_t* persistent_comm, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_persistent_comm(persistent_comm_t* persistent_comm_in) {
+  return free_persistent_comm_x(persistent_comm_in).call();
+}
+
+
+/**
+ * @defgroup LCI_START start
+ * @ingroup LCI_COMM
+ * @brief Post a persistent communication operation.
+ * @details It behaves as @ref post_comm with the arguments given to @ref alloc_persistent_comm. A persistent communication operation can be started again once the previous start has completed.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] persistent_comm of type __persistent_comm_t__; positional argument; The persistent communication operation to post.
+ * @return of type __status_t__; The status of the operation.
+ */
+ 
+ /**
+  * @ingroup LCI_START
+  * @brief The actual implementation for start.
+  */
+class start_x {
+ public:
+  // args declaration
+  persistent_comm_t m_persistent_comm;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  start_x(persistent_comm_t persistent_comm_in) : m_persistent_comm(persistent_comm_in) {}
+
+  // setter
+  inline start_x&& persistent_comm(persistent_comm_t persistent_comm_in) { m_persistent_comm = persistent_comm_in; return std::move(*this); }
+  inline start_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  status_t call_impl(persistent_comm_t persistent_comm, runtime_t runtime) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t start(persistent_comm_t persistent_comm_in) {
+  return start_x(persistent_comm_in).call();
+}
+
+
+/**
+ * @defgroup LCI_BEGIN_BATCH begin_batch
+ * @ingroup LCI_COMM
+ * @brief Start batching the communication operations posted by the calling thread.
+ * @details Until @ref flush_batch is called, the zero-copy sends, puts and gets (and the buffer-copy puts and gets) posted by the calling thread to the endpoint are staged instead of posted, and return *posted*. Other operations posted to the endpoint first flush the staged ones. As without a batch, a buffer-copy put with the memory completion semantic returns *done* once its data is copied, although it is only sent when the batch is flushed. The progress engine posts the staged operations of the calling thread, so polling for the completion of a staged operation does not need @ref flush_batch. A thread can only have one open batch, and the endpoint cannot be freed while a thread has an open batch on it.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint whose operations are batched.
+
+ */
+ 
+ /**
+  * @ingroup LCI_BEGIN_BATCH
+  * @brief The actual implementation for begin_batch.
+  */
+class begin_batch_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+
+  // constructor
+  begin_batch_x() {}
+
+  // setter
+  inline begin_batch_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline begin_batch_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline begin_batch_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+
+  void call_impl(runtime_t runtime, device_t device, endpoint_t endpoint) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void begin_batch() {
+  return begin_batch_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FLUSH_BATCH flush_batch
+ * @ingroup LCI_COMM
+ * @brief Post the communication operations batched by the calling thread and close the batch.
+ * @details The operations to the same target are submitted together, so that the network backend takes its locks and rings its doorbell once per batch. The operations that cannot be posted immediately are pushed to the backlog queue.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FLUSH_BATCH
+  * @brief The actual implementation for flush_batch.
+  */
+class flush_batch_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  flush_batch_x() {}
+
+  // setter
+  inline flush_batch_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void flush_batch() {
+  return flush_batch_x().call();
+}
+
+
+/**
+ * @defgroup LCI_PROGRESS progress
+ * @ingroup LCI_COMM
+ * @brief Perform background work to advance the state of the pending communication.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to progress.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use in case the progress function needs to send internal control messages.
+ * @return of type __error_t__; The error code. The error code *done* means the progress function progressed some work; the error code *retry* means the progress function did no find any work to progress.
+ */
+ 
+ /**
+  * @ingroup LCI_PROGRESS
+  * @brief The actual implementation for progress.
+  */
+class progress_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+
+  // constructor
+  progress_x() {}
+
+  // setter
+  inline progress_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline progress_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline progress_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+
+  error_t call_impl(runtime_t runtime, device_t device, endpoint_t endpoint) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t progress() {
+  return progress_x().call();
+}
+
+
+/**
+ * @defgroup LCI_TEST_DRAINED test_drained
+ * @ingroup LCI_COMM
+ * @brief Test for the completion of all locally posted communication operations.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @return of type __error_t__; The error code. The error code *done* means all previously posted operations are completed; the error code *retry* means not all previously posted operations are completed.
+ */
+ 
+ /**
+  * @ingroup LCI_TEST_DRAINED
+  * @brief The actual implementation for test_drained.
+  */
+class test_drained_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  test_drained_x() {}
+
+  // setter
+  inline test_drained_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline test_drained_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  error_t call_impl(runtime_t runtime, device_t device) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t test_drained() {
+  return test_drained_x().call();
+}
+
+
+/**
+ * @defgroup LCI_WAIT_DRAINED wait_drained
+ * @ingroup LCI_COMM
+ * @brief Test for the completion of all locally posted communication operations.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+
+ */
+ 
+ /**
+  * @ingroup LCI_WAIT_DRAINED
+  * @brief The actual implementation for wait_drained.
+  */
+class wait_drained_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  wait_drained_x() {}
+
+  // setter
+  inline wait_drained_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline wait_drained_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  void call_impl(runtime_t runtime, device_t device) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void wait_drained() {
+  return wait_drained_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FLUSH flush
+ * @ingroup LCI_COMM
+ * @brief Send all active messages aggregated on an endpoint.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to flush.
+ * @return of type __error_t__; The error code. The error code *done* means some aggregated messages have been sent; the error code *retry* means there was nothing to flush.
+ */
+ 
+ /**
+  * @ingroup LCI_FLUSH
+  * @brief The actual implementation for flush.
+  */
+class flush_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+
+  // constructor
+  flush_x() {}
+
+  // setter
+  inline flush_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline flush_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline flush_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+
+  error_t call_impl(runtime_t runtime, device_t device, endpoint_t endpoint) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t flush() {
+  return flush_x().call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_RUNTIME alloc_runtime
+ * @ingroup LCI_SETUP
+ * @brief Allocate a new runtime object.
+ * @details 
+ * @param[in,out] packet_return_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] imm_nbits_tag of type __int__; optional argument; argument for the corresponding attribute
+ * @param[in,out] imm_nbits_rcomp of type __int__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_protocol of type __attr_rdv_protocol_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_read_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_pipeline of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_pipeline_chunk_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] inject_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] eager_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] zcopy_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] tuning_profile of type __std::string__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_default_device of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_default_packet_pool of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_default_matching_engine of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] name of type __const char*__; optional argument; argument for the corresponding attribute
+ * @param[in,out] user_context of type __void*__; optional argument; argument for the corresponding attribute
+ * @param[in] device_name of type __std::string__; optional argument; The network device name to use for the default network context.
+ * @return of type __runtime_t__; The allocated object.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_RUNTIME
+  * @brief The actual implementation for alloc_runtime.
+  */
+class alloc_runtime_x {
+ public:
+  // args declaration
+  option_t<size_t> m_packet_return_threshold ;
+  option_t<int> m_imm_nbits_tag ;
+  option_t<int> m_imm_nbits_rcomp ;
+  option_t<attr_rdv_protocol_t> m_rdv_protocol ;
+  option_t<size_t> m_rdv_read_threshold ;
+  option_t<bool> m_rdv_pipeline ;
+  option_t<size_t> m_rdv_pipeline_chunk_size ;
+  option_t<size_t> m_inject_threshold ;
+  option_t<size_t> m_eager_threshold ;
+  option_t<size_t> m_zcopy_threshold ;
+  option_t<std::string> m_tuning_profile ;
+  option_t<bool> m_alloc_default_device ;
+  option_t<bool> m_alloc_default_packet_pool ;
+  option_t<bool> m_alloc_default_matching_engine ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<std::string> m_device_name ;
+
+  // constructor
+  alloc_runtime_x() {}
+
+  // setter
+  inline alloc_runtime_x&& packet_return_threshold(size_t packet_return_threshold_in) { m_packet_return_threshold = packet_return_threshold_in; return std::move(*this); }
+  inline alloc_runtime_x&& imm_nbits_tag(int imm_nbits_tag_in) { m_imm_nbits_tag = imm_nbits_tag_in; return std::move(*this); }
+  inline alloc_runtime_x&& imm_nbits_rcomp(int imm_nbits_rcomp_in) { m_imm_nbits_rcomp = imm_nbits_rcomp_in; return std::move(*this); }
+  inline alloc_runtime_x&& rdv_protocol(attr_rdv_protocol_t rdv_protocol_in) { m_rdv_protocol = rdv_protocol_in; return std::move(*this); }
+  inline alloc_runtime_x&& rdv_read_threshold(size_t rdv_read_threshold_in) { m_rdv_read_threshold = rdv_read_threshold_in; return std::move(*this); }
+  inline alloc_runtime_x&& rdv_pipeline(bool rdv_pipeline_in) { m_rdv_pipeline = rdv_pipeline_in; return std::move(*this); }
+  inline alloc_runtime_x&& rdv_pipeline_chunk_size(size_t rdv_pipeline_chunk_size_in) { m_rdv_pipeline_chunk_size = rdv_pipeline_chunk_size_in; return std::move(*this); }
+  inline alloc_runtime_x&& inject_threshold(size_t inject_threshold_in) { m_inject_threshold = inject_threshold_in; return std::move(*this); }
+  inline alloc_runtime_x&& eager_threshold(size_t eager_threshold_in) { m_eager_threshold = eager_threshold_in; return std::move(*this); }
+  inline alloc_runtime_x&& zcopy_threshold(size_t zcopy_threshold_in) { m_zcopy_threshold = zcopy_threshold_in; return std::move(*this); }
+  inline alloc_runtime_x&& tuning_profile(std::string tuning_profile_in) { m_tuning_profile = tuning_profile_in; return std::move(*this); }
+  inline alloc_runtime_x&& alloc_default_device(bool alloc_default_device_in) { m_alloc_default_device = alloc_default_device_in; return std::move(*this); }
+  inline alloc_runtime_x&& alloc_default_packet_pool(bool alloc_default_packet_pool_in) { m_alloc_default_packet_pool = alloc_default_packet_pool_in; return std::move(*this); }
+  inline alloc_runtime_x&& alloc_default_matching_engine(bool alloc_default_matching_engine_in) { m_alloc_default_matching_engine = alloc_default_matching_engine_in; return std::move(*this); }
+  inline alloc_runtime_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_runtime_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_runtime_x&& device_name(std::string device_name_in) { m_device_name = device_name_in; return std::move(*this); }
+
+  runtime_t call_impl(size_t packet_return_threshold, int imm_nbits_tag, int imm_nbits_rcomp, attr_rdv_protocol_t rdv_protocol, size_t rdv_read_threshold, bool rdv_pipeline, size_t rdv_pipeline_chunk_size, size_t inject_threshold, size_t eager_threshold, size_t zcopy_threshold, std::string tuning_profile, bool alloc_default_device, bool alloc_default_packet_pool, bool alloc_default_matching_engine, const char* name, void* user_context, std::string device_name) const;
+  runtime_t call() const;
+  inline runtime_t operator()() const { return call(); }
+};
+
+inline runtime_t alloc_runtime() {
+  return alloc_runtime_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_RUNTIME free_runtime
+ * @ingroup LCI_SETUP
+ * @brief Free a new runtime object.
+ * @details 
+ * @param[in,out] runtime of type __runtime_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_RUNTIME
+  * @brief The actual implementation for free_runtime.
+  */
+class free_runtime_x {
+ public:
+  // args declaration
+  runtime_t* m_runtime;
+
+  // constructor
+  free_runtime_x(runtime_t* runtime_in) : m_runtime(runtime_in) {}
+
+  // setter
+  inline free_runtime_x&& runtime(runtime_t* runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(runtime_t* runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_runtime(runtime_t* runtime_in) {
+  return free_runtime_x(runtime_in).call();
+}
+
+
+/**
+ * @defgroup LCI_G_RUNTIME_INIT g_runtime_init
+ * @ingroup LCI_SETUP
+ * @brief Initialize the global default runtime object.
+ * @details 
+ * @param[in,out] packet_return_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] imm_nbits_tag of type __int__; optional argument; argument for the corresponding attribute
+ * @param[in,out] imm_nbits_rcomp of type __int__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_protocol of type __attr_rdv_protocol_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_read_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_pipeline of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] rdv_pipeline_chunk_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] inject_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] eager_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] zcopy_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] tuning_profile of type __std::string__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_default_device of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_default_packet_pool of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_default_matching_engine of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] name of type __const char*__; optional argument; argument for the corresponding attribute
+ * @param[in,out] user_context of type __void*__; optional argument; argument for the corresponding attribute
+ * @param[in] device_name of type __std::string__; optional argument; The network device name to use for the default network context.
+ * @return of type __runtime_t__; The allocated object.
+ */
+ 
+ /**
+  * @ingroup LCI_G_RUNTIME_INIT
+  * @brief The actual implementation for g_runtime_init.
+  */
+class g_runtime_init_x {
+ public:
+  // args declaration
+  option_t<size_t> m_packet_return_threshold ;
+  option_t<int> m_imm_nbits_tag ;
+  option_t<int> m_imm_nbits_rcomp ;
+  option_t<attr_rdv_protocol_t> m_rdv_protocol ;
+  option_t<size_t> m_rdv_read_threshold ;
+  option_t<bool> m_rdv_pipeline ;
+  option_t<size_t> m_rdv_pipeline_chunk_size ;
+  option_t<size_t> m_inject_threshold ;
+  option_t<size_t> m_eager_threshold ;
+  option_t<size_t> m_zcopy_threshold ;
+  option_t<std::string> m_tuning_profile ;
+  option_t<bool> m_alloc_default_device ;
+  option_t<bool> m_alloc_default_packet_pool ;
+  option_t<bool> m_alloc_default_matching_engine ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<std::string> m_device_name ;
+
+  // constructor
+  g_runtime_init_x() {}
+
+  // setter
+  inline g_runtime_init_x&& packet_return_threshold(size_t packet_return_threshold_in) { m_packet_return_threshold = packet_return_threshold_in; return std::move(*this); }
+  inline g_runtime_init_x&& imm_nbits_tag(int imm_nbits_tag_in) { m_imm_nbits_tag = imm_nbits_tag_in; return std::move(*this); }
+  inline g_runtime_init_x&& imm_nbits_rcomp(int imm_nbits_rcomp_in) { m_imm_nbits_rcomp = imm_nbits_rcomp_in; return std::move(*this); }
+  inline g_runtime_init_x&& rdv_protocol(attr_rdv_protocol_t rdv_protocol_in) { m_rdv_protocol = rdv_protocol_in; return std::move(*this); }
+  inline g_runtime_init_x&& rdv_read_threshold(size_t rdv_read_threshold_in) { m_rdv_read_threshold = rdv_read_threshold_in; return std::move(*this); }
+  inline g_runtime_init_x&& rdv_pipeline(bool rdv_pipeline_in) { m_rdv_pipeline = rdv_pipeline_in; return std::move(*this); }
+  inline g_runtime_init_x&& rdv_pipeline_chunk_size(size_t rdv_pipeline_chunk_size_in) { m_rdv_pipeline_chunk_size = rdv_pipeline_chunk_size_in; return std::move(*this); }
+  inline g_runtime_init_x&& inject_threshold(size_t inject_threshold_in) { m_inject_threshold = inject_threshold_in; return std::move(*this); }
+  inline g_runtime_init_x&& eager_threshold(size_t eager_threshold_in) { m_eager_threshold = eager_threshold_in; return std::move(*this); }
+  inline g_runtime_init_x&& zcopy_threshold(size_t zcopy_threshold_in) { m_zcopy_threshold = zcopy_threshold_in; return std::move(*this); }
+  inline g_runtime_init_x&& tuning_profile(std::string tuning_profile_in) { m_tuning_profile = tuning_profile_in; return std::move(*this); }
+  inline g_runtime_init_x&& alloc_default_device(bool alloc_default_device_in) { m_alloc_default_device = alloc_default_device_in; return std::move(*this); }
+  inline g_runtime_init_x&& alloc_default_packet_pool(bool alloc_default_packet_pool_in) { m_alloc_default_packet_pool = alloc_default_packet_pool_in; return std::move(*this); }
+  inline g_runtime_init_x&& alloc_default_matching_engine(bool alloc_default_matching_engine_in) { m_alloc_default_matching_engine = alloc_default_matching_engine_in; return std::move(*this); }
+  inline g_runtime_init_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline g_runtime_init_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline g_runtime_init_x&& device_name(std::string device_name_in) { m_device_name = device_name_in; return std::move(*this); }
+
+  runtime_t call_impl(size_t packet_return_threshold, int imm_nbits_tag, int imm_nbits_rcomp, attr_rdv_protocol_t rdv_protocol, size_t rdv_read_threshold, bool rdv_pipeline, size_t rdv_pipeline_chunk_size, size_t inject_threshold, size_t eager_threshold, size_t zcopy_threshold, std::string tuning_profile, bool alloc_default_device, bool alloc_default_packet_pool, bool alloc_default_matching_engine, const char* name, void* user_context, std::string device_name) const;
+  runtime_t call() const;
+  inline runtime_t operator()() const { return call(); }
+};
+
+inline runtime_t g_runtime_init() {
+  return g_runtime_init_x().call();
+}
+
+
+/**
+ * @defgroup LCI_G_RUNTIME_FINA g_runtime_fina
+ * @ingroup LCI_SETUP
+ * @brief Finalize the global default runtime object.
+ * @details 
+
+
+ */
+ 
+ /**
+  * @ingroup LCI_G_RUNTIME_FINA
+  * @brief The actual implementation for g_runtime_fina.
+  */
+class g_runtime_fina_x {
+ public:
+  // args declaration
+
+  // constructor
+  g_runtime_fina_x() {}
+
+  // setter
+
+  void call_impl() const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void g_runtime_fina() {
+  return g_runtime_fina_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GET_G_RUNTIME get_g_runtime
+ * @ingroup LCI_SETUP
+ * @brief Get the global default runtime object.
+ * @details 
+
+ * @return of type __runtime_t__; The global default runtime object.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_G_RUNTIME
+  * @brief The actual implementation for get_g_runtime.
+  */
+class get_g_runtime_x {
+ public:
+  // args declaration
+
+  // constructor
+  get_g_runtime_x() {}
+
+  // setter
+
+  runtime_t call_impl() const;
+  runtime_t call() const;
+  inline runtime_t operator()() const { return call(); }
+};
+
+inline runtime_t get_g_runtime() {
+  return get_g_runtime_x().call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_PACKET_POOL alloc_packet_pool
+ * @ingroup LCI_RESOURCE
+ * @brief Allocate a new packet_pool object.
+ * @details 
+ * @param[in,out] packet_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] npackets of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] min_packet_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] numa_aware of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] huge_page of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] npackets_max of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] slab_cooldown of type __int__; optional argument; argument for the corresponding attribute
+ * @param[in,out] name of type __const char*__; optional argument; argument for the corresponding attribute
+ * @param[in,out] user_context of type __void*__; optional argument; argument for the corresponding attribute
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __packet_pool_t__; The allocated object.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_PACKET_POOL
+  * @brief The actual implementation for alloc_packet_pool.
+  */
+class alloc_packet_pool_x {
+ public:
+  // args declaration
+  option_t<size_t> m_packet_size ;
+  option_t<size_t> m_npackets ;
+  option_t<size_t> m_min_packet_size ;
+  option_t<bool> m_numa_aware ;
+  option_t<bool> m_huge_page ;
+  option_t<size_t> m_npackets_max ;
+  option_t<int> m_slab_cooldown ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  alloc_packet_pool_x() {}
+
+  // setter
+  inline alloc_packet_pool_x&& packet_size(size_t packet_size_in) { m_packet_size = packet_size_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& npackets(size_t npackets_in) { m_npackets = npackets_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& min_packet_size(size_t min_packet_size_in) { m_min_packet_size = min_packet_size_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& numa_aware(bool numa_aware_in) { m_numa_aware = numa_aware_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& huge_page(bool huge_page_in) { m_huge_page = huge_page_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& npackets_max(size_t npackets_max_in) { m_npackets_max = npackets_max_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& slab_cooldown(int slab_cooldown_in) { m_slab_cooldown = slab_cooldown_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_packet_pool_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  packet_pool_t call_impl(size_t packet_size, size_t npackets, size_t min_packet_size, bool numa_aware, bool huge_page, size_t npackets_max, int slab_cooldown, const char* name, void* user_context, runtime_t runtime) const;
+  packet_pool_t call() const;
+  inline packet_pool_t operator()() const { return call(); }
+};
+
+inline packet_pool_t alloc_packet_pool() {
+  return alloc_packet_pool_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_PACKET_POOL free_packet_pool
+ * @ingroup LCI_RESOURCE
+ * @brief Free a new packet_pool object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] packet_pool of type __packet_pool_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_PACKET_POOL
+  * @brief The actual implementation for free_packet_pool.
+  */
+class free_packet_pool_x {
+ public:
+  // args declaration
+  packet_pool_t* m_packet_pool;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  free_packet_pool_x(packet_pool_t* packet_pool_in) : m_packet_pool(packet_pool_in) {}
+
+  // setter
+  inline free_packet_pool_x&& packet_pool(packet_pool_t* packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline free_packet_pool_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(packet_pool_t* packet_pool, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_packet_pool(packet_pool_t* packet_pool_in) {
+  return free_packet_pool_x(packet_pool_in).call();
+}
+
+
+/**
+ * @defgroup LCI_REGISTER_PACKET_POOL register_packet_pool
+ * @ingroup LCI_RESOURCE
+ * @brief Register a packet pool to a device.
+ * @details A packet pool can be registered to multiple devices. A device can register multiple packet pools. However, a device can only be bound to one packet pool.
+ * @param[in] packet_pool of type __packet_pool_t__; positional argument; The packet pool to register.
+ * @param[in] device of type __device_t__; positional argument; The device to register the packet pool.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+
+ */
+ 
+ /**
+  * @ingroup LCI_REGISTER_PACKET_POOL
+  * @brief The actual implementation for register_packet_pool.
+  */
+class register_packet_pool_x {
+ public:
+  // args declaration
+  packet_pool_t m_packet_pool;
+  device_t m_device;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  register_packet_pool_x(packet_pool_t packet_pool_in, device_t device_in) : m_packet_pool(packet_pool_in), m_device(device_in) {}
+
+  // setter
+  inline register_packet_pool_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline register_packet_pool_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline register_packet_pool_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(packet_pool_t packet_pool, device_t device, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void register_packet_pool(packet_pool_t packet_pool_in, device_t device_in) {
+  return register_packet_pool_x(packet_pool_in, device_in).call();
+}
+
+
+/**
+ * @defgroup LCI_DEREGISTER_PACKET_POOL deregister_packet_pool
+ * @ingroup LCI_RESOURCE
+ * @brief Deregister a packet pool from a device.
+ * @details 
+ * @param[in] packet_pool of type __packet_pool_t__; positional argument; The packet pool to register.
+ * @param[in] device of type __device_t__; positional argument; The device to deregister the packet pool.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+
+ */
+ 
+ /**
+  * @ingroup LCI_DEREGISTER_PACKET_POOL
+  * @brief The actual implementation for deregister_packet_pool.
+  */
+class deregister_packet_pool_x {
+ public:
+  // args declaration
+  packet_pool_t m_packet_pool;
+  device_t m_device;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  deregister_packet_pool_x(packet_pool_t packet_pool_in, device_t device_in) : m_packet_pool(packet_pool_in), m_device(device_in) {}
+
+  // setter
+  inline deregister_packet_pool_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+  inline deregister_packet_pool_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline deregister_packet_pool_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(packet_pool_t packet_pool, device_t device, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void deregister_packet_pool(packet_pool_t packet_pool_in, device_t device_in) {
+  return deregister_packet_pool_x(packet_pool_in, device_in).call();
+}
+
+
+/**
+ * @defgroup LCI_GET_UPACKET get_upacket
+ * @ingroup LCI_RESOURCE
+ * @brief Get a packet for writing user payload from the packet pool.
+ * @details The packet will be automatically returned to the packet pool when the communication is done.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to get the packet.
+ * @return of type __void*__; The packet to use.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_UPACKET
+  * @brief The actual implementation for get_upacket.
+  */
+class get_upacket_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<packet_pool_t> m_packet_pool ;
+
+  // constructor
+  get_upacket_x() {}
+
+  // setter
+  inline get_upacket_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline get_upacket_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+
+  void* call_impl(runtime_t runtime, packet_pool_t packet_pool) const;
+  void* call() const;
+  inline void* operator()() const { return call(); }
+};
+
+inline void* get_upacket() {
+  return get_upacket_x().call();
+}
+
+
+/**
+ * @defgroup LCI_PUT_UPACKET put_upacket
+ * @ingroup LCI_RESOURCE
+ * @brief Return a packet to the packet pool.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] packet of type __void*__; positional argument; The packet to return.
+
+ */
+ 
+ /**
+  * @ingroup LCI_PUT_UPACKET
+  * @brief The actual implementation for put_upacket.
+  */
+class put_upacket_x {
+ public:
+  // args declaration
+  void* m_packet;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  put_upacket_x(void* packet_in) : m_packet(packet_in) {}
+
+  // setter
+  inline put_upacket_x&& packet(void* packet_in) { m_packet = packet_in; return std::move(*this); }
+  inline put_upacket_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(void* packet, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void put_upacket(void* packet_in) {
+  return put_upacket_x(packet_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_MATCHING_ENGINE alloc_matching_engine
+ * @ingroup LCI_RESOURCE
+ * @brief Allocate a new matching_engine object.
+ * @details 
+ * @param[in,out] matching_engine_type of type __attr_matching_engine_type_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] nbuckets of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] name of type __const char*__; optional argument; argument for the corresponding attribute
+ * @param[in,out] user_context of type __void*__; optional argument; argument for the corresponding attribute
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __matching_engine_t__; The allocated object.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_MATCHING_ENGINE
+  * @brief The actual implementation for alloc_matching_engine.
+  */
+class alloc_matching_engine_x {
+ public:
+  // args declaration
+  option_t<attr_matching_engine_type_t> m_matching_engine_type ;
+  option_t<size_t> m_nbuckets ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  alloc_matching_engine_x() {}
+
+  // setter
+  inline alloc_matching_engine_x&& matching_engine_type(attr_matching_engine_type_t matching_engine_type_in) { m_matching_engine_type = matching_engine_type_in; return std::move(*this); }
+  inline alloc_matching_engine_x&& nbuckets(size_t nbuckets_in) { m_nbuckets = nbuckets_in; return std::move(*this); }
+  inline alloc_matching_engine_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_matching_engine_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_matching_engine_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  matching_engine_t call_impl(attr_matching_engine_type_t matching_engine_type, size_t nbuckets, const char* name, void* user_context, runtime_t runtime) const;
+  matching_engine_t call() const;
+  inline matching_engine_t operator()() const { return call(); }
+};
+
+inline matching_engine_t alloc_matching_engine() {
+  return alloc_matching_engine_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_MATCHING_ENGINE free_matching_engine
+ * @ingroup LCI_RESOURCE
+ * @brief Free a new matching_engine object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] matching_engine of type __matching_engine_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_MATCHING_ENGINE
+  * @brief The actual implementation for free_matching_engine.
+  */
+class free_matching_engine_x {
+ public:
+  // args declaration
+  matching_engine_t* m_matching_engine;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  free_matching_engine_x(matching_engine_t* matching_engine_in) : m_matching_engine(matching_engine_in) {}
+
+  // setter
+  inline free_matching_engine_x&& matching_engine(matching_engine_t* matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline free_matching_engine_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(matching_engine_t* matching_engine, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_matching_engine(matching_engine_t* matching_engine_in) {
+  return free_matching_engine_x(matching_engine_in).call();
+}
+
+
+/**
+ * @defgroup LCI_MATCHING_ENGINE_INSERT matching_engine_insert
+ * @ingroup LCI_RESOURCE
+ * @brief Insert an entry into the matching engine.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] matching_engine of type __matching_engine_t__; positional argument; The matching engine to use.
+ * @param[in] key of type __matching_entry_key_t__; positional argument; The key to insert.
+ * @param[in] value of type __matching_entry_val_t__; positional argument; The value to insert.
+ * @param[in] entry_type of type __matching_entry_type_t__; positional argument; The type of the entry.
+ * @return of type __matching_entry_val_t__; The entry matched.
+ */
+ 
+ /**
+  * @ingroup LCI_MATCHING_ENGINE_INSERT
+  * @brief The actual implementation for matching_engine_insert.
+  */
+class matching_engine_insert_x {
+ public:
+  // args declaration
+  matching_engine_t m_matching_engine;
+  matching_entry_key_t m_key;
+  matching_entry_val_t m_value;
+  matching_entry_type_t m_entry_type;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  matching_engine_insert_x(matching_engine_t matching_engine_in, matching_entry_key_t key_in, matching_entry_val_t value_in, matching_entry_type_t entry_type_in) : m_matching_engine(matching_engine_in), m_key(key_in), m_value(value_in), m_entry_type(entry_type_in) {}
+
+  // setter
+  inline matching_engine_insert_x&& matching_engine(matching_engine_t matching_engine_in) { m_matching_engine = matching_engine_in; return std::move(*this); }
+  inline matching_engine_insert_x&& key(matching_entry_key_t key_in) { m_key = key_in; return std::move(*this); }
+  inline matching_engine_insert_x&& value(matching_entry_val_t value_in) { m_value = value_in; return std::move(*this); }
+  inline matching_engine_insert_x&& entry_type(matching_entry_type_t entry_type_in) { m_entry_type = entry_type_in; return std::move(*this); }
+  inline matching_engine_insert_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  matching_entry_val_t call_impl(matching_engine_t matching_engine, matching_entry_key_t key, matching_entry_val_t value, matching_entry_type_t entry_type, runtime_t runtime) const;
+  matching_entry_val_t call() const;
+  inline matching_entry_val_t operator()() const { return call(); }
+};
+
+inline matching_entry_val_t matching_engine_insert(matching_engine_t matching_engine_in, matching_entry_key_t key_in, matching_entry_val_t value_in, matching_entry_type_t entry_type_in) {
+  return matching_engine_insert_x(matching_engine_in, key_in, value_in, entry_type_in).call();
+}
+
+
+/**
+ * @defgroup LCI_SET_ALLOCATOR set_allocator
+ * @ingroup LCI_RESOURCE
+ * @brief Set the message allocator for the runtime.
+ * @details The default allocator will be used for all message buffers delivered to users.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param allocator of type __allocator_base_t*__; positional argument; The allocator to set as the allocator.
+
+ */
+ 
+ /**
+  * @ingroup LCI_SET_ALLOCATOR
+  * @brief The actual implementation for set_allocator.
+  */
+class set_allocator_x {
+ public:
+  // args declaration
+  allocator_base_t* m_allocator;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  set_allocator_x(allocator_base_t* allocator_in) : m_allocator(allocator_in) {}
+
+  // setter
+  inline set_allocator_x&& allocator(allocator_base_t* allocator_in) { m_allocator = allocator_in; return std::move(*this); }
+  inline set_allocator_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(allocator_base_t* allocator, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void set_allocator(allocator_base_t* allocator_in) {
+  return set_allocator_x(allocator_in).call();
+}
+
+
+/**
+ * @defgroup LCI_GET_ALLOCATOR get_allocator
+ * @ingroup LCI_RESOURCE
+ * @brief Get the message allocator for the runtime.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __allocator_base_t*__; The allocator used by the runtime.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_ALLOCATOR
+  * @brief The actual implementation for get_allocator.
+  */
+class get_allocator_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  get_allocator_x() {}
+
+  // setter
+  inline get_allocator_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  allocator_base_t* call_impl(runtime_t runtime) const;
+  allocator_base_t* call() const;
+  inline allocator_base_t* operator()() const { return call(); }
+};
+
+inline allocator_base_t* get_allocator() {
+  return get_allocator_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GET_DEFAULT_NET_CONTEXT get_default_net_context
+ * @ingroup LCI_RESOURCE
+ * @brief Get the default net context of the runtime.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __net_context_t__; The default net context.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_DEFAULT_NET_CONTEXT
+  * @brief The actual implementation for get_default_net_context.
+  */
+class get_default_net_context_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  get_default_net_context_x() {}
+
+  // setter
+  inline get_default_net_context_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  net_context_t call_impl(runtime_t runtime) const;
+  net_context_t call() const;
+  inline net_context_t operator()() const { return call(); }
+};
+
+inline net_context_t get_default_net_context() {
+  return get_default_net_context_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GET_DEFAULT_DEVICE get_default_device
+ * @ingroup LCI_RESOURCE
+ * @brief Get the default net device of the runtime.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __device_t__; The default net device.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_DEFAULT_DEVICE
+  * @brief The actual implementation for get_default_device.
+  */
+class get_default_device_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  get_default_device_x() {}
+
+  // setter
+  inline get_default_device_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  device_t call_impl(runtime_t runtime) const;
+  device_t call() const;
+  inline device_t operator()() const { return call(); }
+};
+
+inline device_t get_default_device() {
+  return get_default_device_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GET_DEFAULT_ENDPOINT get_default_endpoint
+ * @ingroup LCI_RESOURCE
+ * @brief Get the default net endpoint of the runtime.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to get the default endpoint.
+ * @return of type __endpoint_t__; The default net endpoint.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_DEFAULT_ENDPOINT
+  * @brief The actual implementation for get_default_endpoint.
+  */
+class get_default_endpoint_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  get_default_endpoint_x() {}
+
+  // setter
+  inline get_default_endpoint_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline get_default_endpoint_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  endpoint_t call_impl(runtime_t runtime, device_t device) const;
+  endpoint_t call() const;
+  inline endpoint_t operator()() const { return call(); }
+};
+
+inline endpoint_t get_default_endpoint() {
+  return get_default_endpoint_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GET_DEFAULT_PACKET_POOL get_default_packet_pool
+ * @ingroup LCI_RESOURCE
+ * @brief Get the default packet pool of the runtime.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __packet_pool_t__; The default packet pool.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_DEFAULT_PACKET_POOL
+  * @brief The actual implementation for get_default_packet_pool.
+  */
+class get_default_packet_pool_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  get_default_packet_pool_x() {}
+
+  // setter
+  inline get_default_packet_pool_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  packet_pool_t call_impl(runtime_t runtime) const;
+  packet_pool_t call() const;
+  inline packet_pool_t operator()() const { return call(); }
+};
+
+inline packet_pool_t get_default_packet_pool() {
+  return get_default_packet_pool_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GET_DEFAULT_MATCHING_ENGINE get_default_matching_engine
+ * @ingroup LCI_RESOURCE
+ * @brief Get the default matching engine of the runtime.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __matching_engine_t__; The default matching engine.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_DEFAULT_MATCHING_ENGINE
+  * @brief The actual implementation for get_default_matching_engine.
+  */
+class get_default_matching_engine_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  get_default_matching_engine_x() {}
+
+  // setter
+  inline get_default_matching_engine_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  matching_engine_t call_impl(runtime_t runtime) const;
+  matching_engine_t call() const;
+  inline matching_engine_t operator()() const { return call(); }
+};
+
+inline matching_engine_t get_default_matching_engine() {
+  return get_default_matching_engine_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GET_MAX_BCOPY_SIZE get_max_bcopy_size
+ * @ingroup LCI_COMM
+ * @brief Get the maximum message size for the buffer-copy protocol.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool that will be used.
+ * @return of type __size_t__; Get the maximum message size for the buffer-copy protocol.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_MAX_BCOPY_SIZE
+  * @brief The actual implementation for get_max_bcopy_size.
+  */
+class get_max_bcopy_size_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<packet_pool_t> m_packet_pool ;
+
+  // constructor
+  get_max_bcopy_size_x() {}
+
+  // setter
+  inline get_max_bcopy_size_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline get_max_bcopy_size_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+
+  size_t call_impl(runtime_t runtime, packet_pool_t packet_pool) const;
+  size_t call() const;
+  inline size_t operator()() const { return call(); }
+};
+
+inline size_t get_max_bcopy_size() {
+  return get_max_bcopy_size_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_COMP free_comp
+ * @ingroup LCI_COMPLETION
+ * @brief Free a new comp object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] comp of type __comp_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_COMP
+  * @brief The actual implementation for free_comp.
+  */
+class free_comp_x {
+ public:
+  // args declaration
+  comp_t* m_comp;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  free_comp_x(comp_t* comp_in) : m_comp(comp_in) {}
+
+  // setter
+  inline free_comp_x&& comp(comp_t* comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline free_comp_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(comp_t* comp, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_comp(comp_t* comp_in) {
+  return free_comp_x(comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_COMP_SIGNAL comp_signal
+ * @ingroup LCI_COMPLETION
+ * @brief Signal a completion object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The completion object to signal.
+ * @param[in] status of type __status_t__; positional argument; The status to signal.
+
+ */
+ 
+ /**
+  * @ingroup LCI_COMP_SIGNAL
+  * @brief The actual implementation for comp_signal.
+  */
+class comp_signal_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  status_t m_status;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  comp_signal_x(comp_t comp_in, status_t status_in) : m_comp(comp_in), m_status(status_in) {}
+
+  // setter
+  inline comp_signal_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline comp_signal_x&& status(status_t status_in) { m_status = status_in; return std::move(*this); }
+  inline comp_signal_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(comp_t comp, status_t status, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void comp_signal(comp_t comp_in, status_t status_in) {
+  return comp_signal_x(comp_in, status_in).call();
+}
+
+
+/**
+ * @defgroup LCI_RESERVE_RCOMPS reserve_rcomps
+ * @ingroup LCI_COMPLETION
+ * @brief Reserve spaces for n remote completion handlers.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] n of type __rcomp_t__; positional argument; The number of remote completion handler slots to reserve.
+ * @return of type __rcomp_t__; The start of the reserved slots.
+ */
+ 
+ /**
+  * @ingroup LCI_RESERVE_RCOMPS
+  * @brief The actual implementation for reserve_rcomps.
+  */
+class reserve_rcomps_x {
+ public:
+  // args declaration
+  rcomp_t m_n;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  reserve_rcomps_x(rcomp_t n_in) : m_n(n_in) {}
+
+  // setter
+  inline reserve_rcomps_x&& n(rcomp_t n_in) { m_n = n_in; return std::move(*this); }
+  inline reserve_rcomps_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  rcomp_t call_impl(rcomp_t n, runtime_t runtime) const;
+  rcomp_t call() const;
+  inline rcomp_t operator()() const { return call(); }
+};
+
+inline rcomp_t reserve_rcomps(rcomp_t n_in) {
+  return reserve_rcomps_x(n_in).call();
+}
+
+
+/**
+ * @defgroup LCI_REGISTER_RCOMP register_rcomp
+ * @ingroup LCI_COMPLETION
+ * @brief Register a completion object into a remote completion handler.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The completion object to register.
+ * @param[in] rcomp of type __rcomp_t__; optional argument; The remote completion handler slot used to register.
+ * @return of type __rcomp_t__; The remote completion handler pointing to the completion object.
+ */
+ 
+ /**
+  * @ingroup LCI_REGISTER_RCOMP
+  * @brief The actual implementation for register_rcomp.
+  */
+class register_rcomp_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<rcomp_t> m_rcomp ;
+
+  // constructor
+  register_rcomp_x(comp_t comp_in) : m_comp(comp_in) {}
+
+  // setter
+  inline register_rcomp_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline register_rcomp_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline register_rcomp_x&& rcomp(rcomp_t rcomp_in) { m_rcomp = rcomp_in; return std::move(*this); }
+
+  rcomp_t call_impl(comp_t comp, runtime_t runtime, rcomp_t rcomp) const;
+  rcomp_t call() const;
+  inline rcomp_t operator()() const { return call(); }
+};
+
+inline rcomp_t register_rcomp(comp_t comp_in) {
+  return register_rcomp_x(comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_DEREGISTER_RCOMP deregister_rcomp
+ * @ingroup LCI_COMPLETION
+ * @brief Deregister a remote completion handler.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rcomp of type __rcomp_t__; positional argument; The remote completion handler to deregister.
+
+ */
+ 
+ /**
+  * @ingroup LCI_DEREGISTER_RCOMP
+  * @brief The actual implementation for deregister_rcomp.
+  */
+class deregister_rcomp_x {
+ public:
+  // args declaration
+  rcomp_t m_rcomp;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  deregister_rcomp_x(rcomp_t rcomp_in) : m_rcomp(rcomp_in) {}
+
+  // setter
+  inline deregister_rcomp_x&& rcomp(rcomp_t rcomp_in) { m_rcomp = rcomp_in; return std::move(*this); }
+  inline deregister_rcomp_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(rcomp_t rcomp, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void deregister_rcomp(rcomp_t rcomp_in) {
+  return deregister_rcomp_x(rcomp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_SYNC alloc_sync
+ * @ingroup LCI_COMPLETION
+ * @brief Allocate a synchronizer.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] threshold of type __int__; optional argument; The signaling threshold of the synchronizer.
+ * @param[in] zero_copy_am of type __bool__; optional argument; Whether to directly pass internal packet into the completion object.
+ * @param[in] blocking of type __bool__; optional argument; Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever.
+ * @param[in] name of type __const char*__; optional argument; The name of the synchronizer.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this completion object.
+ * @return of type __comp_t__; The allocated synchronizer.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_SYNC
+  * @brief The actual implementation for alloc_sync.
+  */
+class alloc_sync_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<int> m_threshold ;
+  option_t<bool> m_zero_copy_am ;
+  option_t<bool> m_blocking ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  alloc_sync_x() {}
+
+  // setter
+  inline alloc_sync_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alloc_sync_x&& threshold(int threshold_in) { m_threshold = threshold_in; return std::move(*this); }
+  inline alloc_sync_x&& zero_copy_am(bool zero_copy_am_in) { m_zero_copy_am = zero_copy_am_in; return std::move(*this); }
+  inline alloc_sync_x&& blocking(bool blocking_in) { m_blocking = blocking_in; return std::move(*this); }
+  inline alloc_sync_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_sync_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  comp_t call_impl(runtime_t runtime, int threshold, bool zero_copy_am, bool blocking, const char* name, void* user_context) const;
+  comp_t call() const;
+  inline comp_t operator()() const { return call(); }
+};
+
+inline comp_t alloc_sync() {
+  return alloc_sync_x().call();
+}
+
+
+/**
+ * @defgroup LCI_SYNC_TEST sync_test
+ * @ingroup LCI_COMPLETION
+ * @brief Test a synchronizer.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The synchronizer to test.
+ * @param[out] p_out of type __status_t*__; positional argument; The pointer to an status array of size `comp.get_attr_sync_threshold()` to hold the outputs (only valid if the function returns *true*).
+ * @return of type __bool__; Whether the synchronizer is ready.
+ */
+ 
+ /**
+  * @ingroup LCI_SYNC_TEST
+  * @brief The actual implementation for sync_test.
+  */
+class sync_test_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  status_t* m_p_out;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  sync_test_x(comp_t comp_in, status_t* p_out_in) : m_comp(comp_in), m_p_out(p_out_in) {}
+
+  // setter
+  inline sync_test_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline sync_test_x&& p_out(status_t* p_out_in) { m_p_out = p_out_in; return std::move(*this); }
+  inline sync_test_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  bool call_impl(comp_t comp, status_t* p_out, runtime_t runtime) const;
+  bool call() const;
+  inline bool operator()() const { return call(); }
+};
+
+inline bool sync_test(comp_t comp_in, status_t* p_out_in) {
+  return sync_test_x(comp_in, p_out_in).call();
+}
+
+
+/**
+ * @defgroup LCI_SYNC_WAIT sync_wait
+ * @ingroup LCI_COMPLETION
+ * @brief Wait for a synchronizer to be ready.
+ * @details If the synchronizer is blocking, the wait sleeps after an adaptive spin phase. With `do_progress`, it sleeps on the completion channel of the device if it has one (see the device attribute `net_comp_channel`).
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The synchronizer to wait.
+ * @param[out] p_out of type __status_t*__; positional argument; The pointer to an status array of size `comp.get_attr_sync_threshold()` to hold the outputs.
+ * @param[in] do_progress of type __bool__; optional argument; Whether to call `lci::progress()` in the loop.
+ * @param[in] device of type __device_t__; optional argument; The device to make progress on.
+
+ */
+ 
+ /**
+  * @ingroup LCI_SYNC_WAIT
+  * @brief The actual implementation for sync_wait.
+  */
+class sync_wait_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  status_t* m_p_out;
+  option_t<runtime_t> m_runtime ;
+  option_t<bool> m_do_progress ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  sync_wait_x(comp_t comp_in, status_t* p_out_in) : m_comp(comp_in), m_p_out(p_out_in) {}
+
+  // setter
+  inline sync_wait_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline sync_wait_x&& p_out(status_t* p_out_in) { m_p_out = p_out_in; return std::move(*this); }
+  inline sync_wait_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline sync_wait_x&& do_progress(bool do_progress_in) { m_do_progress = do_progress_in; return std::move(*this); }
+  inline sync_wait_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  void call_impl(comp_t comp, status_t* p_out, runtime_t runtime, bool do_progress, device_t device) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void sync_wait(comp_t comp_in, status_t* p_out_in) {
+  return sync_wait_x(comp_in, p_out_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_COUNTER alloc_counter
+ * @ingroup LCI_COMPLETION
+ * @brief Allocate a counter (initialized to 0).
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] blocking of type __bool__; optional argument; Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever.
+ * @param[in] name of type __const char*__; optional argument; The name of the synchronizer.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this completion object.
+ * @return of type __comp_t__; The allocated counter.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_COUNTER
+  * @brief The actual implementation for alloc_counter.
+  */
+class alloc_counter_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<bool> m_blocking ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  alloc_counter_x() {}
+
+  // setter
+  inline alloc_counter_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alloc_counter_x&& blocking(bool blocking_in) { m_blocking = blocking_in; return std::move(*this); }
+  inline alloc_counter_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_counter_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  comp_t call_impl(runtime_t runtime, bool blocking, const char* name, void* user_context) const;
+  comp_t call() const;
+  inline comp_t operator()() const { return call(); }
+};
+
+inline comp_t alloc_counter() {
+  return alloc_counter_x().call();
+}
+
+
+/**
+ * @defgroup LCI_COUNTER_GET counter_get
+ * @ingroup LCI_COMPLETION
+ * @brief Get the current value of a counter.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The counter to get value.
+ * @return of type __int64_t__; The current value of the counter.
+ */
+ 
+ /**
+  * @ingroup LCI_COUNTER_GET
+  * @brief The actual implementation for counter_get.
+  */
+class counter_get_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  counter_get_x(comp_t comp_in) : m_comp(comp_in) {}
+
+  // setter
+  inline counter_get_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline counter_get_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  int64_t call_impl(comp_t comp, runtime_t runtime) const;
+  int64_t call() const;
+  inline int64_t operator()() const { return call(); }
+};
+
+inline int64_t counter_get(comp_t comp_in) {
+  return counter_get_x(comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_COUNTER_SET counter_set
+ * @ingroup LCI_COMPLETION
+ * @brief Set the value of a counter.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The counter to set value.
+ * @param[in] value of type __int64_t__; positional argument; The value to set the counter to.
+
+ */
+ 
+ /**
+  * @ingroup LCI_COUNTER_SET
+  * @brief The actual implementation for counter_set.
+  */
+class counter_set_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  int64_t m_value;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  counter_set_x(comp_t comp_in, int64_t value_in) : m_comp(comp_in), m_value(value_in) {}
+
+  // setter
+  inline counter_set_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline counter_set_x&& value(int64_t value_in) { m_value = value_in; return std::move(*this); }
+  inline counter_set_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(comp_t comp, int64_t value, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void counter_set(comp_t comp_in, int64_t value_in) {
+  return counter_set_x(comp_in, value_in).call();
+}
+
+
+/**
+ * @defgroup LCI_COUNTER_WAIT counter_wait
+ * @ingroup LCI_COMPLETION
+ * @brief Wait for a counter to reach a value.
+ * @details If the counter is blocking, the wait sleeps after an adaptive spin phase. With `do_progress`, it sleeps on the completion channel of the device if it has one (see the device attribute `net_comp_channel`).
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The counter to wait.
+ * @param[in] target of type __int64_t__; positional argument; The value to wait for the counter to reach.
+ * @param[in] do_progress of type __bool__; optional argument; Whether to call `lci::progress()` in the loop.
+ * @param[in] device of type __device_t__; optional argument; The device to make progress on.
+
+ */
+ 
+ /**
+  * @ingroup LCI_COUNTER_WAIT
+  * @brief The actual implementation for counter_wait.
+  */
+class counter_wait_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  int64_t m_target;
+  option_t<runtime_t> m_runtime ;
+  option_t<bool> m_do_progress ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  counter_wait_x(comp_t comp_in, int64_t target_in) : m_comp(comp_in), m_target(target_in) {}
+
+  // setter
+  inline counter_wait_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline counter_wait_x&& target(int64_t target_in) { m_target = target_in; return std::move(*this); }
+  inline counter_wait_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline counter_wait_x&& do_progress(bool do_progress_in) { m_do_progress = do_progress_in; return std::move(*this); }
+  inline counter_wait_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  void call_impl(comp_t comp, int64_t target, runtime_t runtime, bool do_progress, device_t device) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void counter_wait(comp_t comp_in, int64_t target_in) {
+  return counter_wait_x(comp_in, target_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_CQ alloc_cq
+ * @ingroup LCI_COMPLETION
+ * @brief Allocate a completion queue.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] default_length of type __int__; optional argument; The default length of the completion queue.
+ * @param[in] zero_copy_am of type __bool__; optional argument; Whether to directly pass internal packet into the completion object.
+ * @param[in] cq_type of type __attr_cq_type_t__; optional argument; The type of the completion queue.
+ * @param[in] blocking of type __bool__; optional argument; Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever.
+ * @param[in] name of type __const char*__; optional argument; The name of the synchronizer.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this completion object.
+ * @return of type __comp_t__; The allocated completion queue.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_CQ
+  * @brief The actual implementation for alloc_cq.
+  */
+class alloc_cq_x {
+ public:
+  // args declaration
+  option_t<runtime_t> m_runtime ;
+  option_t<int> m_default_length ;
+  option_t<bool> m_zero_copy_am ;
+  option_t<attr_cq_type_t> m_cq_type ;
+  option_t<bool> m_blocking ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  alloc_cq_x() {}
+
+  // setter
+  inline alloc_cq_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alloc_cq_x&& default_length(int default_length_in) { m_default_length = default_length_in; return std::move(*this); }
+  inline alloc_cq_x&& zero_copy_am(bool zero_copy_am_in) { m_zero_copy_am = zero_copy_am_in; return std::move(*this); }
+  inline alloc_cq_x&& cq_type(attr_cq_type_t cq_type_in) { m_cq_type = cq_type_in; return std::move(*this); }
+  inline alloc_cq_x&& blocking(bool blocking_in) { m_blocking = blocking_in; return std::move(*this); }
+  inline alloc_cq_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_cq_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  comp_t call_impl(runtime_t runtime, int default_length, bool zero_copy_am, attr_cq_type_t cq_type, bool blocking, const char* name, void* user_context) const;
+  comp_t call() const;
+  inline comp_t operator()() const { return call(); }
+};
+
+inline comp_t alloc_cq() {
+  return alloc_cq_x().call();
+}
+
+
+/**
+ * @defgroup LCI_CQ_POP cq_pop
+ * @ingroup LCI_COMPLETION
+ * @brief Pop a status from a completion queue.
+ * @details This function is a nonblocking operation. It can return a status with an error code of either *retry* or *done*. Other fields of the status are only valid if the error code is *done*.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The completion queue to pop.
+ * @return of type __status_t__; The popped status.
+ */
+ 
+ /**
+  * @ingroup LCI_CQ_POP
+  * @brief The actual implementation for cq_pop.
+  */
+class cq_pop_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  cq_pop_x(comp_t comp_in) : m_comp(comp_in) {}
+
+  // setter
+  inline cq_pop_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline cq_pop_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  status_t call_impl(comp_t comp, runtime_t runtime) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t cq_pop(comp_t comp_in) {
+  return cq_pop_x(comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_CQ_POP_N cq_pop_n
+ * @ingroup LCI_COMPLETION
+ * @brief Pop multiple statuses from a completion queue.
+ * @details This function is a nonblocking operation. It pops up to `n` statuses at once, all with an error code of *done*, and returns 0 if the completion queue is empty.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The completion queue to pop.
+ * @param[in] n of type __size_t__; positional argument; The maximum number of statuses to pop.
+ * @param[out] p_out of type __status_t*__; positional argument; The pointer to a status array of size `n` to hold the popped statuses.
+ * @return of type __size_t__; The number of statuses popped.
+ */
+ 
+ /**
+  * @ingroup LCI_CQ_POP_N
+  * @brief The actual implementation for cq_pop_n.
+  */
+class cq_pop_n_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  size_t m_n;
+  status_t* m_p_out;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  cq_pop_n_x(comp_t comp_in, size_t n_in, status_t* p_out_in) : m_comp(comp_in), m_n(n_in), m_p_out(p_out_in) {}
+
+  // setter
+  inline cq_pop_n_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline cq_pop_n_x&& n(size_t n_in) { m_n = n_in; return std::move(*this); }
+  inline cq_pop_n_x&& p_out(status_t* p_out_in) { m_p_out = p_out_in; return std::move(*this); }
+  inline cq_pop_n_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  size_t call_impl(comp_t comp, size_t n, status_t* p_out, runtime_t runtime) const;
+  size_t call() const;
+  inline size_t operator()() const { return call(); }
+};
+
+inline size_t cq_pop_n(comp_t comp_in, size_t n_in, status_t* p_out_in) {
+  return cq_pop_n_x(comp_in, n_in, p_out_in).call();
+}
+
+
+/**
+ * @defgroup LCI_CQ_WAIT cq_wait
+ * @ingroup LCI_COMPLETION
+ * @brief Wait for a status and pop it from a completion queue.
+ * @details If the completion queue is blocking, the wait sleeps after an adaptive spin phase. With `do_progress`, it sleeps on the completion channel of the device if it has one (see the device attribute `net_comp_channel`).
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] comp of type __comp_t__; positional argument; The completion queue to pop.
+ * @param[in] do_progress of type __bool__; optional argument; Whether to call `lci::progress()` in the loop.
+ * @param[in] device of type __device_t__; optional argument; The device to make progress on.
+ * @return of type __status_t__; The popped status.
+ */
+ 
+ /**
+  * @ingroup LCI_CQ_WAIT
+  * @brief The actual implementation for cq_wait.
+  */
+class cq_wait_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  option_t<runtime_t> m_runtime ;
+  option_t<bool> m_do_progress ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  cq_wait_x(comp_t comp_in) : m_comp(comp_in) {}
+
+  // setter
+  inline cq_wait_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline cq_wait_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline cq_wait_x&& do_progress(bool do_progress_in) { m_do_progress = do_progress_in; return std::move(*this); }
+  inline cq_wait_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  status_t call_impl(comp_t comp, runtime_t runtime, bool do_progress, device_t device) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t cq_wait(comp_t comp_in) {
+  return cq_wait_x(comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_HANDLER alloc_handler
+ * @ingroup LCI_COMPLETION
+ * @brief Allocate a completion handler.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] handler of type __comp_handler_t__; positional argument; The handler function.
+ * @param[in] zero_copy_am of type __bool__; optional argument; Whether to directly pass internal packet into the completion object.
+ * @param[in] name of type __const char*__; optional argument; The name of the synchronizer.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this completion object.
+ * @return of type __comp_t__; The allocated completion handler.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_HANDLER
+  * @brief The actual implementation for alloc_handler.
+  */
+class alloc_handler_x {
+ public:
+  // args declaration
+  comp_handler_t m_handler;
+  option_t<runtime_t> m_runtime ;
+  option_t<bool> m_zero_copy_am ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  alloc_handler_x(comp_handler_t handler_in) : m_handler(handler_in) {}
+
+  // setter
+  inline alloc_handler_x&& handler(comp_handler_t handler_in) { m_handler = handler_in; return std::move(*this); }
+  inline alloc_handler_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alloc_handler_x&& zero_copy_am(bool zero_copy_am_in) { m_zero_copy_am = zero_copy_am_in; return std::move(*this); }
+  inline alloc_handler_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_handler_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  comp_t call_impl(comp_handler_t handler, runtime_t runtime, bool zero_copy_am, const char* name, void* user_context) const;
+  comp_t call() const;
+  inline comp_t operator()() const { return call(); }
+};
+
+inline comp_t alloc_handler(comp_handler_t handler_in) {
+  return alloc_handler_x(handler_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_GRAPH alloc_graph
+ * @ingroup LCI_COMPLETION
+ * @brief Allocate a completion handler.
+ * @details 
+ * @param[in] comp of type __comp_t__; optional argument; Another completion object to signal when the graph is completed. The graph will be automatically destroyed afterwards.
+ * @param[in] name of type __const char*__; optional argument; The name of the synchronizer.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context associated with this completion object.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __comp_t__; The allocated completion handler.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_GRAPH
+  * @brief The actual implementation for alloc_graph.
+  */
+class alloc_graph_x {
+ public:
+  // args declaration
+  option_t<comp_t> m_comp ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  alloc_graph_x() {}
+
+  // setter
+  inline alloc_graph_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline alloc_graph_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_graph_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_graph_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  comp_t call_impl(comp_t comp, const char* name, void* user_context, runtime_t runtime) const;
+  comp_t call() const;
+  inline comp_t operator()() const { return call(); }
+};
+
+inline comp_t alloc_graph() {
+  return alloc_graph_x().call();
+}
+
+
+/**
+ * @defgroup LCI_GRAPH_ADD_NODE graph_add_node
+ * @ingroup LCI_COMPLETION
+ * @brief Add a node to a graph.
+ * @details 
+ * @param[in] comp of type __comp_t__; positional argument; The graph to add node.
+ * @param[in] fn of type __graph_node_run_cb_t__; positional argument; The function to run when the node is triggered.
+ * @param[in] value of type __void*__; optional argument; The arbitrary user-defined value associated with this node.
+ * @param[in] free_cb of type __graph_node_free_cb_t__; optional argument; The callback to trigger when the node is freed.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __graph_node_t__; A handler representing the node added to the graph.
+ */
+ 
+ /**
+  * @ingroup LCI_GRAPH_ADD_NODE
+  * @brief The actual implementation for graph_add_node.
+  */
+class graph_add_node_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  graph_node_run_cb_t m_fn;
+  option_t<void*> m_value ;
+  option_t<graph_node_free_cb_t> m_free_cb ;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  graph_add_node_x(comp_t comp_in, graph_node_run_cb_t fn_in) : m_comp(comp_in), m_fn(fn_in) {}
+
+  // setter
+  inline graph_add_node_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline graph_add_node_x&& fn(graph_node_run_cb_t fn_in) { m_fn = fn_in; return std::move(*this); }
+  inline graph_add_node_x&& value(void* value_in) { m_value = value_in; return std::move(*this); }
+  inline graph_add_node_x&& free_cb(graph_node_free_cb_t free_cb_in) { m_free_cb = free_cb_in; return std::move(*this); }
+  inline graph_add_node_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  graph_node_t call_impl(comp_t comp, graph_node_run_cb_t fn, void* value, graph_node_free_cb_t free_cb, runtime_t runtime) const;
+  graph_node_t call() const;
+  inline graph_node_t operator()() const { return call(); }
+};
+
+inline graph_node_t graph_add_node(comp_t comp_in, graph_node_run_cb_t fn_in) {
+  return graph_add_node_x(comp_in, fn_in).call();
+}
+
+
+/**
+ * @defgroup LCI_GRAPH_ADD_EDGE graph_add_edge
+ * @ingroup LCI_COMPLETION
+ * @brief Add a edge to a graph.
+ * @details 
+ * @param[in] comp of type __comp_t__; positional argument; The graph to add node.
+ * @param[in] src of type __graph_node_t__; positional argument; The src node.
+ * @param[in] dst of type __graph_node_t__; positional argument; The dst node.
+ * @param[in] fn of type __graph_edge_run_cb_t__; optional argument; The function to run when the edge is triggered.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+
+ */
+ 
+ /**
+  * @ingroup LCI_GRAPH_ADD_EDGE
+  * @brief The actual implementation for graph_add_edge.
+  */
+class graph_add_edge_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  graph_node_t m_src;
+  graph_node_t m_dst;
+  option_t<graph_edge_run_cb_t> m_fn ;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  graph_add_edge_x(comp_t comp_in, graph_node_t src_in, graph_node_t dst_in) : m_comp(comp_in), m_src(src_in), m_dst(dst_in) {}
+
+  // setter
+  inline graph_add_edge_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline graph_add_edge_x&& src(graph_node_t src_in) { m_src = src_in; return std::move(*this); }
+  inline graph_add_edge_x&& dst(graph_node_t dst_in) { m_dst = dst_in; return std::move(*this); }
+  inline graph_add_edge_x&& fn(graph_edge_run_cb_t fn_in) { m_fn = fn_in; return std::move(*this); }
+  inline graph_add_edge_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(comp_t comp, graph_node_t src, graph_node_t dst, graph_edge_run_cb_t fn, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void graph_add_edge(comp_t comp_in, graph_node_t src_in, graph_node_t dst_in) {
+  return graph_add_edge_x(comp_in, src_in, dst_in).call();
+}
+
+
+/**
+ * @defgroup LCI_GRAPH_NODE_MARK_COMPLETE graph_node_mark_complete
+ * @ingroup LCI_COMPLETION
+ * @brief Mark a node complete.
+ * @details 
+ * @param[in] node of type __graph_node_t__; positional argument; The node to mark complete.
+ * @param[in] status of type __status_t__; optional argument; The status to mark complete with.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+
+ */
+ 
+ /**
+  * @ingroup LCI_GRAPH_NODE_MARK_COMPLETE
+  * @brief The actual implementation for graph_node_mark_complete.
+  */
+class graph_node_mark_complete_x {
+ public:
+  // args declaration
+  graph_node_t m_node;
+  option_t<status_t> m_status ;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  graph_node_mark_complete_x(graph_node_t node_in) : m_node(node_in) {}
+
+  // setter
+  inline graph_node_mark_complete_x&& node(graph_node_t node_in) { m_node = node_in; return std::move(*this); }
+  inline graph_node_mark_complete_x&& status(status_t status_in) { m_status = status_in; return std::move(*this); }
+  inline graph_node_mark_complete_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(graph_node_t node, status_t status, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void graph_node_mark_complete(graph_node_t node_in) {
+  return graph_node_mark_complete_x(node_in).call();
+}
+
+
+/**
+ * @defgroup LCI_GRAPH_START graph_start
+ * @ingroup LCI_COMPLETION
+ * @brief Start a graph.
+ * @details 
+ * @param[in] comp of type __comp_t__; positional argument; The graph to start.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+
+ */
+ 
+ /**
+  * @ingroup LCI_GRAPH_START
+  * @brief The actual implementation for graph_start.
+  */
+class graph_start_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  graph_start_x(comp_t comp_in) : m_comp(comp_in) {}
+
+  // setter
+  inline graph_start_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline graph_start_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(comp_t comp, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void graph_start(comp_t comp_in) {
+  return graph_start_x(comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_GRAPH_TEST graph_test
+ * @ingroup LCI_COMPLETION
+ * @brief Test a graph.
+ * @details Successful test will reset the graph to the state that is ready to be started again.
+ * @param[in] comp of type __comp_t__; positional argument; The graph to test.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __status_t__; The status of the graph.
+ */
+ 
+ /**
+  * @ingroup LCI_GRAPH_TEST
+  * @brief The actual implementation for graph_test.
+  */
+class graph_test_x {
+ public:
+  // args declaration
+  comp_t m_comp;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  graph_test_x(comp_t comp_in) : m_comp(comp_in) {}
+
+  // setter
+  inline graph_test_x&& comp(comp_t comp_in) { m_comp = comp_in; return std::move(*this); }
+  inline graph_test_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  status_t call_impl(comp_t comp, runtime_t runtime) const;
+  status_t call() const;
+  inline status_t operator()() const { return call(); }
+};
+
+inline status_t graph_test(comp_t comp_in) {
+  return graph_test_x(comp_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_NET_CONTEXT alloc_net_context
+ * @ingroup LCI_RESOURCE
+ * @brief Allocate a new net_context object.
+ * @details 
+ * @param[in,out] backend of type __attr_backend_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] ofi_provider_name of type __std::string__; optional argument; argument for the corresponding attribute
+ * @param[in,out] max_msg_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] max_inject_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] max_iov of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] ibv_gid_idx of type __int__; optional argument; argument for the corresponding attribute
+ * @param[in,out] ibv_force_gid_auto_select of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] device_name of type __std::string__; optional argument; argument for the corresponding attribute
+ * @param[in,out] ibv_odp_strategy of type __attr_ibv_odp_strategy_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] ibv_prefetch_strategy of type __attr_ibv_prefetch_strategy_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] use_dmabuf of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] name of type __const char*__; optional argument; argument for the corresponding attribute
+ * @param[in,out] user_context of type __void*__; optional argument; argument for the corresponding attribute
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __net_context_t__; The allocated object.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_NET_CONTEXT
+  * @brief The actual implementation for alloc_net_context.
+  */
+class alloc_net_context_x {
+ public:
+  // args declaration
+  option_t<attr_backend_t> m_backend ;
+  option_t<std::string> m_ofi_provider_name ;
+  option_t<size_t> m_max_msg_size ;
+  option_t<size_t> m_max_inject_size ;
+  option_t<size_t> m_max_iov ;
+  option_t<int> m_ibv_gid_idx ;
+  option_t<bool> m_ibv_force_gid_auto_select ;
+  option_t<std::string> m_device_name ;
+  option_t<attr_ibv_odp_strategy_t> m_ibv_odp_strategy ;
+  option_t<attr_ibv_prefetch_strategy_t> m_ibv_prefetch_strategy ;
+  option_t<bool> m_use_dmabuf ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  alloc_net_context_x() {}
+
+  // setter
+  inline alloc_net_context_x&& backend(attr_backend_t backend_in) { m_backend = backend_in; return std::move(*this); }
+  inline alloc_net_context_x&& ofi_provider_name(std::string ofi_provider_name_in) { m_ofi_provider_name = ofi_provider_name_in; return std::move(*this); }
+  inline alloc_net_context_x&& max_msg_size(size_t max_msg_size_in) { m_max_msg_size = max_msg_size_in; return std::move(*this); }
+  inline alloc_net_context_x&& max_inject_size(size_t max_inject_size_in) { m_max_inject_size = max_inject_size_in; return std::move(*this); }
+  inline alloc_net_context_x&& max_iov(size_t max_iov_in) { m_max_iov = max_iov_in; return std::move(*this); }
+  inline alloc_net_context_x&& ibv_gid_idx(int ibv_gid_idx_in) { m_ibv_gid_idx = ibv_gid_idx_in; return std::move(*this); }
+  inline alloc_net_context_x&& ibv_force_gid_auto_select(bool ibv_force_gid_auto_select_in) { m_ibv_force_gid_auto_select = ibv_force_gid_auto_select_in; return std::move(*this); }
+  inline alloc_net_context_x&& device_name(std::string device_name_in) { m_device_name = device_name_in; return std::move(*this); }
+  inline alloc_net_context_x&& ibv_odp_strategy(attr_ibv_odp_strategy_t ibv_odp_strategy_in) { m_ibv_odp_strategy = ibv_odp_strategy_in; return std::move(*this); }
+  inline alloc_net_context_x&& ibv_prefetch_strategy(attr_ibv_prefetch_strategy_t ibv_prefetch_strategy_in) { m_ibv_prefetch_strategy = ibv_prefetch_strategy_in; return std::move(*this); }
+  inline alloc_net_context_x&& use_dmabuf(bool use_dmabuf_in) { m_use_dmabuf = use_dmabuf_in; return std::move(*this); }
+  inline alloc_net_context_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_net_context_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_net_context_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  net_context_t call_impl(attr_backend_t backend, std::string ofi_provider_name, size_t max_msg_size, size_t max_inject_size, size_t max_iov, int ibv_gid_idx, bool ibv_force_gid_auto_select, std::string device_name, attr_ibv_odp_strategy_t ibv_odp_strategy, attr_ibv_prefetch_strategy_t ibv_prefetch_strategy, bool use_dmabuf, const char* name, void* user_context, runtime_t runtime) const;
+  net_context_t call() const;
+  inline net_context_t operator()() const { return call(); }
+};
+
+inline net_context_t alloc_net_context() {
+  return alloc_net_context_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_NET_CONTEXT free_net_context
+ * @ingroup LCI_RESOURCE
+ * @brief Free a new net_context object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] net_context of type __net_context_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_NET_CONTEXT
+  * @brief The actual implementation for free_net_context.
+  */
+class free_net_context_x {
+ public:
+  // args declaration
+  net_context_t* m_net_context;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  free_net_context_x(net_context_t* net_context_in) : m_net_context(net_context_in) {}
+
+  // setter
+  inline free_net_context_x&& net_context(net_context_t* net_context_in) { m_net_context = net_context_in; return std::move(*this); }
+  inline free_net_context_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(net_context_t* net_context, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_net_context(net_context_t* net_context_in) {
+  return free_net_context_x(net_context_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_DEVICE alloc_device
+ * @ingroup LCI_RESOURCE
+ * @brief Allocate a new device object.
+ * @details 
+ * @param[in,out] net_max_sends of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] net_max_recvs of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] net_max_cqes of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] net_send_reserved_pct of type __double__; optional argument; argument for the corresponding attribute
+ * @param[in,out] ofi_lock_mode of type __uint64_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_default_endpoint of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] alloc_progress_endpoint of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] am_aggregation_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] net_comp_channel of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] use_reg_cache of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] shm_enable of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] shm_ring_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] shm_slot_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] shm_producer_cas_attempts of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] shm_consumer_cas_attempts of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] shm_huge_page of type __bool__; optional argument; argument for the corresponding attribute
+ * @param[in,out] shm_max_polls of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] eager_rdma_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] eager_rdma_nslots of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] eager_rdma_slot_size of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] ibv_td_strategy of type __attr_ibv_td_strategy_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] name of type __const char*__; optional argument; argument for the corresponding attribute
+ * @param[in,out] user_context of type __void*__; optional argument; argument for the corresponding attribute
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] net_context of type __net_context_t__; optional argument; The network context to allocate the device.
+ * @param[in] packet_pool of type __packet_pool_t__; optional argument; The packet pool to bind.
+ * @return of type __device_t__; The allocated object.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_DEVICE
+  * @brief The actual implementation for alloc_device.
+  */
+class alloc_device_x {
+ public:
+  // args declaration
+  option_t<size_t> m_net_max_sends ;
+  option_t<size_t> m_net_max_recvs ;
+  option_t<size_t> m_net_max_cqes ;
+  option_t<double> m_net_send_reserved_pct ;
+  option_t<uint64_t> m_ofi_lock_mode ;
+  option_t<bool> m_alloc_default_endpoint ;
+  option_t<bool> m_alloc_progress_endpoint ;
+  option_t<size_t> m_am_aggregation_threshold ;
+  option_t<bool> m_net_comp_channel ;
+  option_t<bool> m_use_reg_cache ;
+  option_t<bool> m_shm_enable ;
+  option_t<size_t> m_shm_ring_size ;
+  option_t<size_t> m_shm_slot_size ;
+  option_t<size_t> m_shm_producer_cas_attempts ;
+  option_t<size_t> m_shm_consumer_cas_attempts ;
+  option_t<bool> m_shm_huge_page ;
+  option_t<size_t> m_shm_max_polls ;
+  option_t<size_t> m_eager_rdma_threshold ;
+  option_t<size_t> m_eager_rdma_nslots ;
+  option_t<size_t> m_eager_rdma_slot_size ;
+  option_t<attr_ibv_td_strategy_t> m_ibv_td_strategy ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<runtime_t> m_runtime ;
+  option_t<net_context_t> m_net_context ;
+  option_t<packet_pool_t> m_packet_pool ;
+
+  // constructor
+  alloc_device_x() {}
+
+  // setter
+  inline alloc_device_x&& net_max_sends(size_t net_max_sends_in) { m_net_max_sends = net_max_sends_in; return std::move(*this); }
+  inline alloc_device_x&& net_max_recvs(size_t net_max_recvs_in) { m_net_max_recvs = net_max_recvs_in; return std::move(*this); }
+  inline alloc_device_x&& net_max_cqes(size_t net_max_cqes_in) { m_net_max_cqes = net_max_cqes_in; return std::move(*this); }
+  inline alloc_device_x&& net_send_reserved_pct(double net_send_reserved_pct_in) { m_net_send_reserved_pct = net_send_reserved_pct_in; return std::move(*this); }
+  inline alloc_device_x&& ofi_lock_mode(uint64_t ofi_lock_mode_in) { m_ofi_lock_mode = ofi_lock_mode_in; return std::move(*this); }
+  inline alloc_device_x&& alloc_default_endpoint(bool alloc_default_endpoint_in) { m_alloc_default_endpoint = alloc_default_endpoint_in; return std::move(*this); }
+  inline alloc_device_x&& alloc_progress_endpoint(bool alloc_progress_endpoint_in) { m_alloc_progress_endpoint = alloc_progress_endpoint_in; return std::move(*this); }
+  inline alloc_device_x&& am_aggregation_threshold(size_t am_aggregation_threshold_in) { m_am_aggregation_threshold = am_aggregation_threshold_in; return std::move(*this); }
+  inline alloc_device_x&& net_comp_channel(bool net_comp_channel_in) { m_net_comp_channel = net_comp_channel_in; return std::move(*this); }
+  inline alloc_device_x&& use_reg_cache(bool use_reg_cache_in) { m_use_reg_cache = use_reg_cache_in; return std::move(*this); }
+  inline alloc_device_x&& shm_enable(bool shm_enable_in) { m_shm_enable = shm_enable_in; return std::move(*this); }
+  inline alloc_device_x&& shm_ring_size(size_t shm_ring_size_in) { m_shm_ring_size = shm_ring_size_in; return std::move(*this); }
+  inline alloc_device_x&& shm_slot_size(size_t shm_slot_size_in) { m_shm_slot_size = shm_slot_size_in; return std::move(*this); }
+  inline alloc_device_x&& shm_producer_cas_attempts(size_t shm_producer_cas_attempts_in) { m_shm_producer_cas_attempts = shm_producer_cas_attempts_in; return std::move(*this); }
+  inline alloc_device_x&& shm_consumer_cas_attempts(size_t shm_consumer_cas_attempts_in) { m_shm_consumer_cas_attempts = shm_consumer_cas_attempts_in; return std::move(*this); }
+  inline alloc_device_x&& shm_huge_page(bool shm_huge_page_in) { m_shm_huge_page = shm_huge_page_in; return std::move(*this); }
+  inline alloc_device_x&& shm_max_polls(size_t shm_max_polls_in) { m_shm_max_polls = shm_max_polls_in; return std::move(*this); }
+  inline alloc_device_x&& eager_rdma_threshold(size_t eager_rdma_threshold_in) { m_eager_rdma_threshold = eager_rdma_threshold_in; return std::move(*this); }
+  inline alloc_device_x&& eager_rdma_nslots(size_t eager_rdma_nslots_in) { m_eager_rdma_nslots = eager_rdma_nslots_in; return std::move(*this); }
+  inline alloc_device_x&& eager_rdma_slot_size(size_t eager_rdma_slot_size_in) { m_eager_rdma_slot_size = eager_rdma_slot_size_in; return std::move(*this); }
+  inline alloc_device_x&& ibv_td_strategy(attr_ibv_td_strategy_t ibv_td_strategy_in) { m_ibv_td_strategy = ibv_td_strategy_in; return std::move(*this); }
+  inline alloc_device_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_device_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_device_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alloc_device_x&& net_context(net_context_t net_context_in) { m_net_context = net_context_in; return std::move(*this); }
+  inline alloc_device_x&& packet_pool(packet_pool_t packet_pool_in) { m_packet_pool = packet_pool_in; return std::move(*this); }
+
+  device_t call_impl(size_t net_max_sends, size_t net_max_recvs, size_t net_max_cqes, double net_send_reserved_pct, uint64_t ofi_lock_mode, bool alloc_default_endpoint, bool alloc_progress_endpoint, size_t am_aggregation_threshold, bool net_comp_channel, bool use_reg_cache, bool shm_enable, size_t shm_ring_size, size_t shm_slot_size, size_t shm_producer_cas_attempts, size_t shm_consumer_cas_attempts, bool shm_huge_page, size_t shm_max_polls, size_t eager_rdma_threshold, size_t eager_rdma_nslots, size_t eager_rdma_slot_size, attr_ibv_td_strategy_t ibv_td_strategy, const char* name, void* user_context, runtime_t runtime, net_context_t net_context, packet_pool_t packet_pool) const;
+  device_t call() const;
+  inline device_t operator()() const { return call(); }
+};
+
+inline device_t alloc_device() {
+  return alloc_device_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_DEVICE free_device
+ * @ingroup LCI_RESOURCE
+ * @brief Free a new device object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] device of type __device_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_DEVICE
+  * @brief The actual implementation for free_device.
+  */
+class free_device_x {
+ public:
+  // args declaration
+  device_t* m_device;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  free_device_x(device_t* device_in) : m_device(device_in) {}
+
+  // setter
+  inline free_device_x&& device(device_t* device_in) { m_device = device_in; return std::move(*this); }
+  inline free_device_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(device_t* device, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_device(device_t* device_in) {
+  return free_device_x(device_in).call();
+}
+
+
+/**
+ * @defgroup LCI_REGISTER_MEMORY register_memory
+ * @ingroup LCI_MEMORY
+ * @brief Register a memory region to a device.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to register the memory region.
+ * @param[in] address of type __void*__; positional argument; The base address of the memory region to register.
+ * @param[in] size of type __size_t__; positional argument; The size of the memory region to register.
+ * @return of type __mr_t__; The handler for the registered memory region.
+ */
+ 
+ /**
+  * @ingroup LCI_REGISTER_MEMORY
+  * @brief The actual implementation for register_memory.
+  */
+class register_memory_x {
+ public:
+  // args declaration
+  void* m_address;
+  size_t m_size;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  register_memory_x(void* address_in, size_t size_in) : m_address(address_in), m_size(size_in) {}
+
+  // setter
+  inline register_memory_x&& address(void* address_in) { m_address = address_in; return std::move(*this); }
+  inline register_memory_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline register_memory_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline register_memory_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  mr_t call_impl(void* address, size_t size, runtime_t runtime, device_t device) const;
+  mr_t call() const;
+  inline mr_t operator()() const { return call(); }
+};
+
+inline mr_t register_memory(void* address_in, size_t size_in) {
+  return register_memory_x(address_in, size_in).call();
+}
+
+
+/**
+ * @defgroup LCI_DEREGISTER_MEMORY deregister_memory
+ * @ingroup LCI_MEMORY
+ * @brief Deregister a memory region from a device.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] mr of type __mr_t*__; positional argument; The memory region to deregister.
+
+ */
+ 
+ /**
+  * @ingroup LCI_DEREGISTER_MEMORY
+  * @brief The actual implementation for deregister_memory.
+  */
+class deregister_memory_x {
+ public:
+  // args declaration
+  mr_t* m_mr;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  deregister_memory_x(mr_t* mr_in) : m_mr(mr_in) {}
+
+  // setter
+  inline deregister_memory_x&& mr(mr_t* mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline deregister_memory_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(mr_t* mr, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void deregister_memory(mr_t* mr_in) {
+  return deregister_memory_x(mr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_GET_RMR get_rmr
+ * @ingroup LCI_MEMORY
+ * @brief Get the remote memory region handle.
+ * @details 
+ * @param[in] mr of type __mr_t__; positional argument; The memory region to get the remote handle.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @return of type __rmr_t__; The remote handle of the memory region.
+ */
+ 
+ /**
+  * @ingroup LCI_GET_RMR
+  * @brief The actual implementation for get_rmr.
+  */
+class get_rmr_x {
+ public:
+  // args declaration
+  mr_t m_mr;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  get_rmr_x(mr_t mr_in) : m_mr(mr_in) {}
+
+  // setter
+  inline get_rmr_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline get_rmr_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  rmr_t call_impl(mr_t mr, runtime_t runtime) const;
+  rmr_t call() const;
+  inline rmr_t operator()() const { return call(); }
+};
+
+inline rmr_t get_rmr(mr_t mr_in) {
+  return get_rmr_x(mr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_ALLOC_ENDPOINT alloc_endpoint
+ * @ingroup LCI_RESOURCE
+ * @brief Allocate a new endpoint object.
+ * @details 
+ * @param[in,out] am_aggregation_threshold of type __size_t__; optional argument; argument for the corresponding attribute
+ * @param[in,out] name of type __const char*__; optional argument; argument for the corresponding attribute
+ * @param[in,out] user_context of type __void*__; optional argument; argument for the corresponding attribute
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] device of type __device_t__; optional argument; The device to allocate the endpoint.
+ * @return of type __endpoint_t__; The allocated object.
+ */
+ 
+ /**
+  * @ingroup LCI_ALLOC_ENDPOINT
+  * @brief The actual implementation for alloc_endpoint.
+  */
+class alloc_endpoint_x {
+ public:
+  // args declaration
+  option_t<size_t> m_am_aggregation_threshold ;
+  option_t<const char*> m_name ;
+  option_t<void*> m_user_context ;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  alloc_endpoint_x() {}
+
+  // setter
+  inline alloc_endpoint_x&& am_aggregation_threshold(size_t am_aggregation_threshold_in) { m_am_aggregation_threshold = am_aggregation_threshold_in; return std::move(*this); }
+  inline alloc_endpoint_x&& name(const char* name_in) { m_name = name_in; return std::move(*this); }
+  inline alloc_endpoint_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+  inline alloc_endpoint_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline alloc_endpoint_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  endpoint_t call_impl(size_t am_aggregation_threshold, const char* name, void* user_context, runtime_t runtime, device_t device) const;
+  endpoint_t call() const;
+  inline endpoint_t operator()() const { return call(); }
+};
+
+inline endpoint_t alloc_endpoint() {
+  return alloc_endpoint_x().call();
+}
+
+
+/**
+ * @defgroup LCI_FREE_ENDPOINT free_endpoint
+ * @ingroup LCI_RESOURCE
+ * @brief Free a new endpoint object.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in,out] endpoint of type __endpoint_t*__; positional argument; The object to free.
+
+ */
+ 
+ /**
+  * @ingroup LCI_FREE_ENDPOINT
+  * @brief The actual implementation for free_endpoint.
+  */
+class free_endpoint_x {
+ public:
+  // args declaration
+  endpoint_t* m_endpoint;
+  option_t<runtime_t> m_runtime ;
+
+  // constructor
+  free_endpoint_x(endpoint_t* endpoint_in) : m_endpoint(endpoint_in) {}
+
+  // setter
+  inline free_endpoint_x&& endpoint(endpoint_t* endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline free_endpoint_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+
+  void call_impl(endpoint_t* endpoint, runtime_t runtime) const;
+  void call() const;
+  inline void operator()() const { return call(); }
+};
+
+inline void free_endpoint(endpoint_t* endpoint_in) {
+  return free_endpoint_x(endpoint_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POLL_CQ net_poll_cq
+ * @ingroup LCI_NET
+ * @brief Poll the network completion queue.
+ * @details Returns every consumed completion descriptor, including asynchronous failures as @ref net_opcode_t::ERROR. Applications should not mix raw network operations with @ref progress on the same device.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] max_polls of type __size_t__; positional argument; The maximum number of completion descriptors to poll.
+ * @param[out] statuses of type __net_status_t*__; positional argument; The output array for the completion descriptors (can be nullptr).
+ * @param[in] device of type __device_t__; optional argument; The device to poll the network completion queue.
+ * @return of type __size_t__; Number of completion descriptors polled from the network layer.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POLL_CQ
+  * @brief The actual implementation for net_poll_cq.
+  */
+class net_poll_cq_x {
+ public:
+  // args declaration
+  size_t m_max_polls;
+  net_status_t* m_statuses;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+
+  // constructor
+  net_poll_cq_x(size_t max_polls_in, net_status_t* statuses_in) : m_max_polls(max_polls_in), m_statuses(statuses_in) {}
+
+  // setter
+  inline net_poll_cq_x&& max_polls(size_t max_polls_in) { m_max_polls = max_polls_in; return std::move(*this); }
+  inline net_poll_cq_x&& statuses(net_status_t* statuses_in) { m_statuses = statuses_in; return std::move(*this); }
+  inline net_poll_cq_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_poll_cq_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+
+  size_t call_impl(size_t max_polls, net_status_t* statuses, runtime_t runtime, device_t device) const;
+  size_t call() const;
+  inline size_t operator()() const { return call(); }
+};
+
+inline size_t net_poll_cq(size_t max_polls_in, net_status_t* statuses_in) {
+  return net_poll_cq_x(max_polls_in, statuses_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_RECV net_post_recv
+ * @ingroup LCI_NET
+ * @brief Post a network receive operation.
+ * @details 
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] buffer of type __void*__; positional argument; The receive buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The receive buffer size.
+ * @param[in] mr of type __mr_t__; positional argument; The registered memory region for the receive buffer.
+ * @param[in] device of type __device_t__; optional argument; The device to post the receive operation.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_RECV
+  * @brief The actual implementation for net_post_recv.
+  */
+class net_post_recv_x {
+ public:
+  // args declaration
+  void* m_buffer;
+  size_t m_size;
+  mr_t m_mr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_recv_x(void* buffer_in, size_t size_in, mr_t mr_in) : m_buffer(buffer_in), m_size(size_in), m_mr(mr_in) {}
+
+  // setter
+  inline net_post_recv_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_recv_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_recv_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline net_post_recv_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_recv_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_recv_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(void* buffer, size_t size, mr_t mr, runtime_t runtime, device_t device, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_recv(void* buffer_in, size_t size_in, mr_t mr_in) {
+  return net_post_recv_x(buffer_in, size_in, mr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_SENDS net_post_sends
+ * @ingroup LCI_NET
+ * @brief Post a network short send operation.
+ * @details This operation uses the *inject* semantics: the data is directly copied into the network hardware with the operation descriptor and the operation is completed immediately.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] buffer of type __void*__; positional argument; The send buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The send buffer size.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] imm_data of type __net_imm_data_t__; optional argument; The immediate data to send with the message.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_SENDS
+  * @brief The actual implementation for net_post_sends.
+  */
+class net_post_sends_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_buffer;
+  size_t m_size;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<net_imm_data_t> m_imm_data ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_sends_x(int rank_in, void* buffer_in, size_t size_in) : m_rank(rank_in), m_buffer(buffer_in), m_size(size_in) {}
+
+  // setter
+  inline net_post_sends_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline net_post_sends_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_sends_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_sends_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_sends_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_sends_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline net_post_sends_x&& imm_data(net_imm_data_t imm_data_in) { m_imm_data = imm_data_in; return std::move(*this); }
+  inline net_post_sends_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(int rank, void* buffer, size_t size, runtime_t runtime, device_t device, endpoint_t endpoint, net_imm_data_t imm_data, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_sends(int rank_in, void* buffer_in, size_t size_in) {
+  return net_post_sends_x(rank_in, buffer_in, size_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_SEND net_post_send
+ * @ingroup LCI_NET
+ * @brief Post a network send operation.
+ * @details This operation uses the *post* semantics: means the operation is posted and not completed immediately; the completed operation will be reported through @ref net_poll_cq; the send buffer can only be written after the operation is completed.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] buffer of type __void*__; positional argument; The send buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The send buffer size.
+ * @param[in] mr of type __mr_t__; positional argument; The registered memory region for the send buffer.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] imm_data of type __net_imm_data_t__; optional argument; The immediate data to send with the message.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_SEND
+  * @brief The actual implementation for net_post_send.
+  */
+class net_post_send_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_buffer;
+  size_t m_size;
+  mr_t m_mr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<net_imm_data_t> m_imm_data ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_send_x(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in) : m_rank(rank_in), m_buffer(buffer_in), m_size(size_in), m_mr(mr_in) {}
+
+  // setter
+  inline net_post_send_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline net_post_send_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_send_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_send_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline net_post_send_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_send_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_send_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline net_post_send_x&& imm_data(net_imm_data_t imm_data_in) { m_imm_data = imm_data_in; return std::move(*this); }
+  inline net_post_send_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(int rank, void* buffer, size_t size, mr_t mr, runtime_t runtime, device_t device, endpoint_t endpoint, net_imm_data_t imm_data, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_send(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in) {
+  return net_post_send_x(rank_in, buffer_in, size_in, mr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_PUTS net_post_puts
+ * @ingroup LCI_NET
+ * @brief Post a network short put operation.
+ * @details This operation uses the *inject* semantics: the data is directly copied into the network hardware with the operation descriptor and the operation is completed immediately.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] buffer of type __void*__; positional argument; The send buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The send buffer size.
+ * @param[in] offset of type __uint64_t__; positional argument; The starting offset to the remote region base address to put the data.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_PUTS
+  * @brief The actual implementation for net_post_puts.
+  */
+class net_post_puts_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_buffer;
+  size_t m_size;
+  uint64_t m_offset;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_puts_x(int rank_in, void* buffer_in, size_t size_in, uint64_t offset_in, rmr_t rmr_in) : m_rank(rank_in), m_buffer(buffer_in), m_size(size_in), m_offset(offset_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline net_post_puts_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline net_post_puts_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_puts_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_puts_x&& offset(uint64_t offset_in) { m_offset = offset_in; return std::move(*this); }
+  inline net_post_puts_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline net_post_puts_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_puts_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_puts_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline net_post_puts_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(int rank, void* buffer, size_t size, uint64_t offset, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_puts(int rank_in, void* buffer_in, size_t size_in, uint64_t offset_in, rmr_t rmr_in) {
+  return net_post_puts_x(rank_in, buffer_in, size_in, offset_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_PUT net_post_put
+ * @ingroup LCI_NET
+ * @brief Post a network put operation.
+ * @details This operation uses the *post* semantics: means the operation is posted and not completed immediately; the completed operation will be reported through @ref net_poll_cq; the send buffer can only be written after the operation is completed.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] buffer of type __void*__; positional argument; The send buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The send buffer size.
+ * @param[in] mr of type __mr_t__; positional argument; The registered memory region for the send buffer.
+ * @param[in] offset of type __uint64_t__; positional argument; The starting offset to the remote region base address to put the data.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_PUT
+  * @brief The actual implementation for net_post_put.
+  */
+class net_post_put_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_buffer;
+  size_t m_size;
+  mr_t m_mr;
+  uint64_t m_offset;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_put_x(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in, uint64_t offset_in, rmr_t rmr_in) : m_rank(rank_in), m_buffer(buffer_in), m_size(size_in), m_mr(mr_in), m_offset(offset_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline net_post_put_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline net_post_put_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_put_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_put_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline net_post_put_x&& offset(uint64_t offset_in) { m_offset = offset_in; return std::move(*this); }
+  inline net_post_put_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline net_post_put_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_put_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_put_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline net_post_put_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(int rank, void* buffer, size_t size, mr_t mr, uint64_t offset, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_put(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in, uint64_t offset_in, rmr_t rmr_in) {
+  return net_post_put_x(rank_in, buffer_in, size_in, mr_in, offset_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_PUTIMMS net_post_putImms
+ * @ingroup LCI_NET
+ * @brief Post a network *short put with immediate data* operation.
+ * @details This operation uses the *inject* semantics: the data is directly copied into the network hardware with the operation descriptor and the operation is completed immediately.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] buffer of type __void*__; positional argument; The send buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The send buffer size.
+ * @param[in] offset of type __uint64_t__; positional argument; The starting offset to the remote region base address to put the data.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] imm_data of type __net_imm_data_t__; optional argument; The immediate data to put with the message.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_PUTIMMS
+  * @brief The actual implementation for net_post_putImms.
+  */
+class net_post_putImms_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_buffer;
+  size_t m_size;
+  uint64_t m_offset;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<net_imm_data_t> m_imm_data ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_putImms_x(int rank_in, void* buffer_in, size_t size_in, uint64_t offset_in, rmr_t rmr_in) : m_rank(rank_in), m_buffer(buffer_in), m_size(size_in), m_offset(offset_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline net_post_putImms_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline net_post_putImms_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_putImms_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_putImms_x&& offset(uint64_t offset_in) { m_offset = offset_in; return std::move(*this); }
+  inline net_post_putImms_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline net_post_putImms_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_putImms_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_putImms_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline net_post_putImms_x&& imm_data(net_imm_data_t imm_data_in) { m_imm_data = imm_data_in; return std::move(*this); }
+  inline net_post_putImms_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(int rank, void* buffer, size_t size, uint64_t offset, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, net_imm_data_t imm_data, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_putImms(int rank_in, void* buffer_in, size_t size_in, uint64_t offset_in, rmr_t rmr_in) {
+  return net_post_putImms_x(rank_in, buffer_in, size_in, offset_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_PUTIMM net_post_putImm
+ * @ingroup LCI_NET
+ * @brief Post a network put with immediate data operation.
+ * @details This operation uses the *post* semantics: means the operation is posted and not completed immediately; the completed operation will be reported through @ref net_poll_cq; the send buffer can only be written after the operation is completed.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] buffer of type __void*__; positional argument; The send buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The send buffer size.
+ * @param[in] mr of type __mr_t__; positional argument; The registered memory region for the send buffer.
+ * @param[in] offset of type __uint64_t__; positional argument; The starting offset to the remote region base address to put the data.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] imm_data of type __net_imm_data_t__; optional argument; The immediate data to put with the message.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_PUTIMM
+  * @brief The actual implementation for net_post_putImm.
+  */
+class net_post_putImm_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_buffer;
+  size_t m_size;
+  mr_t m_mr;
+  uint64_t m_offset;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<net_imm_data_t> m_imm_data ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_putImm_x(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in, uint64_t offset_in, rmr_t rmr_in) : m_rank(rank_in), m_buffer(buffer_in), m_size(size_in), m_mr(mr_in), m_offset(offset_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline net_post_putImm_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline net_post_putImm_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_putImm_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_putImm_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline net_post_putImm_x&& offset(uint64_t offset_in) { m_offset = offset_in; return std::move(*this); }
+  inline net_post_putImm_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline net_post_putImm_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_putImm_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_putImm_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline net_post_putImm_x&& imm_data(net_imm_data_t imm_data_in) { m_imm_data = imm_data_in; return std::move(*this); }
+  inline net_post_putImm_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(int rank, void* buffer, size_t size, mr_t mr, uint64_t offset, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, net_imm_data_t imm_data, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_putImm(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in, uint64_t offset_in, rmr_t rmr_in) {
+  return net_post_putImm_x(rank_in, buffer_in, size_in, mr_in, offset_in, rmr_in).call();
+}
+
+
+/**
+ * @defgroup LCI_NET_POST_GET net_post_get
+ * @ingroup LCI_NET
+ * @brief Post a network get operation.
+ * @details This operation uses the *post* semantics: means the operation is posted and not completed immediately; the completed operation will be reported through @ref net_poll_cq; the receive buffer can only be read after the operation is completed.
+ * @param[in] runtime of type __runtime_t__; optional argument; The runtime object.
+ * @param[in] rank of type __int__; positional argument; The target rank.
+ * @param[in] buffer of type __void*__; positional argument; The receive buffer base address.
+ * @param[in] size of type __size_t__; positional argument; The receive buffer size.
+ * @param[in] mr of type __mr_t__; positional argument; The registered memory region for the receive buffer.
+ * @param[in] offset of type __uint64_t__; positional argument; The starting offset to the remote region base address to get the data.
+ * @param[in] rmr of type __rmr_t__; positional argument; The remote memory region handle.
+ * @param[in] device of type __device_t__; optional argument; The device to use.
+ * @param[in] endpoint of type __endpoint_t__; optional argument; The endpoint to use.
+ * @param[in] user_context of type __void*__; optional argument; The arbitrary user-defined context.
+ * @return of type __error_t__; The error code.
+ */
+ 
+ /**
+  * @ingroup LCI_NET_POST_GET
+  * @brief The actual implementation for net_post_get.
+  */
+class net_post_get_x {
+ public:
+  // args declaration
+  int m_rank;
+  void* m_buffer;
+  size_t m_size;
+  mr_t m_mr;
+  uint64_t m_offset;
+  rmr_t m_rmr;
+  option_t<runtime_t> m_runtime ;
+  option_t<device_t> m_device ;
+  option_t<endpoint_t> m_endpoint ;
+  option_t<void*> m_user_context ;
+
+  // constructor
+  net_post_get_x(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in, uint64_t offset_in, rmr_t rmr_in) : m_rank(rank_in), m_buffer(buffer_in), m_size(size_in), m_mr(mr_in), m_offset(offset_in), m_rmr(rmr_in) {}
+
+  // setter
+  inline net_post_get_x&& rank(int rank_in) { m_rank = rank_in; return std::move(*this); }
+  inline net_post_get_x&& buffer(void* buffer_in) { m_buffer = buffer_in; return std::move(*this); }
+  inline net_post_get_x&& size(size_t size_in) { m_size = size_in; return std::move(*this); }
+  inline net_post_get_x&& mr(mr_t mr_in) { m_mr = mr_in; return std::move(*this); }
+  inline net_post_get_x&& offset(uint64_t offset_in) { m_offset = offset_in; return std::move(*this); }
+  inline net_post_get_x&& rmr(rmr_t rmr_in) { m_rmr = rmr_in; return std::move(*this); }
+  inline net_post_get_x&& runtime(runtime_t runtime_in) { m_runtime = runtime_in; return std::move(*this); }
+  inline net_post_get_x&& device(device_t device_in) { m_device = device_in; return std::move(*this); }
+  inline net_post_get_x&& endpoint(endpoint_t endpoint_in) { m_endpoint = endpoint_in; return std::move(*this); }
+  inline net_post_get_x&& user_context(void* user_context_in) { m_user_context = user_context_in; return std::move(*this); }
+
+  error_t call_impl(int rank, void* buffer, size_t size, mr_t mr, uint64_t offset, rmr_t rmr, runtime_t runtime, device_t device, endpoint_t endpoint, void* user_context) const;
+  error_t call() const;
+  inline error_t operator()() const { return call(); }
+};
+
+inline error_t net_post_get(int rank_in, void* buffer_in, size_t size_in, mr_t mr_in, uint64_t offset_in, rmr_t rmr_in) {
+  return net_post_get_x(rank_in, buffer_in, size_in, mr_in, offset_in, rmr_in).call();
+}
+
+
+} // namespace lci
+
+#endif // LCI_BINDING_POST_HPP_
@@ -0,0 +1,703 @@
+
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+// clang-format off
+// This file is generated by generate_binding.py
+#ifndef LCI_BINDING_PRE_HPP_
+#define LCI_BINDING_PRE_HPP_
+
+namespace lci {
+class persistent_comm_t;
+struct persistent_comm_attr_t;
+class runtime_t;
+struct runtime_attr_t;
+class packet_pool_t;
+struct packet_pool_attr_t;
+class matching_engine_t;
+struct matching_engine_attr_t;
+class comp_t;
+struct comp_attr_t;
+class net_context_t;
+struct net_context_attr_t;
+class device_t;
+struct device_attr_t;
+class mr_t;
+struct mr_attr_t;
+class endpoint_t;
+struct endpoint_attr_t;
+
+enum class attr_rdv_protocol_t {
+  auto_select,
+  write,
+  writeimm,
+  read,
+};
+
+enum class attr_matching_engine_type_t {
+  queue,
+  map,
+  offload,
+};
+
+enum class attr_comp_type_t {
+  sync,
+  counter,
+  cq,
+  handler,
+  graph,
+  custom,
+};
+
+enum class attr_cq_type_t {
+  array_atomic,
+  lcrq,
+};
+
+enum class attr_ibv_odp_strategy_t {
+  none,
+  explicit_odp,
+  implicit_odp,
+};
+
+enum class attr_ibv_prefetch_strategy_t {
+  none,
+  prefetch,
+  prefetch_write,
+  prefetch_no_fault,
+};
+
+enum class attr_ibv_td_strategy_t {
+  none,
+  all_qp,
+  per_qp,
+};
+
+
+struct persistent_comm_attr_t {
+  const char* name;
+  void* user_context;
+};
+
+struct runtime_attr_t {
+  size_t packet_return_threshold;
+  int imm_nbits_tag;
+  int imm_nbits_rcomp;
+  attr_rdv_protocol_t rdv_protocol;
+  size_t rdv_read_threshold;
+  bool rdv_pipeline;
+  size_t rdv_pipeline_chunk_size;
+  size_t inject_threshold;
+  size_t eager_threshold;
+  size_t zcopy_threshold;
+  std::string tuning_profile;
+  uint64_t max_imm_tag;
+  uint64_t max_imm_rcomp;
+  uint64_t max_tag;
+  uint64_t max_rcomp;
+  bool alloc_default_device;
+  bool alloc_default_packet_pool;
+  bool alloc_default_matching_engine;
+  const char* name;
+  void* user_context;
+};
+
+struct packet_pool_attr_t {
+  size_t packet_size;
+  size_t npackets;
+  size_t min_packet_size;
+  bool numa_aware;
+  bool huge_page;
+  size_t npackets_max;
+  int slab_cooldown;
+  const char* name;
+  void* user_context;
+};
+
+struct matching_engine_attr_t {
+  attr_matching_engine_type_t matching_engine_type;
+  size_t nbuckets;
+  const char* name;
+  void* user_context;
+};
+
+struct comp_attr_t {
+  attr_comp_type_t comp_type;
+  int sync_threshold;
+  bool zero_copy_am;
+  attr_cq_type_t cq_type;
+  int cq_default_length;
+  bool blocking;
+  const char* name;
+  void* user_context;
+};
+
+struct net_context_attr_t {
+  attr_backend_t backend;
+  std::string ofi_provider_name;
+  size_t max_msg_size;
+  size_t max_inject_size;
+  size_t max_iov;
+  int ibv_gid_idx;
+  bool ibv_force_gid_auto_select;
+  std::string device_name;
+  attr_ibv_odp_strategy_t ibv_odp_strategy;
+  attr_ibv_prefetch_strategy_t ibv_prefetch_strategy;
+  bool support_putimm;
+  bool support_atomic32;
+  bool support_atomic64;
+  bool support_tagged;
+  bool use_dmabuf;
+  const char* name;
+  void* user_context;
+};
+
+struct device_attr_t {
+  size_t net_max_sends;
+  size_t net_max_recvs;
+  size_t net_max_cqes;
+  double net_send_reserved_pct;
+  uint64_t ofi_lock_mode;
+  bool alloc_default_endpoint;
+  bool alloc_progress_endpoint;
+  size_t am_aggregation_threshold;
+  bool net_comp_channel;
+  bool use_reg_cache;
+  bool shm_enable;
+  size_t shm_ring_size;
+  size_t shm_slot_size;
+  size_t shm_producer_cas_attempts;
+  size_t shm_consumer_cas_attempts;
+  bool shm_huge_page;
+  size_t shm_max_polls;
+  size_t eager_rdma_threshold;
+  size_t eager_rdma_nslots;
+  size_t eager_rdma_slot_size;
+  int uid;
+  attr_ibv_td_strategy_t ibv_td_strategy;
+  const char* name;
+  void* user_context;
+};
+
+struct mr_attr_t {
+  const char* name;
+  void* user_context;
+};
+
+struct endpoint_attr_t {
+  int uid;
+  size_t am_aggregation_threshold;
+  const char* name;
+  void* user_context;
+};
+
+struct global_attr_t {
+  size_t packet_return_threshold;
+  int imm_nbits_tag;
+  int imm_nbits_rcomp;
+  attr_rdv_protocol_t rdv_protocol;
+  size_t rdv_read_threshold;
+  bool rdv_pipeline;
+  size_t rdv_pipeline_chunk_size;
+  size_t inject_threshold;
+  size_t eager_threshold;
+  size_t zcopy_threshold;
+  std::string tuning_profile;
+  bool alloc_default_device;
+  bool alloc_default_packet_pool;
+  bool alloc_default_matching_engine;
+  size_t packet_size;
+  size_t npackets;
+  size_t min_packet_size;
+  bool numa_aware;
+  bool huge_page;
+  size_t npackets_max;
+  int slab_cooldown;
+  attr_matching_engine_type_t matching_engine_type;
+  size_t nbuckets;
+  int sync_threshold;
+  bool zero_copy_am;
+  attr_cq_type_t cq_type;
+  int cq_default_length;
+  bool blocking;
+  attr_backend_t backend;
+  std::string ofi_provider_name;
+  size_t max_msg_size;
+  size_t max_inject_size;
+  size_t max_iov;
+  int ibv_gid_idx;
+  bool ibv_force_gid_auto_select;
+  std::string device_name;
+  attr_ibv_odp_strategy_t ibv_odp_strategy;
+  attr_ibv_prefetch_strategy_t ibv_prefetch_strategy;
+  bool use_dmabuf;
+  size_t net_max_sends;
+  size_t net_max_recvs;
+  size_t net_max_cqes;
+  double net_send_reserved_pct;
+  uint64_t ofi_lock_mode;
+  bool alloc_default_endpoint;
+  bool alloc_progress_endpoint;
+  bool net_comp_channel;
+  bool use_reg_cache;
+  bool shm_enable;
+  size_t shm_ring_size;
+  size_t shm_slot_size;
+  size_t shm_producer_cas_attempts;
+  size_t shm_consumer_cas_attempts;
+  bool shm_huge_page;
+  size_t shm_max_polls;
+  size_t eager_rdma_threshold;
+  size_t eager_rdma_nslots;
+  size_t eager_rdma_slot_size;
+  attr_ibv_td_strategy_t ibv_td_strategy;
+  size_t am_aggregation_threshold;
+};
+
+extern global_attr_t g_default_attr;
+
+class persistent_comm_impl_t;
+
+/**
+ * @defgroup LCI_PERSISTENT_COMM RESOURCE persistent_comm
+ * @ingroup LCI_COMM
+ * @brief The persistent communication resource.
+ * @details A pre-planned communication operation. It is built once by @ref alloc_persistent_comm and posted by @ref start as many times as needed.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_PERSISTENT_COMM
+  * @brief The actual implementation for RESOURCE persistent_comm.
+  */
+class persistent_comm_t {
+ public:
+  using attr_t = persistent_comm_attr_t;
+  // attribute getter
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  persistent_comm_impl_t* p_impl = nullptr;
+
+  persistent_comm_t() = default;
+  persistent_comm_t(void* p) : p_impl(static_cast<persistent_comm_impl_t*>(p)) {}
+  inline bool is_empty() const { return p_impl == nullptr; }
+  inline persistent_comm_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("persistent_comm p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(persistent_comm_impl_t* p) { p_impl = p; }
+  bool operator==(const persistent_comm_t& other) const { return p_impl == other.p_impl; }
+};
+
+class runtime_impl_t;
+
+/**
+ * @defgroup LCI_RUNTIME RESOURCE runtime
+ * @ingroup LCI_SETUP
+ * @brief The runtime object.
+ * @details 
+ * @param[in,out] packet_return_threshold of type __size_t__; The threshold for returning packets to its original pool.
+ * @param[in,out] imm_nbits_tag of type __int__; The number of bits for the immediate data tag.
+ * @param[in,out] imm_nbits_rcomp of type __int__; The number of bits for the immediate data remote completion handle.
+ * @param[in,out] rdv_protocol of type __attr_rdv_protocol_t__; Rendezvous protocol. `read` lets the receiver pull the data with RDMA read. `auto_select` uses `read` for messages up to `rdv_read_threshold` bytes and otherwise selects between `write` and `writeimm` based on network support for put-with-immediate.
+ * @param[in,out] rdv_read_threshold of type __size_t__; The max message size for which `auto_select` uses the read rendezvous protocol.
+ * @param[in,out] rdv_pipeline of type __bool__; Whether the write rendezvous protocols register and transfer large messages in chunks, overlapping the registration of one chunk with the transfer of the previous one.
+ * @param[in,out] rdv_pipeline_chunk_size of type __size_t__; The chunk size of the pipelined rendezvous protocol.
+ * @param[in,out] inject_threshold of type __size_t__; The max message size for the inject protocol. It is capped by the max inject size of the network.
+ * @param[in,out] eager_threshold of type __size_t__; The max message size for the eager protocols of send/am. Larger messages use the rendezvous protocol. It is capped by the max buffer-copy size of the packet pool.
+ * @param[in,out] zcopy_threshold of type __size_t__; The min message size for which an eager message from a registered local buffer is sent without copying. Smaller messages are copied into a packet.
+ * @param[in,out] tuning_profile of type __std::string__; The path of a tuning profile written by `lci_tune`. Its thresholds replace `inject_threshold`, `eager_threshold`, `zcopy_threshold`, and `rdv_read_threshold`. Empty string disables it.
+ * @param[out] max_imm_tag of type __uint64_t__; The max tag that can be put into the immediate data field. It is also the max tag that can be used in put with remote notification.
+ * @param[out] max_imm_rcomp of type __uint64_t__; The max rcomp that can be put into the immediate data field. It is also the max rcomp that can be used in put with remote notification.
+ * @param[out] max_tag of type __uint64_t__; The max tag that can be used in all primitives but put with remote notificaiton.
+ * @param[out] max_rcomp of type __uint64_t__; The max rcomp that can be used in all primitives but put with remote notification.
+ * @param[in,out] alloc_default_device of type __bool__; Whether to allocate the default device.
+ * @param[in,out] alloc_default_packet_pool of type __bool__; Whether to allocate the default packet pool.
+ * @param[in,out] alloc_default_matching_engine of type __bool__; Whether to allocate the default matching engine.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_RUNTIME
+  * @brief The actual implementation for RESOURCE runtime.
+  */
+class runtime_t {
+ public:
+  using attr_t = runtime_attr_t;
+  // attribute getter
+  size_t get_attr_packet_return_threshold() const;
+  int get_attr_imm_nbits_tag() const;
+  int get_attr_imm_nbits_rcomp() const;
+  attr_rdv_protocol_t get_attr_rdv_protocol() const;
+  size_t get_attr_rdv_read_threshold() const;
+  bool get_attr_rdv_pipeline() const;
+  size_t get_attr_rdv_pipeline_chunk_size() const;
+  size_t get_attr_inject_threshold() const;
+  size_t get_attr_eager_threshold() const;
+  size_t get_attr_zcopy_threshold() const;
+  std::string get_attr_tuning_profile() const;
+  uint64_t get_attr_max_imm_tag() const;
+  uint64_t get_attr_max_imm_rcomp() const;
+  uint64_t get_attr_max_tag() const;
+  uint64_t get_attr_max_rcomp() const;
+  bool get_attr_alloc_default_device() const;
+  bool get_attr_alloc_default_packet_pool() const;
+  bool get_attr_alloc_default_matching_engine() const;
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  runtime_impl_t* p_impl = nullptr;
+
+  runtime_t() = default;
+  runtime_t(void* p) : p_impl(static_cast<runtime_impl_t*>(p)) {}
+  inline bool is_empty() const { return p_impl == nullptr; }
+  inline runtime_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("runtime p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(runtime_impl_t* p) { p_impl = p; }
+  bool operator==(const runtime_t& other) const { return p_impl == other.p_impl; }
+};
+
+class packet_pool_impl_t;
+
+/**
+ * @defgroup LCI_PACKET_POOL RESOURCE packet_pool
+ * @ingroup LCI_RESOURCE
+ * @brief The packet pool resource.
+ * @details 
+ * @param[in,out] packet_size of type __size_t__; The size of the packet.
+ * @param[in,out] npackets of type __size_t__; The number of packets in the pool. They are split evenly across the size classes.
+ * @param[in,out] min_packet_size of type __size_t__; The size of the smallest packet size class. Every class is 4 times smaller than the next one, up to packet_size (at most 4 classes). 0 means a single class of packet_size. The smaller classes back the eager sends and other packets that fit in them. They only back receives if the network supports tagged messages; otherwise (e.g., verbs) every receive takes a packet of the largest class.
+ * @param[in,out] numa_aware of type __bool__; Whether to split the packets into one sub-heap per NUMA node. Threads draw packets from their own node first.
+ * @param[in,out] huge_page of type __bool__; Whether to back the packets with huge pages (explicit ones if reserved, otherwise transparent ones). It reduces TLB misses and the registration cost of the pool.
+ * @param[in,out] npackets_max of type __size_t__; The number of packets the pool can grow to when it runs out of packets. It grows by slabs of npackets packets, which are registered to every device the pool has been registered to. 0 means the pool does not grow.
+ * @param[in,out] slab_cooldown of type __int__; How long (in milliseconds) the pool has to go without running out of packets before it returns a slab it has grown.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_PACKET_POOL
+  * @brief The actual implementation for RESOURCE packet_pool.
+  */
+class packet_pool_t {
+ public:
+  using attr_t = packet_pool_attr_t;
+  // attribute getter
+  size_t get_attr_packet_size() const;
+  size_t get_attr_npackets() const;
+  size_t get_attr_min_packet_size() const;
+  bool get_attr_numa_aware() const;
+  bool get_attr_huge_page() const;
+  size_t get_attr_npackets_max() const;
+  int get_attr_slab_cooldown() const;
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  packet_pool_impl_t* p_impl = nullptr;
+
+  packet_pool_t() = default;
+  packet_pool_t(void* p) : p_impl(static_cast<packet_pool_impl_t*>(p)) {}
+  inline bool is_empty() const { return p_impl == nullptr; }
+  inline packet_pool_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("packet_pool p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(packet_pool_impl_t* p) { p_impl = p; }
+  bool operator==(const packet_pool_t& other) const { return p_impl == other.p_impl; }
+};
+
+class matching_engine_impl_t;
+
+/**
+ * @defgroup LCI_MATCHING_ENGINE RESOURCE matching_engine
+ * @ingroup LCI_RESOURCE
+ * @brief The matching engine resource.
+ * @details 
+ * @param[in,out] matching_engine_type of type __attr_matching_engine_type_t__; The type of the matching engine. The offload matching engine lets the network match send-recv if the network context supports tagged messages (see the `support_tagged` attribute) and falls back to the map matching engine otherwise. With a tagged network, its send-recv cannot use io vectors, datatypes or zero-copy receives, and its tags have to fit in 32 bits.
+ * @param[in,out] nbuckets of type __size_t__; The initial number of buckets of the map matching engine, rounded up to a power of two. The table grows and shrinks with the number of pending keys but never below this size.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_MATCHING_ENGINE
+  * @brief The actual implementation for RESOURCE matching_engine.
+  */
+class matching_engine_t {
+ public:
+  using attr_t = matching_engine_attr_t;
+  // attribute getter
+  attr_matching_engine_type_t get_attr_matching_engine_type() const;
+  size_t get_attr_nbuckets() const;
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  matching_engine_impl_t* p_impl = nullptr;
+
+  matching_engine_t() = default;
+  matching_engine_t(void* p) : p_impl(static_cast<matching_engine_impl_t*>(p)) {}
+  inline bool is_empty() const { return p_impl == nullptr; }
+  inline matching_engine_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("matching_engine p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(matching_engine_impl_t* p) { p_impl = p; }
+  bool operator==(const matching_engine_t& other) const { return p_impl == other.p_impl; }
+};
+
+class comp_impl_t;
+
+/**
+ * @defgroup LCI_COMP RESOURCE comp
+ * @ingroup LCI_COMPLETION
+ * @brief The completion object resource.
+ * @details 
+ * @param[out] comp_type of type __attr_comp_type_t__; The completion object type.
+ * @param[in,out] sync_threshold of type __int__; The threshold for sync (synchronizer).
+ * @param[in,out] zero_copy_am of type __bool__; Whether to directly pass internal packet into the completion object.
+ * @param[in,out] cq_type of type __attr_cq_type_t__; The completion object type.
+ * @param[in,out] cq_default_length of type __int__; The default length of the completion queue. Up to 1024 statuses are kept inline at 56 bytes each; the rest go to an overflow queue allocated on first use.
+ * @param[in,out] blocking of type __bool__; Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_COMP
+  * @brief The actual implementation for RESOURCE comp.
+  */
+class comp_t {
+ public:
+  using attr_t = comp_attr_t;
+  // attribute getter
+  attr_comp_type_t get_attr_comp_type() const;
+  int get_attr_sync_threshold() const;
+  bool get_attr_zero_copy_am() const;
+  attr_cq_type_t get_attr_cq_type() const;
+  int get_attr_cq_default_length() const;
+  bool get_attr_blocking() const;
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  comp_impl_t* p_impl = nullptr;
+
+  comp_t() = default;
+  comp_t(void* p) : p_impl(static_cast<comp_impl_t*>(p)) {}
+  inline bool is_empty() const;
+  inline comp_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("comp p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(comp_impl_t* p) { p_impl = p; }
+  bool operator==(const comp_t& other) const { return p_impl == other.p_impl; }
+};
+
+class net_context_impl_t;
+
+/**
+ * @defgroup LCI_NET_CONTEXT RESOURCE net_context
+ * @ingroup LCI_RESOURCE
+ * @brief The network context resource.
+ * @details 
+ * @param[in,out] backend of type __attr_backend_t__; The network backend to use.
+ * @param[in,out] ofi_provider_name of type __std::string__; For the OFI backend: the provider name.
+ * @param[in,out] max_msg_size of type __size_t__; The maximum message size.
+ * @param[in,out] max_inject_size of type __size_t__; The maximum inject size.
+ * @param[in,out] max_iov of type __size_t__; The maximum number of io vector entries posted as a single network operation. Backends reduce it to what the hardware supports.
+ * @param[in,out] ibv_gid_idx of type __int__; For the IBV backend: the GID index by default (only needed by RoCE).
+ * @param[in,out] ibv_force_gid_auto_select of type __bool__; For the IBV backend: whether to force GID auto selection.
+ * @param[in,out] device_name of type __std::string__; The network device name to use. For the IBV backend this is the verbs device name; for the OFI backend this is the libfabric domain name. Empty string selects the default/best available device.
+ * @param[in,out] ibv_odp_strategy of type __attr_ibv_odp_strategy_t__; For the IBV backend: the on-demand paging strategy.
+ * @param[in,out] ibv_prefetch_strategy of type __attr_ibv_prefetch_strategy_t__; For the IBV backend: the mr prefetch strategy.
+ * @param[out] support_putimm of type __bool__; Whether the network context supports put with immediate data.
+ * @param[out] support_atomic32 of type __bool__; Whether the network context executes remote atomic operations on 32-bit integers natively. Otherwise, they are executed by the target's progress engine.
+ * @param[out] support_atomic64 of type __bool__; Whether the network context executes remote atomic operations on 64-bit integers natively. Otherwise, they are executed by the target's progress engine.
+ * @param[out] support_tagged of type __bool__; Whether the network context matches tagged messages itself. Otherwise, the offload matching engine matches send-recv in software.
+ * @param[in,out] use_dmabuf of type __bool__; Whether to use dmabuf for cuda buffer registration.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_NET_CONTEXT
+  * @brief The actual implementation for RESOURCE net_context.
+  */
+class net_context_t {
+ public:
+  using attr_t = net_context_attr_t;
+  // attribute getter
+  attr_backend_t get_attr_backend() const;
+  std::string get_attr_ofi_provider_name() const;
+  size_t get_attr_max_msg_size() const;
+  size_t get_attr_max_inject_size() const;
+  size_t get_attr_max_iov() const;
+  int get_attr_ibv_gid_idx() const;
+  bool get_attr_ibv_force_gid_auto_select() const;
+  std::string get_attr_device_name() const;
+  attr_ibv_odp_strategy_t get_attr_ibv_odp_strategy() const;
+  attr_ibv_prefetch_strategy_t get_attr_ibv_prefetch_strategy() const;
+  bool get_attr_support_putimm() const;
+  bool get_attr_support_atomic32() const;
+  bool get_attr_support_atomic64() const;
+  bool get_attr_support_tagged() const;
+  bool get_attr_use_dmabuf() const;
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  net_context_impl_t* p_impl = nullptr;
+
+  net_context_t() = default;
+  net_context_t(void* p) : p_impl(static_cast<net_context_impl_t*>(p)) {}
+  inline bool is_empty() const { return p_impl == nullptr; }
+  inline net_context_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("net_context p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(net_context_impl_t* p) { p_impl = p; }
+  bool operator==(const net_context_t& other) const { return p_impl == other.p_impl; }
+};
+
+class device_impl_t;
+
+/**
+ * @defgroup LCI_DEVICE RESOURCE device
+ * @ingroup LCI_RESOURCE
+ * @brief The device resource.
+ * @details 
+ * @param[in,out] net_max_sends of type __size_t__; The maximum number of sends that can be posted to the underlying network queue at the same time.
+ * @param[in,out] net_max_recvs of type __size_t__; The maximum number of receives that can be posted to the underlying network queue at the same time.
+ * @param[in,out] net_max_cqes of type __size_t__; The maximum number of CQEs that can reside in the underlying network queue at the same time.
+ * @param[in,out] net_send_reserved_pct of type __double__; Fraction of send queue slots reserved for high-priority operations (0.0-1.0).
+ * @param[in,out] ofi_lock_mode of type __uint64_t__; For the OFI backend: the lock mode for the device.
+ * @param[in,out] alloc_default_endpoint of type __bool__; Whether to allocate the default endpoint.
+ * @param[in,out] alloc_progress_endpoint of type __bool__; Whether to allocate another endpoint for communication invoked by the progress function.
+ * @param[in,out] am_aggregation_threshold of type __size_t__; The am_aggregation_threshold of the default endpoint. It defaults to the endpoint attribute of the same name.
+ * @param[in,out] net_comp_channel of type __bool__; Whether to create a completion channel (IBV) or a wait object (OFI) for the network completion queue, so that the blocking waits of completion objects can sleep until the network completes something.
+ * @param[in,out] use_reg_cache of type __bool__; Whether to use the memory registration cache (if compiled).
+ * @param[in,out] shm_enable of type __bool__; Whether to enable the experimental intra-node shared-memory small-message transport.
+ * @param[in,out] shm_ring_size of type __size_t__; Maximum shared-memory inbound slot-array size in bytes; the effective slot count is rounded down to a power of two.
+ * @param[in,out] shm_slot_size of type __size_t__; Shared-memory fixed slot size in bytes.
+ * @param[in,out] shm_producer_cas_attempts of type __size_t__; Maximum compare-and-swap attempts for each shared-memory ring producer reservation.
+ * @param[in,out] shm_consumer_cas_attempts of type __size_t__; Maximum compare-and-swap attempts for each shared-memory ring consumer claim.
+ * @param[in,out] shm_huge_page of type __bool__; Whether to ask for transparent huge pages for the shared-memory rings. It only matters for rings of at least one huge page.
+ * @param[in,out] shm_max_polls of type __size_t__; Maximum shared-memory receive slots progressed after each network completion poll.
+ * @param[in,out] eager_rdma_threshold of type __size_t__; Number of eager sends to a peer after which an eager-RDMA ring is set up for it. 0 disables eager-RDMA.
+ * @param[in,out] eager_rdma_nslots of type __size_t__; Number of slots of each eager-RDMA ring (at most 8192).
+ * @param[in,out] eager_rdma_slot_size of type __size_t__; Size in bytes of each eager-RDMA ring slot (at most 32768). A slot minus its 4-byte immediate data has to fit in a packet payload.
+ * @param[out] uid of type __int__; A unique device id across the entire process.
+ * @param[in,out] ibv_td_strategy of type __attr_ibv_td_strategy_t__; For the IBV backend: the thread domain strategy.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_DEVICE
+  * @brief The actual implementation for RESOURCE device.
+  */
+class device_t {
+ public:
+  using attr_t = device_attr_t;
+  // attribute getter
+  size_t get_attr_net_max_sends() const;
+  size_t get_attr_net_max_recvs() const;
+  size_t get_attr_net_max_cqes() const;
+  double get_attr_net_send_reserved_pct() const;
+  uint64_t get_attr_ofi_lock_mode() const;
+  bool get_attr_alloc_default_endpoint() const;
+  bool get_attr_alloc_progress_endpoint() const;
+  size_t get_attr_am_aggregation_threshold() const;
+  bool get_attr_net_comp_channel() const;
+  bool get_attr_use_reg_cache() const;
+  bool get_attr_shm_enable() const;
+  size_t get_attr_shm_ring_size() const;
+  size_t get_attr_shm_slot_size() const;
+  size_t get_attr_shm_producer_cas_attempts() const;
+  size_t get_attr_shm_consumer_cas_attempts() const;
+  bool get_attr_shm_huge_page() const;
+  size_t get_attr_shm_max_polls() const;
+  size_t get_attr_eager_rdma_threshold() const;
+  size_t get_attr_eager_rdma_nslots() const;
+  size_t get_attr_eager_rdma_slot_size() const;
+  int get_attr_uid() const;
+  attr_ibv_td_strategy_t get_attr_ibv_td_strategy() const;
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  device_impl_t* p_impl = nullptr;
+
+  device_t() = default;
+  device_t(void* p) : p_impl(static_cast<device_impl_t*>(p)) {}
+  inline bool is_empty() const { return p_impl == nullptr; }
+  inline device_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("device p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(device_impl_t* p) { p_impl = p; }
+  bool operator==(const device_t& other) const { return p_impl == other.p_impl; }
+};
+
+class mr_impl_t;
+
+/**
+ * @defgroup LCI_MR RESOURCE mr
+ * @ingroup LCI_MEMORY
+ * @brief The memory region resource.
+ * @details 
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_MR
+  * @brief The actual implementation for RESOURCE mr.
+  */
+class mr_t {
+ public:
+  using attr_t = mr_attr_t;
+  // attribute getter
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  mr_impl_t* p_impl = nullptr;
+
+  mr_t() = default;
+  mr_t(void* p) : p_impl(static_cast<mr_impl_t*>(p)) {}
+  inline bool is_empty() const;
+  inline mr_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("mr p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(mr_impl_t* p) { p_impl = p; }
+  bool operator==(const mr_t& other) const { return p_impl == other.p_impl; }
+};
+
+class endpoint_impl_t;
+
+/**
+ * @defgroup LCI_ENDPOINT RESOURCE endpoint
+ * @ingroup LCI_RESOURCE
+ * @brief The endpoint resource.
+ * @details 
+ * @param[out] uid of type __int__; A unique endpoint id across the entire process.
+ * @param[in,out] am_aggregation_threshold of type __size_t__; Active messages no larger than this size are aggregated per target rank into one packet. 0 disables aggregation.
+ * @param[in,out] name of type __const char*__; Name of the resource.
+ * @param[in,out] user_context of type __void*__; User context for the resource.
+
+ */
+ 
+ /**
+  * @ingroup LCI_ENDPOINT
+  * @brief The actual implementation for RESOURCE endpoint.
+  */
+class endpoint_t {
+ public:
+  using attr_t = endpoint_attr_t;
+  // attribute getter
+  int get_attr_uid() const;
+  size_t get_attr_am_aggregation_threshold() const;
+  const char* get_attr_name() const;
+  void* get_attr_user_context() const;
+  attr_t get_attr() const;
+  endpoint_impl_t* p_impl = nullptr;
+
+  endpoint_t() = default;
+  endpoint_t(void* p) : p_impl(static_cast<endpoint_impl_t*>(p)) {}
+  inline bool is_empty() const { return p_impl == nullptr; }
+  inline endpoint_impl_t *get_impl() const { if (!p_impl) throw std::runtime_error("endpoint p_impl is nullptr!"); return p_impl; }
+  inline void set_impl(endpoint_impl_t* p) { p_impl = p; }
+  bool operator==(const endpoint_t& other) const { return p_impl == other.p_impl; }
+};
+
+
+} // namespace lci
+
+#endif // LCI_BINDING_PRE_HPP_
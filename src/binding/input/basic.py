@@ -10,7 +10,14 @@ runtime_attr = [
     attr("size_t", "packet_return_threshold", default_value=4096, comment="The threshold for returning packets to its original pool."),
     attr("int", "imm_nbits_tag", default_value=16, comment="The number of bits for the immediate data tag."),
     attr("int", "imm_nbits_rcomp", default_value=15, comment="The number of bits for the immediate data remote completion handle."),
-    attr_enum("rdv_protocol", enum_options=["auto_select", "write", "writeimm"], default_value="auto_select", comment="Rendezvous completion protocol. `auto_select` selects based on network support for put-with-immediate."),
+    attr_enum("rdv_protocol", enum_options=["auto_select", "write", "writeimm", "read"], default_value="auto_select", comment="Rendezvous protocol. `read` lets the receiver pull the data with RDMA read. `auto_select` uses `read` for messages up to `rdv_read_threshold` bytes and otherwise selects between `write` and `writeimm` based on network support for put-with-immediate."),
+    attr("size_t", "rdv_read_threshold", default_value=262144, comment="The max message size for which `auto_select` uses the read rendezvous protocol."),
+    attr("bool", "rdv_pipeline", default_value=0, comment="Whether the write rendezvous protocols register and transfer large messages in chunks, overlapping the registration of one chunk with the transfer of the previous one."),
+    attr("size_t", "rdv_pipeline_chunk_size", default_value=1048576, comment="The chunk size of the pipelined rendezvous protocol."),
+    attr("size_t", "inject_threshold", default_value="SIZE_MAX", comment="The max message size for the inject protocol. It is capped by the max inject size of the network."),
+    attr("size_t", "eager_threshold", default_value="SIZE_MAX", comment="The max message size for the eager protocols of send/am. Larger messages use the rendezvous protocol. It is capped by the max buffer-copy size of the packet pool."),
+    attr("size_t", "zcopy_threshold", default_value=0, comment="The min message size for which an eager message from a registered local buffer is sent without copying. Smaller messages are copied into a packet."),
+    attr("std::string", "tuning_profile", default_value="\"\"", comment="The path of a tuning profile written by `lci_tune`. Its thresholds replace `inject_threshold`, `eager_threshold`, `zcopy_threshold`, and `rdv_read_threshold`. Empty string disables it."),
     attr("uint64_t", "max_imm_tag", inout_trait="out", comment="The max tag that can be put into the immediate data field. It is also the max tag that can be used in put with remote notification."),
     attr("uint64_t", "max_imm_rcomp", inout_trait="out", comment="The max rcomp that can be put into the immediate data field. It is also the max rcomp that can be used in put with remote notification."),
     attr("uint64_t", "max_tag", inout_trait="out", comment="The max tag that can be used in all primitives but put with remote notificaiton."),
@@ -82,7 +89,12 @@ resource_packet_pool := resource(
     "packet_pool", 
     [
         attr("size_t", "packet_size", default_value="LCI_PACKET_SIZE_DEFAULT", comment="The size of the packet."),
-        attr("size_t", "npackets", default_value="LCI_PACKET_NUM_DEFAULT", comment="The number of packets in the pool."),
+        attr("size_t", "npackets", default_value="LCI_PACKET_NUM_DEFAULT", comment="The number of packets in the pool. They are split evenly across the size classes."),
+        attr("size_t", "min_packet_size", default_value=0, comment="The size of the smallest packet size class. Every class is 4 times smaller than the next one, up to packet_size (at most 4 classes). 0 means a single class of packet_size. The smaller classes back the eager sends and other packets that fit in them. They only back receives if the network supports tagged messages; otherwise (e.g., verbs) every receive takes a packet of the largest class."),
+        attr("bool", "numa_aware", default_value=0, comment="Whether to split the packets into one sub-heap per NUMA node. Threads draw packets from their own node first."),
+        attr("bool", "huge_page", default_value=0, comment="Whether to back the packets with huge pages (explicit ones if reserved, otherwise transparent ones). It reduces TLB misses and the registration cost of the pool."),
+        attr("size_t", "npackets_max", default_value=0, comment="The number of packets the pool can grow to when it runs out of packets. It grows by slabs of npackets packets, which are registered to every device the pool has been registered to. 0 means the pool does not grow."),
+        attr("int", "slab_cooldown", default_value=1000, comment="How long (in milliseconds) the pool has to go without running out of packets before it returns a slab it has grown."),
     ],
     doc = {
         "in_group": "LCI_RESOURCE",
@@ -145,7 +157,8 @@ operation(
 resource_matching_engine := resource(
     "matching_engine", 
     [
-        attr_enum("matching_engine_type", enum_options=["queue", "map"], default_value="map", comment="The type of the matching engine."),
+        attr_enum("matching_engine_type", enum_options=["queue", "map", "offload"], default_value="map", comment="The type of the matching engine. The offload matching engine lets the network match send-recv if the network context supports tagged messages (see the `support_tagged` attribute) and falls back to the map matching engine otherwise. With a tagged network, its send-recv cannot use io vectors, datatypes or zero-copy receives, and its tags have to fit in 32 bits."),
+        attr("size_t", "nbuckets", default_value=256, comment="The initial number of buckets of the map matching engine, rounded up to a power of two. The table grows and shrinks with the number of pending keys but never below this size."),
     ],
     doc = {
         "in_group": "LCI_RESOURCE",
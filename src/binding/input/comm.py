@@ -27,6 +27,10 @@ operation(
         optional_arg("rcomp_t", "remote_comp", "0", comment="The remote completion handler to use."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
         optional_arg("matching_policy_t", "matching_policy", "matching_policy_t::rank_tag", comment="The matching policy to use."),
+        optional_arg("const iovec_t*", "iov", "nullptr", comment="The local io vector. If set, it replaces `local_buffer`, `size`, and `mr`. Only read during the call."),
+        optional_arg("size_t", "iov_count", "0", comment="The number of entries in `iov`."),
+        optional_arg("const datatype_t*", "datatype", "nullptr", comment="The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call."),
+        optional_arg("bool", "zero_copy", "false", comment="Only valid for recv. Whether to deliver an eager message in the internal packet instead of copying it into `local_buffer` (see @ref post_recv)."),
         optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
         optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
         optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
@@ -53,6 +57,7 @@ operation(
         optional_arg("mr_t", "mr", "MR_HOST", comment="The registered memory region for the local buffer."),
         optional_arg("tag_t", "tag", "0", comment="The tag to use."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("const datatype_t*", "datatype", "nullptr", comment="The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call."),
         optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
         optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
         optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
@@ -80,6 +85,7 @@ operation(
         optional_arg("mr_t", "mr", "MR_HOST", comment="The registered memory region for the local buffer."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
         optional_arg("matching_policy_t", "matching_policy", "matching_policy_t::rank_tag", comment="The matching policy to use."),
+        optional_arg("const datatype_t*", "datatype", "nullptr", comment="The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call."),
         optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
         optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
         optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
@@ -90,6 +96,59 @@ operation(
         "brief": "Post a send communication operation.",
     }
 ),
+operation(
+    "post_amv", 
+    [
+        optional_runtime_args,
+        positional_arg("int", "rank", comment="The target rank."),
+        positional_arg("const iovec_t*", "iov", comment="The local io vector. Only read during the call."),
+        positional_arg("size_t", "iov_count", comment="The number of entries in the io vector."),
+        positional_arg("comp_t", "local_comp", comment="The local completion object."),
+        positional_arg("rcomp_t", "remote_comp", comment="The remote completion handler to use."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint to use."),
+        optional_arg("packet_pool_t", "packet_pool", "device.get_impl()->packet_pool", comment="The packet pool to use."),
+        optional_arg("comp_semantic_t", "comp_semantic", "comp_semantic_t::memory", comment="The completion semantic."),
+        optional_arg("tag_t", "tag", "0", comment="The tag to use."),
+        optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
+        optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
+        optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
+        return_val("status_t", "status", comment="The status of the operation."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Post an active message communication operation with a local io vector.",
+        "details": "The io vector is sent as one contiguous message. The status has a null `buffer` and the total message size as `size`.",
+    }
+),
+operation(
+    "post_sendv", 
+    [
+        optional_runtime_args,
+        positional_arg("int", "rank", comment="The target rank."),
+        positional_arg("const iovec_t*", "iov", comment="The local io vector. Only read during the call."),
+        positional_arg("size_t", "iov_count", comment="The number of entries in the io vector."),
+        positional_arg("tag_t", "tag", comment="The tag to use."),
+        positional_arg("comp_t", "local_comp", comment="The local completion object."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint to use."),
+        optional_arg("packet_pool_t", "packet_pool", "device.get_impl()->packet_pool", comment="The packet pool to use."),
+        optional_arg("matching_engine_t", "matching_engine", "runtime.get_impl()->default_matching_engine", comment="The matching engine to use."),
+        optional_arg("comp_semantic_t", "comp_semantic", "comp_semantic_t::memory", comment="The completion semantic."),
+        optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("matching_policy_t", "matching_policy", "matching_policy_t::rank_tag", comment="The matching policy to use."),
+        optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
+        optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
+        optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
+        return_val("status_t", "status", comment="The status of the operation."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Post a send communication operation with a local io vector.",
+        "details": "The io vector is sent as one contiguous message and can be received by a regular receive. The status has a null `buffer` and the total message size as `size`.",
+    }
+),
 operation(
     "post_recv", 
     [
@@ -107,6 +166,7 @@ operation(
         optional_arg("mr_t", "mr", "MR_HOST", comment="The registered memory region for the local buffer."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
         optional_arg("matching_policy_t", "matching_policy", "matching_policy_t::rank_tag", comment="The matching policy to use."),
+        optional_arg("bool", "zero_copy", "false", comment="Whether to deliver an eager message in the internal packet instead of copying it into `local_buffer`."),
         optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
         optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
         optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
@@ -115,6 +175,7 @@ operation(
     doc = {
         "in_group": "LCI_COMM",
         "brief": "Post a receive communication operation.",
+        "details": "With `zero_copy`, an eager message is not copied: the buffer of the completion status points to the payload of the internal packet, and the user has to return it with @ref put_upacket once done. A message too large for a packet is still received into `local_buffer`, so the two cases can be told apart by comparing the buffer of the status with `local_buffer`. `local_buffer` can be null if the messages are known to be eager.",
     }
 ),
 operation(
@@ -135,6 +196,7 @@ operation(
         optional_arg("tag_t", "tag", "0", comment="The tag to use."),
         optional_arg("rcomp_t", "remote_comp", "0", comment="The remote completion handler to use."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("const datatype_t*", "datatype", "nullptr", comment="The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call."),
         optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
         optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
         optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
@@ -145,6 +207,34 @@ operation(
         "brief": "Post a put (one-sided write) communication operation.",
     }
 ),
+operation(
+    "post_putv", 
+    [
+        optional_runtime_args,
+        positional_arg("int", "rank", comment="The target rank."),
+        positional_arg("const iovec_t*", "iov", comment="The local io vector. Only read during the call."),
+        positional_arg("size_t", "iov_count", comment="The number of entries in the io vector."),
+        positional_arg("comp_t", "local_comp", comment="The local completion object."),
+        positional_arg("uintptr_t", "remote_disp", comment="The displacement from the remote buffer base address."),
+        positional_arg("rmr_t", "rmr", comment="The remote memory region handle of the remote buffer."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint to use."),
+        optional_arg("packet_pool_t", "packet_pool", "device.get_impl()->packet_pool", comment="The packet pool to use."),
+        optional_arg("comp_semantic_t", "comp_semantic", "comp_semantic_t::memory", comment="The completion semantic."),
+        optional_arg("tag_t", "tag", "0", comment="The tag to use."),
+        optional_arg("rcomp_t", "remote_comp", "0", comment="The remote completion handler to use."),
+        optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
+        optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
+        optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
+        return_val("status_t", "status", comment="The status of the operation."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Post a put (one-sided write) communication operation with a local io vector.",
+        "details": "The io vector is written to a contiguous remote buffer.",
+    }
+),
 operation(
     "post_get", 
     [
@@ -161,8 +251,9 @@ operation(
         optional_arg("comp_semantic_t", "comp_semantic", "comp_semantic_t::memory", comment="The completion semantic."),
         optional_arg("mr_t", "mr", "MR_HOST", comment="The registered memory region for the local buffer."),
         optional_arg("tag_t", "tag", "0", comment="The tag to use."),
-        optional_arg("rcomp_t", "remote_comp", "0", comment="The remote completion handler to use."),
+        optional_arg("rcomp_t", "remote_comp", "0", comment="The remote completion handler to signal at the target once the data has been read. The target receives it as an active message of size 0."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("const datatype_t*", "datatype", "nullptr", comment="The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Only read during the call."),
         optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
         optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
         optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
@@ -173,6 +264,144 @@ operation(
         "brief": "Post a get (one-sided read) communication operation.",
     }
 ),
+operation(
+    "post_getv", 
+    [
+        optional_runtime_args,
+        positional_arg("int", "rank", comment="The target rank."),
+        positional_arg("const iovec_t*", "iov", comment="The local io vector. Only read during the call."),
+        positional_arg("size_t", "iov_count", comment="The number of entries in the io vector."),
+        positional_arg("comp_t", "local_comp", comment="The local completion object."),
+        positional_arg("uintptr_t", "remote_disp", comment="The displacement from the remote buffer base address."),
+        positional_arg("rmr_t", "rmr", comment="The remote memory region handle of the remote buffer."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint to use."),
+        optional_arg("packet_pool_t", "packet_pool", "device.get_impl()->packet_pool", comment="The packet pool to use."),
+        optional_arg("tag_t", "tag", "0", comment="The tag to use."),
+        optional_arg("rcomp_t", "remote_comp", "0", comment="The remote completion handler to signal at the target once the data has been read. The target receives it as an active message of size 0."),
+        optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
+        optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
+        optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
+        return_val("status_t", "status", comment="The status of the operation."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Post a get (one-sided read) communication operation with a local io vector.",
+        "details": "A contiguous remote buffer is read into the io vector.",
+    }
+),
+operation(
+    "post_atomic", 
+    [
+        optional_runtime_args,
+        positional_arg("int", "rank", comment="The target rank."),
+        positional_arg("atomic_op_t", "op", comment="The atomic operation."),
+        positional_arg("uint64_t", "operand", comment="The operand. For 32-bit types, only the low 32 bits are used."),
+        positional_arg("void*", "result", comment="The local buffer (of the size of `type`) to store the old value of the remote integer. Not used by add and can be nullptr then."),
+        positional_arg("comp_t", "local_comp", comment="The local completion object."),
+        positional_arg("uintptr_t", "remote_disp", comment="The displacement from the remote buffer base address. The remote address has to be aligned to the size of `type`."),
+        positional_arg("rmr_t", "rmr", comment="The remote memory region handle of the remote buffer."),
+        optional_arg("uint64_t", "compare", "0", comment="For cas: the value to compare the remote integer with."),
+        optional_arg("atomic_type_t", "type", "atomic_type_t::uint64", comment="The integer type."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint to use."),
+        optional_arg("packet_pool_t", "packet_pool", "device.get_impl()->packet_pool", comment="The packet pool to use."),
+        optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
+        optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
+        optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
+        return_val("status_t", "status", comment="The status of the operation."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Post a remote atomic operation on an integer in a remote memory region.",
+        "details": "The operation is executed by the network if the net context supports atomics on this type (see the `support_atomic32` and `support_atomic64` attributes), and by the progress engine of the target otherwise. It completes once the old value has been fetched (or, for add, once it has been executed). The remote atomic operations are atomic with respect to each other, but not with respect to other accesses to the remote integer.",
+    }
+),
+resource_persistent_comm := resource(
+    "persistent_comm", 
+    [],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "The persistent communication resource.",
+        "details": "A pre-planned communication operation. It is built once by @ref alloc_persistent_comm and posted by @ref start as many times as needed.",
+    }
+),
+operation(
+    "alloc_persistent_comm", 
+    [
+        optional_runtime_args,
+        positional_arg("direction_t", "direction", comment="The communication direction."),
+        positional_arg("int", "rank", comment="The target rank."),
+        positional_arg("void*", "local_buffer", comment="The local buffer base address."),
+        positional_arg("size_t", "size", comment="The message size."),
+        positional_arg("comp_t", "local_comp", comment="The local completion object."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint to use."),
+        optional_arg("packet_pool_t", "packet_pool", "device.get_impl()->packet_pool", comment="The packet pool to use."),
+        optional_arg("matching_engine_t", "matching_engine", "runtime.get_impl()->default_matching_engine", comment="The matching engine to use."),
+        optional_arg("comp_semantic_t", "comp_semantic", "comp_semantic_t::memory", comment="The completion semantic (only valid when `direction == direction_t::OUT`)."),
+        optional_arg("mr_t", "mr", "MR_HOST", comment="The registered memory region for the local buffer. If not set, the local buffer is registered by the allocation when the chosen protocol needs it."),
+        optional_arg("uintptr_t", "remote_disp", "0", comment="The displacement from the remote buffer base address."),
+        optional_arg("rmr_t", "rmr", "RMR_NULL", comment="The remote memory region handle of the remote buffer."),
+        optional_arg("tag_t", "tag", "0", comment="The tag to use."),
+        optional_arg("rcomp_t", "remote_comp", "0", comment="The remote completion handler to use."),
+        optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this operation."),
+        optional_arg("matching_policy_t", "matching_policy", "matching_policy_t::rank_tag", comment="The matching policy to use."),
+        optional_arg("const iovec_t*", "iov", "nullptr", comment="The local io vector. If set, it replaces `local_buffer`, `size`, and `mr`. Copied by the allocation."),
+        optional_arg("size_t", "iov_count", "0", comment="The number of entries in `iov`."),
+        optional_arg("const datatype_t*", "datatype", "nullptr", comment="The layout of the local buffer. If set, `local_buffer` is the base address of the layout and `size` is ignored. Copied by the allocation, but the displacements of an indexed block have to stay valid until the object is freed."),
+        optional_arg("bool", "zero_copy", "false", comment="Only valid for recv. Whether to deliver an eager message in the internal packet instead of copying it into `local_buffer` (see @ref post_recv)."),
+        optional_arg("bool", "allow_done", "true", comment="Whether to allow the *done* error code."),
+        optional_arg("bool", "allow_posted", "true", comment="Whether to allow the *posted* error code."),
+        optional_arg("bool", "allow_retry", "true", comment="Whether to allow the *retry* error code."),
+        return_val("persistent_comm_t", "persistent_comm", comment="The allocated persistent communication operation."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Plan a generic communication operation to be posted later by @ref start.",
+        "details": "The arguments are the same as the ones of @ref post_comm. The argument checks, the remote handler, the protocol, and the immediate data are computed once here, and the local buffer is registered if the protocol needs it. The local buffer and the message size are therefore fixed.",
+    }
+),
+operation_free(resource_persistent_comm),
+operation(
+    "start", 
+    [
+        optional_runtime_args,
+        positional_arg("persistent_comm_t", "persistent_comm", comment="The persistent communication operation to post."),
+        return_val("status_t", "status", comment="The status of the operation."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Post a persistent communication operation.",
+        "details": "It behaves as @ref post_comm with the arguments given to @ref alloc_persistent_comm. A persistent communication operation can be started again once the previous start has completed.",
+    }
+),
+operation(
+    "begin_batch", 
+    [
+        optional_runtime_args,
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint whose operations are batched."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Start batching the communication operations posted by the calling thread.",
+        "details": "Until @ref flush_batch is called, the zero-copy sends, puts and gets (and the buffer-copy puts and gets) posted by the calling thread to the endpoint are staged instead of posted, and return *posted*. Other operations posted to the endpoint first flush the staged ones. As without a batch, a buffer-copy put with the memory completion semantic returns *done* once its data is copied, although it is only sent when the batch is flushed. The progress engine posts the staged operations of the calling thread, so polling for the completion of a staged operation does not need @ref flush_batch. A thread can only have one open batch, and the endpoint cannot be freed while a thread has an open batch on it.",
+    }
+),
+operation(
+    "flush_batch", 
+    [
+        optional_runtime_args,
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Post the communication operations batched by the calling thread and close the batch.",
+        "details": "The operations to the same target are submitted together, so that the network backend takes its locks and rings its doorbell once per batch. The operations that cannot be posted immediately are pushed to the backlog queue.",
+    }
+),
 operation(
     "progress", 
     [
@@ -208,6 +437,19 @@ operation(
         "in_group": "LCI_COMM",
         "brief": "Test for the completion of all locally posted communication operations.",
     }
+),
+operation(
+    "flush",
+    [
+        optional_runtime_args,
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to use."),
+        optional_arg("endpoint_t", "endpoint", "device.get_impl()->default_endpoint", comment="The endpoint to flush."),
+        return_val("error_t", "error", comment="The error code. The error code *done* means some aggregated messages have been sent; the error code *retry* means there was nothing to flush."),
+    ],
+    doc = {
+        "in_group": "LCI_COMM",
+        "brief": "Send all active messages aggregated on an endpoint.",
+    }
 )
 ]
 
@@ -14,7 +14,8 @@ resource_comp := resource(
         attr("int", "sync_threshold", default_value=1, comment="The threshold for sync (synchronizer)."),
         attr("bool", "zero_copy_am", default_value="false", comment="Whether to directly pass internal packet into the completion object."),
         attr_enum("cq_type", enum_options=["array_atomic", "lcrq"], default_value="lcrq", comment="The completion object type."),
-        attr("int", "cq_default_length", default_value=65536, comment="The default length of the completion queue."),
+        attr("int", "cq_default_length", default_value=65536, comment="The default length of the completion queue. Up to 1024 statuses are kept inline at 56 bytes each; the rest go to an overflow queue allocated on first use."),
+        attr("bool", "blocking", default_value="false", comment="Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever."),
     ],
     custom_is_empty_method=True,
     doc = {
@@ -78,6 +79,7 @@ operation(
         optional_runtime_args,
         optional_arg("int", "threshold", get_attr_default_value("comp", "sync_threshold"), comment="The signaling threshold of the synchronizer."),
         optional_arg("bool", "zero_copy_am", get_attr_default_value("comp", "zero_copy_am"), comment="Whether to directly pass internal packet into the completion object."),
+        optional_arg("bool", "blocking", get_attr_default_value("comp", "blocking"), comment="Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever."),
         optional_arg("const char*", "name", '"DEFAULT_NAME"', comment="The name of the synchronizer."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this completion object."),
         return_val("comp_t", "comp", comment="The allocated synchronizer.")
@@ -112,6 +114,7 @@ operation(
     doc = {
         "in_group": "LCI_COMPLETION",
         "brief": "Wait for a synchronizer to be ready.",
+        "details": "If the synchronizer is blocking, the wait sleeps after an adaptive spin phase. With `do_progress`, it sleeps on the completion channel of the device if it has one (see the device attribute `net_comp_channel`)."
     }
 ),
 # counter
@@ -119,6 +122,7 @@ operation(
     "alloc_counter",
     [
         optional_runtime_args,
+        optional_arg("bool", "blocking", get_attr_default_value("comp", "blocking"), comment="Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever."),
         optional_arg("const char*", "name", '"DEFAULT_NAME"', comment="The name of the synchronizer."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this completion object."),
         return_val("comp_t", "comp", comment="The allocated counter.")
@@ -152,6 +156,21 @@ operation(
         "brief": "Set the value of a counter.",
     }
 ),
+operation(
+    "counter_wait",
+    [
+        optional_runtime_args,
+        positional_arg("comp_t", "comp", comment="The counter to wait."),
+        positional_arg("int64_t", "target", comment="The value to wait for the counter to reach."),
+        optional_arg("bool", "do_progress", "true", comment="Whether to call `lci::progress()` in the loop."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to make progress on."),
+    ],
+    doc = {
+        "in_group": "LCI_COMPLETION",
+        "brief": "Wait for a counter to reach a value.",
+        "details": "If the counter is blocking, the wait sleeps after an adaptive spin phase. With `do_progress`, it sleeps on the completion channel of the device if it has one (see the device attribute `net_comp_channel`)."
+    }
+),
 # cq
 operation(
     "alloc_cq", 
@@ -160,6 +179,7 @@ operation(
         optional_arg("int", "default_length", get_attr_default_value("comp", "cq_default_length"), comment="The default length of the completion queue."),
         optional_arg("bool", "zero_copy_am", get_attr_default_value("comp", "zero_copy_am"), comment="Whether to directly pass internal packet into the completion object."),
         optional_arg("attr_cq_type_t", "cq_type", get_attr_default_value("comp", "cq_type"), comment="The type of the completion queue."),
+        optional_arg("bool", "blocking", get_attr_default_value("comp", "blocking"), comment="Whether waits on the completion object sleep after an adaptive spin phase instead of spinning forever."),
         optional_arg("const char*", "name", '"DEFAULT_NAME"', comment="The name of the synchronizer."),
         optional_arg("void*", "user_context", "nullptr", comment="The arbitrary user-defined context associated with this completion object."),
         return_val("comp_t", "comp", comment="The allocated completion queue.")
@@ -182,6 +202,36 @@ operation(
         "details": "This function is a nonblocking operation. It can return a status with an error code of either *retry* or *done*. Other fields of the status are only valid if the error code is *done*."
     }
 ),
+operation(
+    "cq_pop_n", 
+    [
+        optional_runtime_args,
+        positional_arg("comp_t", "comp", comment="The completion queue to pop."),
+        positional_arg("size_t", "n", comment="The maximum number of statuses to pop."),
+        positional_arg("status_t*", "p_out", inout_trait="out", comment="The pointer to a status array of size `n` to hold the popped statuses."),
+        return_val("size_t", "count", comment="The number of statuses popped.")
+    ],
+    doc = {
+        "in_group": "LCI_COMPLETION",
+        "brief": "Pop multiple statuses from a completion queue.",
+        "details": "This function is a nonblocking operation. It pops up to `n` statuses at once, all with an error code of *done*, and returns 0 if the completion queue is empty."
+    }
+),
+operation(
+    "cq_wait",
+    [
+        optional_runtime_args,
+        positional_arg("comp_t", "comp", comment="The completion queue to pop."),
+        optional_arg("bool", "do_progress", "true", comment="Whether to call `lci::progress()` in the loop."),
+        optional_arg("device_t", "device", "runtime.get_impl()->default_device", comment="The device to make progress on."),
+        return_val("status_t", "status", comment="The popped status.")
+    ],
+    doc = {
+        "in_group": "LCI_COMPLETION",
+        "brief": "Wait for a status and pop it from a completion queue.",
+        "details": "If the completion queue is blocking, the wait sleeps after an adaptive spin phase. With `do_progress`, it sleeps on the completion channel of the device if it has one (see the device attribute `net_comp_channel`)."
+    }
+),
 # handler
 operation(
     "alloc_handler", 
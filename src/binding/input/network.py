@@ -17,12 +17,16 @@ resource_net_context := resource(
         attr("std::string", "ofi_provider_name", default_value="LCI_OFI_PROVIDER_HINT_DEFAULT", comment="For the OFI backend: the provider name."),
         attr("size_t", "max_msg_size", default_value="LCI_USE_MAX_SINGLE_MESSAGE_SIZE_DEFAULT", comment="The maximum message size."),
         attr("size_t", "max_inject_size", default_value=64, comment="The maximum inject size."),
+        attr("size_t", "max_iov", default_value="LCI_BACKEND_MAX_IOV", comment="The maximum number of io vector entries posted as a single network operation. Backends reduce it to what the hardware supports."),
         attr("int", "ibv_gid_idx", default_value=-1, comment="For the IBV backend: the GID index by default (only needed by RoCE)."),
         attr("bool", "ibv_force_gid_auto_select", default_value=0, comment="For the IBV backend: whether to force GID auto selection."),
         attr("std::string", "device_name", default_value="\"\"", comment="The network device name to use. For the IBV backend this is the verbs device name; for the OFI backend this is the libfabric domain name. Empty string selects the default/best available device."),
         attr_enum("ibv_odp_strategy", enum_options=["none", "explicit_odp", "implicit_odp"], default_value="none", comment="For the IBV backend: the on-demand paging strategy."),
         attr_enum("ibv_prefetch_strategy", enum_options=["none", "prefetch", "prefetch_write", "prefetch_no_fault"], default_value="none", comment="For the IBV backend: the mr prefetch strategy."),
         attr("bool", "support_putimm", inout_trait="out", comment="Whether the network context supports put with immediate data."),
+        attr("bool", "support_atomic32", inout_trait="out", comment="Whether the network context executes remote atomic operations on 32-bit integers natively. Otherwise, they are executed by the target's progress engine."),
+        attr("bool", "support_atomic64", inout_trait="out", comment="Whether the network context executes remote atomic operations on 64-bit integers natively. Otherwise, they are executed by the target's progress engine."),
+        attr("bool", "support_tagged", inout_trait="out", comment="Whether the network context matches tagged messages itself. Otherwise, the offload matching engine matches send-recv in software."),
         attr("bool", "use_dmabuf", default_value=1, comment="Whether to use dmabuf for cuda buffer registration."),
     ],
     doc = {
@@ -44,13 +48,19 @@ resource_device := resource(
         attr("uint64_t", "ofi_lock_mode", comment="For the OFI backend: the lock mode for the device."),
         attr("bool", "alloc_default_endpoint", default_value=1, comment="Whether to allocate the default endpoint."),
         attr("bool", "alloc_progress_endpoint", default_value=0, comment="Whether to allocate another endpoint for communication invoked by the progress function."),
+        attr("size_t", "am_aggregation_threshold", default_value="g_default_attr.am_aggregation_threshold", comment="The am_aggregation_threshold of the default endpoint. It defaults to the endpoint attribute of the same name.", extra_trait=["no_env_config"]),
+        attr("bool", "net_comp_channel", default_value=0, comment="Whether to create a completion channel (IBV) or a wait object (OFI) for the network completion queue, so that the blocking waits of completion objects can sleep until the network completes something."),
         attr("bool", "use_reg_cache", default_value="LCI_USE_REG_CACHE", comment="Whether to use the memory registration cache (if compiled)."),
         attr("bool", "shm_enable", default_value="LCI_WITH_SHM", comment="Whether to enable the experimental intra-node shared-memory small-message transport."),
         attr("size_t", "shm_ring_size", default_value="64 * 1024", comment="Maximum shared-memory inbound slot-array size in bytes; the effective slot count is rounded down to a power of two."),
         attr("size_t", "shm_slot_size", default_value=128, comment="Shared-memory fixed slot size in bytes."),
         attr("size_t", "shm_producer_cas_attempts", default_value=4, comment="Maximum compare-and-swap attempts for each shared-memory ring producer reservation."),
         attr("size_t", "shm_consumer_cas_attempts", default_value=1, comment="Maximum compare-and-swap attempts for each shared-memory ring consumer claim."),
+        attr("bool", "shm_huge_page", default_value=0, comment="Whether to ask for transparent huge pages for the shared-memory rings. It only matters for rings of at least one huge page."),
         attr("size_t", "shm_max_polls", default_value="LCI_BACKEND_MAX_POLLS", comment="Maximum shared-memory receive slots progressed after each network completion poll."),
+        attr("size_t", "eager_rdma_threshold", default_value=0, comment="Number of eager sends to a peer after which an eager-RDMA ring is set up for it. 0 disables eager-RDMA."),
+        attr("size_t", "eager_rdma_nslots", default_value=64, comment="Number of slots of each eager-RDMA ring (at most 8192)."),
+        attr("size_t", "eager_rdma_slot_size", default_value=1024, comment="Size in bytes of each eager-RDMA ring slot (at most 32768). A slot minus its 4-byte immediate data has to fit in a packet payload."),
         attr("int", "uid", default_value=-1, inout_trait="out", comment="A unique device id across the entire process."),
         attr_enum("ibv_td_strategy", enum_options=["none", "all_qp", "per_qp"], default_value="per_qp", comment="For the IBV backend: the thread domain strategy."),
     ],
@@ -122,6 +132,7 @@ resource_endpoint := resource(
     "endpoint", 
     [
         attr("int", "uid", default_value=-1, inout_trait="out", comment="A unique endpoint id across the entire process."),
+        attr("size_t", "am_aggregation_threshold", default_value=0, comment="Active messages no larger than this size are aggregated per target rank into one packet. 0 disables aggregation."),
     ],
     doc = {
         "in_group": "LCI_RESOURCE",
@@ -6,11 +6,13 @@
 namespace lci
 {
 comp_t alloc_sync_x::call_impl(runtime_t, int threshold, bool zero_copy_am,
-                               const char* name, void* user_context) const
+                               bool blocking, const char* name,
+                               void* user_context) const
 {
   comp_attr_t attr;
   memset(&attr, 0, sizeof(attr));
   attr.zero_copy_am = zero_copy_am;
+  attr.blocking = blocking;
   attr.name = name;
   attr.user_context = user_context;
   comp_t comp;
@@ -18,11 +20,12 @@ comp_t alloc_sync_x::call_impl(runtime_t, int threshold, bool zero_copy_am,
   return comp;
 }
 
-comp_t alloc_counter_x::call_impl(runtime_t, const char* name,
+comp_t alloc_counter_x::call_impl(runtime_t, bool blocking, const char* name,
                                   void* user_context) const
 {
   comp_attr_t attr;
   memset(&attr, 0, sizeof(attr));
+  attr.blocking = blocking;
   attr.name = name;
   attr.user_context = user_context;
   comp_t comp;
@@ -31,13 +34,14 @@ comp_t alloc_counter_x::call_impl(runtime_t, const char* name,
 }
 
 comp_t alloc_cq_x::call_impl(runtime_t, int default_length, bool zero_copy_am,
-                             attr_cq_type_t cq_type, const char* name,
-                             void* user_context) const
+                             attr_cq_type_t cq_type, bool blocking,
+                             const char* name, void* user_context) const
 {
   comp_attr_t attr;
   memset(&attr, 0, sizeof(attr));
   attr.zero_copy_am = zero_copy_am;
   attr.cq_type = cq_type;
+  attr.blocking = blocking;
   attr.name = name;
   attr.user_context = user_context;
   comp_t comp;
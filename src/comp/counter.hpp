@@ -21,15 +21,34 @@ class counter_t : public comp_impl_t
     count.fetch_add(1, std::memory_order_relaxed);
     LCI_PCOUNTER_ADD(comp_produce, 1);
     LCI_PCOUNTER_ADD(comp_consume, 1);
+    if (attr.blocking) waiter.notify();
   }
 
-  void set(int64_t value) { count.store(value, std::memory_order_release); }
+  void set(int64_t value)
+  {
+    count.store(value, std::memory_order_release);
+    if (attr.blocking) waiter.notify();
+  }
 
   int64_t get() const { return count.load(std::memory_order_acquire); }
 
+  void wait(int64_t target, device_t device = device_t())
+  {
+    if (attr.blocking) {
+      waiter.wait([&]() { return get() >= target; }, device);
+      return;
+    }
+    while (get() < target) {
+      if (!device.is_empty()) {
+        progress_x().device(device)();
+      }
+    }
+  }
+
  private:
   std::atomic<int64_t> count;
   LCIU_CACHE_PADDING(sizeof(std::atomic<int64_t>));
+  waiter_t waiter;
 };
 
 inline int64_t counter_get_x::call_impl(comp_t comp, runtime_t) const
@@ -45,6 +64,17 @@ inline void counter_set_x::call_impl(comp_t comp, int64_t value,
   counter->set(value);
 }
 
+inline void counter_wait_x::call_impl(comp_t comp, int64_t target, runtime_t,
+                                      bool do_progress, device_t device) const
+{
+  counter_t* counter = static_cast<counter_t*>(comp.p_impl);
+  if (!do_progress) {
+    counter->wait(target);
+  } else {
+    counter->wait(target, device);
+  }
+}
+
 }  // namespace lci
 
 #endif  // LCI_COMP_COUNTER_HPP
\ No newline at end of file
@@ -6,54 +6,213 @@
 
 namespace lci
 {
+// The completion queue stores the statuses inline in a bounded MPMC ring of
+// `default_length` (rounded up to a power of two, at most `max_ring_length`)
+// cells. Every cell has a sequence number telling whether it is ready for the
+// producer or the consumer of the current lap, so producers and consumers only
+// contend on their own position counter. A cell takes
+// sizeof(status_t) + 8 = 56 bytes, so the ring costs at most 56 KiB per queue.
+// If the ring is full, the statuses overflow into a heap-allocated LCT queue
+// of type `cq_type`, allocated on the first overflow. While the overflow queue
+// is not empty, new statuses also go there, so the ring only ever holds
+// statuses older than the overflowed ones and popping the ring first keeps
+// the FIFO order.
 class cq_t : public comp_impl_t
 {
+  struct cell_t {
+    std::atomic<uint64_t> seq;
+    status_t status;
+  };
+
  public:
   cq_t(comp_attr_t attr_, int default_length_)
-      : comp_impl_t(attr_), default_length(default_length_)
+      : comp_impl_t(attr_),
+        default_length(default_length_),
+        enqueue_pos(0),
+        dequeue_pos(0),
+        noverflow(0),
+        overflow(nullptr)
   {
     attr.comp_type = attr_comp_type_t::cq;
-    LCT_queue_type_t cq_type = LCT_QUEUE_ARRAY_ATOMIC_FAA;
-    switch (attr.cq_type) {
-      case attr_cq_type_t::array_atomic:
-        cq_type = LCT_QUEUE_ARRAY_ATOMIC_FAA;
-        break;
-      case attr_cq_type_t::lcrq:
-        cq_type = LCT_QUEUE_LCRQ;
-        break;
-      default:
-        LCI_Assert(false, "cq type is not supported!\n");
+    LCI_Assert(default_length_ > 0, "default_length must be positive\n");
+    LCI_Assert(attr.cq_type == attr_cq_type_t::array_atomic ||
+                   attr.cq_type == attr_cq_type_t::lcrq,
+               "cq type is not supported!\n");
+    size_t capacity = 1;
+    while (capacity < default_length && capacity < max_ring_length)
+      capacity *= 2;
+    mask = capacity - 1;
+    cells = static_cast<cell_t*>(alloc_memalign(capacity * sizeof(cell_t)));
+    for (size_t i = 0; i < capacity; i++) {
+      new (&cells[i]) cell_t;
+      cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+  ~cq_t()
+  {
+    for (size_t i = 0; i <= mask; i++) {
+      cells[i].~cell_t();
+    }
+    std::free(cells);
+    LCT_queue_t q = overflow.load(std::memory_order_acquire);
+    if (q) {
+      status_t* p;
+      while ((p = static_cast<status_t*>(LCT_queue_pop(q))) != nullptr) {
+        delete p;
+      }
+      LCT_queue_free(&q);
     }
-    queue = LCT_queue_alloc(cq_type, default_length);
   }
-  ~cq_t() { LCT_queue_free(&queue); }
   void signal(status_t status) override
   {
     LCI_Assert(status.is_done(), "status is not done!\n");
     LCI_PCOUNTER_ADD(comp_produce, 1);
-    status_t* p = new status_t(std::move(status));
-    LCT_queue_push(queue, p);
+    // Once a status has overflowed, keep using the overflow queue until it
+    // is drained so that no status can overtake an older one.
+    if (LCT_unlikely(noverflow.load(std::memory_order_acquire) > 0 ||
+                     !push(status))) {
+      // Count the status before pushing it so that a consumer never sees the
+      // counter drop to zero while it is still in the overflow queue.
+      noverflow.fetch_add(1, std::memory_order_acq_rel);
+      status_t* p = new status_t(std::move(status));
+      LCT_queue_push(get_overflow(), p);
+    }
+    if (attr.blocking) waiter.notify();
   }
   status_t pop()
   {
-    // TODO: let cq directly store status_t instead of a pointer
     status_t status;
-    status_t* p = static_cast<status_t*>(LCT_queue_pop(queue));
-    if (p == nullptr) {
+    if (pop_n(1, &status) == 0) {
       LCI_Assert(status.is_retry(), "status is not retry!\n");
+    }
+    return status;
+  }
+  status_t wait(device_t device = device_t())
+  {
+    status_t status;
+    if (attr.blocking) {
+      waiter.wait([&]() { return pop_n(1, &status) > 0; }, device);
       return status;
-    } else {
-      status = std::move(*p);
-      delete p;
-      LCI_PCOUNTER_ADD(comp_consume, 1);
-      LCI_Assert(status.is_done(), "status is not done!\n");
-      return status;
     }
+    while (pop_n(1, &status) == 0) {
+      if (!device.is_empty()) {
+        progress_x().device(device)();
+      }
+    }
+    return status;
+  }
+  // Pop up to n statuses. Return the number of statuses popped.
+  size_t pop_n(size_t n, status_t* p_out)
+  {
+    size_t npopped = pop_ring(n, p_out);
+    // Only look at the overflow queue once every claimed ring cell has been
+    // consumed, as a producer may still be filling an older one.
+    if (npopped < n && noverflow.load(std::memory_order_acquire) > 0 &&
+        enqueue_pos.load(std::memory_order_relaxed) ==
+            dequeue_pos.load(std::memory_order_relaxed)) {
+      // the first overflowing producer may not have allocated it yet
+      LCT_queue_t q = overflow.load(std::memory_order_acquire);
+      for (; q && npopped < n; npopped++) {
+        status_t* p = static_cast<status_t*>(LCT_queue_pop(q));
+        if (p == nullptr) break;
+        noverflow.fetch_sub(1, std::memory_order_relaxed);
+        p_out[npopped] = std::move(*p);
+        delete p;
+      }
+    }
+    LCI_PCOUNTER_ADD(comp_consume, npopped);
+    return npopped;
   }
 
  private:
+  static constexpr size_t max_ring_length = 1024;
+
+  LCT_queue_t get_overflow()
+  {
+    LCT_queue_t q = overflow.load(std::memory_order_acquire);
+    if (LCT_likely(q != nullptr)) return q;
+    LCT_queue_t new_q = LCT_queue_alloc(
+        attr.cq_type == attr_cq_type_t::lcrq ? LCT_QUEUE_LCRQ
+                                             : LCT_QUEUE_ARRAY_ATOMIC_FAA,
+        default_length);
+    if (overflow.compare_exchange_strong(q, new_q, std::memory_order_acq_rel)) {
+      return new_q;
+    }
+    // another producer has allocated it
+    LCT_queue_free(&new_q);
+    return q;
+  }
+
+  // Return false if the ring is full.
+  bool push(status_t& status)
+  {
+    uint64_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    cell_t* cell;
+    while (true) {
+      cell = &cells[pos & mask];
+      uint64_t seq = cell->seq.load(std::memory_order_acquire);
+      int64_t diff = static_cast<int64_t>(seq - pos);
+      if (diff == 0) {
+        // the cell is free in this lap; try to claim it
+        if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        // the cell has not been consumed in the previous lap
+        return false;
+      } else {
+        // another producer has claimed it
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    cell->status = std::move(status);
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Reserve up to n consecutive ready cells with a single compare-and-swap.
+  size_t pop_ring(size_t n, status_t* p_out)
+  {
+    uint64_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    size_t nready;
+    while (true) {
+      nready = 0;
+      while (nready < n && nready <= mask) {
+        uint64_t idx = pos + nready;
+        uint64_t seq = cells[idx & mask].seq.load(std::memory_order_acquire);
+        if (seq != idx + 1) break;
+        ++nready;
+      }
+      if (nready == 0) {
+        uint64_t seq = cells[pos & mask].seq.load(std::memory_order_relaxed);
+        // the cell has not been produced; the ring is empty
+        if (static_cast<int64_t>(seq - (pos + 1)) < 0) return 0;
+        // another consumer has claimed it
+        pos = dequeue_pos.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (dequeue_pos.compare_exchange_weak(pos, pos + nready,
+                                            std::memory_order_relaxed))
+        break;
+    }
+    for (size_t i = 0; i < nready; i++) {
+      cell_t* cell = &cells[(pos + i) & mask];
+      p_out[i] = std::move(cell->status);
+      LCI_DBG_Assert(p_out[i].is_done(), "status is not done!\n");
+      // free the cell for the next lap
+      cell->seq.store(pos + i + mask + 1, std::memory_order_release);
+    }
+    return nready;
+  }
+
   size_t default_length;
-  LCT_queue_t queue;
+  uint64_t mask;
+  cell_t* cells;
+  alignas(LCI_CACHE_LINE) std::atomic<uint64_t> enqueue_pos;
+  alignas(LCI_CACHE_LINE) std::atomic<uint64_t> dequeue_pos;
+  alignas(LCI_CACHE_LINE) std::atomic<int64_t> noverflow;
+  std::atomic<LCT_queue_t> overflow;
+  waiter_t waiter;
 };
 
 inline status_t cq_pop_x::call_impl(comp_t comp, runtime_t) const
@@ -62,6 +221,24 @@ inline status_t cq_pop_x::call_impl(comp_t comp, runtime_t) const
   return p_cq->pop();
 }
 
+inline size_t cq_pop_n_x::call_impl(comp_t comp, size_t n, status_t* p_out,
+                                    runtime_t) const
+{
+  cq_t* p_cq = static_cast<cq_t*>(comp.p_impl);
+  return p_cq->pop_n(n, p_out);
+}
+
+inline status_t cq_wait_x::call_impl(comp_t comp, runtime_t, bool do_progress,
+                                     device_t device) const
+{
+  cq_t* p_cq = static_cast<cq_t*>(comp.p_impl);
+  if (!do_progress) {
+    return p_cq->wait();
+  } else {
+    return p_cq->wait(device);
+  }
+}
+
 }  // namespace lci
 
-#endif  // LCI_DATA_STRUCTURE_CQ_CQ_HPP
\ No newline at end of file
+#endif  // LCI_DATA_STRUCTURE_CQ_CQ_HPP
@@ -35,6 +35,7 @@ class sync_t : public comp_impl_t
     statuses[pos - tail] = std::move(status);
     m_top2.fetch_add(1, std::memory_order_release);
     LCI_PCOUNTER_ADD(comp_produce, 1);
+    if (attr.blocking) waiter.notify();
   }
 
   bool test(status_t* p_out)
@@ -63,6 +64,10 @@ class sync_t : public comp_impl_t
 
   void wait(status_t* p_out, device_t device = device_t())
   {
+    if (attr.blocking) {
+      waiter.wait([&]() { return test(p_out); }, device);
+      return;
+    }
     bool succeed;
     do {
       succeed = test(p_out);
@@ -80,6 +85,7 @@ class sync_t : public comp_impl_t
   LCIU_CACHE_PADDING(sizeof(std::atomic<uint64_t>));
   int threshold;
   std::vector<status_t> statuses;
+  waiter_t waiter;
 };
 
 inline bool sync_test_x::call_impl(comp_t comp, status_t* p_out,
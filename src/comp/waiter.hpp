@@ -0,0 +1,102 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_COMP_WAITER_HPP
+#define LCI_COMP_WAITER_HPP
+
+namespace lci
+{
+// The blocking wait of a completion object (with the `blocking` attribute).
+// - A waiter first spins, making progress on the device if it has one. The
+//   spin phase doubles every time it ends with the completion and halves every
+//   time it does not, so busy waiters do not pay for sleeping.
+// - Without a device, the waiter then sleeps on a futex until the completion
+//   object is signaled.
+// - With a device, it sleeps on the completion channel of the network backend
+//   until the network completes something, as nobody else may be making
+//   progress for it. It arms the channel and then makes progress once more,
+//   so a completion that arrived before the arm is not missed. The sleep is
+//   bounded by WAIT_TIMEOUT_MS, as a signal from another thread does not go
+//   through the channel. Backends without a completion channel sleep on the
+//   futex for as long if that progress found nothing.
+// The signaler only makes a system call if someone is sleeping.
+class waiter_t
+{
+ public:
+  static constexpr int SPIN_MIN = 64;
+  static constexpr int SPIN_MAX = 1 << 16;
+  static constexpr int WAIT_TIMEOUT_MS = 1;
+
+  waiter_t() : seq(0), nsleepers(0), spin_limit(1024) {}
+
+  // Called after the condition of the waiters has been met.
+  void notify()
+  {
+    // pairs with the fence in wait
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (nsleepers.load(std::memory_order_relaxed) == 0) return;
+    seq.fetch_add(1, std::memory_order_release);
+    futex_wake(&seq);
+  }
+
+  // Wait until test() returns true.
+  template <typename Test>
+  void wait(Test test, device_t device = device_t());
+
+ private:
+  alignas(LCI_CACHE_LINE) std::atomic<uint32_t> seq;
+  std::atomic<int> nsleepers;
+  std::atomic<int> spin_limit;
+};
+
+template <typename Test>
+void waiter_t::wait(Test test, device_t device)
+{
+  int limit = spin_limit.load(std::memory_order_relaxed);
+  for (int i = 0; i < limit; i++) {
+    if (test()) {
+      if (limit < SPIN_MAX)
+        spin_limit.store(limit * 2, std::memory_order_relaxed);
+      return;
+    }
+    // keep spinning as long as the device is busy
+    if (!device.is_empty() && progress_x().device(device)().is_done()) i = 0;
+  }
+  if (limit > SPIN_MIN) spin_limit.store(limit / 2, std::memory_order_relaxed);
+
+  while (true) {
+    nsleepers.fetch_add(1, std::memory_order_relaxed);
+    // pairs with the fence in notify: either we see the condition or the
+    // signaler sees us
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t expected = seq.load(std::memory_order_acquire);
+    bool done = test();
+    if (!done) {
+      LCI_PCOUNTER_ADD(comp_block, 1);
+      if (device.is_empty()) {
+        futex_wait(&seq, expected);
+      } else {
+        bool armed = device.get_impl()->arm_comp();
+        // only sleep if the network is idle after the arm
+        if (!progress_x().device(device)().is_done()) {
+          if (armed) {
+            device.get_impl()->wait_comp(WAIT_TIMEOUT_MS);
+          } else {
+            futex_wait(&seq, expected, WAIT_TIMEOUT_MS);
+          }
+        }
+      }
+    }
+    nsleepers.fetch_sub(1, std::memory_order_relaxed);
+    if (done) return;
+    // make progress on whatever woke us up
+    if (!device.is_empty()) {
+      while (progress_x().device(device)().is_done()) {
+        if (test()) return;
+      }
+    }
+  }
+}
+}  // namespace lci
+
+#endif  // LCI_COMP_WAITER_HPP
@@ -0,0 +1,211 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_CORE_AM_AGGREGATION_HPP
+#define LCI_CORE_AM_AGGREGATION_HPP
+
+namespace lci
+{
+/**
+ * Per-destination aggregation of small active messages on an endpoint.
+ *
+ * Active messages no larger than am_aggregation_threshold are appended to a
+ * packet per target rank, each with a compact header_t, instead of being
+ * posted to the network one by one. A packet is sent as one internal control
+ * message (IMM_DATA_CTRL_AM_AGGREGATE) when it cannot take another message,
+ * when the user calls flush, or when the progress engine finds the device
+ * idle and no message has been appended to it since the last idle progress.
+ */
+class am_aggregator_t
+{
+ public:
+  struct header_t {
+    tag_t tag;
+    rcomp_t rcomp;
+    uint32_t size;
+  };
+
+  am_aggregator_t(endpoint_t endpoint_, size_t threshold_);
+  ~am_aggregator_t();
+
+  size_t get_threshold() const { return threshold; }
+  bool is_empty() const
+  {
+    return nbuffers_in_use.load(std::memory_order_relaxed) == 0;
+  }
+  // Append an active message to the packet of the target rank.
+  inline error_t push(int rank, void* buffer, size_t size, tag_t tag,
+                      rcomp_t rcomp, bool allow_retry);
+  // Send all non-empty packets. Return whether any packet has been sent.
+  inline bool flush();
+  // Send the packets that have not been appended to since the last call.
+  // Packets being appended by other threads are skipped.
+  inline bool flush_idle();
+
+ private:
+  struct alignas(LCI_CACHE_LINE) buffer_t {
+    spinlock_t lock;
+    packet_t* packet = nullptr;
+    size_t size = 0;
+    uint32_t nmsgs = 0;
+    // whether a message has been appended since the last flush_idle
+    bool active = false;
+  };
+
+  // Take the packet out of the buffer; the lock must be held.
+  inline packet_t* take(buffer_t& b, size_t* size, uint32_t* nmsgs);
+
+  inline void send(int rank, packet_t* packet, size_t size, uint32_t nmsgs);
+
+  endpoint_t endpoint;
+  packet_pool_t packet_pool;
+  size_t threshold;
+  size_t capacity;
+  int nranks;
+  std::unique_ptr<buffer_t[]> buffers;
+  std::atomic<int> nbuffers_in_use;
+};
+
+inline am_aggregator_t::am_aggregator_t(endpoint_t endpoint_,
+                                        size_t threshold_)
+    : endpoint(endpoint_),
+      packet_pool(endpoint_.get_impl()->device.get_impl()->packet_pool),
+      threshold(threshold_),
+      nranks(get_rank_n()),
+      nbuffers_in_use(0)
+{
+  LCI_Assert(!packet_pool.is_empty(),
+             "Active message aggregation requires a packet pool\n");
+  capacity = packet_pool.get_impl()->get_payload_size();
+  LCI_Assert(sizeof(header_t) + threshold <= capacity,
+             "am_aggregation_threshold %lu is too large for packets of %lu "
+             "bytes\n",
+             threshold, capacity);
+  buffers.reset(new buffer_t[nranks]);
+}
+
+inline am_aggregator_t::~am_aggregator_t()
+{
+  for (int i = 0; i < nranks; i++) {
+    if (buffers[i].packet) {
+      LCI_Warn("Drop %u aggregated active messages to rank %d\n",
+               buffers[i].nmsgs, i);
+      buffers[i].packet->put_back();
+    }
+  }
+}
+
+inline void am_aggregator_t::send(int rank, packet_t* packet, size_t size,
+                                  uint32_t nmsgs)
+{
+  internal_context_t* internal_ctx = new internal_context_t;
+  internal_ctx->rank = rank;
+  internal_ctx->packet_to_free = packet;
+  error_t error = endpoint.get_impl()->post_send(
+      rank, packet->get_payload_address(), size,
+      packet->get_mr(endpoint.get_impl()->device),
+      make_ctrl_imm_data(IMM_DATA_CTRL_AM_AGGREGATE, nmsgs), internal_ctx,
+      false /* allow_retry */);
+  LCI_Assert(!error.is_retry(), "Unexpected error %s\n", error.get_str());
+  LCI_PCOUNTER_ADD(am_aggregation_send, 1);
+}
+
+inline error_t am_aggregator_t::push(int rank, void* buffer, size_t size,
+                                     tag_t tag, rcomp_t rcomp,
+                                     bool allow_retry)
+{
+  LCI_DBG_Assert(size <= threshold, "The message is too large\n");
+  buffer_t& b = buffers[rank];
+  packet_t* packet_to_send = nullptr;
+  size_t size_to_send = 0;
+  uint32_t nmsgs_to_send = 0;
+  b.lock.lock();
+  if (!b.packet) {
+    b.packet = packet_pool.get_impl()->get(!allow_retry);
+    if (!b.packet) {
+      b.lock.unlock();
+      return errorcode_t::retry_nopacket;
+    }
+    nbuffers_in_use.fetch_add(1, std::memory_order_relaxed);
+  }
+  char* address =
+      static_cast<char*>(b.packet->get_payload_address()) + b.size;
+  header_t header = {tag, rcomp, static_cast<uint32_t>(size)};
+  memcpy(address, &header, sizeof(header));
+  if (size > 0) memcpy(address + sizeof(header), buffer, size);
+  b.size += sizeof(header) + size;
+  ++b.nmsgs;
+  b.active = true;
+  if (b.size + sizeof(header_t) + threshold > capacity) {
+    // The packet might not be able to take another message.
+    packet_to_send = take(b, &size_to_send, &nmsgs_to_send);
+  }
+  b.lock.unlock();
+  LCI_PCOUNTER_ADD(am_aggregation_push, 1);
+  if (packet_to_send) {
+    send(rank, packet_to_send, size_to_send, nmsgs_to_send);
+  }
+  return errorcode_t::done;
+}
+
+inline packet_t* am_aggregator_t::take(buffer_t& b, size_t* size,
+                                       uint32_t* nmsgs)
+{
+  packet_t* packet = b.packet;
+  *size = b.size;
+  *nmsgs = b.nmsgs;
+  if (packet) {
+    b.packet = nullptr;
+    b.size = 0;
+    b.nmsgs = 0;
+    nbuffers_in_use.fetch_sub(1, std::memory_order_relaxed);
+  }
+  return packet;
+}
+
+inline bool am_aggregator_t::flush()
+{
+  if (is_empty()) return false;
+  bool ret = false;
+  for (int rank = 0; rank < nranks; rank++) {
+    buffer_t& b = buffers[rank];
+    size_t size;
+    uint32_t nmsgs;
+    b.lock.lock();
+    packet_t* packet = take(b, &size, &nmsgs);
+    b.lock.unlock();
+    if (packet) {
+      send(rank, packet, size, nmsgs);
+      ret = true;
+    }
+  }
+  return ret;
+}
+
+inline bool am_aggregator_t::flush_idle()
+{
+  if (is_empty()) return false;
+  bool ret = false;
+  for (int rank = 0; rank < nranks; rank++) {
+    buffer_t& b = buffers[rank];
+    if (!b.lock.try_lock()) continue;
+    size_t size;
+    uint32_t nmsgs;
+    packet_t* packet = nullptr;
+    if (b.active) {
+      // give the packet one more chance to be filled
+      b.active = false;
+    } else {
+      packet = take(b, &size, &nmsgs);
+    }
+    b.lock.unlock();
+    if (packet) {
+      send(rank, packet, size, nmsgs);
+      ret = true;
+    }
+  }
+  return ret;
+}
+}  // namespace lci
+
+#endif  // LCI_CORE_AM_AGGREGATION_HPP
@@ -0,0 +1,203 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#include "lci_internal.hpp"
+
+namespace lci
+{
+namespace
+{
+error_t post_native_atomic(int rank, atomic_op_t op, atomic_type_t type,
+                           uint64_t operand, uint64_t compare,
+                           uintptr_t remote_disp, rmr_t rmr,
+                           endpoint_t endpoint, packet_pool_t packet_pool,
+                           internal_context_t* ctx, bool allow_retry)
+{
+  packet_t* packet =
+      packet_pool.get_impl()->get_for_size(sizeof(atomic_req_t), !allow_retry);
+  if (!packet) {
+    return errorcode_t::retry_nopacket;
+  }
+  ctx->packet_to_free = packet;
+  auto* req = static_cast<atomic_req_t*>(packet->get_payload_address());
+  req->buffer.result = 0;
+  req->buffer.operand = make_atomic_word(type, operand);
+  req->buffer.compare = make_atomic_word(type, compare);
+  req->offset = remote_disp;
+  req->rmr = rmr;
+  req->op = op;
+  req->type = type;
+  net_context_impl_t* p_net_context =
+      endpoint.get_impl()->device.get_impl()->net_context.get_impl();
+  req->is_cas_loop =
+      op == atomic_op_t::swap && p_net_context->emulate_atomic_swap;
+  if (req->is_cas_loop) {
+    // guess the remote value is 0; progress_atomic retries otherwise
+    op = atomic_op_t::cas;
+    req->buffer.compare = 0;
+  }
+  return endpoint.get_impl()->post_atomic(rank, op, type, &req->buffer,
+                                          packet->get_mr(endpoint), remote_disp,
+                                          rmr, ctx, allow_retry);
+}
+
+error_t post_am_atomic(int rank, atomic_op_t op, atomic_type_t type,
+                       uint64_t operand, uint64_t compare,
+                       uintptr_t remote_disp, rmr_t rmr, endpoint_t endpoint,
+                       internal_context_t* ctx, bool allow_retry)
+{
+  LCI_Assert(sizeof(atomic_msg_t) <=
+                 endpoint.get_impl()->net_context_attr.max_inject_size,
+             "The atomic message (%lu bytes) cannot be injected\n",
+             sizeof(atomic_msg_t));
+  atomic_msg_t msg;
+  msg.ctx = ctx;
+  msg.address = rmr.base + remote_disp;
+  msg.operand = make_atomic_word(type, operand);
+  msg.compare = make_atomic_word(type, compare);
+  error_t error = endpoint.get_impl()->post_sends(
+      rank, &msg, sizeof(msg),
+      make_ctrl_imm_data(IMM_DATA_CTRL_ATOMIC_REQ,
+                         make_atomic_ctrl_value(op, type)),
+      nullptr, allow_retry);
+  if (!error.is_retry()) {
+    LCI_PCOUNTER_ADD(atomic_am_send, 1);
+    // the operation completes with the response
+    error = errorcode_t::posted;
+  }
+  return error;
+}
+}  // namespace
+
+void progress_atomic(endpoint_t endpoint, const net_status_t& net_status)
+{
+  LCI_PCOUNTER_ADD(net_atomic_comp, 1)
+  internal_context_t* ctx =
+      static_cast<internal_context_t*>(net_status.user_context);
+  packet_t* packet = ctx->packet_to_free;
+  auto* req = static_cast<atomic_req_t*>(packet->get_payload_address());
+  if (req->is_cas_loop &&
+      memcmp(&req->buffer.result, &req->buffer.compare, ctx->size) != 0) {
+    // the swap failed: try again with the value we have just fetched
+    req->buffer.compare = req->buffer.result;
+    error_t error = endpoint.get_impl()->post_atomic(
+        ctx->rank, atomic_op_t::cas, req->type, &req->buffer,
+        packet->get_mr(endpoint), req->offset, req->rmr, ctx,
+        false /* allow_retry */);
+    LCI_Assert(!error.is_retry(), "Unexpected error %s\n", error.get_str());
+    return;
+  }
+  if (ctx->buffer && is_fetching_atomic_op(req->op)) {
+    memcpy(ctx->buffer, &req->buffer.result, ctx->size);
+  }
+  free_ctx_and_signal_comp(ctx);
+}
+
+void progress_atomic_req(endpoint_t endpoint, const net_status_t& net_status,
+                         uint32_t value)
+{
+  LCI_PCOUNTER_ADD(atomic_am_exec, 1)
+  packet_t* packet = static_cast<packet_t*>(net_status.user_context);
+  LCI_DBG_Assert(net_status.length == sizeof(atomic_msg_t),
+                 "Unexpected atomic message size %lu\n", net_status.length);
+  atomic_msg_t msg;
+  memcpy(&msg, packet->get_payload_address(), sizeof(msg));
+  packet->put_back();
+  atomic_resp_t resp;
+  resp.ctx = msg.ctx;
+  resp.result =
+      execute_atomic(get_atomic_ctrl_op(value), get_atomic_ctrl_type(value),
+                     msg.address, msg.operand, msg.compare);
+  error_t error = endpoint.get_impl()->post_sends(
+      net_status.rank, &resp, sizeof(resp),
+      make_ctrl_imm_data(IMM_DATA_CTRL_ATOMIC_RESP, value), nullptr,
+      false /* allow_retry */);
+  LCI_Assert(!error.is_retry(), "Unexpected error %s\n", error.get_str());
+}
+
+void progress_atomic_resp(const net_status_t& net_status, uint32_t value)
+{
+  packet_t* packet = static_cast<packet_t*>(net_status.user_context);
+  atomic_resp_t resp;
+  memcpy(&resp, packet->get_payload_address(), sizeof(resp));
+  packet->put_back();
+  internal_context_t* ctx = resp.ctx;
+  if (ctx->buffer && is_fetching_atomic_op(get_atomic_ctrl_op(value))) {
+    memcpy(ctx->buffer, &resp.result, ctx->size);
+  }
+  free_ctx_and_signal_comp(ctx);
+}
+
+status_t post_atomic_x::call_impl(
+    int rank, atomic_op_t op, uint64_t operand, void* result, comp_t local_comp,
+    uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, uint64_t compare,
+    atomic_type_t type, device_t device, endpoint_t endpoint,
+    packet_pool_t packet_pool, void* user_context, bool allow_done,
+    bool allow_posted, bool allow_retry) const
+{
+  // handle COMP_NULL and COMP_NULL_RETRY
+  if (local_comp == COMP_NULL) {
+    allow_retry = false;
+    allow_posted = false;
+  } else if (local_comp == COMP_NULL_RETRY) {
+    allow_posted = false;
+  }
+  LCI_Assert(allow_posted || allow_done,
+             "At least one of allow_posted and allow_done should be true\n");
+  LCI_Assert(!rmr.is_empty(),
+             "Atomic operations need a remote memory region\n");
+  const size_t size = get_atomic_type_size(type);
+  LCI_Assert((rmr.base + remote_disp) % size == 0,
+             "The remote address of an atomic operation has to be aligned to "
+             "%lu bytes\n",
+             size);
+  const auto& net_context_attr = device.get_impl()->net_context_attr;
+  bool is_native = size == 4 ? net_context_attr.support_atomic32
+                             : net_context_attr.support_atomic64;
+
+  status_t status;
+  status.rank = rank;
+  status.user_context = user_context;
+  status.buffer = result;
+  status.size = size;
+  comp_t comp = allow_posted ? local_comp : alloc_sync();
+  internal_context_t* ctx = new internal_context_t;
+  ctx->set_user_posted_op(endpoint);
+  ctx->rank = rank;
+  ctx->comp = comp;
+  ctx->buffer = result;
+  ctx->size = size;
+  ctx->user_context = user_context;
+  error_t error;
+  if (is_native) {
+    error = post_native_atomic(rank, op, type, operand, compare, remote_disp,
+                               rmr, endpoint, packet_pool, ctx, allow_retry);
+  } else {
+    error = post_am_atomic(rank, op, type, operand, compare, remote_disp, rmr,
+                           endpoint, ctx, allow_retry);
+  }
+  // We should not access the internal context after this point if the error
+  // is not retry, as it might be freed by the progress function.
+  status.error = error;
+  if (status.is_retry()) {
+    LCI_DBG_Assert(allow_retry, "Unexpected retry\n");
+    delete ctx;
+  } else if (!allow_posted) {
+    while (!sync_test(comp, &status)) {
+      progress_x().runtime(runtime).device(device).endpoint(endpoint)();
+    }
+    status.set_done();
+  } else {
+    status.set_posted();
+  }
+  if (!allow_posted) {
+    free_comp(&comp);
+  }
+  if (status.is_done() && !allow_done) {
+    lci::comp_signal(local_comp, status);
+    status.set_posted();
+  }
+  return status;
+}
+
+}  // namespace lci
@@ -0,0 +1,147 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_CORE_ATOMIC_HPP
+#define LCI_CORE_ATOMIC_HPP
+
+namespace lci
+{
+/**
+ * Remote atomic operations.
+ *
+ * If the network supports atomics on the operation type, the operation is
+ * posted as a network atomic. Its net_atomic_buffer_t lives in a packet (which
+ * is registered), together with what is needed to repost it. Networks without
+ * a native swap (verbs) execute swap as a loop of compare-and-swap.
+ *
+ * Otherwise, the operation is sent to the target as an internal control
+ * message (IMM_DATA_CTRL_ATOMIC_REQ) and executed by its progress engine,
+ * which replies with the old value (IMM_DATA_CTRL_ATOMIC_RESP). Both messages
+ * are injected.
+ *
+ * The two paths are not atomic with respect to each other, but all processes
+ * pick the same path for the same type.
+ */
+struct atomic_req_t {
+  net_atomic_buffer_t buffer;
+  uint64_t offset;
+  rmr_t rmr;
+  atomic_op_t op;
+  atomic_type_t type;
+  // a swap executed as compare-and-swap
+  bool is_cas_loop;
+};
+
+struct atomic_msg_t {
+  internal_context_t* ctx;
+  uintptr_t address;
+  uint64_t operand;
+  uint64_t compare;
+};
+
+struct atomic_resp_t {
+  internal_context_t* ctx;
+  uint64_t result;
+};
+
+inline size_t get_atomic_type_size(atomic_type_t type)
+{
+  return type == atomic_type_t::int32 || type == atomic_type_t::uint32 ? 4 : 8;
+}
+
+inline bool is_fetching_atomic_op(atomic_op_t op)
+{
+  return op != atomic_op_t::add;
+}
+
+// Store an integer of the type in the first bytes of a word.
+inline uint64_t make_atomic_word(atomic_type_t type, uint64_t value)
+{
+  uint64_t word = 0;
+  if (get_atomic_type_size(type) == 4) {
+    uint32_t v = static_cast<uint32_t>(value);
+    memcpy(&word, &v, sizeof(v));
+  } else {
+    word = value;
+  }
+  return word;
+}
+
+// The control message value of an atomic operation: op (4) ; type (4)
+inline uint32_t make_atomic_ctrl_value(atomic_op_t op, atomic_type_t type)
+{
+  return set_bits32(static_cast<uint32_t>(type), static_cast<uint32_t>(op), 4,
+                    4);
+}
+
+inline atomic_op_t get_atomic_ctrl_op(uint32_t value)
+{
+  return static_cast<atomic_op_t>(get_bits32(value, 4, 4));
+}
+
+inline atomic_type_t get_atomic_ctrl_type(uint32_t value)
+{
+  return static_cast<atomic_type_t>(get_bits32(value, 4, 0));
+}
+
+namespace atomic_detail
+{
+template <typename T>
+inline uint64_t execute(atomic_op_t op, uintptr_t address, uint64_t operand_,
+                        uint64_t compare_)
+{
+  T* p = reinterpret_cast<T*>(address);
+  T operand, compare, old;
+  memcpy(&operand, &operand_, sizeof(T));
+  memcpy(&compare, &compare_, sizeof(T));
+  switch (op) {
+    case atomic_op_t::add:
+    case atomic_op_t::fetch_add:
+      old = __atomic_fetch_add(p, operand, __ATOMIC_RELAXED);
+      break;
+    case atomic_op_t::swap:
+      old = __atomic_exchange_n(p, operand, __ATOMIC_RELAXED);
+      break;
+    case atomic_op_t::cas:
+      old = compare;
+      __atomic_compare_exchange_n(p, &old, operand, false, __ATOMIC_RELAXED,
+                                  __ATOMIC_RELAXED);
+      break;
+    default:
+      LCI_Assert(false, "Unknown atomic operation %d\n", static_cast<int>(op));
+      old = 0;
+  }
+  uint64_t ret = 0;
+  memcpy(&ret, &old, sizeof(T));
+  return ret;
+}
+}  // namespace atomic_detail
+
+// Execute an atomic operation on a local integer and return the old value.
+inline uint64_t execute_atomic(atomic_op_t op, atomic_type_t type,
+                               uintptr_t address, uint64_t operand,
+                               uint64_t compare)
+{
+  switch (type) {
+    case atomic_type_t::int32:
+      return atomic_detail::execute<int32_t>(op, address, operand, compare);
+    case atomic_type_t::uint32:
+      return atomic_detail::execute<uint32_t>(op, address, operand, compare);
+    case atomic_type_t::int64:
+      return atomic_detail::execute<int64_t>(op, address, operand, compare);
+    case atomic_type_t::uint64:
+      return atomic_detail::execute<uint64_t>(op, address, operand, compare);
+    default:
+      LCI_Assert(false, "Unknown atomic type %d\n", static_cast<int>(type));
+      return 0;
+  }
+}
+
+void progress_atomic(endpoint_t endpoint, const net_status_t& net_status);
+void progress_atomic_req(endpoint_t endpoint, const net_status_t& net_status,
+                         uint32_t value);
+void progress_atomic_resp(const net_status_t& net_status, uint32_t value);
+
+}  // namespace lci
+
+#endif  // LCI_CORE_ATOMIC_HPP
@@ -5,70 +5,15 @@
 
 namespace lci
 {
-enum class protocol_t {
-  none,
-  inject,
-  eager_bcopy,
-  eager_zcopy,
-  rdv_zcopy,
-  recv,
-};
-
 const char* get_protocol_str(protocol_t protocol)
 {
   static const char protocol_str[][16] = {
-      "none", "inject", "eager_bcopy", "eager_zcopy", "rdv_zcopy", "recv",
+      "none",      "inject", "eager_bcopy", "eager_zcopy",
+      "rdv_zcopy", "recv",   "aggregate",
   };
   return protocol_str[static_cast<int>(protocol)];
 }
 
-struct post_comm_args_t {
-  direction_t direction;
-  int rank;
-  void* local_buffer;
-  size_t size;
-  comp_t local_comp;
-  runtime_t runtime;
-  packet_pool_t packet_pool;
-  device_t device;
-  endpoint_t endpoint;
-  matching_engine_t matching_engine;
-  comp_semantic_t comp_semantic;
-  mr_t mr;
-  uintptr_t remote_disp;
-  rmr_t rmr;
-  tag_t tag;
-  rcomp_t remote_comp;
-  void* user_context;
-  matching_policy_t matching_policy;
-  bool allow_done;
-  bool allow_posted;
-  bool allow_retry;
-};
-
-struct post_comm_traits_t {
-  bool local_buffer_only;
-  bool local_comp_only;
-  bool is_recv;
-  size_t max_inject_size;
-  size_t max_bcopy_size;
-};
-
-struct post_comm_state_t {
-  rcomp_t rhandler = 0;
-  bool piggyback_tag_rcomp_in_msg = false;
-  net_imm_data_t imm_data = 0;
-  packet_t* packet = nullptr;
-  size_t packet_size_to_send = 0;
-  bool user_provided_packet = false;
-  internal_context_t* internal_ctx = nullptr;
-  protocol_t protocol = protocol_t::none;
-  mr_t mr;
-  comp_t local_comp = COMP_NULL;
-  bool comp_passed_to_network = false;
-  status_t status;
-};
-
 bool mr_may_be_device_memory(mr_t mr)
 {
   if (mr == MR_DEVICE || mr == MR_UNKNOWN) return true;
@@ -99,6 +44,26 @@ void preprocess_args(post_comm_args_t& args)
     args.allow_posted = false;
   }
 
+  // handle io vectors
+  if (args.iov) {
+    args.size = get_iov_size(args.iov, args.iov_count);
+    args.mr = MR_HOST;
+    for (size_t i = 0; i < args.iov_count; i++) {
+      LCI_Assert(!(args.iov[i].mr == MR_UNKNOWN),
+                 "MR_UNKNOWN is not supported in io vectors\n");
+      if (mr_may_be_device_memory(args.iov[i].mr)) args.mr = MR_DEVICE;
+    }
+  }
+
+  // handle datatypes
+  if (args.datatype) {
+    LCI_Assert(!args.iov, "datatypes cannot be used with io vectors\n");
+    LCI_Assert(!mr_may_be_device_memory(args.mr),
+               "datatypes are not supported for device memory\n");
+    validate_datatype(*args.datatype);
+    args.size = get_datatype_size(*args.datatype);
+  }
+
   // handle MR_UNKNOWN
 #if defined(LCI_USE_CUDA) || defined(LCI_USE_HIP)
   if (args.mr == MR_UNKNOWN) {
@@ -137,9 +102,12 @@ post_comm_traits_t validate_and_get_traits(const post_comm_args_t& args)
   LCI_Assert(!(args.direction == direction_t::IN && traits.local_buffer_only &&
                !traits.local_comp_only),
              "invalid communication primitive\n");
-  LCI_Assert(!(args.direction == direction_t::IN && !traits.local_buffer_only &&
-               !traits.local_comp_only),
-             "get with signal has not been implemented yet\n");
+  LCI_Assert(!(args.iov && traits.is_recv),
+             "io vectors are not supported by recv\n");
+  LCI_Assert(!(args.datatype && traits.is_recv),
+             "datatypes are not supported by recv\n");
+  LCI_Assert(!args.zero_copy || (traits.is_recv && !args.datatype),
+             "zero_copy is only supported by recv\n");
 
   return traits;
 }
@@ -163,11 +131,59 @@ void resolve_rhandler(const post_comm_args_t& args,
   }
 }
 
+// The network tag of a send-recv matched by the network:
+// rhandler (12) ; rank (20) ; tag (32)
+// The rhandler encodes the matching engine and the matching policy.
+uint64_t make_net_tag(rcomp_t rhandler, int rank, tag_t tag)
+{
+  // 0xfff is reserved for the packet size classes (make_size_class_net_tag)
+  LCI_Assert(rhandler < (1u << 12) - 1 && rank < (1 << 20),
+             "The remote handler %u or the rank %d does not fit in the network "
+             "tag\n",
+             rhandler, rank);
+  uint64_t net_tag = set_bits64(0, rhandler, 12, 52);
+  net_tag = set_bits64(net_tag, rank, 20, 32);
+  return set_bits64(net_tag, tag, 32, 0);
+}
+
+// Whether a send-recv is matched by the network instead of the matching
+// engine. Both sides have to make the same decision, so it only depends on
+// the matching engine and the network context.
+bool is_tagged_sendrecv(const post_comm_args_t& args,
+                        const post_comm_traits_t& traits)
+{
+  if (args.matching_engine.is_empty() || args.remote_comp ||
+      !traits.local_buffer_only ||
+      args.matching_engine.get_impl()->attr.matching_engine_type !=
+          attr_matching_engine_type_t::offload ||
+      !args.device.get_impl()->net_context_attr.support_tagged) {
+    return false;
+  }
+  LCI_Assert(!args.iov && !args.datatype && !args.zero_copy,
+             "io vectors, datatypes and zero-copy receives are not supported "
+             "by the offload matching engine\n");
+  LCI_Assert(args.tag <= std::numeric_limits<uint32_t>::max() ||
+                 (traits.is_recv && args.tag == ANY_TAG),
+             "The tag %lu of the offload matching engine does not fit in 32 "
+             "bits\n",
+             args.tag);
+  LCI_Assert(args.size <=
+                 args.device.get_impl()->net_context.get_attr_max_msg_size(),
+             "The message (%lu bytes) of the offload matching engine is "
+             "larger than the maximum message size\n",
+             args.size);
+  return true;
+}
+
 // state in: rhandler
-// state out: protocol, piggyback_tag_rcomp_in_msg
+// state out: protocol, use_tagged, rdv_use_read, rdv_use_pipeline,
+//            piggyback_tag_rcomp_in_msg
 void set_protocol(const post_comm_args_t& args,
                   const post_comm_traits_t& traits, post_comm_state_t& state)
 {
+  // The network carries the tag of a tagged message and takes care of the
+  // rendezvous of large ones.
+  state.use_tagged = is_tagged_sendrecv(args, traits);
   bool force_zcopy = false;
 #if defined(LCI_USE_CUDA) || defined(LCI_USE_HIP)
   if (args.mr == MR_DEVICE ||
@@ -178,37 +194,80 @@ void set_protocol(const post_comm_args_t& args,
 #endif  // LCI_USE_CUDA || LCI_USE_HIP
   // determine the message size if we are using the eager protocol
   size_t msg_size_if_eager = args.size;
-  if (args.direction == direction_t::OUT && state.rhandler) {
+  if (args.direction == direction_t::OUT && state.rhandler &&
+      !state.use_tagged) {
     // send/am/put_signal with eager protocol
     if (eager_payload_needs_metadata(args, state)) {
       msg_size_if_eager += sizeof(args.tag) + sizeof(state.rhandler);
     }
   }
   const bool eager_needs_payload_metadata = msg_size_if_eager > args.size;
+  // the protocol thresholds of the runtime are capped by the static limits
+  const runtime_attr_t& runtime_attr = args.runtime.get_impl()->attr;
+  const size_t inject_threshold =
+      std::min(runtime_attr.inject_threshold, traits.max_inject_size);
+  const size_t eager_threshold =
+      std::min(runtime_attr.eager_threshold, traits.max_bcopy_size);
+  // Whether a buffer copy is preferred to a zero-copy eager message, i.e.,
+  // the local buffer has not been registered. An outgoing io vector is also
+  // copied if it cannot be sent with one network operation. A datatype is
+  // always packed into/unpacked from a packet.
+  bool bcopy_preferred = args.mr.is_empty() || args.datatype ||
+                         args.size < runtime_attr.zcopy_threshold;
+  if (args.iov) {
+    bcopy_preferred =
+        args.direction == direction_t::OUT &&
+        args.iov_count >
+            args.device.get_impl()->net_context.get_attr_max_iov();
+    for (size_t i = 0; i < args.iov_count && !bcopy_preferred; i++) {
+      if (args.iov[i].size > 0 && args.iov[i].mr.is_empty())
+        bcopy_preferred = args.direction == direction_t::OUT;
+    }
+  }
 
   if (args.direction == direction_t::IN && traits.local_buffer_only) {
     state.protocol = protocol_t::recv;
   } else if (args.direction == direction_t::OUT && traits.local_buffer_only &&
-             (msg_size_if_eager > traits.max_bcopy_size || force_zcopy)) {
+             !state.use_tagged &&
+             (msg_size_if_eager > eager_threshold || force_zcopy)) {
     // We use the rendezvous protocol if
     // 1. we are doing a send/am, and
-    // 1.1 The size of the data is larger than the maximum buffer-copy size, or
+    // 1.1 The size of the data is larger than the eager threshold, or
     // 1.2 We force the use of the zero-copy protocol.
+    // io vectors are written segment by segment and datatypes are packed
+    // chunk by chunk with the write protocol
+    const bool contiguous = !args.iov && !args.datatype;
     state.protocol = protocol_t::rdv_zcopy;
-  } else if (msg_size_if_eager <= traits.max_inject_size &&
+    state.rdv_use_read =
+        contiguous && rdv_use_read(args.runtime.get_impl(), args.size);
+    state.rdv_use_pipeline =
+        contiguous && !state.rdv_use_read &&
+        rdv_use_pipeline(args.runtime.get_impl(),
+                         args.device.get_impl()->net_context, args.size);
+  } else if (args.direction == direction_t::OUT && traits.local_buffer_only &&
+             args.remote_comp && args.endpoint.get_impl()->am_aggregator &&
+             args.size <=
+                 args.endpoint.get_impl()->am_aggregator->get_threshold() &&
+             args.comp_semantic == comp_semantic_t::memory && !args.iov &&
+             !args.datatype && !mr_may_be_device_memory(args.mr) &&
+             !force_zcopy) {
+    // Small active messages are packed into the per-rank packet of the
+    // endpoint aggregator. The data is copied, so they complete immediately.
+    state.protocol = protocol_t::aggregate;
+  } else if (msg_size_if_eager <= inject_threshold &&
              args.direction == direction_t::OUT &&
              args.comp_semantic == comp_semantic_t::memory && !force_zcopy &&
-             !eager_needs_payload_metadata) {
+             !eager_needs_payload_metadata && !args.iov && !args.datatype) {
     // We use the inject protocol only if the six conditions are met:
     // 1. We are sending a single buffer, and
-    // 2. The size of the data is smaller than the maximum inject size, and
+    // 2. The size of the data is not larger than the inject threshold, and
     // 3. The direction is OUT, and
     // 4. The completion type is buffer.
     // 5. We are not forcing the use of the zero-copy protocol.
     // 6. The tag/rcomp metadata fits in immediate data. Slow-path metadata
     //    must be carried in a bcopy packet payload.
     state.protocol = protocol_t::inject;
-  } else if ((args.mr.is_empty() || eager_needs_payload_metadata) &&
+  } else if ((bcopy_preferred || eager_needs_payload_metadata) &&
              msg_size_if_eager <= traits.max_bcopy_size &&
              !mr_may_be_device_memory(args.mr) && !force_zcopy) {
     state.protocol = protocol_t::eager_bcopy;
@@ -244,35 +303,33 @@ void set_immediate_data(const post_comm_args_t& args, const post_comm_traits_t&,
     // send/am with rendezvous
     // bit 29-30: imm_data_msg_type_t
     imm_data = set_bits32(0, IMM_DATA_MSG_RTS, 2, 29);
-  } else if (args.direction == direction_t::OUT && state.rhandler) {
+  } else if (args.direction == direction_t::OUT && state.rhandler &&
+             !state.use_tagged) {
     // send/am/put_signal with eager protocol
-    if (args.tag <= args.runtime.get_attr_max_imm_tag() &&
-        state.rhandler <= args.runtime.get_attr_max_imm_rcomp()) {
-      // is_fastpath (1) ; rhandler (15) ; tag (16)
-      imm_data = set_bits32(imm_data, 1, 1, 31);  // is_fastpath
-      imm_data = set_bits32(imm_data, args.tag,
-                            args.runtime.get_attr_imm_nbits_tag(), 0);
-      imm_data = set_bits32(imm_data, state.rhandler,
-                            args.runtime.get_attr_imm_nbits_rcomp(), 16);
-    } else {
-      // is_fastpath (0) ; msg_type (2)
-      static_assert(IMM_DATA_MSG_EAGER == 0, "Unexpected IMM_DATA_MSG_EAGER");
-    }
+    make_eager_imm_data(args.runtime, args.tag, state.rhandler, &imm_data);
   }
   state.imm_data = imm_data;
 }
 
 // state in: protocol, rhandler, piggyback_tag_rcomp_in_msg
-// state.out: packet, user_provided_packet
+// state.out: packet, user_provided_packet, user_packet_to_free
 error_t set_packet_if_needed(const post_comm_args_t& args,
-                             [[maybe_unused]] const post_comm_traits_t& traits,
+                             const post_comm_traits_t& traits,
                              post_comm_state_t& state)
 {
-  // Only the bcopy protocol and the rendezvous protocol need a packet
-  if (state.protocol != protocol_t::eager_bcopy &&
-      state.protocol != protocol_t::rdv_zcopy) {
+  // Only the bcopy protocol and the rendezvous protocol need a packet.
+  // The rendezvous protocol only needs it when the rts message cannot be
+  // injected. A tagged recv receives a small message into a packet if the
+  // local buffer has not been registered.
+  bool need_packet =
+      state.protocol == protocol_t::eager_bcopy ||
+      (state.protocol == protocol_t::rdv_zcopy &&
+       sizeof(rts_msg_t) > traits.max_inject_size) ||
+      (state.use_tagged && traits.is_recv && args.mr.is_empty() &&
+       args.size <= traits.max_bcopy_size);
+  if (!need_packet) {
     if (args.packet_pool.p_impl->is_packet(args.local_buffer)) {
-      // Even though these two protocols do not need a packet, the user
+      // Even though this protocol does not need a packet, the user
       // might provide a packet as the local buffer. In this case, we
       // should mark that the user has provided a packet to make sure
       // that we will free
@@ -281,15 +338,34 @@ error_t set_packet_if_needed(const post_comm_args_t& args,
     }
     return errorcode_t::done;
   }
+  // The payload the packet needs. An eager message also needs room for the
+  // piggybacked tag and remote handler and the immediate data appended by
+  // eager-RDMA.
+  size_t packet_size_needed = sizeof(rts_msg_t);
+  if (state.protocol != protocol_t::rdv_zcopy) {
+    packet_size_needed = args.size + sizeof(tag_t) + sizeof(rcomp_t) +
+                         sizeof(net_imm_data_t);
+  }
   // get a packet
-  if (state.protocol == protocol_t::eager_bcopy &&
+  if (state.protocol == protocol_t::eager_bcopy && !args.datatype &&
       args.packet_pool.p_impl->is_packet(args.local_buffer)) {
     // users provide a packet
-    state.user_provided_packet = true;
     state.packet = address2packet(args.local_buffer);
-  } else {
-    // allocate a packet
-    state.packet = args.packet_pool.p_impl->get(!args.allow_retry);
+    if (args.packet_pool.p_impl->get_payload_size(state.packet) >=
+        packet_size_needed) {
+      state.user_provided_packet = true;
+    } else {
+      // a packet of a smaller size class without room for the trailer
+      state.user_packet_to_free = state.packet;
+      state.packet = nullptr;
+    }
+  }
+  if (!state.packet) {
+    // allocate a packet of the smallest size class that fits
+    state.packet = args.packet_pool.p_impl->get_for_size(
+        std::min(packet_size_needed,
+                 args.packet_pool.p_impl->get_payload_size()),
+        !args.allow_retry);
     if (!state.packet) {
       return errorcode_t::retry_nopacket;
     }
@@ -299,8 +375,20 @@ error_t set_packet_if_needed(const post_comm_args_t& args,
   }
   // build the packet
   if (args.direction == direction_t::OUT) {
-    if (!state.user_provided_packet)
+    if (args.iov) {
+      // gather the io vector into the packet
+      char* buffer = static_cast<char*>(state.packet->get_payload_address());
+      for (size_t i = 0; i < args.iov_count; i++) {
+        if (args.iov[i].size == 0) continue;
+        memcpy(buffer, args.iov[i].buffer, args.iov[i].size);
+        buffer += args.iov[i].size;
+      }
+    } else if (args.datatype) {
+      datatype_pack(*args.datatype, args.local_buffer, 0,
+                    state.packet->get_payload_address(), args.size);
+    } else if (!state.user_provided_packet) {
       memcpy(state.packet->get_payload_address(), args.local_buffer, args.size);
+    }
     state.packet_size_to_send = args.size;
     if (state.piggyback_tag_rcomp_in_msg) {
       char* buffer = (char*)state.packet->get_payload_address();
@@ -343,9 +431,10 @@ error_t check_backlog(const post_comm_args_t& args, const post_comm_traits_t&,
   return errorcode_t::done;
 }
 
-// state in: protocol, packet, local_comp
+// state in: protocol, rdv_use_read, packet, local_comp, rhandler
 // state out: internal_ctx, mr
-void set_internal_ctx(const post_comm_args_t& args, const post_comm_traits_t&,
+void set_internal_ctx(const post_comm_args_t& args,
+                      const post_comm_traits_t& traits,
                       post_comm_state_t& state)
 {
   state.internal_ctx = new internal_context_t;
@@ -356,6 +445,11 @@ void set_internal_ctx(const post_comm_args_t& args, const post_comm_traits_t&,
   state.internal_ctx->buffer = args.local_buffer;
   state.internal_ctx->size = args.size;
   state.internal_ctx->packet_to_free = state.packet;
+  state.internal_ctx->is_zero_copy_recv = args.zero_copy;
+  if (args.direction == direction_t::IN && !traits.is_recv) {
+    // get with signal: signal the target once the data has arrived
+    state.internal_ctx->signal_rcomp = state.rhandler;
+  }
   // We need to set the local completion object in one of the following cases:
   // 1. The protocol is zero-copy.
   // 2. The completion type is network.
@@ -372,17 +466,38 @@ void set_internal_ctx(const post_comm_args_t& args, const post_comm_traits_t&,
   } else {
     state.comp_passed_to_network = false;
   }
-  // We need to have valid memeory regions if all of the following conditions
-  // are met:
+  // We need to have valid memeory regions in one of the following cases:
   // 1. The protocol is zero-copy.
   // Note: mr for zero-copy send/recv will be handled in the rendezvous
   // protocol.
+  // 2. The protocol is rendezvous with the read protocol.
+  // 3. The network receives a tagged message into the local buffer.
+  // Note: the entries of an io vector are registered when they are posted.
   state.mr = args.mr;
-  if (state.protocol == protocol_t::eager_zcopy && state.mr.is_empty()) {
+  if (args.iov) {
+    if (state.protocol == protocol_t::rdv_zcopy) {
+      // the io vector is only read after the rtr message arrives
+      state.internal_ctx->iov = new iovec_t[args.iov_count];
+      std::copy(args.iov, args.iov + args.iov_count, state.internal_ctx->iov);
+      state.internal_ctx->iov_count = args.iov_count;
+    }
+  } else if (args.datatype) {
+    // the data is packed/unpacked through a packet or a staging buffer
+    if (state.protocol == protocol_t::rdv_zcopy ||
+        args.direction == direction_t::IN) {
+      state.internal_ctx->datatype = new datatype_t(*args.datatype);
+    }
+  } else if ((state.protocol == protocol_t::eager_zcopy ||
+              state.rdv_use_read ||
+              (state.use_tagged && traits.is_recv && !state.packet)) &&
+             state.mr.is_empty()) {
     state.mr = register_memory_x(args.local_buffer, args.size)
                    .runtime(args.runtime)
                    .device(args.device)();
     state.internal_ctx->set_mr_on_the_fly(state.mr);
+  } else if (!state.mr.is_empty()) {
+    // the rendezvous protocol reuses the registration of the local buffer
+    state.internal_ctx->mr = state.mr;
   }
 }
 
@@ -400,13 +515,350 @@ void set_status(const post_comm_args_t& args, const post_comm_traits_t&,
   state.status = status;
 }
 
+// Try to write an eager message into the eager-RDMA ring of the target.
+// `mr` is empty if the message is sent from the user buffer without a packet.
+// Return false if the message should go through the regular send path.
+bool post_eager_rdma(const post_comm_args_t& args,
+                     const post_comm_traits_t& traits,
+                     const post_comm_state_t& state, void* buffer, size_t size,
+                     mr_t mr, error_t* error)
+{
+  eager_rdma_t* eager_rdma = args.device.get_impl()->eager_rdma;
+  if (!eager_rdma) return false;
+  size_t msg_size = size + sizeof(net_imm_data_t);
+  if (mr.is_empty()) {
+    if (msg_size > traits.max_inject_size ||
+        msg_size > eager_rdma_t::MAX_INJECT_SIZE)
+      return false;
+  } else if (msg_size >
+             args.packet_pool.get_impl()->get_payload_size(state.packet)) {
+    return false;
+  }
+  uint64_t offset;
+  rmr_t rmr;
+  net_imm_data_t imm_data;
+  if (!eager_rdma->acquire_slot(args.endpoint, args.rank, &offset, &rmr,
+                                &imm_data, size))
+    return false;
+  // The slot has been taken, so the write must not be retried by the user.
+  // Append the immediate data of the message after the payload.
+  if (mr.is_empty()) {
+    char staging[eager_rdma_t::MAX_INJECT_SIZE];
+    memcpy(staging, buffer, size);
+    memcpy(staging + size, &state.imm_data, sizeof(net_imm_data_t));
+    *error = args.endpoint.p_impl->post_putImms(
+        args.rank, staging, msg_size, offset, rmr, imm_data,
+        state.internal_ctx, false /* allow_retry */);
+  } else {
+    memcpy(static_cast<char*>(buffer) + size, &state.imm_data,
+           sizeof(net_imm_data_t));
+    *error = args.endpoint.p_impl->post_putImm(
+        args.rank, buffer, msg_size, mr, offset, rmr, imm_data,
+        state.internal_ctx, false /* allow_retry */);
+  }
+  LCI_PCOUNTER_ADD(eager_rdma_send, 1);
+  return true;
+}
+
+// Post a zero-copy put/get/send of an io vector. The io vector is split into
+// as few network operations as possible. Unregistered entries are registered
+// on the fly and deregistered once all operations complete.
+error_t post_iov_zcopy(const post_comm_args_t& args,
+                       const post_comm_traits_t& traits,
+                       post_comm_state_t& state)
+{
+  net_context_t net_context = args.device.get_impl()->net_context;
+  internal_context_extended_t* ectx = nullptr;
+  std::vector<iovec_t> iov(args.iov, args.iov + args.iov_count);
+  for (size_t i = 0; i < iov.size(); i++) {
+    if (iov[i].size == 0 || !iov[i].mr.is_empty()) continue;
+    if (!ectx) {
+      ectx = new internal_context_extended_t;
+      ectx->alloc_chunk_mrs(iov.size());
+    }
+    iov[i].mr = register_memory_x(iov[i].buffer, iov[i].size)
+                    .runtime(args.runtime)
+                    .device(args.device)();
+    ectx->chunk_mrs[i] = iov[i].mr;
+  }
+  iov_splitter_t splitter(iov.data(), iov.size(),
+                          net_context.get_attr_max_iov(),
+                          net_context.get_attr_max_msg_size());
+  size_t nops = splitter.count_pieces();
+  LCI_Assert(nops == 1 || !traits.local_buffer_only,
+             "Cannot split an io vector send into %lu messages\n", nops);
+  if (nops > 1 && !ectx) {
+    ectx = new internal_context_extended_t;
+  }
+  void* ctx = state.internal_ctx;
+  // Whether the immediate data is sent after all writes complete
+  bool separate_imm = false;
+  if (ectx) {
+    ectx->internal_ctx = state.internal_ctx;
+    ectx->signal_count = nops;
+    ctx = ectx;
+    if (nops > 1 && state.rhandler && args.direction == direction_t::OUT &&
+        !traits.local_buffer_only) {
+      ectx->imm_data_rank = args.rank;
+      ectx->imm_data = state.imm_data;
+      separate_imm = true;
+    }
+  }
+
+  iovec_t piece[LCI_BACKEND_MAX_IOV];
+  size_t piece_count, piece_size;
+  uintptr_t remote_disp = args.remote_disp;
+  bool allow_retry = args.allow_retry;
+  error_t error;
+  while (splitter.next(piece, &piece_count, &piece_size)) {
+    auto endpoint = args.endpoint.get_impl();
+    if (args.direction == direction_t::IN) {
+      error = endpoint->post_getv(args.rank, piece, piece_count, remote_disp,
+                                  args.rmr, ctx, allow_retry);
+    } else if (traits.local_buffer_only) {
+      error = endpoint->post_sendv(args.rank, piece, piece_count,
+                                   state.imm_data, ctx, allow_retry);
+    } else if (state.rhandler && !separate_imm) {
+      error = endpoint->post_putImmv(args.rank, piece, piece_count,
+                                     remote_disp, args.rmr, state.imm_data,
+                                     ctx, allow_retry);
+    } else {
+      error = endpoint->post_putv(args.rank, piece, piece_count, remote_disp,
+                                  args.rmr, ctx, allow_retry);
+    }
+    if (error.is_retry()) {
+      LCI_DBG_Assert(allow_retry, "Unexpected retry\n");
+      delete ectx;
+      return error;
+    }
+    LCI_Assert(error.is_posted(), "Unexpected error %s\n", error.get_str());
+    // The operation has started; the remaining pieces go to the backlog
+    // queue if the network is busy.
+    allow_retry = false;
+    remote_disp += piece_size;
+  }
+  return error;
+}
+
+// Post a put/get of a datatype too large for a packet through a registered
+// staging buffer. The data is moved in chunks so that packing a chunk
+// overlaps with the transfer of the previous ones. The data of a get is
+// unpacked once all chunks have arrived.
+error_t post_datatype_zcopy(const post_comm_args_t& args,
+                            [[maybe_unused]] const post_comm_traits_t& traits,
+                            post_comm_state_t& state)
+{
+  LCI_DBG_Assert(!traits.local_buffer_only,
+                 "Unexpected zero-copy datatype send\n");
+  const size_t chunk_size = rdv_pipeline_chunk_size(
+      args.runtime.get_impl(), args.device.get_impl()->net_context);
+  const size_t nchunks = (args.size + chunk_size - 1) / chunk_size;
+  auto ectx = new internal_context_extended_t;
+  ectx->internal_ctx = state.internal_ctx;
+  ectx->signal_count = nchunks;
+  ectx->staging_buffer = alloc_memalign(args.size);
+  ectx->alloc_chunk_mrs(1);
+  ectx->chunk_mrs[0] = register_memory_x(ectx->staging_buffer, args.size)
+                           .runtime(args.runtime)
+                           .device(args.device)();
+  mr_t mr = ectx->chunk_mrs[0];
+  // Whether the immediate data is sent after all writes complete
+  const bool separate_imm =
+      nchunks > 1 && state.rhandler && args.direction == direction_t::OUT;
+  if (separate_imm) {
+    ectx->imm_data_rank = args.rank;
+    ectx->imm_data = state.imm_data;
+  }
+
+  bool allow_retry = args.allow_retry;
+  error_t error;
+  for (size_t offset = 0; offset < args.size; offset += chunk_size) {
+    char* address = static_cast<char*>(ectx->staging_buffer) + offset;
+    size_t length = std::min(args.size - offset, chunk_size);
+    auto endpoint = args.endpoint.get_impl();
+    if (args.direction == direction_t::IN) {
+      error = endpoint->post_get(args.rank, address, length, mr,
+                                 args.remote_disp + offset, args.rmr, ectx,
+                                 allow_retry);
+    } else {
+      datatype_pack(*args.datatype, args.local_buffer, offset, address,
+                    length);
+      if (state.rhandler && !separate_imm) {
+        error = endpoint->post_putImm(args.rank, address, length, mr,
+                                      args.remote_disp + offset, args.rmr,
+                                      state.imm_data, ectx, allow_retry);
+      } else {
+        error = endpoint->post_put(args.rank, address, length, mr,
+                                   args.remote_disp + offset, args.rmr, ectx,
+                                   allow_retry);
+      }
+    }
+    if (error.is_retry()) {
+      LCI_DBG_Assert(allow_retry, "Unexpected retry\n");
+      delete ectx;
+      return error;
+    }
+    LCI_Assert(error.is_posted(), "Unexpected error %s\n", error.get_str());
+    allow_retry = false;
+  }
+  return error;
+}
+
+namespace
+{
+// The operations staged by begin_batch on the calling thread.
+struct comm_batch_t {
+  endpoint_impl_t* endpoint = nullptr;
+  std::vector<net_batch_op_t> ops;
+};
+thread_local comm_batch_t tls_batch;
+
+void flush_staged_ops()
+{
+  if (tls_batch.ops.empty()) return;
+  tls_batch.endpoint->post_batch(tls_batch.ops.data(), tls_batch.ops.size(),
+                                 false /* allow_retry */);
+  tls_batch.ops.clear();
+}
+}  // namespace
+
+void flush_thread_batch()
+{
+  if (LCT_unlikely(!tls_batch.ops.empty())) flush_staged_ops();
+}
+
+// Stage the operation in the open batch of the calling thread if it is a
+// single send/put/get of a registered buffer. Blocking operations are never
+// staged. Return false if the operation should be posted now.
+bool stage_batch_op(const post_comm_args_t& args,
+                    const post_comm_traits_t& traits,
+                    const post_comm_state_t& state, error_t* error)
+{
+  if (!args.allow_posted || args.iov || args.datatype) return false;
+  net_batch_op_t op;
+  op.rank = args.rank;
+  op.offset = args.remote_disp;
+  op.rmr = args.rmr;
+  op.imm_data = state.imm_data;
+  op.user_context = state.internal_ctx;
+  if (state.protocol == protocol_t::eager_zcopy) {
+    op.buffer = args.local_buffer;
+    op.size = args.size;
+    op.mr = state.mr;
+  } else if (state.protocol == protocol_t::eager_bcopy &&
+             !traits.local_buffer_only) {
+    // the buffer-copy sends may go through shared memory or eager RDMA
+    op.buffer = state.packet->get_payload_address();
+    op.size = args.direction == direction_t::OUT ? state.packet_size_to_send
+                                                 : args.size;
+    op.mr = state.packet->get_mr(args.device);
+  } else {
+    return false;
+  }
+  if (args.direction == direction_t::IN) {
+    op.type = net_batch_op_t::type_t::get;
+  } else if (traits.local_buffer_only) {
+    op.type = net_batch_op_t::type_t::send;
+  } else if (state.rhandler) {
+    op.type = net_batch_op_t::type_t::putImm;
+  } else {
+    op.type = net_batch_op_t::type_t::put;
+  }
+  tls_batch.ops.push_back(op);
+  *error = errorcode_t::posted;
+  // As without a batch, the local buffer of a buffer-copy put can be reused
+  // once it has been copied into the packet, although the packet is only
+  // sent when the batch is flushed.
+  if (state.protocol == protocol_t::eager_bcopy &&
+      args.direction == direction_t::OUT &&
+      args.comp_semantic == comp_semantic_t::memory) {
+    *error = errorcode_t::done;
+  }
+  return true;
+}
+
 // state in: all
 // state out: status
+// Post a send-recv matched by the network.
+error_t post_tagged(const post_comm_args_t& args,
+                    const post_comm_state_t& state)
+{
+  error_t error;
+  if (args.direction == direction_t::OUT) {
+    uint64_t net_tag = make_net_tag(state.rhandler, get_rank_me(), args.tag);
+    if (state.protocol == protocol_t::inject) {
+      error = args.endpoint.p_impl->post_tsends(
+          args.rank, args.local_buffer, args.size, net_tag, state.internal_ctx,
+          args.allow_retry);
+    } else if (state.protocol == protocol_t::eager_bcopy) {
+      error = args.endpoint.p_impl->post_tsend(
+          args.rank, state.packet->get_payload_address(), args.size,
+          state.packet->get_mr(args.device), net_tag, state.internal_ctx,
+          args.allow_retry);
+      if (error.is_posted() && args.comp_semantic == comp_semantic_t::memory) {
+        error = errorcode_t::done;
+      }
+    } else {
+      error = args.endpoint.p_impl->post_tsend(
+          args.rank, args.local_buffer, args.size, state.mr, net_tag,
+          state.internal_ctx, args.allow_retry);
+    }
+    return error;
+  }
+  // If any of the LCI_ANY is used, we will ignore the matching policy
+  matching_policy_t matching_policy = args.matching_policy;
+  if (args.rank == ANY_SOURCE && args.tag == ANY_TAG) {
+    matching_policy = matching_policy_t::none;
+  } else if (args.rank == ANY_SOURCE) {
+    matching_policy = matching_policy_t::tag_only;
+  } else if (args.tag == ANY_TAG) {
+    matching_policy = matching_policy_t::rank_only;
+  }
+  const bool match_rank = matching_policy == matching_policy_t::rank_only ||
+                          matching_policy == matching_policy_t::rank_tag;
+  const bool match_tag = matching_policy == matching_policy_t::tag_only ||
+                         matching_policy == matching_policy_t::rank_tag;
+  uint64_t net_tag = make_net_tag(
+      args.matching_engine.get_impl()->get_rhandler(matching_policy),
+      match_rank ? args.rank : 0, match_tag ? args.tag : 0);
+  uint64_t ignore = 0;
+  if (!match_rank) ignore = set_bits64(ignore, (1 << 20) - 1, 20, 32);
+  if (!match_tag) ignore = set_bits64(ignore, UINT32_MAX, 32, 0);
+  void* buffer = args.local_buffer;
+  mr_t mr = state.mr;
+  if (state.packet) {
+    // the message is copied into the local buffer once it arrives
+    buffer = state.packet->get_payload_address();
+    mr = state.packet->get_mr(args.device);
+  }
+  device_impl_t* device = args.device.get_impl();
+  error = device->post_trecv(buffer, args.size, mr, net_tag, ignore,
+                             state.internal_ctx);
+  while (error.is_retry() && !args.allow_retry) {
+    progress_x().runtime(args.runtime).device(args.device).endpoint(
+        args.endpoint)();
+    error = device->post_trecv(buffer, args.size, mr, net_tag, ignore,
+                               state.internal_ctx);
+  }
+  LCI_DBG_Assert(!error.is_done(), "Unexpected error %s\n", error.get_str());
+  return error;
+}
+
 error_t post_network_op(const post_comm_args_t& args,
                         const post_comm_traits_t& traits,
                         post_comm_state_t& state)
 {
   error_t error;
+  if (state.use_tagged) {
+    // send-recv matched by the network
+    return post_tagged(args, state);
+  }
+  if (LCT_unlikely(tls_batch.endpoint == args.endpoint.get_impl()) &&
+      state.protocol != protocol_t::recv) {
+    if (stage_batch_op(args, traits, state, &error)) return error;
+    // keep the order of the operations
+    flush_staged_ops();
+  }
   if (args.direction == direction_t::OUT) {
     /**********************************************************************************
      * direction out
@@ -430,9 +882,12 @@ error_t post_network_op(const post_comm_args_t& args,
                      "Unexpected SHM post_send error %s\n", error.get_str());
         }
 #endif
-        error = args.endpoint.p_impl->post_sends(
-            args.rank, args.local_buffer, args.size, state.imm_data,
-            state.internal_ctx, args.allow_retry);
+        if (!post_eager_rdma(args, traits, state, args.local_buffer,
+                             args.size, mr_t(), &error)) {
+          error = args.endpoint.p_impl->post_sends(
+              args.rank, args.local_buffer, args.size, state.imm_data,
+              state.internal_ctx, args.allow_retry);
+        }
       } else if (!state.rhandler) {
         // rdma write
         error = args.endpoint.p_impl->post_puts(
@@ -468,10 +923,14 @@ error_t post_network_op(const post_comm_args_t& args,
                      "Unexpected SHM post_send error %s\n", error.get_str());
         }
 #endif
-        error = args.endpoint.p_impl->post_send(
-            args.rank, buffer, state.packet_size_to_send,
-            state.packet->get_mr(args.device), state.imm_data,
-            state.internal_ctx, args.allow_retry);
+        if (!post_eager_rdma(args, traits, state, buffer,
+                             state.packet_size_to_send,
+                             state.packet->get_mr(args.device), &error)) {
+          error = args.endpoint.p_impl->post_send(
+              args.rank, buffer, state.packet_size_to_send,
+              state.packet->get_mr(args.device), state.imm_data,
+              state.internal_ctx, args.allow_retry);
+        }
       } else if (!state.rhandler) {
         // buffer-copy put
         error = args.endpoint.p_impl->post_put(
@@ -490,7 +949,13 @@ error_t post_network_op(const post_comm_args_t& args,
       }
       // end of bcopy protocol
     } else if (state.protocol == protocol_t::eager_zcopy) {
-      if (traits.local_buffer_only) {
+      if (args.iov) {
+        // zero-copy io vector send/put
+        error = post_iov_zcopy(args, traits, state);
+      } else if (args.datatype) {
+        // datatype put through a staging buffer
+        error = post_datatype_zcopy(args, traits, state);
+      } else if (traits.local_buffer_only) {
         // zero-copy send
         error = args.endpoint.p_impl->post_send(
             args.rank, args.local_buffer, args.size, state.mr, state.imm_data,
@@ -509,12 +974,25 @@ error_t post_network_op(const post_comm_args_t& args,
         }
         // end of zero-copy put
       }
+    } else if (state.protocol == protocol_t::aggregate) {
+      // active message aggregation (return retry or done)
+      error = args.endpoint.get_impl()->am_aggregator->push(
+          args.rank, args.local_buffer, args.size, args.tag, state.rhandler,
+          args.allow_retry);
+      if (error.is_done()) {
+        // this also returns the packet provided by the user
+        delete state.internal_ctx;
+        state.internal_ctx = nullptr;
+      }
     } else /* protocol == protocol_t::rdv_zcopy */ {
       // rendezvous send
       // build the rts message
+      // The rts message is injected from the stack whenever it fits, so that
+      // starting a rendezvous does not need any heap allocation or packet.
+      rts_msg_t rts;
       rts_msg_t* p_rts;
       if (sizeof(rts_msg_t) <= traits.max_inject_size) {
-        p_rts = reinterpret_cast<rts_msg_t*>(malloc(sizeof(rts_msg_t)));
+        p_rts = &rts;
       } else {
         LCI_Assert(sizeof(rts_msg_t) <= traits.max_bcopy_size,
                    "The rts message is too large\n");
@@ -524,20 +1002,42 @@ error_t post_network_op(const post_comm_args_t& args,
       p_rts->tag = args.tag;
       p_rts->rcomp = state.rhandler;
       p_rts->size = args.size;
+      p_rts->use_read = state.rdv_use_read;
+      p_rts->use_pipeline = state.rdv_use_pipeline;
+      internal_context_extended_t* pipeline_ctx = nullptr;
+      if (state.rdv_use_pipeline) {
+        // The rtr messages of all chunks point to an extended context that
+        // collects the completions of the chunk writes.
+        size_t nchunks = rdv_pipeline_nchunks(
+            args.runtime.get_impl(), args.device.get_impl()->net_context,
+            args.size);
+        pipeline_ctx = new internal_context_extended_t;
+        pipeline_ctx->internal_ctx = state.internal_ctx;
+        pipeline_ctx->signal_count = nchunks;
+        pipeline_ctx->alloc_chunk_mrs(nchunks);
+        p_rts->send_ctx = (uintptr_t)pipeline_ctx;
+      }
+      if (state.rdv_use_read) {
+        // the receiver will pull the data from the local buffer
+        p_rts->rmr = get_rmr(state.mr);
+        p_rts->offset =
+            reinterpret_cast<uintptr_t>(args.local_buffer) - p_rts->rmr.base;
+      }
       // post send for the rts message
       if (sizeof(rts_msg_t) <= traits.max_inject_size) {
         error = args.endpoint.p_impl->post_sends(
-            args.rank, p_rts, sizeof(rts_msg_t), state.imm_data, nullptr,
+            args.rank, p_rts, p_rts->get_size(), state.imm_data, nullptr,
             args.allow_retry);
-        free(p_rts);
       } else {
         error = args.endpoint.p_impl->post_send(
-            args.rank, p_rts, sizeof(rts_msg_t),
+            args.rank, p_rts, p_rts->get_size(),
             state.packet->get_mr(args.device), state.imm_data, nullptr,
             args.allow_retry);
       }
       if (error.is_done()) {
         error = errorcode_t::posted;
+      } else if (error.is_retry()) {
+        delete pipeline_ctx;
       }
       // end of rendezvous send
       // end of zero-copy protocol
@@ -562,10 +1062,9 @@ error_t post_network_op(const post_comm_args_t& args,
       } else if (args.tag == ANY_TAG) {
         matching_policy = matching_policy_t::rank_only;
       }
-      auto key = args.matching_engine.get_impl()->make_key(args.rank, args.tag,
-                                                           matching_policy);
       auto ret = args.matching_engine.get_impl()->insert(
-          key, state.internal_ctx, matching_engine_impl_t::insert_type_t::recv);
+          args.rank, args.tag, matching_policy, state.internal_ctx,
+          matching_engine_impl_t::insert_type_t::recv);
       if (ret) {
         handle_matched_sendrecv(args.runtime, args.endpoint,
                                 reinterpret_cast<packet_t*>(ret),
@@ -580,6 +1079,12 @@ error_t post_network_op(const post_comm_args_t& args,
             args.rank, state.packet->get_payload_address(), args.size,
             state.packet->get_mr(args.device), args.remote_disp, args.rmr,
             state.internal_ctx, args.allow_retry);
+      } else if (args.iov) {
+        // zero-copy io vector
+        error = post_iov_zcopy(args, traits, state);
+      } else if (args.datatype) {
+        // datatype get through a staging buffer
+        error = post_datatype_zcopy(args, traits, state);
       } else {
         // zero-copy
         error = args.endpoint.p_impl->post_get(
@@ -617,6 +1122,9 @@ void exit_handler(error_t error_, const post_comm_args_t& args,
       // it.
       state.internal_ctx->packet_to_free = nullptr;
     delete state.internal_ctx;
+  } else if (state.user_packet_to_free) {
+    // the message has been copied out of it
+    state.user_packet_to_free->put_back();
   }
   if (state.status.is_posted() && !args.allow_posted) {
     while (!sync_test(state.local_comp, &state.status)) {
@@ -659,49 +1167,47 @@ void exit_handler(error_t error_, const post_comm_args_t& args,
   }
 }
 
-status_t post_comm_x::call_impl(
-    direction_t direction, int rank, void* local_buffer, size_t size,
-    comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint,
-    packet_pool_t packet_pool, matching_engine_t matching_engine,
-    comp_semantic_t comp_semantic, mr_t mr, uintptr_t remote_disp, rmr_t rmr,
-    tag_t tag, rcomp_t remote_comp, void* user_context,
-    matching_policy_t matching_policy, bool allow_done, bool allow_posted,
-    bool allow_retry) const
+// The steps that only depend on the arguments.
+// state out: rhandler, protocol, use_tagged, rdv_use_read, rdv_use_pipeline,
+//            piggyback_tag_rcomp_in_msg, imm_data, status
+void plan_comm(post_comm_args_t& args, post_comm_traits_t& traits,
+               post_comm_state_t& state)
 {
-  error_t error;
-  post_comm_args_t args = {
-      direction,     rank,         local_buffer,    size,       local_comp,
-      runtime,       packet_pool,  device,          endpoint,   matching_engine,
-      comp_semantic, mr,           remote_disp,     rmr,        tag,
-      remote_comp,   user_context, matching_policy, allow_done, allow_posted,
-      allow_retry,
-  };
   preprocess_args(args);
-  post_comm_traits_t traits = validate_and_get_traits(args);
-  post_comm_state_t state;
+  traits = validate_and_get_traits(args);
   // state out: rhandler
   resolve_rhandler(args, traits, state);
   // state in: rhandler
-  // state out: protocol, piggyback_tag_rcomp_in_msg
+  // state out: protocol, use_tagged, rdv_use_read, rdv_use_pipeline,
+  //            piggyback_tag_rcomp_in_msg
   set_protocol(args, traits, state);
+  // state in: protocol, rhandler
+  // state out: imm_data
+  set_immediate_data(args, traits, state);
+  // state in: none
+  // state out: status
+  set_status(args, traits, state);
+}
+
+// The steps that have to be executed every time the operation is posted.
+// state in: the output of plan_comm
+// state out: status
+status_t start_comm(const post_comm_args_t& args,
+                    const post_comm_traits_t& traits, post_comm_state_t& state)
+{
+  error_t error;
   // state in: protocol
   // state out: none
   error = check_backlog(args, traits, state);
   if (!error.is_done()) goto exit;
   // state in: protocol, rhandler, piggyback_tag_rcomp_in_msg
-  // state.out: packet, user_provided_packet
+  // state.out: packet, user_provided_packet, user_packet_to_free
   error = set_packet_if_needed(args, traits, state);
   if (!error.is_done()) goto exit;
-  // state in: protocol, rhandler
-  // state out: imm_data
-  set_immediate_data(args, traits, state);
   // state in: none
   // state out: local_comp
   set_local_comp(args, traits, state);
-  // state in: none
-  // state out: status
-  set_status(args, traits, state);
-  // state in: protocol, packet, local_comp
+  // state in: protocol, rdv_use_read, packet, local_comp, rhandler
   // state out: internal_ctx, mr
   set_internal_ctx(args, traits, state);
   // state in: all
@@ -713,13 +1219,136 @@ exit:
   return state.status;
 }
 
+status_t post_comm_x::call_impl(
+    direction_t direction, int rank, void* local_buffer, size_t size,
+    comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint,
+    packet_pool_t packet_pool, matching_engine_t matching_engine,
+    comp_semantic_t comp_semantic, mr_t mr, uintptr_t remote_disp, rmr_t rmr,
+    tag_t tag, rcomp_t remote_comp, void* user_context,
+    matching_policy_t matching_policy, const iovec_t* iov, size_t iov_count,
+    const datatype_t* datatype, bool zero_copy, bool allow_done,
+    bool allow_posted, bool allow_retry) const
+{
+  post_comm_args_t args = {
+      direction,     rank,         local_buffer,    size,       local_comp,
+      runtime,       packet_pool,  device,          endpoint,   matching_engine,
+      comp_semantic, mr,           remote_disp,     rmr,        tag,
+      remote_comp,   user_context, matching_policy, iov,        iov_count,
+      datatype,      zero_copy,    allow_done,      allow_posted,
+      allow_retry,
+  };
+  post_comm_traits_t traits;
+  post_comm_state_t state;
+  plan_comm(args, traits, state);
+  return start_comm(args, traits, state);
+}
+
+persistent_comm_impl_t::persistent_comm_impl_t(const post_comm_args_t& args_,
+                                               attr_t attr_)
+    : attr(attr_), args(args_)
+{
+  // keep what args points to
+  if (args.iov) {
+    iov.assign(args.iov, args.iov + args.iov_count);
+    args.iov = iov.data();
+  }
+  if (args.datatype) {
+    datatype = *args.datatype;
+    args.datatype = &datatype;
+  }
+  LCI_Assert(args.iov || args.datatype || !args.local_buffer ||
+                 !args.packet_pool.get_impl()->is_packet(args.local_buffer),
+             "A persistent operation cannot use a packet as the local "
+             "buffer\n");
+  plan_comm(args, traits, state);
+  // Register the local buffer now if the protocol would register it on the
+  // fly. A recv buffer is only registered if it can receive a rendezvous
+  // message.
+  if (!args.iov && !args.datatype && args.local_buffer && args.size > 0 &&
+      args.mr.is_empty() &&
+      (state.protocol == protocol_t::eager_zcopy ||
+       state.protocol == protocol_t::rdv_zcopy ||
+       (state.protocol == protocol_t::recv &&
+        args.size > traits.max_bcopy_size))) {
+    mr_to_free = register_memory_x(args.local_buffer, args.size)
+                     .runtime(args.runtime)
+                     .device(args.device)();
+    args.mr = mr_to_free;
+  }
+}
+
+persistent_comm_impl_t::~persistent_comm_impl_t()
+{
+  if (!mr_to_free.is_empty()) {
+    deregister_memory_x(&mr_to_free).runtime(args.runtime)();
+  }
+}
+
+persistent_comm_t alloc_persistent_comm_x::call_impl(
+    direction_t direction, int rank, void* local_buffer, size_t size,
+    comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint,
+    packet_pool_t packet_pool, matching_engine_t matching_engine,
+    comp_semantic_t comp_semantic, mr_t mr, uintptr_t remote_disp, rmr_t rmr,
+    tag_t tag, rcomp_t remote_comp, void* user_context,
+    matching_policy_t matching_policy, const iovec_t* iov, size_t iov_count,
+    const datatype_t* datatype, bool zero_copy, bool allow_done,
+    bool allow_posted, bool allow_retry) const
+{
+  post_comm_args_t args = {
+      direction,     rank,         local_buffer,    size,       local_comp,
+      runtime,       packet_pool,  device,          endpoint,   matching_engine,
+      comp_semantic, mr,           remote_disp,     rmr,        tag,
+      remote_comp,   user_context, matching_policy, iov,        iov_count,
+      datatype,      zero_copy,    allow_done,      allow_posted,
+      allow_retry,
+  };
+  persistent_comm_impl_t::attr_t attr;
+  attr.name = DEFAULT_NAME;
+  attr.user_context = user_context;
+  persistent_comm_t ret;
+  ret.p_impl = new persistent_comm_impl_t(args, attr);
+  return ret;
+}
+
+void free_persistent_comm_x::call_impl(persistent_comm_t* persistent_comm,
+                                       runtime_t) const
+{
+  delete persistent_comm->p_impl;
+  persistent_comm->p_impl = nullptr;
+}
+
+status_t start_x::call_impl(persistent_comm_t persistent_comm,
+                            runtime_t) const
+{
+  persistent_comm_impl_t* p_impl = persistent_comm.get_impl();
+  post_comm_state_t state = p_impl->state;
+  return start_comm(p_impl->args, p_impl->traits, state);
+}
+
+void begin_batch_x::call_impl(runtime_t, device_t,
+                              endpoint_t endpoint) const
+{
+  LCI_Assert(!tls_batch.endpoint, "The thread already has an open batch\n");
+  tls_batch.endpoint = endpoint.get_impl();
+  tls_batch.endpoint->nopen_batches.fetch_add(1, std::memory_order_relaxed);
+}
+
+void flush_batch_x::call_impl(runtime_t) const
+{
+  LCI_Assert(tls_batch.endpoint, "The thread has no open batch\n");
+  flush_staged_ops();
+  tls_batch.endpoint->nopen_batches.fetch_sub(1, std::memory_order_relaxed);
+  tls_batch.endpoint = nullptr;
+}
+
 status_t post_am_x::call_impl(int rank, void* local_buffer, size_t size,
                               comp_t local_comp, rcomp_t remote_comp,
                               runtime_t runtime, device_t device,
                               endpoint_t endpoint, packet_pool_t packet_pool,
                               comp_semantic_t comp_semantic, mr_t mr, tag_t tag,
-                              void* user_context, bool allow_done,
-                              bool allow_posted, bool allow_retry) const
+                              void* user_context, const datatype_t* datatype,
+                              bool allow_done, bool allow_posted,
+                              bool allow_retry) const
 {
   return post_comm_x(direction_t::OUT, rank, local_buffer, size, local_comp)
       .runtime(runtime)
@@ -732,6 +1361,32 @@ status_t post_am_x::call_impl(int rank, void* local_buffer, size_t size,
       .tag(tag)
       .remote_comp(remote_comp)
       .user_context(user_context)
+      .datatype(datatype)
+      .allow_done(allow_done)
+      .allow_posted(allow_posted)
+      .allow_retry(allow_retry)();
+}
+
+status_t post_amv_x::call_impl(int rank, const iovec_t* iov, size_t iov_count,
+                               comp_t local_comp, rcomp_t remote_comp,
+                               runtime_t runtime, device_t device,
+                               endpoint_t endpoint, packet_pool_t packet_pool,
+                               comp_semantic_t comp_semantic, tag_t tag,
+                               void* user_context, bool allow_done,
+                               bool allow_posted, bool allow_retry) const
+{
+  return post_comm_x(direction_t::OUT, rank, nullptr, 0, local_comp)
+      .runtime(runtime)
+      .packet_pool(packet_pool)
+      .device(device)
+      .endpoint(endpoint)
+      .matching_engine(matching_engine_t())
+      .comp_semantic(comp_semantic)
+      .tag(tag)
+      .remote_comp(remote_comp)
+      .user_context(user_context)
+      .iov(iov)
+      .iov_count(iov_count)
       .allow_done(allow_done)
       .allow_posted(allow_posted)
       .allow_retry(allow_retry)();
@@ -742,8 +1397,8 @@ status_t post_send_x::call_impl(
     runtime_t runtime, device_t device, endpoint_t endpoint,
     packet_pool_t packet_pool, matching_engine_t matching_engine,
     comp_semantic_t comp_semantic, mr_t mr, void* user_context,
-    matching_policy_t matching_policy, bool allow_done, bool allow_posted,
-    bool allow_retry) const
+    matching_policy_t matching_policy, const datatype_t* datatype,
+    bool allow_done, bool allow_posted, bool allow_retry) const
 {
   return post_comm_x(direction_t::OUT, rank, local_buffer, size, local_comp)
       .runtime(runtime)
@@ -756,6 +1411,32 @@ status_t post_send_x::call_impl(
       .tag(tag)
       .user_context(user_context)
       .matching_policy(matching_policy)
+      .datatype(datatype)
+      .allow_done(allow_done)
+      .allow_posted(allow_posted)
+      .allow_retry(allow_retry)();
+}
+
+status_t post_sendv_x::call_impl(
+    int rank, const iovec_t* iov, size_t iov_count, tag_t tag,
+    comp_t local_comp, runtime_t runtime, device_t device, endpoint_t endpoint,
+    packet_pool_t packet_pool, matching_engine_t matching_engine,
+    comp_semantic_t comp_semantic, void* user_context,
+    matching_policy_t matching_policy, bool allow_done, bool allow_posted,
+    bool allow_retry) const
+{
+  return post_comm_x(direction_t::OUT, rank, nullptr, 0, local_comp)
+      .runtime(runtime)
+      .packet_pool(packet_pool)
+      .device(device)
+      .endpoint(endpoint)
+      .matching_engine(matching_engine)
+      .comp_semantic(comp_semantic)
+      .tag(tag)
+      .user_context(user_context)
+      .matching_policy(matching_policy)
+      .iov(iov)
+      .iov_count(iov_count)
       .allow_done(allow_done)
       .allow_posted(allow_posted)
       .allow_retry(allow_retry)();
@@ -766,8 +1447,8 @@ status_t post_recv_x::call_impl(
     runtime_t runtime, device_t device, endpoint_t endpoint,
     packet_pool_t packet_pool, matching_engine_t matching_engine,
     comp_semantic_t comp_semantic, mr_t mr, void* user_context,
-    matching_policy_t matching_policy, bool allow_done, bool allow_posted,
-    bool allow_retry) const
+    matching_policy_t matching_policy, bool zero_copy, bool allow_done,
+    bool allow_posted, bool allow_retry) const
 {
   return post_comm_x(direction_t::IN, rank, local_buffer, size, local_comp)
       .runtime(runtime)
@@ -780,6 +1461,7 @@ status_t post_recv_x::call_impl(
       .tag(tag)
       .user_context(user_context)
       .matching_policy(matching_policy)
+      .zero_copy(zero_copy)
       .allow_done(allow_done)
       .allow_posted(allow_posted)
       .allow_retry(allow_retry)();
@@ -791,8 +1473,9 @@ status_t post_put_x::call_impl(int rank, void* local_buffer, size_t size,
                                endpoint_t endpoint, packet_pool_t packet_pool,
                                comp_semantic_t comp_semantic, mr_t mr,
                                tag_t tag, rcomp_t remote_comp,
-                               void* user_context, bool allow_done,
-                               bool allow_posted, bool allow_retry) const
+                               void* user_context, const datatype_t* datatype,
+                               bool allow_done, bool allow_posted,
+                               bool allow_retry) const
 {
   return post_comm_x(direction_t::OUT, rank, local_buffer, size, local_comp)
       .remote_disp(remote_disp)
@@ -807,6 +1490,34 @@ status_t post_put_x::call_impl(int rank, void* local_buffer, size_t size,
       .tag(tag)
       .remote_comp(remote_comp)
       .user_context(user_context)
+      .datatype(datatype)
+      .allow_done(allow_done)
+      .allow_posted(allow_posted)
+      .allow_retry(allow_retry)();
+}
+
+status_t post_putv_x::call_impl(
+    int rank, const iovec_t* iov, size_t iov_count, comp_t local_comp,
+    uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, device_t device,
+    endpoint_t endpoint, packet_pool_t packet_pool,
+    comp_semantic_t comp_semantic, tag_t tag, rcomp_t remote_comp,
+    void* user_context, bool allow_done, bool allow_posted,
+    bool allow_retry) const
+{
+  return post_comm_x(direction_t::OUT, rank, nullptr, 0, local_comp)
+      .remote_disp(remote_disp)
+      .rmr(rmr)
+      .runtime(runtime)
+      .packet_pool(packet_pool)
+      .device(device)
+      .endpoint(endpoint)
+      .matching_engine(matching_engine_t())
+      .comp_semantic(comp_semantic)
+      .tag(tag)
+      .remote_comp(remote_comp)
+      .user_context(user_context)
+      .iov(iov)
+      .iov_count(iov_count)
       .allow_done(allow_done)
       .allow_posted(allow_posted)
       .allow_retry(allow_retry)();
@@ -818,8 +1529,9 @@ status_t post_get_x::call_impl(int rank, void* local_buffer, size_t size,
                                endpoint_t endpoint, packet_pool_t packet_pool,
                                comp_semantic_t comp_semantic, mr_t mr,
                                tag_t tag, rcomp_t remote_comp,
-                               void* user_context, bool allow_done,
-                               bool allow_posted, bool allow_retry) const
+                               void* user_context, const datatype_t* datatype,
+                               bool allow_done, bool allow_posted,
+                               bool allow_retry) const
 {
   return post_comm_x(direction_t::IN, rank, local_buffer, size, local_comp)
       .remote_disp(remote_disp)
@@ -834,6 +1546,32 @@ status_t post_get_x::call_impl(int rank, void* local_buffer, size_t size,
       .tag(tag)
       .remote_comp(remote_comp)
       .user_context(user_context)
+      .datatype(datatype)
+      .allow_done(allow_done)
+      .allow_posted(allow_posted)
+      .allow_retry(allow_retry)();
+}
+
+status_t post_getv_x::call_impl(
+    int rank, const iovec_t* iov, size_t iov_count, comp_t local_comp,
+    uintptr_t remote_disp, rmr_t rmr, runtime_t runtime, device_t device,
+    endpoint_t endpoint, packet_pool_t packet_pool, tag_t tag,
+    rcomp_t remote_comp, void* user_context, bool allow_done,
+    bool allow_posted, bool allow_retry) const
+{
+  return post_comm_x(direction_t::IN, rank, nullptr, 0, local_comp)
+      .remote_disp(remote_disp)
+      .rmr(rmr)
+      .runtime(runtime)
+      .packet_pool(packet_pool)
+      .device(device)
+      .endpoint(endpoint)
+      .matching_engine(matching_engine_t())
+      .tag(tag)
+      .remote_comp(remote_comp)
+      .user_context(user_context)
+      .iov(iov)
+      .iov_count(iov_count)
       .allow_done(allow_done)
       .allow_posted(allow_posted)
       .allow_retry(allow_retry)();
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_CORE_COMMUNICATE_HPP
+#define LCI_CORE_COMMUNICATE_HPP
+
+namespace lci
+{
+enum class protocol_t {
+  none,
+  inject,
+  eager_bcopy,
+  eager_zcopy,
+  rdv_zcopy,
+  recv,
+  aggregate,
+};
+
+struct post_comm_args_t {
+  direction_t direction;
+  int rank;
+  void* local_buffer;
+  size_t size;
+  comp_t local_comp;
+  runtime_t runtime;
+  packet_pool_t packet_pool;
+  device_t device;
+  endpoint_t endpoint;
+  matching_engine_t matching_engine;
+  comp_semantic_t comp_semantic;
+  mr_t mr;
+  uintptr_t remote_disp;
+  rmr_t rmr;
+  tag_t tag;
+  rcomp_t remote_comp;
+  void* user_context;
+  matching_policy_t matching_policy;
+  const iovec_t* iov;
+  size_t iov_count;
+  const datatype_t* datatype;
+  bool zero_copy;
+  bool allow_done;
+  bool allow_posted;
+  bool allow_retry;
+};
+
+struct post_comm_traits_t {
+  bool local_buffer_only;
+  bool local_comp_only;
+  bool is_recv;
+  size_t max_inject_size;
+  size_t max_bcopy_size;
+};
+
+struct post_comm_state_t {
+  rcomp_t rhandler = 0;
+  bool piggyback_tag_rcomp_in_msg = false;
+  net_imm_data_t imm_data = 0;
+  packet_t* packet = nullptr;
+  size_t packet_size_to_send = 0;
+  bool user_provided_packet = false;
+  // A packet provided by users that is too small to send the message from.
+  // The message is copied into another packet and it is freed unless the
+  // operation is retried.
+  packet_t* user_packet_to_free = nullptr;
+  internal_context_t* internal_ctx = nullptr;
+  protocol_t protocol = protocol_t::none;
+  // send-recv matched by the network with tagged messages
+  bool use_tagged = false;
+  bool rdv_use_read = false;
+  bool rdv_use_pipeline = false;
+  mr_t mr;
+  comp_t local_comp = COMP_NULL;
+  bool comp_passed_to_network = false;
+  status_t status;
+};
+
+class persistent_comm_impl_t
+{
+ public:
+  using attr_t = persistent_comm_t::attr_t;
+  attr_t attr;
+  // The planned operation. The steps that only depend on the arguments have
+  // been executed, so `state` is the state every start begins with.
+  post_comm_args_t args;
+  post_comm_traits_t traits;
+  post_comm_state_t state;
+  // the copies of the io vector and the datatype that `args` points to
+  std::vector<iovec_t> iov;
+  datatype_t datatype;
+  // the local buffer registered by the plan
+  mr_t mr_to_free;
+
+  persistent_comm_impl_t(const post_comm_args_t& args_, attr_t attr_);
+  ~persistent_comm_impl_t();
+};
+
+// Post the operations staged in the open batch of the calling thread, if
+// any; the batch stays open. The progress engine calls it, so that a thread
+// polling for a staged operation does not wait for flush_batch forever.
+void flush_thread_batch();
+
+}  // namespace lci
+
+#endif  // LCI_CORE_COMMUNICATE_HPP
@@ -0,0 +1,213 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_CORE_DATATYPE_HPP
+#define LCI_CORE_DATATYPE_HPP
+
+namespace lci
+{
+/**
+ * A datatype is a sequence of equally sized blocks. Blocks are visited in
+ * runs of equally spaced blocks (a vector is a single run, a subarray has one
+ * run per plane of rows), so that the pack/unpack kernels can use a strided
+ * copy loop with a compile-time block size for the common small blocks.
+ */
+inline size_t get_datatype_nblocks(const datatype_t& datatype)
+{
+  if (datatype.type != datatype_t::type_t::subarray) return datatype.count;
+  if (datatype.ndims == 0) return 0;
+  size_t nblocks = 1;
+  for (int d = 0; d < datatype.ndims - 1; d++) {
+    nblocks *= datatype.subsizes[d];
+  }
+  return nblocks;
+}
+
+inline size_t get_datatype_block_size(const datatype_t& datatype)
+{
+  if (datatype.type != datatype_t::type_t::subarray)
+    return datatype.blocklength * datatype.elem_size;
+  if (datatype.ndims == 0) return 0;
+  return datatype.subsizes[datatype.ndims - 1] * datatype.elem_size;
+}
+
+// The size of the packed data
+inline size_t get_datatype_size(const datatype_t& datatype)
+{
+  return get_datatype_nblocks(datatype) * get_datatype_block_size(datatype);
+}
+
+inline void validate_datatype(const datatype_t& datatype)
+{
+  LCI_Assert(datatype.type != datatype_t::type_t::contiguous ||
+                 datatype.count <= 1,
+             "A contiguous datatype has at most one block\n");
+  LCI_Assert(datatype.type != datatype_t::type_t::subarray ||
+                 (datatype.ndims > 0 &&
+                  datatype.ndims <= datatype_t::MAX_NDIMS),
+             "Unsupported number of dimensions %d\n", datatype.ndims);
+  for (int d = 0; d < datatype.ndims; d++) {
+    LCI_Assert(datatype.starts[d] + datatype.subsizes[d] <= datatype.sizes[d],
+               "The subarray is out of bound at dimension %d\n", d);
+  }
+  LCI_Assert(datatype.type != datatype_t::type_t::indexed_block ||
+                 datatype.displacements || datatype.count == 0,
+             "An indexed-block datatype needs displacements\n");
+}
+
+// Get the run of equally spaced blocks starting at block i: the offset of
+// block i from the base address, the distance between two blocks, and the
+// number of blocks in the run.
+inline size_t get_datatype_run(const datatype_t& datatype, size_t i,
+                               size_t* offset, size_t* stride)
+{
+  const size_t block_size = get_datatype_block_size(datatype);
+  switch (datatype.type) {
+    case datatype_t::type_t::contiguous:
+      *offset = 0;
+      *stride = block_size;
+      return datatype.count - i;
+    case datatype_t::type_t::vector:
+      *stride = datatype.stride * datatype.elem_size;
+      *offset = i * *stride;
+      return datatype.count - i;
+    case datatype_t::type_t::indexed_block:
+      *offset = datatype.displacements[i] * datatype.elem_size;
+      *stride = block_size;
+      return 1;
+    case datatype_t::type_t::subarray: {
+      const int ndims = datatype.ndims;
+      size_t pitch = datatype.elem_size;
+      *offset = datatype.starts[ndims - 1] * pitch;
+      *stride = pitch;
+      size_t n = 1;
+      for (int d = ndims - 2; d >= 0; d--) {
+        pitch *= datatype.sizes[d + 1];
+        size_t idx = i % datatype.subsizes[d];
+        i /= datatype.subsizes[d];
+        if (d == ndims - 2) {
+          // the rows of a plane are equally spaced
+          *stride = pitch;
+          n = datatype.subsizes[d] - idx;
+        }
+        *offset += (datatype.starts[d] + idx) * pitch;
+      }
+      return n;
+    }
+    default:
+      LCI_Assert(false, "Unknown datatype %d\n",
+                 static_cast<int>(datatype.type));
+      return 0;
+  }
+}
+
+namespace datatype_detail
+{
+template <bool is_pack>
+inline void copy(char* strided, char* packed, size_t size)
+{
+  if (is_pack)
+    memcpy(packed, strided, size);
+  else
+    memcpy(strided, packed, size);
+}
+
+// The block size is a compile-time constant, so the compiler turns every
+// block copy into a few (vector) loads and stores.
+template <bool is_pack, size_t N>
+inline void copy_strided_fixed(char* strided, size_t stride, char* packed,
+                               size_t n)
+{
+  for (size_t k = 0; k < n; k++) {
+    copy<is_pack>(strided + k * stride, packed + k * N, N);
+  }
+}
+
+template <bool is_pack>
+inline void copy_strided(char* strided, size_t stride, char* packed,
+                         size_t block_size, size_t n)
+{
+  if (stride == block_size) {
+    copy<is_pack>(strided, packed, n * block_size);
+    return;
+  }
+  switch (block_size) {
+    case 4:
+      copy_strided_fixed<is_pack, 4>(strided, stride, packed, n);
+      break;
+    case 8:
+      copy_strided_fixed<is_pack, 8>(strided, stride, packed, n);
+      break;
+    case 16:
+      copy_strided_fixed<is_pack, 16>(strided, stride, packed, n);
+      break;
+    case 32:
+      copy_strided_fixed<is_pack, 32>(strided, stride, packed, n);
+      break;
+    default:
+      for (size_t k = 0; k < n; k++) {
+        copy<is_pack>(strided + k * stride, packed + k * block_size,
+                      block_size);
+      }
+  }
+}
+
+// Copy the bytes [offset, offset + size) of the packed data between the
+// strided buffer and the packed buffer.
+template <bool is_pack>
+inline void copy_datatype(const datatype_t& datatype, void* base,
+                          size_t offset, void* packed, size_t size)
+{
+  if (size == 0) return;
+  const size_t block_size = get_datatype_block_size(datatype);
+  LCI_DBG_Assert(offset + size <= get_datatype_size(datatype),
+                 "Out of bound (%lu + %lu)\n", offset, size);
+  char* p = static_cast<char*>(packed);
+  size_t i = offset / block_size;
+  size_t intra = offset % block_size;
+  while (size > 0) {
+    size_t block_offset = 0, stride = 0;
+    size_t n = get_datatype_run(datatype, i, &block_offset, &stride);
+    char* b = static_cast<char*>(base) + block_offset;
+    if (intra > 0 || size < block_size) {
+      // a partial block
+      size_t length = std::min(block_size - intra, size);
+      copy<is_pack>(b + intra, p, length);
+      p += length;
+      size -= length;
+      intra += length;
+      if (intra == block_size) {
+        intra = 0;
+        ++i;
+      }
+      continue;
+    }
+    n = std::min(n, size / block_size);
+    copy_strided<is_pack>(b, stride, p, block_size, n);
+    p += n * block_size;
+    size -= n * block_size;
+    i += n;
+  }
+}
+}  // namespace datatype_detail
+
+// Pack the bytes [offset, offset + size) of the packed data of the datatype
+// at base into packed.
+inline void datatype_pack(const datatype_t& datatype, const void* base,
+                          size_t offset, void* packed, size_t size)
+{
+  datatype_detail::copy_datatype<true>(datatype, const_cast<void*>(base),
+                                       offset, packed, size);
+}
+
+// Unpack size bytes of packed data into the bytes [offset, offset + size) of
+// the datatype at base.
+inline void datatype_unpack(const datatype_t& datatype, void* base,
+                            size_t offset, const void* packed, size_t size)
+{
+  datatype_detail::copy_datatype<false>(datatype, base, offset,
+                                        const_cast<void*>(packed), size);
+}
+}  // namespace lci
+
+#endif  // LCI_CORE_DATATYPE_HPP
@@ -0,0 +1,253 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_CORE_EAGER_RDMA_HPP
+#define LCI_CORE_EAGER_RDMA_HPP
+
+namespace lci
+{
+/**
+ * Eager-RDMA fast path of a device.
+ *
+ * Once the number of eager sends to a peer reaches eager_rdma_threshold, the
+ * sender asks the peer for a ring of eager_rdma_nslots slots registered in the
+ * receiver's memory. From then on, small send/am messages to that peer are
+ * written into the next slot of the ring with RDMA write with immediate data
+ * instead of being received into a pre-posted packet and matched there.
+ *
+ * A slot holds the eager payload followed by the immediate data the message
+ * would have carried as a regular send. The immediate data of the write
+ * itself only carries the slot index and the payload size.
+ *
+ * The receiver returns consumed slots to the sender as credits once half of
+ * the ring has been consumed. The sender falls back to the regular eager path
+ * whenever it runs out of credits.
+ *
+ * Ring setup and credits go through internal control messages (see
+ * imm_data_ctrl_type_t).
+ */
+class eager_rdma_t
+{
+ public:
+  static const int SLOT_NBITS = 13;
+  static const int SIZE_NBITS = 15;
+  static const size_t MAX_NSLOTS = 1 << SLOT_NBITS;
+  static const size_t MAX_SLOT_SIZE = 1 << SIZE_NBITS;
+  // injected messages are staged on the stack before being written
+  static const size_t MAX_INJECT_SIZE = 256;
+
+  eager_rdma_t(runtime_t runtime_, device_t device_, size_t threshold_,
+               size_t nslots_, size_t slot_size_);
+  ~eager_rdma_t();
+
+  // The maximum payload size that fits into a slot
+  size_t get_max_size() const { return slot_size - sizeof(net_imm_data_t); }
+
+  // sender side
+  // Return false if the message cannot go through the ring of the peer.
+  inline bool acquire_slot(endpoint_t endpoint, int rank, uint64_t* offset,
+                           rmr_t* rmr, net_imm_data_t* imm_data, size_t size);
+  // receiver side
+  // Copy the message out of its slot and return the slot.
+  inline void consume(endpoint_t endpoint, int rank, net_imm_data_t imm_data,
+                      void* buffer, size_t* size, net_imm_data_t* msg_imm_data);
+  // both sides
+  inline void handle_ctrl(endpoint_t endpoint, int rank,
+                          imm_data_ctrl_type_t type, uint32_t value,
+                          packet_t* packet);
+
+ private:
+  struct alignas(LCI_CACHE_LINE) send_peer_t {
+    enum state_t { none, requested, ready };
+    std::atomic<int> state = {none};
+    std::atomic<size_t> nsends = {0};
+    std::atomic<int64_t> credits = {0};
+    std::atomic<uint64_t> head = {0};
+    rmr_t rmr;
+  };
+
+  struct recv_peer_t {
+    char* ring = nullptr;
+    mr_t mr;
+    std::unique_ptr<std::atomic<bool>[]> consumed;
+    spinlock_t lock;
+    size_t tail = 0;
+    size_t credits_to_return = 0;
+  };
+
+  inline void send_ctrl(endpoint_t endpoint, int rank,
+                        imm_data_ctrl_type_t type, uint32_t value,
+                        void* buffer = nullptr, size_t size = 0);
+  inline void setup_ring(endpoint_t endpoint, int rank);
+
+  runtime_t runtime;
+  device_t device;
+  size_t threshold;
+  size_t nslots;
+  size_t slot_size;
+  int nranks;
+  std::unique_ptr<send_peer_t[]> send_peers;
+  std::unique_ptr<std::atomic<recv_peer_t*>[]> recv_peers;
+};
+
+inline eager_rdma_t::eager_rdma_t(runtime_t runtime_, device_t device_,
+                                  size_t threshold_, size_t nslots_,
+                                  size_t slot_size_)
+    : runtime(runtime_),
+      device(device_),
+      threshold(threshold_),
+      nslots(nslots_),
+      slot_size(slot_size_),
+      nranks(get_rank_n())
+{
+  LCI_Assert(nslots >= 2 && nslots <= MAX_NSLOTS,
+             "eager_rdma_nslots must be in the range [2, %lu]\n", MAX_NSLOTS);
+  LCI_Assert(slot_size > sizeof(net_imm_data_t) && slot_size <= MAX_SLOT_SIZE,
+             "eager_rdma_slot_size must be in the range (%lu, %lu]\n",
+             sizeof(net_imm_data_t), MAX_SLOT_SIZE);
+  LCI_Assert(sizeof(rmr_t) <=
+                 device.get_impl()->net_context.get_attr_max_inject_size(),
+             "The eager-RDMA ack message cannot be injected\n");
+  // A slot is moved into a packet once it is consumed.
+  packet_pool_t packet_pool = device.get_impl()->packet_pool;
+  LCI_Assert(!packet_pool.is_empty(), "Eager-RDMA requires a packet pool\n");
+  LCI_Assert(slot_size - sizeof(net_imm_data_t) <=
+                 packet_pool.get_impl()->get_payload_size(),
+             "eager_rdma_slot_size %lu does not fit in packets of %lu "
+             "bytes\n",
+             slot_size, packet_pool.get_impl()->get_payload_size());
+  send_peers.reset(new send_peer_t[nranks]);
+  recv_peers.reset(new std::atomic<recv_peer_t*>[nranks]());
+}
+
+inline eager_rdma_t::~eager_rdma_t()
+{
+  for (int i = 0; i < nranks; i++) {
+    recv_peer_t* peer = recv_peers[i].load(std::memory_order_relaxed);
+    if (!peer) continue;
+    deregister_memory_x(&peer->mr).runtime(runtime)();
+    std::free(peer->ring);
+    delete peer;
+  }
+}
+
+inline void eager_rdma_t::send_ctrl(endpoint_t endpoint, int rank,
+                                    imm_data_ctrl_type_t type, uint32_t value,
+                                    void* buffer, size_t size)
+{
+  error_t error = endpoint.get_impl()->post_sends(
+      rank, buffer, size, make_ctrl_imm_data(type, value), nullptr,
+      false /* allow_retry */);
+  LCI_Assert(!error.is_retry(), "Unexpected error %s\n", error.get_str());
+}
+
+inline bool eager_rdma_t::acquire_slot(endpoint_t endpoint, int rank,
+                                       uint64_t* offset, rmr_t* rmr,
+                                       net_imm_data_t* imm_data, size_t size)
+{
+  send_peer_t& peer = send_peers[rank];
+  int state = peer.state.load(std::memory_order_acquire);
+  if (LCT_unlikely(state != send_peer_t::ready)) {
+    if (state == send_peer_t::none &&
+        peer.nsends.fetch_add(1, std::memory_order_relaxed) + 1 == threshold) {
+      // ask the peer for a ring
+      peer.state.store(send_peer_t::requested, std::memory_order_relaxed);
+      send_ctrl(endpoint, rank, IMM_DATA_CTRL_EAGER_RDMA_REQ, 0);
+    }
+    return false;
+  }
+  if (size > get_max_size()) return false;
+  // take a credit
+  int64_t credits = peer.credits.load(std::memory_order_relaxed);
+  do {
+    if (credits <= 0) {
+      LCI_PCOUNTER_ADD(eager_rdma_no_credit, 1);
+      return false;
+    }
+  } while (!peer.credits.compare_exchange_weak(credits, credits - 1,
+                                               std::memory_order_acquire,
+                                               std::memory_order_relaxed));
+  uint32_t slot = peer.head.fetch_add(1, std::memory_order_relaxed) % nslots;
+  *offset = slot * slot_size;
+  *rmr = peer.rmr;
+  *imm_data = set_bits32(0, IMM_DATA_MSG_EAGER, 2, 29);
+  *imm_data = set_bits32(*imm_data, slot, SLOT_NBITS, 0);
+  *imm_data = set_bits32(*imm_data, size, SIZE_NBITS, SLOT_NBITS);
+  return true;
+}
+
+inline void eager_rdma_t::consume(endpoint_t endpoint, int rank,
+                                  net_imm_data_t imm_data, void* buffer,
+                                  size_t* size, net_imm_data_t* msg_imm_data)
+{
+  uint32_t slot = get_bits32(imm_data, SLOT_NBITS, 0);
+  *size = get_bits32(imm_data, SIZE_NBITS, SLOT_NBITS);
+  recv_peer_t* peer = recv_peers[rank].load(std::memory_order_acquire);
+  LCI_DBG_Assert(peer && slot < nslots, "Unexpected eager-RDMA message\n");
+  char* address = peer->ring + slot * slot_size;
+  memcpy(buffer, address, *size);
+  memcpy(msg_imm_data, address + *size, sizeof(net_imm_data_t));
+  // Slots can be consumed out of order by different threads, but they can
+  // only be returned to the sender in order.
+  peer->consumed[slot].store(true, std::memory_order_release);
+  size_t credits = 0;
+  peer->lock.lock();
+  while (peer->consumed[peer->tail].load(std::memory_order_acquire)) {
+    peer->consumed[peer->tail].store(false, std::memory_order_relaxed);
+    peer->tail = (peer->tail + 1) % nslots;
+    ++peer->credits_to_return;
+  }
+  if (peer->credits_to_return >= nslots / 2) {
+    credits = peer->credits_to_return;
+    peer->credits_to_return = 0;
+  }
+  peer->lock.unlock();
+  if (credits > 0) {
+    send_ctrl(endpoint, rank, IMM_DATA_CTRL_EAGER_RDMA_CREDIT, credits);
+  }
+}
+
+inline void eager_rdma_t::setup_ring(endpoint_t endpoint, int rank)
+{
+  LCI_Assert(!recv_peers[rank].load(std::memory_order_relaxed),
+             "Duplicated eager-RDMA ring request from rank %d\n", rank);
+  recv_peer_t* peer = new recv_peer_t;
+  peer->ring = static_cast<char*>(alloc_memalign(nslots * slot_size));
+  LCI_Assert(peer->ring, "Failed to allocate the eager-RDMA ring\n");
+  peer->mr = register_memory_x(peer->ring, nslots * slot_size)
+                 .runtime(runtime)
+                 .device(device)();
+  peer->consumed.reset(new std::atomic<bool>[nslots]());
+  recv_peers[rank].store(peer, std::memory_order_release);
+  rmr_t rmr = get_rmr(peer->mr);
+  LCI_PCOUNTER_ADD(eager_rdma_ring_setup, 1);
+  LCI_DBG_Log(LOG_TRACE, "eager_rdma", "set up a ring for rank %d\n", rank);
+  send_ctrl(endpoint, rank, IMM_DATA_CTRL_EAGER_RDMA_ACK, 0, &rmr,
+            sizeof(rmr));
+}
+
+inline void eager_rdma_t::handle_ctrl(endpoint_t endpoint, int rank,
+                                      imm_data_ctrl_type_t type, uint32_t value,
+                                      packet_t* packet)
+{
+  send_peer_t& peer = send_peers[rank];
+  switch (type) {
+    case IMM_DATA_CTRL_EAGER_RDMA_REQ:
+      setup_ring(endpoint, rank);
+      break;
+    case IMM_DATA_CTRL_EAGER_RDMA_ACK:
+      memcpy(&peer.rmr, packet->get_payload_address(), sizeof(rmr_t));
+      peer.credits.store(nslots, std::memory_order_relaxed);
+      peer.state.store(send_peer_t::ready, std::memory_order_release);
+      break;
+    case IMM_DATA_CTRL_EAGER_RDMA_CREDIT:
+      peer.credits.fetch_add(value, std::memory_order_release);
+      break;
+    default:
+      LCI_Assert(false, "Unknown eager-RDMA control message %d\n", type);
+  }
+  packet->put_back();
+}
+}  // namespace lci
+
+#endif  // LCI_CORE_EAGER_RDMA_HPP
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_CORE_IOVEC_HPP
+#define LCI_CORE_IOVEC_HPP
+
+namespace lci
+{
+inline size_t get_iov_size(const iovec_t* iov, size_t count)
+{
+  size_t size = 0;
+  for (size_t i = 0; i < count; i++) {
+    size += iov[i].size;
+  }
+  return size;
+}
+
+/**
+ * Split an io vector into pieces that can each be posted as one network
+ * operation, i.e., with at most max_iov entries and max_msg_size bytes.
+ * Entries larger than max_msg_size are cut into several pieces and empty
+ * entries are skipped. An empty io vector yields one empty piece.
+ */
+class iov_splitter_t
+{
+ public:
+  iov_splitter_t(const iovec_t* iov_, size_t count_, size_t max_iov_,
+                 size_t max_msg_size_)
+      : iov(iov_),
+        count(count_),
+        max_iov(max_iov_),
+        max_msg_size(max_msg_size_),
+        idx(0),
+        offset(0),
+        started(false)
+  {
+    LCI_DBG_Assert(max_iov > 0 && max_iov <= LCI_BACKEND_MAX_IOV,
+                   "Unexpected max_iov %lu\n", max_iov);
+  }
+
+  // Fill `piece` (which has room for max_iov entries) with the next piece.
+  // Return false if the whole io vector has been consumed.
+  bool next(iovec_t* piece, size_t* piece_count, size_t* piece_size)
+  {
+    while (idx < count && offset == iov[idx].size) {
+      ++idx;
+      offset = 0;
+    }
+    if (idx == count && started) return false;
+    started = true;
+    *piece_count = 0;
+    *piece_size = 0;
+    while (idx < count && *piece_count < max_iov &&
+           *piece_size < max_msg_size) {
+      size_t length =
+          std::min(iov[idx].size - offset, max_msg_size - *piece_size);
+      if (length > 0) {
+        piece[*piece_count] = iovec_t(
+            static_cast<char*>(iov[idx].buffer) + offset, length, iov[idx].mr);
+        ++*piece_count;
+        *piece_size += length;
+        offset += length;
+      }
+      if (offset == iov[idx].size) {
+        ++idx;
+        offset = 0;
+      }
+    }
+    return true;
+  }
+
+  // The number of pieces left
+  size_t count_pieces() const
+  {
+    iov_splitter_t splitter(*this);
+    iovec_t piece[LCI_BACKEND_MAX_IOV];
+    size_t piece_count, piece_size;
+    size_t n = 0;
+    while (splitter.next(piece, &piece_count, &piece_size)) {
+      ++n;
+    }
+    return n;
+  }
+
+ private:
+  const iovec_t* iov;
+  size_t count;
+  size_t max_iov;
+  size_t max_msg_size;
+  size_t idx;
+  size_t offset;
+  bool started;
+};
+}  // namespace lci
+
+#endif  // LCI_CORE_IOVEC_HPP
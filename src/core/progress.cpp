@@ -5,6 +5,74 @@
 
 namespace lci
 {
+void progress_am_aggregate(runtime_t runtime, endpoint_t endpoint,
+                           const net_status_t& net_status, uint32_t nmsgs)
+{
+  LCI_PCOUNTER_ADD(am_aggregation_recv, 1)
+  packet_t* packet = static_cast<packet_t*>(net_status.user_context);
+  char* address = static_cast<char*>(packet->get_payload_address());
+  [[maybe_unused]] char* end = address + net_status.length;
+  for (uint32_t i = 0; i < nmsgs; i++) {
+    am_aggregator_t::header_t header;
+    memcpy(&header, address, sizeof(header));
+    address += sizeof(header);
+    LCI_DBG_Assert(address + header.size <= end,
+                   "Malformed aggregated active messages\n");
+    auto entry = runtime.p_impl->default_rhandler_registry.get(header.rcomp);
+    LCI_Assert(entry.type == rhandler_registry_t::type_t::comp,
+               "Aggregated messages must be active messages\n");
+    comp_impl_t* comp = reinterpret_cast<comp_impl_t*>(entry.value);
+    status_t status;
+    status.set_done();
+    status.rank = net_status.rank;
+    status.tag = header.tag;
+    status.size = header.size;
+    status.user_context = nullptr;
+    if (comp->attr.zero_copy_am) {
+      // every message needs a packet of its own
+      packet_t* msg_packet =
+          endpoint.get_impl()->device.get_impl()->packet_pool.get_impl()->get(
+              true /* blocking */);
+      LCI_Assert(msg_packet, "Failed to get a packet\n");
+      status.buffer = msg_packet->get_payload_address();
+    } else {
+      status.buffer = runtime.get_impl()->allocator->allocate(header.size);
+    }
+    memcpy(status.buffer, address, header.size);
+    address += header.size;
+    comp->signal(std::move(status));
+  }
+  packet->put_back();
+}
+
+void progress_ctrl(runtime_t runtime, endpoint_t endpoint,
+                   const net_status_t& net_status)
+{
+  packet_t* packet = static_cast<packet_t*>(net_status.user_context);
+  auto type = static_cast<imm_data_ctrl_type_t>(
+      get_bits32(net_status.imm_data, 4, 24));
+  uint32_t value = get_bits32(net_status.imm_data, 24, 0);
+  switch (type) {
+    case IMM_DATA_CTRL_EAGER_RDMA_REQ:
+    case IMM_DATA_CTRL_EAGER_RDMA_ACK:
+    case IMM_DATA_CTRL_EAGER_RDMA_CREDIT:
+      endpoint.get_impl()->device.get_impl()->eager_rdma->handle_ctrl(
+          endpoint, net_status.rank, type, value, packet);
+      break;
+    case IMM_DATA_CTRL_AM_AGGREGATE:
+      progress_am_aggregate(runtime, endpoint, net_status, value);
+      break;
+    case IMM_DATA_CTRL_ATOMIC_REQ:
+      progress_atomic_req(endpoint, net_status, value);
+      break;
+    case IMM_DATA_CTRL_ATOMIC_RESP:
+      progress_atomic_resp(net_status, value);
+      break;
+    default:
+      LCI_Assert(false, "Unknown control message type %d\n", type);
+  }
+}
+
 void progress_recv(runtime_t runtime, endpoint_t endpoint,
                    const net_status_t& net_status)
 {
@@ -23,6 +91,11 @@ void progress_recv(runtime_t runtime, endpoint_t endpoint,
     msg_type = IMM_DATA_MSG_EAGER;
   } else {
     msg_type = static_cast<imm_data_msg_type_t>(get_bits32(imm_data, 2, 29));
+    if (is_ctrl_imm_data(imm_data)) {
+      // internal control message
+      progress_ctrl(runtime, endpoint, net_status);
+      return;
+    }
     if (msg_type == IMM_DATA_MSG_EAGER) {
       // get tag and rcomp by looking at the message payload
       msg_size -= sizeof(remote_comp);
@@ -58,15 +131,14 @@ void progress_recv(runtime_t runtime, endpoint_t endpoint,
         // we get a matching table entry
         matching_engine_impl_t* p_matching_engine =
             reinterpret_cast<matching_engine_impl_t*>(entry.value);
-        auto key = p_matching_engine->make_key(
-            net_status.rank, tag,
-            static_cast<matching_policy_t>(entry.metadata));
         packet->local_context.is_eager = true;
         packet->local_context.rank = net_status.rank;
         packet->local_context.tag = tag;
         packet->local_context.size = msg_size;
         auto ret = p_matching_engine->insert(
-            key, packet, matching_engine_impl_t::insert_type_t::send);
+            net_status.rank, tag,
+            static_cast<matching_policy_t>(entry.metadata), packet,
+            matching_engine_impl_t::insert_type_t::send);
         if (ret)
           handle_matched_sendrecv(runtime, endpoint, packet,
                                   reinterpret_cast<internal_context_t*>(ret));
@@ -88,6 +160,29 @@ void progress_recv(runtime_t runtime, endpoint_t endpoint,
   }
 }
 
+void progress_eager_rdma(runtime_t runtime, endpoint_t endpoint,
+                         const net_status_t& net_status)
+{
+  LCI_PCOUNTER_ADD(eager_rdma_recv, 1)
+  device_impl_t* device = endpoint.get_impl()->device.get_impl();
+  LCI_Assert(device->eager_rdma,
+             "Received an eager-RDMA message while eager-RDMA is disabled\n");
+  // The write with immediate data might have consumed a pre-posted packet.
+  // Move the message into it and process it as a received eager message.
+  packet_t* packet = static_cast<packet_t*>(net_status.user_context);
+  if (!packet) {
+    packet = device->packet_pool.get_impl()->get(true /* blocking */);
+    LCI_Assert(packet, "Failed to get a packet for an eager-RDMA message\n");
+  }
+  net_status_t status = net_status;
+  status.opcode = net_opcode_t::RECV;
+  status.user_context = packet;
+  device->eager_rdma->consume(endpoint, net_status.rank, net_status.imm_data,
+                              packet->get_payload_address(), &status.length,
+                              &status.imm_data);
+  progress_recv(runtime, endpoint, status);
+}
+
 void progress_send(const net_status_t& net_status)
 {
   LCI_PCOUNTER_ADD(net_send_comp, 1)
@@ -97,6 +192,24 @@ void progress_send(const net_status_t& net_status)
   free_ctx_and_signal_comp(internal_ctx);
 }
 
+void progress_tagged_recv(const net_status_t& net_status)
+{
+  LCI_PCOUNTER_ADD(net_recv_comp, 1)
+  internal_context_t* internal_ctx =
+      static_cast<internal_context_t*>(net_status.user_context);
+  // the rank and the tag of ANY_SOURCE and ANY_TAG
+  internal_ctx->rank = net_status.rank;
+  internal_ctx->tag = net_status.imm_data;
+  internal_ctx->size = net_status.length;
+  if (internal_ctx->packet_to_free) {
+    // a small message received into a packet
+    memcpy(internal_ctx->buffer,
+           internal_ctx->packet_to_free->get_payload_address(),
+           net_status.length);
+  }
+  free_ctx_and_signal_comp(internal_ctx);
+}
+
 static int get_failed_peer_rank(const net_status_t& net_status)
 {
   // Extract peer identity before cleanup. A rank is still useful diagnostic
@@ -153,7 +266,7 @@ void progress_write(endpoint_t endpoint, const net_status_t& net_status)
     LCI_DBG_Assert(signal_count == 0, "Unexpected signal!\n");
     internal_context_t* ctx = ectx->internal_ctx;
     if (ectx->recv_ctx) {
-      handle_rdv_local_write(endpoint, ectx);
+      handle_rdv_local_comp(endpoint, ectx);
     } else if (ectx->imm_data_rank != -1) {
       // send immediate data
       error_t error = endpoint.get_impl()->post_sends(
@@ -168,18 +281,24 @@ void progress_write(endpoint_t endpoint, const net_status_t& net_status)
   }
 }
 
-void progress_remote_write(runtime_t runtime, const net_status_t& net_status)
+void progress_remote_write(runtime_t runtime, endpoint_t endpoint,
+                           const net_status_t& net_status)
 {
   LCI_PCOUNTER_ADD(net_remote_write_comp, 1)
-  packet_t* packet = static_cast<packet_t*>(net_status.user_context);
-  if (packet) {
-    packet->put_back();
-  }
   // decode immediate data
   uint32_t imm_data = net_status.imm_data;
   tag_t tag;
   rcomp_t remote_comp;
   bool is_fastpath = get_bits32(imm_data, 1, 31);
+  if (!is_fastpath && get_bits32(imm_data, 2, 29) == IMM_DATA_MSG_EAGER) {
+    // a message written into an eager-RDMA ring
+    progress_eager_rdma(runtime, endpoint, net_status);
+    return;
+  }
+  packet_t* packet = static_cast<packet_t*>(net_status.user_context);
+  if (packet) {
+    packet->put_back();
+  }
   if (is_fastpath) {
     // user posted RDMA write with immediate data
     tag = get_bits32(imm_data, 16, 0);
@@ -196,7 +315,7 @@ void progress_remote_write(runtime_t runtime, const net_status_t& net_status)
         static_cast<imm_data_msg_type_t>(get_bits32(imm_data, 2, 29));
     switch (msg_type) {
       case IMM_DATA_MSG_FIN: {
-        LCI_Assert(runtime.get_impl()->attr.rdv_protocol ==
+        LCI_Assert(runtime.get_impl()->rdv_write_protocol ==
                        attr_rdv_protocol_t::writeimm,
                    "Received write-with-imm completion while rendezvous "
                    "protocol is not writeimm\n");
@@ -217,7 +336,29 @@ void progress_remote_write(runtime_t runtime, const net_status_t& net_status)
   }
 }
 
-void progress_read(const net_status_t& net_status)
+// Signal the target of a get with signal once all data has arrived. The
+// signal is a zero-byte active message.
+void send_get_signal(runtime_t runtime, endpoint_t endpoint,
+                     internal_context_t* ctx)
+{
+  net_imm_data_t imm_data;
+  char payload[sizeof(tag_t) + sizeof(rcomp_t)];
+  size_t size = 0;
+  if (!make_eager_imm_data(runtime, ctx->tag, ctx->signal_rcomp, &imm_data)) {
+    // the tag and the rcomp are at the end of the payload
+    memcpy(payload, &ctx->tag, sizeof(tag_t));
+    memcpy(payload + sizeof(tag_t), &ctx->signal_rcomp, sizeof(rcomp_t));
+    size = sizeof(payload);
+  }
+  error_t error =
+      endpoint.get_impl()->post_sends(ctx->rank, payload, size, imm_data,
+                                      nullptr, false /* allow_retry */);
+  LCI_Assert(!error.is_retry(), "Unexpected error %s\n", error.get_str());
+  LCI_PCOUNTER_ADD(get_signal_send, 1);
+}
+
+void progress_read(runtime_t runtime, endpoint_t endpoint,
+                   const net_status_t& net_status)
 {
   LCI_PCOUNTER_ADD(net_read_comp, 1)
   internal_context_t* internal_ctx =
@@ -233,14 +374,30 @@ void progress_read(const net_status_t& net_status)
     }
     LCI_DBG_Assert(signal_count == 0, "Unexpected signal!\n");
     internal_context_t* ctx = ectx->internal_ctx;
+    if (ectx->recv_ctx) {
+      // rendezvous with the read protocol
+      handle_rdv_local_comp(endpoint, ectx);
+    } else if (ectx->staging_buffer) {
+      // datatype get
+      datatype_unpack(*ctx->datatype, ctx->buffer, 0, ectx->staging_buffer,
+                      ctx->size);
+    }
+    if (ctx->signal_rcomp) send_get_signal(runtime, endpoint, ctx);
     delete ectx;
     free_ctx_and_signal_comp(ctx);
   } else {
-    if (internal_ctx->packet_to_free) {
+    if (internal_ctx->packet_to_free && internal_ctx->datatype) {
+      datatype_unpack(*internal_ctx->datatype, internal_ctx->buffer, 0,
+                      internal_ctx->packet_to_free->get_payload_address(),
+                      internal_ctx->size);
+    } else if (internal_ctx->packet_to_free) {
       memcpy(internal_ctx->buffer,
              internal_ctx->packet_to_free->get_payload_address(),
              internal_ctx->size);
     }
+    if (internal_ctx->signal_rcomp) {
+      send_get_signal(runtime, endpoint, internal_ctx);
+    }
     free_ctx_and_signal_comp(internal_ctx);
   }
 }
@@ -264,16 +421,21 @@ void process_completion_batch(runtime_t runtime, device_t device,
         first_failed_rank = failed_rank;
       }
     } else if (status.opcode == net_opcode_t::RECV) {
-      device.get_impl()->consume_recvs(1);
+      device.get_impl()->consume_recv(
+          static_cast<packet_t*>(status.user_context));
       progress_recv(runtime, endpoint, status);
     } else if (status.opcode == net_opcode_t::SEND) {
       progress_send(status);
     } else if (status.opcode == net_opcode_t::WRITE) {
       progress_write(endpoint, status);
     } else if (status.opcode == net_opcode_t::REMOTE_WRITE) {
-      progress_remote_write(runtime, status);
+      progress_remote_write(runtime, endpoint, status);
     } else if (status.opcode == net_opcode_t::READ) {
-      progress_read(status);
+      progress_read(runtime, endpoint, status);
+    } else if (status.opcode == net_opcode_t::ATOMIC) {
+      progress_atomic(endpoint, status);
+    } else if (status.opcode == net_opcode_t::TAGGED_RECV) {
+      progress_tagged_recv(status);
     }
   }
   if (has_failure) {
@@ -347,6 +509,8 @@ error_t progress_x::call_impl(runtime_t runtime, device_t device,
 {
   LCI_PCOUNTER_ADD(progress, 1);
   error_t error(errorcode_t::retry);
+  // the operations staged by this thread may be what the caller waits for
+  flush_thread_batch();
 
   // for (auto& endpoint : device.p_impl->endpoints) {
   for (int i = 0;
@@ -358,6 +522,12 @@ error_t progress_x::call_impl(runtime_t runtime, device_t device,
     while (endpoint.get_impl()->progress_backlog_queue())
       error = errorcode_t::done;
   }
+  // register and announce the next chunk of a pipelined rendezvous message
+  rdv_pipeline_queue_t* rdv_pipeline_queue =
+      device.get_impl()->rdv_pipeline_queue;
+  if (rdv_pipeline_queue && rdv_pipeline_queue->progress()) {
+    error = errorcode_t::done;
+  }
   // poll device completion queue
   net_status_t statuses[LCI_BACKEND_MAX_POLLS];
   size_t ret = device.get_impl()->poll_comp(statuses, LCI_BACKEND_MAX_POLLS);
@@ -370,6 +540,17 @@ error_t progress_x::call_impl(runtime_t runtime, device_t device,
     error = errorcode_t::done;
   }
 #endif
+  if (error.is_retry()) {
+    // flush the aggregated active messages once the device is idle
+    for (int i = 0; i < device.get_impl()->next_endpoint_idx.load(
+                            std::memory_order_relaxed);
+         i++) {
+      endpoint_t endpoint = device.get_impl()->endpoints.get(i);
+      if (endpoint.is_empty() || !endpoint.get_impl()->am_aggregator) continue;
+      if (endpoint.get_impl()->am_aggregator->flush_idle())
+        error = errorcode_t::done;
+    }
+  }
   if (device.p_impl->refill_recvs()) {
     error = errorcode_t::done;
   }
@@ -405,6 +586,10 @@ error_t progress_x::call_impl(runtime_t runtime, device_t device,
 
 error_t test_drained_x::call_impl(runtime_t, device_t device) const
 {
+  if (device.get_impl()->rdv_pipeline_queue &&
+      !device.get_impl()->rdv_pipeline_queue->is_empty()) {
+    return errorcode_t::retry;
+  }
   // Relaxed memory order is sufficient here because we are not trying to ensure
   // any mutual exclusion
   for (int i = 0;
@@ -413,7 +598,9 @@ error_t test_drained_x::call_impl(runtime_t, device_t device) const
     endpoint_t endpoint = device.get_impl()->endpoints.get(i);
     if (endpoint.is_empty()) continue;
     if (endpoint.get_impl()->is_backlog_queue_empty() &&
-        endpoint.get_impl()->get_pending_ops() == 0) {
+        endpoint.get_impl()->get_pending_ops() == 0 &&
+        (!endpoint.get_impl()->am_aggregator ||
+         endpoint.get_impl()->am_aggregator->is_empty())) {
       continue;
     } else {
       return errorcode_t::retry;
@@ -422,6 +609,15 @@ error_t test_drained_x::call_impl(runtime_t, device_t device) const
   return errorcode_t::done;
 }
 
+error_t flush_x::call_impl(runtime_t, device_t, endpoint_t endpoint) const
+{
+  am_aggregator_t* am_aggregator = endpoint.get_impl()->am_aggregator;
+  if (am_aggregator && am_aggregator->flush()) {
+    return errorcode_t::done;
+  }
+  return errorcode_t::retry;
+}
+
 void wait_drained_x::call_impl(runtime_t, device_t device) const
 {
   LCI_DBG_Log(LOG_INFO, "network", "Enter wait_drained\n");
@@ -13,6 +13,38 @@ enum imm_data_msg_type_t {
   IMM_DATA_MSG_FIN = 3
 };
 
+// Internal control messages are sends with non-fastpath EAGER immediate data
+// and bit 28 set. bit 24-27: imm_data_ctrl_type_t; bit 0-23: a value.
+enum imm_data_ctrl_type_t {
+  IMM_DATA_CTRL_EAGER_RDMA_REQ = 0,     // ask the receiver for a ring
+  IMM_DATA_CTRL_EAGER_RDMA_ACK = 1,     // the payload is the ring rmr
+  IMM_DATA_CTRL_EAGER_RDMA_CREDIT = 2,  // the value is the returned slots
+  IMM_DATA_CTRL_AM_AGGREGATE = 3,       // the value is the number of AMs
+  IMM_DATA_CTRL_ATOMIC_REQ = 4,         // the value is the atomic op and type
+  IMM_DATA_CTRL_ATOMIC_RESP = 5,        // the value is the atomic op and type
+};
+
+inline net_imm_data_t make_ctrl_imm_data(imm_data_ctrl_type_t type,
+                                         uint32_t value)
+{
+  net_imm_data_t imm_data = set_bits32(0, IMM_DATA_MSG_EAGER, 2, 29);
+  imm_data = set_bits32(imm_data, 1, 1, 28);
+  imm_data = set_bits32(imm_data, type, 4, 24);
+  return set_bits32(imm_data, value, 24, 0);
+}
+
+// Set the immediate data of an eager message. Return false if the tag or the
+// rcomp does not fit, in which case they are carried in the payload.
+inline bool make_eager_imm_data(runtime_t runtime, tag_t tag, rcomp_t rcomp,
+                                net_imm_data_t* imm_data);
+
+inline bool is_ctrl_imm_data(net_imm_data_t imm_data)
+{
+  return !get_bits32(imm_data, 1, 31) &&
+         get_bits32(imm_data, 2, 29) == IMM_DATA_MSG_EAGER &&
+         get_bits32(imm_data, 1, 28);
+}
+
 /**
  * Internal context structure, Used by asynchronous operations to pass
  * information between initialization phase and completion phase.
@@ -30,13 +62,15 @@ enum imm_data_msg_type_t {
  */
 struct packet_t;
 struct alignas(LCI_CACHE_LINE) internal_context_t {
-  // 68 bytes, 3 bit
+  // 96 bytes, 4 bit
   // is_extended has to be the first bit (be the same as internal_context_t)
   bool is_extended : 1;  // 1 bit
  private:
   bool mr_on_the_fly : 1;      // 1 bit
   bool is_user_posted_op : 1;  // 1 bit
  public:
+  // a recv that is given the eager packet instead of a copy
+  bool is_zero_copy_recv : 1;          // 1 bit
   int rank;                            // 4 bytes
   comp_t comp;                         // 8 bytes
   tag_t tag;                           // 8 bytes
@@ -46,12 +80,20 @@ struct alignas(LCI_CACHE_LINE) internal_context_t {
   packet_t* packet_to_free = nullptr;  // 8 bytes
   endpoint_t endpoint;                 // 8 bytes
   mr_t mr;                             // 8 bytes
+  // a copy of the io vector of a rendezvous sendv/amv
+  iovec_t* iov = nullptr;  // 8 bytes
+  size_t iov_count = 0;    // 8 bytes
+  // a copy of the datatype of a rendezvous send/am or a get
+  datatype_t* datatype = nullptr;  // 8 bytes
+  // get with signal: the remote completion to signal at the target
+  rcomp_t signal_rcomp = 0;  // 4 bytes
 
  public:
   internal_context_t()
       : is_extended(false),
         mr_on_the_fly(false),
         is_user_posted_op(false),
+        is_zero_copy_recv(false),
         rank(-1),
         comp(COMP_NULL),
         tag(0),
@@ -62,6 +104,10 @@ struct alignas(LCI_CACHE_LINE) internal_context_t {
 
   ~internal_context_t();
 
+  // Allocated from a per-thread object pool (see g_internal_context_pool).
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
   // A user posted operation is bind to an endpoint
   void set_user_posted_op(endpoint_t ep)
   {
@@ -100,6 +146,11 @@ struct alignas(LCI_CACHE_LINE) internal_context_extended_t {
   // if set, send imm_data to rank once signal_count reaches 0
   int imm_data_rank;        // 4 bytes
   net_imm_data_t imm_data;  // 4 bytes
+  // memory regions registered per chunk by the pipelined rendezvous protocol
+  mr_t* chunk_mrs;    // 8 bytes
+  size_t nchunk_mrs;  // 8 bytes
+  // the packed data of a datatype, freed with the context
+  void* staging_buffer;  // 8 bytes
 
   internal_context_extended_t()
       : is_extended(true),
@@ -107,11 +158,31 @@ struct alignas(LCI_CACHE_LINE) internal_context_extended_t {
         signal_count(0),
         recv_ctx(0),
         imm_data_rank(-1),
-        imm_data(0)
+        imm_data(0),
+        chunk_mrs(nullptr),
+        nchunk_mrs(0),
+        staging_buffer(nullptr)
   {
   }
+
+  ~internal_context_extended_t();
+
+  void alloc_chunk_mrs(size_t n)
+  {
+    chunk_mrs = new mr_t[n];
+    nchunk_mrs = n;
+  }
+
+  // Allocated from a per-thread object pool (see
+  // g_internal_context_extended_pool).
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
 };
 
+extern object_pool_t<sizeof(internal_context_t)> g_internal_context_pool;
+extern object_pool_t<sizeof(internal_context_extended_t)>
+    g_internal_context_extended_pool;
+
 void process_completion_batch(runtime_t runtime, device_t device,
                               endpoint_t endpoint, const net_status_t* statuses,
                               size_t count);
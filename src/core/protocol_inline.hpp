@@ -6,6 +6,26 @@
 
 namespace lci
 {
+inline bool make_eager_imm_data(runtime_t runtime, tag_t tag, rcomp_t rcomp,
+                                net_imm_data_t* imm_data)
+{
+  if (tag <= runtime.get_attr_max_imm_tag() &&
+      rcomp <= runtime.get_attr_max_imm_rcomp()) {
+    // is_fastpath (1) ; rhandler (15) ; tag (16)
+    *imm_data = set_bits32(0, 1, 1, 31);  // is_fastpath
+    *imm_data =
+        set_bits32(*imm_data, tag, runtime.get_attr_imm_nbits_tag(), 0);
+    *imm_data =
+        set_bits32(*imm_data, rcomp, runtime.get_attr_imm_nbits_rcomp(), 16);
+    return true;
+  } else {
+    // is_fastpath (0) ; msg_type (2)
+    static_assert(IMM_DATA_MSG_EAGER == 0, "Unexpected IMM_DATA_MSG_EAGER");
+    *imm_data = 0;
+    return false;
+  }
+}
+
 inline internal_context_t::~internal_context_t()
 {
   if (mr_on_the_fly) {
@@ -14,10 +34,48 @@ inline internal_context_t::~internal_context_t()
   if (packet_to_free) {
     packet_to_free->put_back();
   }
+  delete[] iov;
+  delete datatype;
   if (is_user_posted_op) {
     endpoint.get_impl()->sub_pending_ops();
   }
 }
+
+inline internal_context_extended_t::~internal_context_extended_t()
+{
+  for (size_t i = 0; i < nchunk_mrs; i++) {
+    if (!chunk_mrs[i].is_empty()) {
+      deregister_memory(&chunk_mrs[i]);
+    }
+  }
+  delete[] chunk_mrs;
+  free(staging_buffer);
+}
+
+inline void* internal_context_t::operator new([[maybe_unused]] size_t size)
+{
+  LCI_DBG_Assert(size == sizeof(internal_context_t), "Unexpected size %lu\n",
+                 size);
+  return g_internal_context_pool.alloc();
+}
+
+inline void internal_context_t::operator delete(void* ptr)
+{
+  if (ptr) g_internal_context_pool.free(ptr);
+}
+
+inline void* internal_context_extended_t::operator new(
+    [[maybe_unused]] size_t size)
+{
+  LCI_DBG_Assert(size == sizeof(internal_context_extended_t),
+                 "Unexpected size %lu\n", size);
+  return g_internal_context_extended_pool.alloc();
+}
+
+inline void internal_context_extended_t::operator delete(void* ptr)
+{
+  if (ptr) g_internal_context_extended_pool.free(ptr);
+}
 }  // namespace lci
 
 #endif  // LCI_CORE_PROTOCOL_INLINE_HPP
\ No newline at end of file
@@ -9,6 +9,11 @@ namespace lci
 inline void handle_rdv_rts_common(runtime_t runtime, endpoint_t endpoint,
                                   packet_t* packet,
                                   internal_context_t* rdv_ctx);
+inline void handle_rdv_read(endpoint_t endpoint, packet_t* packet,
+                            internal_context_t* rdv_ctx);
+inline void handle_rdv_rts_pipeline(runtime_t runtime, endpoint_t endpoint,
+                                    packet_t* packet,
+                                    internal_context_t* rdv_ctx);
 // Also for eager protocol
 inline void handle_matched_sendrecv(runtime_t runtime, endpoint_t endpoint,
                                     packet_t* packet,
@@ -26,15 +31,20 @@ inline void handle_matched_sendrecv(runtime_t runtime, endpoint_t endpoint,
     status.set_done();
     status.buffer = recv_ctx->buffer;
     status.user_context = recv_ctx->user_context;
-    delete recv_ctx;
     status.rank = packet->local_context.rank;
     status.tag = packet->local_context.tag;
-    if (packet->local_context.size > 0) {
-      memcpy(status.buffer, packet->get_payload_address(),
-             packet->local_context.size);
-    }
     status.size = packet->local_context.size;
-    packet->put_back();
+    if (recv_ctx->is_zero_copy_recv) {
+      // the user returns the packet with put_upacket
+      status.buffer = packet->get_payload_address();
+    } else {
+      if (packet->local_context.size > 0) {
+        memcpy(status.buffer, packet->get_payload_address(),
+               packet->local_context.size);
+      }
+      packet->put_back();
+    }
+    delete recv_ctx;
     if (!p_status) {
       comp.get_impl()->signal(status);
     } else {
@@ -50,16 +60,110 @@ inline void handle_matched_sendrecv(runtime_t runtime, endpoint_t endpoint,
 
 struct rts_msg_t {
   rcomp_t rcomp;
+  // whether the receiver should pull the data with RDMA read
+  bool use_read;
+  // whether the receiver should send one rtr message per pipeline chunk
+  bool use_pipeline;
   uintptr_t send_ctx;
   tag_t tag;
   size_t size;
+  // only sent with the read protocol
+  rmr_t rmr;
+  size_t offset;
+
+  // the size of the message to send
+  size_t get_size() const
+  {
+    return use_read ? sizeof(rts_msg_t) : offsetof(rts_msg_t, rmr);
+  }
 };
 
+// Whether a rendezvous message of the given size uses the read protocol.
+inline bool rdv_use_read(runtime_impl_t* runtime, size_t size)
+{
+  // an empty message has nothing to read; the receiver completes it directly
+  if (size == 0) return false;
+  switch (runtime->attr.rdv_protocol) {
+    case attr_rdv_protocol_t::read:
+      return true;
+    case attr_rdv_protocol_t::auto_select:
+      return size <= runtime->attr.rdv_read_threshold;
+    default:
+      return false;
+  }
+}
+
 struct rtr_msg_t {
   uintptr_t send_ctx;
   uintptr_t recv_ctx_or_key;
   rmr_t rmr;
   size_t offset;
+  // the offset of the chunk in the message (pipelined protocol only)
+  size_t chunk_offset;
+};
+
+// Whether a rendezvous message is registered and transferred in chunks.
+// Both sides must agree on it, so it only depends on the runtime attributes
+// and the network context.
+inline bool rdv_use_pipeline(runtime_impl_t* runtime, net_context_t net_context,
+                             size_t size)
+{
+  return runtime->attr.rdv_pipeline &&
+         size > runtime->attr.rdv_pipeline_chunk_size &&
+         net_context.get_attr_max_inject_size() >= sizeof(rtr_msg_t);
+}
+
+// Each pipeline chunk has to fit in a single network message.
+inline size_t rdv_pipeline_chunk_size(runtime_impl_t* runtime,
+                                      net_context_t net_context)
+{
+  return std::min(runtime->attr.rdv_pipeline_chunk_size,
+                  net_context.get_attr_max_msg_size());
+}
+
+inline size_t rdv_pipeline_nchunks(runtime_impl_t* runtime,
+                                   net_context_t net_context, size_t size)
+{
+  size_t chunk_size = rdv_pipeline_chunk_size(runtime, net_context);
+  return (size + chunk_size - 1) / chunk_size;
+}
+
+/**
+ * The receiver-side pipelined rendezvous messages of a device whose chunks
+ * have not all been registered and announced with an rtr message yet. The
+ * progress engine handles the oldest message first, one chunk per call.
+ */
+class rdv_pipeline_queue_t
+{
+ public:
+  struct entry_t {
+    endpoint_t endpoint;
+    internal_context_extended_t* ectx;
+    uintptr_t send_ctx;
+    size_t next_chunk;
+    size_t nchunks;
+    size_t chunk_size;
+  };
+
+  rdv_pipeline_queue_t() : nentries(0) {}
+  ~rdv_pipeline_queue_t()
+  {
+    LCI_Assert(is_empty(), "Drop %lu pipelined rendezvous messages\n",
+               nentries.load());
+  }
+  bool is_empty() const
+  {
+    return nentries.load(std::memory_order_relaxed) == 0;
+  }
+  inline void push(const entry_t& entry);
+  // Register the next chunk of the oldest message and send its rtr message.
+  // Return whether a chunk has been issued.
+  inline bool progress();
+
+ private:
+  spinlock_t lock;
+  std::queue<entry_t> entries;
+  std::atomic<size_t> nentries;
 };
 
 inline void handle_rdv_rts(runtime_t runtime, endpoint_t endpoint,
@@ -78,11 +182,10 @@ inline void handle_rdv_rts(runtime_t runtime, endpoint_t endpoint,
     matching_engine_impl_t* p_matching_engine =
         reinterpret_cast<matching_engine_impl_t*>(entry.value);
     // insert into the matching engine
-    auto key = p_matching_engine->make_key(
-        packet->local_context.rank, packet->local_context.tag,
-        static_cast<matching_policy_t>(entry.metadata));
     auto ret = p_matching_engine->insert(
-        key, packet, matching_engine_impl_t::insert_type_t::send);
+        packet->local_context.rank, packet->local_context.tag,
+        static_cast<matching_policy_t>(entry.metadata), packet,
+        matching_engine_impl_t::insert_type_t::send);
     if (!ret) return;
     handle_rdv_rts_common(runtime, endpoint, packet,
                           reinterpret_cast<internal_context_t*>(ret));
@@ -119,11 +222,35 @@ inline void handle_rdv_rts_common(runtime_t runtime, endpoint_t endpoint,
 
     // set rdv_ctx->data size(s) based on rts->size
     LCI_Assert(rdv_ctx->size >= rts->size, "");
+    LCI_Assert(rdv_ctx->buffer || rts->size == 0,
+               "A zero-copy recv without a buffer got a message of %lu bytes "
+               "too large for a packet\n",
+               rts->size);
     rdv_ctx->size = rts->size;
   }
   rdv_ctx->tag = rts->tag;
   rdv_ctx->rank = packet->local_context.rank;
 
+  if (rdv_ctx->size == 0) {
+    // There is no data to move: send the FIN back and complete the receive.
+    uintptr_t send_ctx = rts->send_ctx;
+    packet->put_back();
+    LCI_DBG_Log(LOG_TRACE, "rdv", "empty message: send FIN sctx %p\n",
+                (void*)send_ctx);
+    net_imm_data_t imm_data = set_bits32(0, IMM_DATA_MSG_FIN, 2, 29);
+    error_t error = endpoint.get_impl()->post_sends(
+        (int)rdv_ctx->rank, &send_ctx, sizeof(send_ctx), imm_data, nullptr,
+        false /* allow_retry */);
+    LCI_Assert(error.is_done(), "Unexpected error %s\n", error.get_str());
+    free_ctx_and_signal_comp(rdv_ctx);
+    return;
+  }
+
+  if (rts->use_pipeline) {
+    handle_rdv_rts_pipeline(runtime, endpoint, packet, rdv_ctx);
+    return;
+  }
+
   // Register the data
   if (rdv_ctx->size > 0 && rdv_ctx->mr.is_empty()) {
     mr_t mr = register_memory_x(rdv_ctx->buffer, rdv_ctx->size)
@@ -132,6 +259,11 @@ inline void handle_rdv_rts_common(runtime_t runtime, endpoint_t endpoint,
     rdv_ctx->set_mr_on_the_fly(mr);
   }
 
+  if (rts->use_read) {
+    handle_rdv_read(endpoint, packet, rdv_ctx);
+    return;
+  }
+
   // Prepare the RTR packet
   // reuse the rts packet as rtr packet
   uintptr_t send_ctx = rts->send_ctx;
@@ -141,11 +273,12 @@ inline void handle_rdv_rts_common(runtime_t runtime, endpoint_t endpoint,
   rtr->recv_ctx_or_key = 0;
   rtr->rmr = get_rmr(rdv_ctx->mr);
   rtr->offset = reinterpret_cast<uintptr_t>(rdv_ctx->buffer) - rtr->rmr.base;
+  rtr->chunk_offset = 0;
 
   LCI_DBG_Log(LOG_TRACE, "rdv", "send rtr: sctx %p\n", (void*)rtr->send_ctx);
 
-  const bool use_writeimm =
-      runtime.get_impl()->attr.rdv_protocol == attr_rdv_protocol_t::writeimm;
+  const bool use_writeimm = runtime.get_impl()->rdv_write_protocol ==
+                            attr_rdv_protocol_t::writeimm;
 
   bool inserted_into_archive = false;
   imm_tag_archive_t::tag_t writeimm_tag = 0;
@@ -158,14 +291,27 @@ inline void handle_rdv_rts_common(runtime_t runtime, endpoint_t endpoint,
     rtr->recv_ctx_or_key = reinterpret_cast<uintptr_t>(rdv_ctx);
   }
 
-  // send the rtr packet
-  internal_context_t* rtr_ctx = new internal_context_t;
-  rtr_ctx->packet_to_free = packet;
-
+  // send the rtr message
   net_imm_data_t imm_data = set_bits32(0, IMM_DATA_MSG_RTR, 2, 29);
-  error_t error = endpoint.get_impl()->post_send(
-      (int)rdv_ctx->rank, packet->get_payload_address(), sizeof(rtr_msg_t),
-      packet->get_mr(endpoint), imm_data, rtr_ctx, false /* allow_retry */);
+  error_t error;
+  if (sizeof(rtr_msg_t) <=
+      device.get_impl()->net_context.get_attr_max_inject_size()) {
+    // inject the rtr message and release the packet right away, so that we
+    // do not need a context to track the send completion.
+    error = endpoint.get_impl()->post_sends(
+        (int)rdv_ctx->rank, packet->get_payload_address(), sizeof(rtr_msg_t),
+        imm_data, nullptr, false /* allow_retry */);
+    if (error.is_done()) {
+      packet->put_back();
+      error = errorcode_t::posted;
+    }
+  } else {
+    internal_context_t* rtr_ctx = new internal_context_t;
+    rtr_ctx->packet_to_free = packet;
+    error = endpoint.get_impl()->post_send(
+        (int)rdv_ctx->rank, packet->get_payload_address(), sizeof(rtr_msg_t),
+        packet->get_mr(endpoint), imm_data, rtr_ctx, false /* allow_retry */);
+  }
   if (!error.is_posted()) {
     if (inserted_into_archive) {
       (void)runtime.get_impl()->rdv_imm_archive.remove(writeimm_tag);
@@ -174,6 +320,286 @@ inline void handle_rdv_rts_common(runtime_t runtime, endpoint_t endpoint,
   }
 }
 
+// Register a chunk of a pipelined message on the receiver side if needed and
+// send its rtr message.
+inline void issue_rdv_pipeline_chunk(rdv_pipeline_queue_t::entry_t& entry)
+{
+  endpoint_t endpoint = entry.endpoint;
+  internal_context_extended_t* ectx = entry.ectx;
+  internal_context_t* rdv_ctx = ectx->internal_ctx;
+  size_t chunk_offset = entry.next_chunk * entry.chunk_size;
+  char* address = (char*)rdv_ctx->buffer + chunk_offset;
+  size_t length = std::min(rdv_ctx->size - chunk_offset, entry.chunk_size);
+  mr_t mr = rdv_ctx->mr;
+  if (mr.is_empty()) {
+    mr = register_memory_x(address, length)
+             .runtime(endpoint.get_impl()->runtime)
+             .device(endpoint.get_impl()->device)();
+    ectx->chunk_mrs[entry.next_chunk] = mr;
+  }
+  rtr_msg_t rtr;
+  rtr.send_ctx = entry.send_ctx;
+  rtr.recv_ctx_or_key = reinterpret_cast<uintptr_t>(ectx);
+  rtr.rmr = get_rmr(mr);
+  rtr.offset = reinterpret_cast<uintptr_t>(address) - rtr.rmr.base;
+  rtr.chunk_offset = chunk_offset;
+  LCI_DBG_Log(LOG_TRACE, "rdv", "send rtr: sctx %p chunk %lu/%lu\n",
+              (void*)entry.send_ctx, entry.next_chunk, entry.nchunks);
+  net_imm_data_t imm_data = set_bits32(0, IMM_DATA_MSG_RTR, 2, 29);
+  error_t error = endpoint.get_impl()->post_sends(
+      (int)rdv_ctx->rank, &rtr, sizeof(rtr_msg_t), imm_data, nullptr,
+      false /* allow_retry */);
+  LCI_Assert(error.is_done(), "Unexpected error %s\n", error.get_str());
+  ++entry.next_chunk;
+}
+
+inline void rdv_pipeline_queue_t::push(const entry_t& entry)
+{
+  lock.lock();
+  entries.push(entry);
+  nentries.fetch_add(1, std::memory_order_relaxed);
+  lock.unlock();
+}
+
+inline bool rdv_pipeline_queue_t::progress()
+{
+  if (is_empty() || !lock.try_lock()) return false;
+  bool progressed = false;
+  if (!entries.empty()) {
+    entry_t& entry = entries.front();
+    issue_rdv_pipeline_chunk(entry);
+    if (entry.next_chunk == entry.nchunks) {
+      entries.pop();
+      nentries.fetch_sub(1, std::memory_order_relaxed);
+    }
+    progressed = true;
+  }
+  lock.unlock();
+  return progressed;
+}
+
+// The receiver side of the pipelined protocol: register the first chunk and
+// send its rtr message right away. The progress engine registers and
+// announces the remaining chunks one per progress call, so that the sender
+// writes the chunks already announced while we register the next ones.
+inline void handle_rdv_rts_pipeline(runtime_t runtime, endpoint_t endpoint,
+                                    packet_t* packet,
+                                    internal_context_t* rdv_ctx)
+{
+  device_t device = endpoint.get_impl()->device;
+  net_context_t net_context = device.get_impl()->net_context;
+  rts_msg_t* rts = reinterpret_cast<rts_msg_t*>(packet->get_payload_address());
+  uintptr_t send_ctx = rts->send_ctx;
+  // We have extracted everything from the RTS packet
+  packet->put_back();
+
+  rdv_pipeline_queue_t::entry_t entry;
+  entry.endpoint = endpoint;
+  entry.send_ctx = send_ctx;
+  entry.next_chunk = 0;
+  entry.chunk_size = rdv_pipeline_chunk_size(runtime.get_impl(), net_context);
+  entry.nchunks =
+      rdv_pipeline_nchunks(runtime.get_impl(), net_context, rdv_ctx->size);
+  // The extended context keeps the chunk memory regions until the FIN
+  // message arrives.
+  entry.ectx = new internal_context_extended_t;
+  entry.ectx->internal_ctx = rdv_ctx;
+  if (rdv_ctx->mr.is_empty()) {
+    entry.ectx->alloc_chunk_mrs(entry.nchunks);
+    issue_rdv_pipeline_chunk(entry);
+    if (entry.next_chunk < entry.nchunks) {
+      rdv_pipeline_queue_t* queue = device.get_impl()->rdv_pipeline_queue;
+      LCI_Assert(queue, "The device has no rendezvous pipeline queue\n");
+      queue->push(entry);
+    }
+  } else {
+    // nothing to register: announce all chunks at once
+    while (entry.next_chunk < entry.nchunks) issue_rdv_pipeline_chunk(entry);
+  }
+}
+
+inline void handle_rdv_rtr_pipeline(runtime_t runtime, endpoint_t endpoint,
+                                    packet_t* packet)
+{
+  device_t device = endpoint.get_impl()->device;
+  net_context_t net_context = device.get_impl()->net_context;
+  rtr_msg_t* rtr = reinterpret_cast<rtr_msg_t*>(packet->get_payload_address());
+  auto ectx = reinterpret_cast<internal_context_extended_t*>(rtr->send_ctx);
+  internal_context_t* rdv_ctx = ectx->internal_ctx;
+
+  const size_t chunk_size =
+      rdv_pipeline_chunk_size(runtime.get_impl(), net_context);
+  size_t chunk_idx = rtr->chunk_offset / chunk_size;
+  LCI_DBG_Assert(rtr->chunk_offset % chunk_size == 0 &&
+                     chunk_idx < ectx->nchunk_mrs,
+                 "Unexpected chunk offset %lu\n", rtr->chunk_offset);
+  if (chunk_idx == 0) {
+    // All rtr messages carry the same receiver context. It is read after the
+    // last write completes.
+    ectx->recv_ctx = rtr->recv_ctx_or_key;
+  }
+  char* address = (char*)rdv_ctx->buffer + rtr->chunk_offset;
+  size_t length = std::min(rdv_ctx->size - rtr->chunk_offset, chunk_size);
+  mr_t mr = rdv_ctx->mr;
+  if (mr.is_empty()) {
+    mr = register_memory_x(address, length).runtime(runtime).device(device)();
+    ectx->chunk_mrs[chunk_idx] = mr;
+  }
+  error_t error = endpoint.get_impl()->post_put(
+      (int)rdv_ctx->rank, address, length, mr, rtr->offset, rtr->rmr, ectx,
+      false /* allow_retry */);
+  LCI_Assert(error.is_posted(), "Unexpected error %s\n", error.get_str());
+  packet->put_back();
+}
+
+// The receiver side of the read protocol: pull the data from the sender.
+inline void handle_rdv_read(endpoint_t endpoint, packet_t* packet,
+                            internal_context_t* rdv_ctx)
+{
+  net_context_t net_context =
+      endpoint.get_impl()->device.get_impl()->net_context;
+  const size_t max_single_msg_size = net_context.get_attr_max_msg_size();
+  rts_msg_t* rts = reinterpret_cast<rts_msg_t*>(packet->get_payload_address());
+
+  auto ectx = new internal_context_extended_t;
+  ectx->internal_ctx = rdv_ctx;
+  ectx->signal_count =
+      (rdv_ctx->size + max_single_msg_size - 1) / max_single_msg_size;
+  // the FIN goes back to the sender once all reads complete
+  ectx->recv_ctx = rts->send_ctx;
+  rmr_t rmr = rts->rmr;
+  size_t remote_offset = rts->offset;
+  // We have extracted everything from the RTS packet
+  packet->put_back();
+
+  LCI_DBG_Log(LOG_TRACE, "rdv", "read: sctx %p size %lu\n",
+              (void*)ectx->recv_ctx, rdv_ctx->size);
+  // post the reads in batches of at most NET_BATCH_MAX_OPS; the ones that
+  // cannot be posted go to the backlog queue in order
+  size_t nops = ectx->signal_count;
+  net_batch_op_t ops[NET_BATCH_MAX_OPS];
+  for (size_t first = 0; first < nops; first += NET_BATCH_MAX_OPS) {
+    size_t n = std::min(nops - first, NET_BATCH_MAX_OPS);
+    for (size_t i = 0; i < n; i++) {
+      size_t offset = (first + i) * max_single_msg_size;
+      net_batch_op_t& op = ops[i];
+      op.type = net_batch_op_t::type_t::get;
+      op.rank = (int)rdv_ctx->rank;
+      op.buffer = (char*)rdv_ctx->buffer + offset;
+      op.size = std::min(rdv_ctx->size - offset, max_single_msg_size);
+      op.mr = rdv_ctx->mr;
+      op.offset = remote_offset + offset;
+      op.rmr = rmr;
+      op.imm_data = 0;
+      op.user_context = ectx;
+    }
+    endpoint.get_impl()->post_batch(ops, n, false /* allow_retry */);
+  }
+}
+
+// The sender side of an io vector rendezvous message: write the io vector
+// into the contiguous receive buffer with as few writes as possible.
+inline void handle_rdv_rtr_iov(runtime_t runtime, endpoint_t endpoint,
+                               packet_t* packet,
+                               internal_context_extended_t* ectx,
+                               net_imm_data_t writeimm_data, bool use_writeimm)
+{
+  device_t device = endpoint.get_impl()->device;
+  net_context_t net_context = device.get_impl()->net_context;
+  rtr_msg_t* rtr = reinterpret_cast<rtr_msg_t*>(packet->get_payload_address());
+  internal_context_t* rdv_ctx = ectx->internal_ctx;
+  iovec_t* iov = rdv_ctx->iov;
+  // register the entries if necessary
+  ectx->alloc_chunk_mrs(rdv_ctx->iov_count);
+  for (size_t i = 0; i < rdv_ctx->iov_count; i++) {
+    if (iov[i].size == 0 || !iov[i].mr.is_empty()) continue;
+    iov[i].mr = register_memory_x(iov[i].buffer, iov[i].size)
+                    .runtime(runtime)
+                    .device(device)();
+    ectx->chunk_mrs[i] = iov[i].mr;
+  }
+  iov_splitter_t splitter(iov, rdv_ctx->iov_count,
+                          net_context.get_attr_max_iov(),
+                          net_context.get_attr_max_msg_size());
+  iovec_t piece[LCI_BACKEND_MAX_IOV];
+  size_t piece_count = 0, piece_size = 0;
+  // The write with immediate data always has a single entry, as not all
+  // backends can post it with an io vector. Count the writes first.
+  size_t npieces = 0;
+  iov_splitter_t counter(splitter);
+  while (counter.next(piece, &piece_count, &piece_size)) ++npieces;
+  const bool split_last = use_writeimm && piece_count > 1;
+  ectx->signal_count = npieces + split_last;
+  size_t offset = 0;
+  for (size_t i = 0; i < npieces; i++) {
+    splitter.next(piece, &piece_count, &piece_size);
+    size_t nentries = piece_count;
+    const bool is_last_piece = i + 1 == npieces;
+    if (use_writeimm && is_last_piece) --nentries;
+    error_t error;
+    if (nentries > 0) {
+      error = endpoint.get_impl()->post_putv(
+          (int)rdv_ctx->rank, piece, nentries, rtr->offset + offset, rtr->rmr,
+          ectx, false /* allow_retry */);
+      LCI_Assert(error.is_posted(), "Unexpected error %s\n", error.get_str());
+    }
+    if (use_writeimm && is_last_piece) {
+      size_t last_offset = offset + piece_size - piece[nentries].size;
+      error = endpoint.get_impl()->post_putImmv(
+          (int)rdv_ctx->rank, &piece[nentries], 1, rtr->offset + last_offset,
+          rtr->rmr, writeimm_data, ectx, false /* allow_retry */);
+      LCI_Assert(error.is_posted(), "Unexpected error %s\n", error.get_str());
+    }
+    offset += piece_size;
+  }
+  // free the rtr packet
+  packet->put_back();
+}
+
+// The sender side of a datatype rendezvous message: pack the data chunk by
+// chunk into a registered staging buffer and write each chunk once packed,
+// so that packing overlaps with the transfer.
+inline void handle_rdv_rtr_datatype(runtime_t runtime, endpoint_t endpoint,
+                                    packet_t* packet,
+                                    internal_context_extended_t* ectx,
+                                    net_imm_data_t writeimm_data,
+                                    bool use_writeimm)
+{
+  device_t device = endpoint.get_impl()->device;
+  net_context_t net_context = device.get_impl()->net_context;
+  rtr_msg_t* rtr = reinterpret_cast<rtr_msg_t*>(packet->get_payload_address());
+  internal_context_t* rdv_ctx = ectx->internal_ctx;
+  const size_t size = rdv_ctx->size;
+  const size_t chunk_size =
+      rdv_pipeline_chunk_size(runtime.get_impl(), net_context);
+  ectx->signal_count = (size + chunk_size - 1) / chunk_size;
+  ectx->staging_buffer = alloc_memalign(size);
+  ectx->alloc_chunk_mrs(1);
+  ectx->chunk_mrs[0] = register_memory_x(ectx->staging_buffer, size)
+                           .runtime(runtime)
+                           .device(device)();
+  for (size_t offset = 0; offset < size; offset += chunk_size) {
+    char* address = static_cast<char*>(ectx->staging_buffer) + offset;
+    size_t length = std::min(size - offset, chunk_size);
+    datatype_pack(*rdv_ctx->datatype, rdv_ctx->buffer, offset, address,
+                  length);
+    error_t error;
+    if (use_writeimm && offset + length >= size) {
+      error = endpoint.get_impl()->post_putImm(
+          (int)rdv_ctx->rank, address, length, ectx->chunk_mrs[0],
+          rtr->offset + offset, rtr->rmr, writeimm_data, ectx,
+          false /* allow_retry */);
+    } else {
+      error = endpoint.get_impl()->post_put(
+          (int)rdv_ctx->rank, address, length, ectx->chunk_mrs[0],
+          rtr->offset + offset, rtr->rmr, ectx, false /* allow_retry */);
+    }
+    LCI_Assert(error.is_posted(), "Unexpected error %s\n", error.get_str());
+  }
+  // free the rtr packet
+  packet->put_back();
+}
+
 inline void handle_rdv_rtr(runtime_t runtime, endpoint_t endpoint,
                            packet_t* packet)
 {
@@ -183,13 +609,17 @@ inline void handle_rdv_rtr(runtime_t runtime, endpoint_t endpoint,
   const size_t max_single_msg_size = net_context.get_attr_max_msg_size();
   rtr_msg_t* rtr = reinterpret_cast<rtr_msg_t*>(packet->get_payload_address());
   internal_context_t* rdv_ctx = (internal_context_t*)rtr->send_ctx;
+  if (rdv_ctx->is_extended) {
+    handle_rdv_rtr_pipeline(runtime, endpoint, packet);
+    return;
+  }
 
   auto ectx = new internal_context_extended_t;
   ectx->internal_ctx = rdv_ctx;
   ectx->signal_count =
       (rdv_ctx->size + max_single_msg_size - 1) / max_single_msg_size;
-  const bool use_writeimm =
-      runtime.get_impl()->attr.rdv_protocol == attr_rdv_protocol_t::writeimm;
+  const bool use_writeimm = runtime.get_impl()->rdv_write_protocol ==
+                            attr_rdv_protocol_t::writeimm;
   net_imm_data_t writeimm_data = 0;
   if (use_writeimm) {
     uint32_t tag_bits = runtime.get_impl()->rdv_imm_archive.tag_bits();
@@ -204,6 +634,17 @@ inline void handle_rdv_rtr(runtime_t runtime, endpoint_t endpoint,
     ectx->recv_ctx = rtr->recv_ctx_or_key;
   }
 
+  if (rdv_ctx->iov) {
+    handle_rdv_rtr_iov(runtime, endpoint, packet, ectx, writeimm_data,
+                       use_writeimm);
+    return;
+  }
+  if (rdv_ctx->datatype) {
+    handle_rdv_rtr_datatype(runtime, endpoint, packet, ectx, writeimm_data,
+                            use_writeimm);
+    return;
+  }
+
   void* buffer = rdv_ctx->buffer;
   size_t size = rdv_ctx->size;
   mr_t* p_mr = &rdv_ctx->mr;
@@ -217,28 +658,40 @@ inline void handle_rdv_rtr(runtime_t runtime, endpoint_t endpoint,
     LCI_DBG_Log(LOG_TRACE, "rdv", "Splitting a large message of %lu bytes\n",
                 size);
   }
-  for (size_t offset = 0; offset < size; offset += max_single_msg_size) {
-    char* address = (char*)buffer + offset;
-    size_t length = std::min(size - offset, max_single_msg_size);
-    bool is_last_chunk = offset + length >= size;
-    error_t error;
-    if (use_writeimm && is_last_chunk) {
-      error = endpoint.get_impl()->post_putImm(
-          (int)rdv_ctx->rank, address, length, *p_mr, rtr->offset + offset,
-          rtr->rmr, writeimm_data, ectx, false /* allow_retry */);
-    } else {
-      error = endpoint.get_impl()->post_put(
-          (int)rdv_ctx->rank, address, length, *p_mr, rtr->offset + offset,
-          rtr->rmr, ectx, false /* allow_retry */);
+  // post the writes in batches of at most NET_BATCH_MAX_OPS; the ones that
+  // cannot be posted go to the backlog queue in order
+  size_t nops = ectx->signal_count;
+  net_batch_op_t ops[NET_BATCH_MAX_OPS];
+  for (size_t first = 0; first < nops; first += NET_BATCH_MAX_OPS) {
+    size_t n = std::min(nops - first, NET_BATCH_MAX_OPS);
+    for (size_t i = 0; i < n; i++) {
+      size_t offset = (first + i) * max_single_msg_size;
+      net_batch_op_t& op = ops[i];
+      op.type = net_batch_op_t::type_t::put;
+      op.rank = (int)rdv_ctx->rank;
+      op.buffer = (char*)buffer + offset;
+      op.size = std::min(size - offset, max_single_msg_size);
+      op.mr = *p_mr;
+      op.offset = rtr->offset + offset;
+      op.rmr = rtr->rmr;
+      op.imm_data = 0;
+      op.user_context = ectx;
     }
-    LCI_Assert(error.is_posted(), "Unexpected error %s\n", error.get_str());
+    if (use_writeimm && first + n == nops) {
+      ops[n - 1].type = net_batch_op_t::type_t::putImm;
+      ops[n - 1].imm_data = writeimm_data;
+    }
+    endpoint.get_impl()->post_batch(ops, n, false /* allow_retry */);
   }
   // free the rtr packet
   packet->put_back();
 }
 
-inline void handle_rdv_local_write(endpoint_t endpoint,
-                                   internal_context_extended_t* ectx)
+// Send the FIN message carrying the peer context once all local RDMA
+// operations (writes for the write protocol, reads for the read protocol)
+// of a rendezvous message have completed.
+inline void handle_rdv_local_comp(endpoint_t endpoint,
+                                  internal_context_extended_t* ectx)
 {
   internal_context_t* ctx = ectx->internal_ctx;
   LCI_Assert(ectx->recv_ctx, "Unexpected recv_ctx\n");
@@ -268,6 +721,12 @@ inline void handle_rdv_fin(packet_t* packet)
   memcpy(&ctx, packet->get_payload_address(), sizeof(ctx));
   LCI_DBG_Log(LOG_TRACE, "rdv", "recv FIN: rctx %p\n", ctx);
   packet->put_back();
+  if (ctx->is_extended) {
+    // pipelined protocol: release the chunk memory regions
+    auto ectx = reinterpret_cast<internal_context_extended_t*>(ctx);
+    ctx = ectx->internal_ctx;
+    delete ectx;
+  }
   handle_rdv_remote_comp(ctx);
 }
 
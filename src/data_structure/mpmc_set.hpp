@@ -7,19 +7,58 @@
 namespace lci
 {
 // The packet pool is implemented as a multiple-producer multiple-consumer set
-// consisting of a deque per thread, protected by a spinlock.
-// For better cache locality, we define the following rules:
-// - Normal push and pop happens at the bottom of the deque.
-// - Cross-thread push and packet steal happens at the top of the deque.
+// consisting of a lock-free deque per thread (Chase-Lev work-stealing deque).
+// - The owner thread pushes and pops at the bottom of its deque without any
+//   atomic read-modify-write, except when racing for the last element.
+// - Other threads steal from the top of the deque with a compare-and-swap.
+// - When a deque is full, the owner copies its elements into an array twice
+//   as large and publishes it. Thieves may still be reading the old array, so
+//   it is kept until the set is destroyed.
+// - Packets put back to the deque of another thread go to its mailbox, a
+//   lock-free list that is taken as a whole (no ABA problem). The owner takes
+//   its mailbox when its deque runs dry; thieves take it when there is
+//   nothing left to steal from the deque.
+// With more than one NUMA node, every deque belongs to the node its thread
+// first ran on. Threads steal from the deques of their own node first, and
+// packets put by a thread of another node go to the mailbox of the reserve
+// deque of their home node. The reserve deque has no owner thread; pushes to
+// its bottom are serialized by a spinlock and it is only ever stolen from.
 class mpmc_set_t
 {
+  struct mailbox_node_t {
+    mailbox_node_t* next;
+    void* packet;
+  };
+
   class alignas(LCI_CACHE_LINE) local_set_t
   {
+    struct array_t {
+      int64_t capacity;  // a power of two
+      std::unique_ptr<std::atomic<void*>[]> slots;
+
+      array_t(int64_t capacity_)
+          : capacity(capacity_), slots(new std::atomic<void*>[capacity_])
+      {
+      }
+      void* get(int64_t idx) const
+      {
+        return slots[idx & (capacity - 1)].load(std::memory_order_relaxed);
+      }
+      void put(int64_t idx, void* val)
+      {
+        slots[idx & (capacity - 1)].store(val, std::memory_order_relaxed);
+      }
+    };
+
    public:
-    local_set_t(int64_t default_size = 1024) : head(0), tail(0)
+    local_set_t(int64_t default_size = 1024)
+        : nmailbox(0), top(0), bottom(0), mailbox(nullptr)
     {
       LCI_Assert(default_size > 0, "default_size must be positive");
-      queue.resize(default_size + 1, nullptr);
+      int64_t capacity = 1;
+      while (capacity < default_size) capacity *= 2;
+      arrays.emplace_back(new array_t(capacity));
+      array.store(arrays.back().get(), std::memory_order_relaxed);
     }
 
     static inline local_set_t* alloc(int64_t default_size = 1024)
@@ -35,113 +74,148 @@ class mpmc_set_t
       std::free(ctx);
     }
 
-    void expand()
-    {
-      int64_t current_size = size();
-      std::vector<void*> new_queue(queue.size() * 2);
-      local_set_t::copy_to_new(this, new_queue, current_size);
-      head = 0;
-      tail = current_size;
-      LCI_Assert(head < tail, "header (%ld) > tail (%ld)\n", head, tail);
-      queue.swap(new_queue);
-      for (int i = 0; i < current_size; i++) {
-        void* val = queue[i];
-        LCI_Assert(val, "val must not be nullptr\n");
-      }
-    }
-
-    void push_to_bot(void* packet)
+    // Only called by the owner.
+    void push(void* packet)
     {
       LCI_Assert(packet, "push found a nullptr\n");
-      if (size() == queue.size() - 1) {
-        expand();
+      int64_t b = bottom.load(std::memory_order_relaxed);
+      int64_t t = top.load(std::memory_order_acquire);
+      array_t* a = array.load(std::memory_order_relaxed);
+      if (b - t >= a->capacity) {
+        a = expand(a, t, b);
       }
-      queue[get_position(tail++)] = packet;
+      a->put(b, packet);
+      std::atomic_thread_fence(std::memory_order_release);
+      bottom.store(b + 1, std::memory_order_relaxed);
     }
 
-    void push_to_top(void* packet)
+    // Only called by the owner.
+    void* pop()
     {
-      LCI_Assert(packet, "push found a nullptr\n");
-      if (size() == queue.size() - 1) {
-        expand();
+      int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+      array_t* a = array.load(std::memory_order_relaxed);
+      bottom.store(b, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t t = top.load(std::memory_order_relaxed);
+      void* ret = nullptr;
+      if (t <= b) {
+        ret = a->get(b);
+        if (t == b) {
+          // the last element: race with the thieves for it
+          if (!top.compare_exchange_strong(t, t + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed))
+            ret = nullptr;
+          bottom.store(b + 1, std::memory_order_relaxed);
+        }
+      } else {
+        bottom.store(b + 1, std::memory_order_relaxed);
       }
-      queue[get_position(--head)] = packet;
+      return ret;
     }
 
-    void* pop_from_top()
+    // Called by any thread. Return nullptr if the deque is empty or another
+    // thread won the race for the top element.
+    void* steal()
     {
-      if (head == tail) {
+      int64_t t = top.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t b = bottom.load(std::memory_order_acquire);
+      if (t >= b) return nullptr;
+      array_t* a = array.load(std::memory_order_acquire);
+      void* ret = a->get(t);
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
         return nullptr;
-      }
-      LCI_Assert(head < tail, "header (%ld) > tail (%ld)\n", head, tail);
-      void* ret = queue[get_position(head++)];
-      LCI_Assert(ret, "pop a nullptr\n");
       return ret;
     }
 
-    void* pop_from_bot()
+    // Called by any thread.
+    void post(mailbox_node_t* node)
     {
-      if (head == tail) {
-        return nullptr;
+      nmailbox.fetch_add(1, std::memory_order_relaxed);
+      node->next = mailbox.load(std::memory_order_relaxed);
+      while (!mailbox.compare_exchange_weak(node->next, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
       }
-      LCI_Assert(head < tail, "header (%ld) > tail (%ld)\n", head, tail);
-      void* ret = queue[get_position(--tail)];
-      LCI_Assert(ret, "pop a nullptr\n");
-      return ret;
     }
 
-    bool empty() const { return head == tail; }
-    size_t size() const { return tail - head; }
-    size_t capacity() const { return queue.size() - 1; }
-
-    int id;
-    std::vector<void*> queue;
-    int64_t head;  // head is the index of the first element
-    int64_t tail;  // tail is the index of the next available slot
-    spinlock_t lock;
+    // Called by any thread. Take all the nodes in the mailbox.
+    mailbox_node_t* take_mailbox()
+    {
+      if (!mailbox.load(std::memory_order_relaxed)) return nullptr;
+      return mailbox.exchange(nullptr, std::memory_order_acquire);
+    }
 
-    // modulo operation that always returns a positive number [0, queue.size())
-    int64_t get_position(int64_t idx)
+    bool empty() const
     {
-      int64_t size = queue.size();
-      return (idx % size + size) % size;
+      return bottom.load(std::memory_order_relaxed) <=
+             top.load(std::memory_order_relaxed);
+    }
+    // The number of elements in the deque (approximate if it is being
+    // modified)
+    size_t size() const
+    {
+      int64_t n = bottom.load(std::memory_order_relaxed) -
+                  top.load(std::memory_order_relaxed);
+      return n > 0 ? n : 0;
     }
 
-    // copy from the top of the source pool to the destination queue
-    static void copy_to_new(local_set_t* src, std::vector<void*>& new_queue,
-                            size_t n)
+    int id;
+    int numa_node;
+    // serialize the pushes to a reserve deque
+    spinlock_t lock;
+    // the number of packets posted to the mailbox but not yet taken
+    // (maintained by the mpmc set)
+    std::atomic<int64_t> nmailbox;
+
+   private:
+    // Move the elements to a larger array. The old one is kept for the
+    // thieves that are still reading it.
+    array_t* expand(array_t* a, int64_t t, int64_t b)
     {
-      LCI_Assert(src->size() >= n,
-                 "Insufficient packets in source pool: %ld (need %ld)\n",
-                 src->size(), n);
-      LCI_Assert(new_queue.size() > n,
-                 "Insufficient size in destination queue: %lu (need %ld)\n",
-                 new_queue.size(), n);
-      int64_t head_idx = src->get_position(src->head);
-      if (head_idx + n <= src->queue.size()) {
-        // no wrap around
-        memcpy(new_queue.data(), &src->queue[head_idx], n * sizeof(void*));
-      } else {
-        int64_t first_segment_size = src->queue.size() - head_idx;
-        memcpy(new_queue.data(), &src->queue[head_idx],
-               first_segment_size * sizeof(void*));
-        memcpy(new_queue.data() + first_segment_size, &src->queue[0],
-               (n - first_segment_size) * sizeof(void*));
+      arrays.emplace_back(new array_t(a->capacity * 2));
+      array_t* new_array = arrays.back().get();
+      for (int64_t i = t; i < b; i++) {
+        new_array->put(i, a->get(i));
       }
-      src->head += n;
+      array.store(new_array, std::memory_order_release);
+      return new_array;
     }
+
+    // top is the index of the first element; only increases
+    alignas(LCI_CACHE_LINE) std::atomic<int64_t> top;
+    // bottom is the index of the next available slot; written by the owner
+    alignas(LCI_CACHE_LINE) std::atomic<int64_t> bottom;
+    std::atomic<array_t*> array;
+    // all arrays ever used by this deque; only accessed by the owner
+    std::vector<std::unique_ptr<array_t>> arrays;
+    alignas(LCI_CACHE_LINE) std::atomic<mailbox_node_t*> mailbox;
   };
 
  public:
-  mpmc_set_t(int default_nthreads = 256, size_t default_lpool_size_ = 1024)
+  mpmc_set_t(int default_nthreads = 256, size_t default_lpool_size_ = 1024,
+             int nnodes_ = 1)
       : default_lpool_size(default_lpool_size_),
+        nnodes(std::max(nnodes_, 1)),
         npools(0),
         pools(default_nthreads),
-        tid_to_pools(default_nthreads)
+        tid_to_pools(default_nthreads),
+        mailbox_nodes(default_nthreads)
   {
+    for (int i = 0; i < nnodes; i++) {
+      nodes.emplace_back(new node_t(default_nthreads));
+    }
+    if (nnodes > 1) {
+      for (int i = 0; i < nnodes; i++) {
+        nodes[i]->reserve = add_pool(i);
+      }
+    }
   }
   ~mpmc_set_t()
   {
+    // the mailbox nodes are freed with the object pool
     for (int i = 0; i < npools; i++) {
       auto ptr = static_cast<local_set_t*>(pools.get(i));
       local_set_t::free(ptr);
@@ -152,20 +226,58 @@ class mpmc_set_t
   bool steal_packets(local_set_t* local_pool, int64_t max_steal_attempts);
   void* get(int64_t max_steal_attempts = 1);
   size_t get_n(size_t n, void* buf_out[], int64_t max_steal_attempts = 1);
-  void put(void* packet, int tid);
+  // tid: the local set id the packet should go back to (-1 for the current
+  // thread)
+  // node: the NUMA node the packet belongs to (-1 if unknown)
+  void put(void* packet, int tid, int node);
+  // put a packet into the reserve set of a NUMA node
+  void put_to_node(void* packet, int node);
+  int get_nnodes() const { return nnodes; }
   // not thread safe
   size_t size() const;
 
  private:
+  struct node_t {
+    node_t(int default_nthreads)
+        : npools(0), pools(default_nthreads), reserve(nullptr)
+    {
+    }
+    std::atomic<int> npools;
+    mpmc_array_t<void*> pools;
+    local_set_t* reserve;
+  };
+
+  local_set_t* add_pool(int node);
   local_set_t* get_local_pool();
   local_set_t* get_random_pool();
+  local_set_t* get_random_pool(int node);
+  bool steal_from(local_set_t* local_pool, local_set_t* random_pool);
+  // post a packet to the mailbox of a pool
+  void post(local_set_t* pool, void* packet);
+  // move the packets in the mailbox of a pool to the local pool
+  size_t take_mailbox(local_set_t* local_pool, local_set_t* pool);
 
   size_t default_lpool_size;
+  int nnodes;
+  std::vector<std::unique_ptr<node_t>> nodes;
   std::atomic<int> npools;
   mpmc_array_t<void*> pools;
   mpmc_array_t<void*> tid_to_pools;
+  object_pool_t<LCI_CACHE_LINE> mailbox_nodes;
 };
 
+inline mpmc_set_t::local_set_t* mpmc_set_t::add_pool(int node)
+{
+  local_set_t* pool = local_set_t::alloc(default_lpool_size);
+  pool->numa_node = node;
+  int pool_id = npools++;
+  pool->id = pool_id;
+  pools.put(pool_id, pool);
+  node_t* p_node = nodes[node].get();
+  p_node->pools.put(p_node->npools++, pool);
+  return pool;
+}
+
 inline mpmc_set_t::local_set_t* mpmc_set_t::get_local_pool()
 {
   int tid = get_local_set_id();
@@ -174,10 +286,8 @@ inline mpmc_set_t::local_set_t* mpmc_set_t::get_local_pool()
     return static_cast<local_set_t*>(ptr);
   }
   // we need to allocate a new one
-  ptr = local_set_t::alloc(default_lpool_size);
-  int pool_id = npools++;
-  static_cast<local_set_t*>(ptr)->id = pool_id;
-  pools.put(pool_id, ptr);
+  int node = nnodes > 1 ? std::min(get_current_numa_node(), nnodes - 1) : 0;
+  ptr = add_pool(node);
   tid_to_pools.put(tid, ptr);
   return static_cast<local_set_t*>(ptr);
 }
@@ -188,52 +298,68 @@ inline mpmc_set_t::local_set_t* mpmc_set_t::get_random_pool()
   return static_cast<local_set_t*>(pools.get(pool_id));
 }
 
+inline mpmc_set_t::local_set_t* mpmc_set_t::get_random_pool(int node)
+{
+  node_t* p_node = nodes[node].get();
+  int n = p_node->npools;
+  if (n == 0) return nullptr;
+  return static_cast<local_set_t*>(p_node->pools.get(rand_mt() % n));
+}
+
+inline void mpmc_set_t::post(local_set_t* pool, void* packet)
+{
+  auto node = static_cast<mailbox_node_t*>(mailbox_nodes.alloc());
+  node->packet = packet;
+  pool->post(node);
+  LCI_PCOUNTER_ADD(packet_put_remote, 1);
+}
+
+inline size_t mpmc_set_t::take_mailbox(local_set_t* local_pool,
+                                       local_set_t* pool)
+{
+  mailbox_node_t* node = pool->take_mailbox();
+  size_t n = 0;
+  while (node) {
+    mailbox_node_t* next = node->next;
+    local_pool->push(node->packet);
+    mailbox_nodes.free(node);
+    node = next;
+    ++n;
+  }
+  pool->nmailbox.fetch_sub(n, std::memory_order_relaxed);
+  return n;
+}
+
+inline bool mpmc_set_t::steal_from(local_set_t* local_pool,
+                                   local_set_t* random_pool)
+{
+  if (!random_pool || random_pool == local_pool) return false;
+  // we steal half of the packets from the top of the random pool, one at a
+  // time, as the owner may be popping from the bottom meanwhile
+  size_t size_to_steal = (random_pool->size() + 1) / 2;
+  size_t nstolen = 0;
+  for (; nstolen < size_to_steal; nstolen++) {
+    void* packet = random_pool->steal();
+    if (!packet) break;
+    local_pool->push(packet);
+  }
+  if (nstolen > 0) return true;
+  // nothing left in the deque; the packets in its mailbox are up for grabs
+  return take_mailbox(local_pool, random_pool) > 0;
+}
+
 inline bool mpmc_set_t::steal_packets(local_set_t* local_pool,
                                       int64_t max_steal_attempts = 1)
 {
-  // We assume we are holding the lock of local_pool
   // random packet stealing
-  // we steal from the top of the random pool
   for (int64_t i = 0; i < max_steal_attempts; i++) {
-    size_t size_to_steal;
-    local_set_t* random_pool;
-
+    // the packets returned to us by other threads first
+    if (take_mailbox(local_pool, local_pool) > 0) return true;
     LCI_PCOUNTER_ADD(packet_steal, 1);
-    LCI_Assert(local_pool->empty(), "local pool must be empty\n");
-    random_pool = get_random_pool();
-    if (!random_pool || random_pool == local_pool || random_pool->size() <= 0)
-      continue;
-    if (!random_pool->lock.try_lock()) continue;
-    // At this point, we should have locked both pools
-    size_to_steal = (random_pool->size() + 1) / 2;
-    if (size_to_steal > 0) {
-      LCI_Assert(size_to_steal <= random_pool->size(),
-                 "n (%ld) > random_pool->size() (%ld)\n", size_to_steal,
-                 random_pool->size());
-      local_pool->queue.resize(std::max(default_lpool_size, size_to_steal * 2) +
-                               1);
-      // steal half packets from random_pool
-      local_set_t::copy_to_new(random_pool, local_pool->queue, size_to_steal);
-      LCI_Assert(random_pool->head <= random_pool->tail,
-                 "header (%ld) > tail (%ld)\n", random_pool->head,
-                 random_pool->tail);
-    }
-    random_pool->lock.unlock();
-
-    if (size_to_steal == 0) {
-      // no packets to steal
-      continue;
-    }
-
-    local_pool->tail = size_to_steal;
-    local_pool->head = 0;
-#ifdef LCI_DEBUG
-    for (size_t i = 0; i < size_to_steal; i++) {
-      void* val = local_pool->queue[i];
-      LCI_DBG_Assert(val, "val must not be nullptr\n");
-    }
-#endif
-    return true;
+    // the pools of the same NUMA node first
+    if (steal_from(local_pool, get_random_pool(local_pool->numa_node)))
+      return true;
+    if (nnodes > 1 && steal_from(local_pool, get_random_pool())) return true;
   }
   return false;
 }
@@ -250,49 +376,52 @@ inline size_t mpmc_set_t::get_n(size_t n, void* buf_out[],
 {
   local_set_t* local_pool = get_local_pool();
 
-  bool succeed = false;
-  for (int64_t i = 0; i < max_retry_attempts; i++) {
-    succeed = local_pool->lock.try_lock();
-    if (succeed) break;
-  }
-  if (!succeed) {
-    return 0;
-  }
-
-  if (local_pool->size() == 0) steal_packets(local_pool, max_retry_attempts);
+  if (local_pool->empty()) steal_packets(local_pool, max_retry_attempts);
 
   size_t n_popped = 0;
   for (size_t i = 0; i < n; i++) {
-    void* ret = local_pool->pop_from_bot();
+    void* ret = local_pool->pop();
     if (!ret) break;
     buf_out[i] = ret;
     n_popped++;
   }
-
-  local_pool->lock.unlock();
   return n_popped;
 }
 
 inline void mpmc_set_t::put(void* packet,
-                            int tid = mpmc_set_t::LOCAL_SET_ID_NULL)
+                            int tid = mpmc_set_t::LOCAL_SET_ID_NULL,
+                            int node = -1)
 {
   LCI_Assert(packet, "packet must not be nullptr\n");
-  bool return_to_current = false;
-  if (tid < 0) {
-    // return to the local pool of the current thread
-    tid = get_local_set_id();
-    return_to_current = true;
-  }
   local_set_t* local_pool = get_local_pool();
-
-  local_pool->lock.lock();
-  if (return_to_current) {
-    // we push to the bot for better cacahe locality
-    local_pool->push_to_bot(packet);
-  } else {
-    local_pool->push_to_top(packet);
+  LCI_DBG_Assert(node < nnodes, "Unexpected NUMA node %d\n", node);
+  if (node >= 0 && node != local_pool->numa_node) {
+    // send the packet back to its home node
+    post(nodes[node]->reserve, packet);
+    return;
+  }
+  if (tid >= 0 && tid != get_local_set_id()) {
+    // return the packet to the thread that last had it, whose cache is
+    // likely to still hold it
+    auto pool = static_cast<local_set_t*>(tid_to_pools.get(tid));
+    if (pool && pool->numa_node == local_pool->numa_node) {
+      post(pool, packet);
+      return;
+    }
   }
-  local_pool->lock.unlock();
+  // we push to the bottom for better cache locality
+  local_pool->push(packet);
+}
+
+inline void mpmc_set_t::put_to_node(void* packet, int node)
+{
+  LCI_Assert(packet, "packet must not be nullptr\n");
+  LCI_Assert(0 <= node && node < nnodes && nodes[node]->reserve,
+             "Unexpected NUMA node %d\n", node);
+  local_set_t* pool = nodes[node]->reserve;
+  pool->lock.lock();
+  pool->push(packet);
+  pool->lock.unlock();
 }
 
 inline size_t mpmc_set_t::size() const
@@ -301,10 +430,10 @@ inline size_t mpmc_set_t::size() const
   for (int i = 0; i < npools; i++) {
     local_set_t* pool = static_cast<local_set_t*>(pools.get(i));
     LCI_Assert(pool, "pool must not be nullptr\n");
-    total += pool->size();
+    total += pool->size() + pool->nmailbox.load(std::memory_order_relaxed);
   }
   return total;
 }
 }  // namespace lci
 
-#endif  // LCI_MPMC_SET_HPP
\ No newline at end of file
+#endif  // LCI_MPMC_SET_HPP
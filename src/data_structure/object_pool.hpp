@@ -0,0 +1,150 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_OBJECT_POOL_HPP
+#define LCI_OBJECT_POOL_HPP
+
+namespace lci
+{
+// A fixed-size object allocator with a cache per thread.
+// - Objects are carved out of slabs aligned to the slab size, so the cache
+//   owning an object can be found by masking its address.
+// - Allocation and same-thread free only touch the local free list of the
+//   calling thread; no atomic operation is involved.
+// - Cross-thread free pushes the object to a lock-free list of the owning
+//   cache. The owner takes the whole list at once when its local free list
+//   runs dry, so the list is never popped concurrently (no ABA problem).
+// Slabs are never returned to the system before the pool is destroyed.
+template <size_t OBJ_SIZE>
+class object_pool_t
+{
+  static_assert(OBJ_SIZE % LCI_CACHE_LINE == 0,
+                "object size must be a multiple of the cache line size");
+
+  struct free_node_t {
+    free_node_t* next;
+  };
+
+  struct local_cache_t;
+
+  struct alignas(LCI_CACHE_LINE) slab_header_t {
+    local_cache_t* owner;
+  };
+
+  struct alignas(LCI_CACHE_LINE) local_cache_t {
+    // only accessed by the owner thread
+    free_node_t* free_list = nullptr;
+    std::vector<void*> slabs;
+    // pushed by other threads, drained by the owner thread
+    alignas(LCI_CACHE_LINE) std::atomic<free_node_t*> remote_free_list;
+
+    local_cache_t() : remote_free_list(nullptr) {}
+
+    static local_cache_t* alloc()
+    {
+      auto ptr = reinterpret_cast<local_cache_t*>(
+          alloc_memalign(sizeof(local_cache_t)));
+      return new (ptr) local_cache_t();
+    }
+
+    static void free(local_cache_t* cache)
+    {
+      for (auto slab : cache->slabs) {
+        std::free(slab);
+      }
+      cache->~local_cache_t();
+      std::free(cache);
+    }
+  };
+
+ public:
+  static constexpr size_t SLAB_SIZE = 64 * 1024;
+  static constexpr size_t NOBJS_PER_SLAB =
+      (SLAB_SIZE - sizeof(slab_header_t)) / OBJ_SIZE;
+  static_assert(NOBJS_PER_SLAB > 0, "object size is too large for a slab");
+
+  object_pool_t(int default_nthreads = 256) : caches(default_nthreads) {}
+
+  ~object_pool_t()
+  {
+    for (size_t i = 0; i < caches.get_size(); i++) {
+      auto cache = static_cast<local_cache_t*>(caches.get(i));
+      if (cache) local_cache_t::free(cache);
+    }
+  }
+
+  void* alloc()
+  {
+    local_cache_t* cache = get_local_cache();
+    free_node_t* node = cache->free_list;
+    if (LCT_unlikely(!node)) {
+      node = cache->remote_free_list.exchange(nullptr,
+                                              std::memory_order_acquire);
+      if (node) {
+        LCI_PCOUNTER_ADD(object_pool_reclaim, 1);
+      } else {
+        node = alloc_slab(cache);
+      }
+    }
+    cache->free_list = node->next;
+    LCI_PCOUNTER_ADD(object_pool_alloc, 1);
+    return node;
+  }
+
+  void free(void* ptr)
+  {
+    LCI_DBG_Assert(ptr, "free a nullptr\n");
+    auto slab = reinterpret_cast<slab_header_t*>(
+        reinterpret_cast<uintptr_t>(ptr) & ~(SLAB_SIZE - 1));
+    local_cache_t* owner = slab->owner;
+    auto node = static_cast<free_node_t*>(ptr);
+    if (LCT_likely(owner == caches.get(LCT_get_thread_id()))) {
+      node->next = owner->free_list;
+      owner->free_list = node;
+    } else {
+      node->next = owner->remote_free_list.load(std::memory_order_relaxed);
+      while (!owner->remote_free_list.compare_exchange_weak(
+          node->next, node, std::memory_order_release,
+          std::memory_order_relaxed)) {
+      }
+      LCI_PCOUNTER_ADD(object_pool_free_remote, 1);
+    }
+    LCI_PCOUNTER_ADD(object_pool_free, 1);
+  }
+
+ private:
+  local_cache_t* get_local_cache()
+  {
+    int tid = LCT_get_thread_id();
+    void* ptr = caches.get(tid);
+    if (LCT_likely(ptr)) {
+      return static_cast<local_cache_t*>(ptr);
+    }
+    local_cache_t* cache = local_cache_t::alloc();
+    caches.put(tid, cache);
+    return cache;
+  }
+
+  // Allocate a new slab for the cache and return a list of its objects.
+  free_node_t* alloc_slab(local_cache_t* cache)
+  {
+    void* slab = alloc_memalign(SLAB_SIZE, SLAB_SIZE);
+    LCI_Assert(slab, "Failed to allocate a slab of %lu bytes\n", SLAB_SIZE);
+    static_cast<slab_header_t*>(slab)->owner = cache;
+    cache->slabs.push_back(slab);
+    char* base = static_cast<char*>(slab) + sizeof(slab_header_t);
+    free_node_t* head = nullptr;
+    for (size_t i = NOBJS_PER_SLAB; i > 0; i--) {
+      auto node = reinterpret_cast<free_node_t*>(base + (i - 1) * OBJ_SIZE);
+      node->next = head;
+      head = node;
+    }
+    LCI_PCOUNTER_ADD(object_pool_slab_alloc, 1);
+    return head;
+  }
+
+  mpmc_array_t<void*> caches;
+};
+}  // namespace lci
+
+#endif  // LCI_OBJECT_POOL_HPP
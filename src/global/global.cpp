@@ -11,6 +11,9 @@ const char* DEFAULT_NAME = "unnamed";
 bool g_is_active = false;
 int g_rank_me = -1, g_rank_n = -1;
 allocator_default_t g_allocator_default;
+object_pool_t<sizeof(internal_context_t)> g_internal_context_pool;
+object_pool_t<sizeof(internal_context_extended_t)>
+    g_internal_context_extended_pool;
 // TODO: make the default runtime a thread_local stack
 // and let users to switch runtime via function calls
 // instead of optional arguments
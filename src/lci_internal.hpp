@@ -22,9 +22,13 @@
 #include "util/log.hpp"
 #include "util/random.hpp"
 #include "util/misc.hpp"
+#include "util/numa.hpp"
+#include "util/huge_page.hpp"
 #include "util/spinlock.hpp"
+#include "util/futex.hpp"
 #include "monitor/performance_counter.hpp"
 #include "data_structure/mpmc_array.hpp"
+#include "data_structure/object_pool.hpp"
 #include "data_structure/mpmc_set.hpp"
 #include "data_structure/imm_tag_archive.hpp"
 #include "bootstrap/bootstrap.hpp"
@@ -49,6 +53,9 @@
 #include "rhandler_registry/rhandler_registry.hpp"
 #include "global/global.hpp"
 #include "core/protocol.hpp"
+#include "core/iovec.hpp"
+#include "core/datatype.hpp"
+#include "comp/waiter.hpp"
 #include "comp/sync.hpp"
 #include "comp/counter.hpp"
 #include "comp/cq.hpp"
@@ -58,6 +65,10 @@
 #include "packet_pool/packet_pool.hpp"
 #include "runtime/runtime.hpp"
 #include "core/rendezvous.hpp"
+#include "core/eager_rdma.hpp"
+#include "core/am_aggregation.hpp"
+#include "core/atomic.hpp"
+#include "core/communicate.hpp"
 #include "collective/collective.hpp"
 
 // inline implementation
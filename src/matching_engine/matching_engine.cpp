@@ -18,16 +18,19 @@ void matching_engine_impl_t::register_rhandler(runtime_t runtime)
 }
 
 matching_engine_t alloc_matching_engine_x::call_impl(
-    attr_matching_engine_type_t matching_engine_type, const char* name,
-    void* user_context, runtime_t runtime) const
+    attr_matching_engine_type_t matching_engine_type, size_t nbuckets,
+    const char* name, void* user_context, runtime_t runtime) const
 {
   matching_engine_t::attr_t attr;
   attr.matching_engine_type = matching_engine_type;
+  attr.nbuckets = nbuckets;
   attr.name = name;
   attr.user_context = user_context;
   matching_engine_t matching_engine;
   switch (attr.matching_engine_type) {
     case attr_matching_engine_type_t::map:
+    case attr_matching_engine_type_t::offload:
+      // send-recv on a tagged network bypasses the offload matching engine
       matching_engine.p_impl = new matching_engine_map_t(attr);
       break;
     case attr_matching_engine_type_t::queue:
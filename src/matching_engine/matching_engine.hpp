@@ -6,6 +6,18 @@
 
 namespace lci
 {
+// The key of a (rank, tag) pair whose tag does not fit in the 32-bit tag field
+// of matching_entry_key_t.
+struct matching_entry_wide_key_t {
+  uint64_t rank;
+  uint64_t tag;
+
+  bool operator==(const matching_entry_wide_key_t& other) const
+  {
+    return rank == other.rank && tag == other.tag;
+  }
+};
+
 class matching_engine_impl_t
 {
  public:
@@ -13,6 +25,7 @@ class matching_engine_impl_t
   attr_t attr;
   using insert_type_t = matching_entry_type_t;
   using key_t = matching_entry_key_t;
+  using wide_key_t = matching_entry_wide_key_t;
   using val_t = matching_entry_val_t;
   matching_engine_impl_t(attr_t attr_) : attr(attr_) {}
   virtual ~matching_engine_impl_t() = default;
@@ -27,6 +40,19 @@ class matching_engine_impl_t
   virtual key_t make_key(int rank, tag_t tag, matching_policy_t policy) const;
   // insert a key-value pair
   virtual val_t insert(key_t key, val_t value, insert_type_t type) = 0;
+  // insert a key-value pair whose key does not fit in key_t
+  virtual val_t insert_wide(wide_key_t key, val_t value,
+                            insert_type_t type) = 0;
+  // insert a (rank, tag) pair, using the wide key only if the tag needs it
+  val_t insert(int rank, tag_t tag, matching_policy_t policy, val_t value,
+               insert_type_t type)
+  {
+    if (LCT_unlikely(policy == matching_policy_t::rank_tag &&
+                     tag > std::numeric_limits<uint32_t>::max())) {
+      return insert_wide({static_cast<uint64_t>(rank), tag}, value, type);
+    }
+    return insert(make_key(rank, tag, policy), value, type);
+  }
 
  private:
   rcomp_t rcomp_base;
@@ -43,7 +69,7 @@ inline matching_engine_impl_t::key_t matching_engine_impl_t::make_key(
       key = set_bits64(key, rank, 32, 0);
       break;
     case matching_policy_t::tag_only:
-      key = set_bits64(key, tag, 32, 0);
+      key = tag;
       break;
     case matching_policy_t::rank_tag:
       key = set_bits64(key, rank, 32, 32);
@@ -4,10 +4,73 @@
 #ifndef LCI_MATCHING_ENGINE_MAP_HPP
 #define LCI_MATCHING_ENGINE_MAP_HPP
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace lci
 {
-class matching_engine_map_t : public matching_engine_impl_t
+#if defined(__ARM_NEON) && defined(__aarch64__)
+// the bitmask of the nonzero bytes of a comparison result
+static inline uint32_t movemask_u8(uint8x16_t eq)
 {
+  static const uint8_t bits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                   1, 2, 4, 8, 16, 32, 64, 128};
+  uint8x16_t masked = vandq_u8(eq, vld1q_u8(bits));
+  return vaddv_u8(vget_low_u8(masked)) |
+         (static_cast<uint32_t>(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+#endif
+
+// Compare 16 bytes with a byte and return the bitmask of the equal ones.
+// The bitmask of the zero bytes is returned in zero_mask.
+static inline uint32_t match_bytes16(const uint8_t* bytes, uint8_t byte,
+                                     uint32_t* zero_mask)
+{
+#if defined(__SSE2__)
+  __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+  *zero_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)byte)));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  uint8x16_t v = vld1q_u8(bytes);
+  *zero_mask = movemask_u8(vceqzq_u8(v));
+  return movemask_u8(vceqq_u8(v, vdupq_n_u8(byte)));
+#else
+  uint32_t mask = 0;
+  *zero_mask = 0;
+  for (int i = 0; i < 16; ++i) {
+    mask |= static_cast<uint32_t>(bytes[i] == byte) << i;
+    *zero_mask |= static_cast<uint32_t>(bytes[i] == 0) << i;
+  }
+  return mask;
+#endif
+}
+
+// A hash table of the queues of the entries with the same key.
+//
+// The table grows and shrinks online with linear hashing: the number of
+// master buckets is changed by one at a time, by splitting the next bucket
+// into a new one at the end of the table or merging the last bucket back into
+// its partner. Only the queues of these two buckets move, so a resize step
+// only needs their locks and an insertion never waits for the whole table.
+// An insertion checks, after locking its bucket, that the bucket is still the
+// one its key maps to, and retries otherwise.
+//
+// The master buckets are allocated in segments of doubling size. A thread
+// may still be spinning on the lock of a bucket that has just been merged,
+// so, like mpmc_array_t, we never free a segment while the table is alive;
+// the segments beyond the end of the table are reused when it grows again.
+//
+// Every bucket keeps a one-byte tag per queue: 0 for an empty queue and a
+// byte of the key hash otherwise. A lookup compares the tags of 16 queues
+// at once and only compares the keys of the queues whose tags match.
+template <typename K>
+class matching_table_t
+{
+  using val_t = matching_entry_val_t;
+  using insert_type_t = matching_entry_type_t;
   static constexpr val_t VALUE_EMPTY = nullptr;
   static const int NODE_NUM_VALUES =
       (LCI_CACHE_LINE - sizeof(struct node_t*)) / sizeof(uint64_t);
@@ -15,8 +78,23 @@ class matching_engine_map_t : public matching_engine_impl_t
   // sizeof(bucket_t) - 1;
   static const int BUCKET_NUM_QUEUES_DEFAULT = 3;
   static const int SLOT_NUM_VALUES = 2;
-  static const int TABLE_BIT_SIZE = 16;
-  static const int TABLE_NUM_MASTER_BUCKETS = 1 << 16;
+  // The tags of buckets with up to this many queues fit in the control block.
+  static const int BUCKET_NUM_INLINE_TAGS = 16;
+  // match_bytes16 looks for the empty tags as the zero bytes
+  static const uint8_t TAG_EMPTY = 0;
+  static const uint32_t TABLE_MIN_NUM_BUCKETS = 16;
+  static const uint32_t TABLE_MAX_NUM_BUCKETS = 1 << 24;
+  static const int TABLE_MAX_NUM_SEGMENTS = 32;
+  // The table grows when there are more than TABLE_MAX_LOAD queues per master
+  // bucket and shrinks when there are fewer than 1 / TABLE_MIN_LOAD_INV.
+  static const int TABLE_MAX_LOAD = 1;
+  static const int TABLE_MIN_LOAD_INV = 4;
+  // The number of buckets split or merged by one insertion. It is larger
+  // than TABLE_MIN_LOAD_INV so that shrinking keeps up with the removals.
+  static const int TABLE_RESIZE_STEP = 8;
+  // The number of shards of the queue counter. A shard is picked by the high
+  // bits of the hash, so the table size can be estimated from one shard.
+  static const int TABLE_NUM_COUNTERS = 16;
 
   struct node_t {
     val_t values[NODE_NUM_VALUES];
@@ -30,12 +108,12 @@ class matching_engine_map_t : public matching_engine_impl_t
     }
   };
 
-  // 32 bytes
+  // 32 bytes with a 64-bit key
   struct queue_t {
     bool is_empty;
     bool is_queue;
     insert_type_t type;
-    key_t key;
+    K key;
     // 16 bytes
     union {
 #if defined(__clang__)
@@ -179,7 +257,7 @@ class matching_engine_map_t : public matching_engine_impl_t
       }
     }
 
-    void setup(key_t key_, insert_type_t type_, val_t value)
+    void setup(K key_, insert_type_t type_, val_t value)
     {
       LCI_DBG_Assert(is_empty, "This queue is nonn-empty!\n");
       is_empty = false;
@@ -196,20 +274,19 @@ class matching_engine_map_t : public matching_engine_impl_t
   struct bucket_t {
     // 32 bytes
     // Note: on apple, this may be a multiple of 32 bytes
-    struct {
+    struct alignas(32) {
       bucket_t* next = nullptr;
       spinlock_t lock;
       int nqueues;
-      char padding[32 -
-                   (sizeof(bucket_t*) + sizeof(spinlock_t) + sizeof(int)) % 32];
+      // the tags of the queues if they fit, see get_tags
+      alignas(16) uint8_t tags[BUCKET_NUM_INLINE_TAGS];
     } control;
 
     bucket_t() : bucket_t(BUCKET_NUM_QUEUES_DEFAULT) {}
 
     static bucket_t* alloc(int nqueues = BUCKET_NUM_QUEUES_DEFAULT)
     {
-      size_t size = sizeof(bucket_t) + nqueues * sizeof(queue_t);
-      bucket_t* bucket = (bucket_t*)alloc_memalign(size);
+      bucket_t* bucket = (bucket_t*)alloc_memalign(size(nqueues));
       bucket = new (bucket) bucket_t(nqueues);
       return bucket;
     }
@@ -220,9 +297,25 @@ class matching_engine_map_t : public matching_engine_impl_t
       std::free(bucket);
     }
 
+    // the number of tags rounded up to a multiple of 16
+    static size_t get_tags_size(int nqueues)
+    {
+      return (nqueues + BUCKET_NUM_INLINE_TAGS - 1) / BUCKET_NUM_INLINE_TAGS *
+             BUCKET_NUM_INLINE_TAGS;
+    }
+
     static size_t size(int nqueues = BUCKET_NUM_QUEUES_DEFAULT)
     {
-      return sizeof(bucket_t) + nqueues * sizeof(queue_t);
+      size_t size = sizeof(bucket_t) + nqueues * sizeof(queue_t);
+      // larger buckets keep their tags after the queues
+      if (nqueues > BUCKET_NUM_INLINE_TAGS) size += get_tags_size(nqueues);
+      return size;
+    }
+
+    uint8_t* get_tags()
+    {
+      if (control.nqueues <= BUCKET_NUM_INLINE_TAGS) return control.tags;
+      return reinterpret_cast<uint8_t*>(get_queues_p() + control.nqueues);
     }
 
     queue_t* get_queues_p()
@@ -239,6 +332,7 @@ class matching_engine_map_t : public matching_engine_impl_t
       for (int i = 0; i < nqueues_; i++) {
         new (get_queue_p(i)) queue_t();
       }
+      memset(get_tags(), TAG_EMPTY, get_tags_size(nqueues_));
     }
 
     ~bucket_t()
@@ -251,26 +345,36 @@ class matching_engine_map_t : public matching_engine_impl_t
 
   static inline uint32_t hash_fn(const uint64_t k)
   {
-    // default values recommended by http://isthe.com/chongo/tech/comp/fnv/
-    static const uint32_t Prime = 0x01000193;  //   16777619
-    static const uint32_t Seed = 0x811C9DC5;   // 2166136261
-
-    uint32_t hash = ((k & 0xff) ^ Seed) * Prime;
-    hash = (((k >> 8) & 0xff) ^ hash) * Prime;
-    hash = (((k >> 16) & 0xff) ^ hash) * Prime;
-    hash = (((k >> 24) & 0xff) ^ hash) * Prime;
-    hash = (((k >> 32) & 0xff) ^ hash) * Prime;
-    hash = (((k >> 40) & 0xff) ^ hash) * Prime;
-    hash = (((k >> 48) & 0xff) ^ hash) * Prime;
-    hash = (((k >> 56) & 0xff) ^ hash) * Prime;
-
-    // Mask into smaller space.
-    return (((hash >> TABLE_BIT_SIZE) ^ hash) &
-            (((uint32_t)1 << TABLE_BIT_SIZE) - 1));
+    // Multiply by the 64-bit golden ratio and fold the high half of the
+    // product into the low half, so that every bit of the key reaches the
+    // low bits used to pick the bucket.
+    static const uint64_t Golden = 0x9E3779B97F4A7C15ULL;
+#ifdef __SIZEOF_INT128__
+    __uint128_t product = static_cast<__uint128_t>(k) * Golden;
+    uint64_t hash = static_cast<uint64_t>(product) ^
+                    static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t hash = k * Golden;
+    hash ^= hash >> 29;
+#endif
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+  }
+
+  // The tag of a non-empty queue: the high bits of the hash (the low bits
+  // pick the bucket) with the highest bit set to tell it from TAG_EMPTY.
+  static inline uint8_t get_tag(uint32_t hash)
+  {
+    return static_cast<uint8_t>(0x80 | (hash >> 25));
+  }
+
+  static inline uint32_t hash_fn(const matching_entry_wide_key_t& k)
+  {
+    // mix the rank into the tag with the 64-bit golden ratio
+    return hash_fn(k.tag ^ (k.rank * 0x9E3779B97F4A7C15ULL));
   }
 
  public:
-  matching_engine_map_t(attr_t attr) : matching_engine_impl_t(attr)
+  matching_table_t(size_t nbuckets)
   {
     if constexpr (sizeof(bucket_t) != 32) {
       LCI_DBG_Log(
@@ -280,76 +384,120 @@ class matching_engine_map_t : public matching_engine_impl_t
           sizeof(bucket_t));
     }
     static_assert(sizeof(node_t) == 64, "node_t size is not 16 bytes");
-    table =
-        (bucket_t*)alloc_memalign(TABLE_NUM_MASTER_BUCKETS * bucket_t::size());
-    for (size_t i = 0; i < TABLE_NUM_MASTER_BUCKETS; i++) {
-      new (get_master_bucket(i)) bucket_t();
+    // The first segment has a power-of-two number of buckets.
+    nbuckets = std::min<size_t>(nbuckets, TABLE_MAX_NUM_BUCKETS);
+    base_nbuckets = TABLE_MIN_NUM_BUCKETS;
+    while (base_nbuckets < nbuckets) base_nbuckets *= 2;
+    base_nbits = __builtin_ctz(base_nbuckets);
+    for (auto& segment : segments) {
+      segment = nullptr;
+    }
+    for (auto& counter : counters) {
+      counter.val = 0;
     }
+    alloc_segment(0);
+    current_nbuckets = base_nbuckets;
   }
 
-  ~matching_engine_map_t()
+  ~matching_table_t()
   {
-    for (size_t i = 0; i < TABLE_NUM_MASTER_BUCKETS; i++) {
-      bucket_t* master = get_master_bucket(i);
-      bucket_t* bucket_p = master;
-      bucket_t* bucket_q;
-      while (bucket_p) {
-        bucket_q = bucket_p;
-        bucket_p = bucket_p->control.next;
-        if (bucket_q != master) {
+    for (int i = 0; i < TABLE_MAX_NUM_SEGMENTS; i++) {
+      char* segment = segments[i];
+      if (!segment) break;
+      for (size_t j = 0; j < get_segment_nbuckets(i); j++) {
+        bucket_t* master =
+            reinterpret_cast<bucket_t*>(segment + j * bucket_t::size());
+        bucket_t* bucket_p = master->control.next;
+        bucket_t* bucket_q;
+        while (bucket_p) {
+          bucket_q = bucket_p;
+          bucket_p = bucket_p->control.next;
           bucket_t::free(bucket_q);
         }
+        master->~bucket_t();
       }
-      master->~bucket_t();
+      free(segment);
     }
-    free(table);
+  }
+
+  size_t get_nbuckets() const
+  {
+    return current_nbuckets.load(std::memory_order_relaxed);
   }
 
   bucket_t* get_master_bucket(uint32_t bucket_idx) const
   {
-    return (bucket_t*)((char*)table + bucket_idx * bucket_t::size());
+    int segment_idx = 0;
+    uint32_t offset = bucket_idx;
+    if (bucket_idx >= base_nbuckets) {
+      int msb = 31 - __builtin_clz(bucket_idx);
+      segment_idx = msb - base_nbits + 1;
+      offset = bucket_idx - (1u << msb);
+    }
+    return reinterpret_cast<bucket_t*>(
+        segments[segment_idx].load(std::memory_order_acquire) +
+        offset * bucket_t::size());
   }
 
-  val_t insert(key_t key, val_t value, insert_type_t type) override
+  val_t insert(K key, val_t value, insert_type_t type)
   {
     val_t ret = nullptr;
-    const uint32_t bucket_idx = hash_fn(key);
-
-    bucket_t* master = get_master_bucket(bucket_idx);
+    const uint32_t hash = hash_fn(key);
+    uint32_t bucket_idx;
+    bucket_t* master = lock_master_bucket(hash, &bucket_idx);
     insert_type_t target_type =
         type == insert_type_t::send ? insert_type_t::recv : insert_type_t::send;
+    // the change of the number of queues
+    int nqueues_delta = 0;
 
-    master->control.lock.lock();
     bucket_t* current_bucket = master;
     bucket_t* previous_bucket = nullptr;
     queue_t* target_queue = nullptr;
     queue_t* same_type_queue = nullptr;
     queue_t* first_empty_queue = nullptr;
+    uint8_t* target_tag = nullptr;
+    uint8_t* first_empty_tag = nullptr;
+    const uint8_t tag = get_tag(hash);
     // Search the buckets and find the queue.
     while (current_bucket) {
       bool is_current_bucket_nonempty = false;
-      for (int i = 0; i < current_bucket->control.nqueues; ++i) {
-        queue_t* current_queue = current_bucket->get_queue_p(i);
-        if (current_queue->is_empty) {
-          if (first_empty_queue == nullptr) {
-            first_empty_queue = current_queue;
-            is_current_bucket_nonempty = true;
-          }
-          continue;
-        } else {
+      const int nqueues = current_bucket->control.nqueues;
+      uint8_t* tags = current_bucket->get_tags();
+      for (int i = 0; i < nqueues; i += BUCKET_NUM_INLINE_TAGS) {
+        const uint32_t valid_mask =
+            nqueues - i >= BUCKET_NUM_INLINE_TAGS
+                ? (1u << BUCKET_NUM_INLINE_TAGS) - 1
+                : (1u << (nqueues - i)) - 1;
+        uint32_t empty_mask;
+        uint32_t tag_mask = match_bytes16(tags + i, tag, &empty_mask);
+        empty_mask &= valid_mask;
+        tag_mask &= valid_mask;
+        if (empty_mask != valid_mask) {
           is_current_bucket_nonempty = true;
         }
-        if (current_queue->key == key) {
-          if (current_queue->type == target_type) {
-            // found the right queue
-            target_queue = current_queue;
-          } else {
-            // we would not find the right queue
-            same_type_queue = current_queue;
-          }
+        if (empty_mask && first_empty_queue == nullptr) {
+          int j = i + __builtin_ctz(empty_mask);
+          first_empty_queue = current_bucket->get_queue_p(j);
+          first_empty_tag = &tags[j];
           is_current_bucket_nonempty = true;
-          break;
         }
+        while (tag_mask) {
+          int j = i + __builtin_ctz(tag_mask);
+          tag_mask &= tag_mask - 1;
+          queue_t* current_queue = current_bucket->get_queue_p(j);
+          if (current_queue->key == key) {
+            if (current_queue->type == target_type) {
+              // found the right queue
+              target_queue = current_queue;
+              target_tag = &tags[j];
+            } else {
+              // we would not find the right queue
+              same_type_queue = current_queue;
+            }
+            break;
+          }
+        }
+        if (target_queue || same_type_queue) break;
       }
       if (target_queue || same_type_queue) break;
       if (!is_current_bucket_nonempty && previous_bucket) {
@@ -363,6 +511,10 @@ class matching_engine_map_t : public matching_engine_impl_t
     }
     if (target_queue) {
       ret = target_queue->pop();
+      if (target_queue->is_empty) {
+        *target_tag = TAG_EMPTY;
+        nqueues_delta = -1;
+      }
     } else if (same_type_queue) {
       // didn't find the target queue
       // Just append an entry to the queue
@@ -376,25 +528,219 @@ class matching_engine_map_t : public matching_engine_impl_t
         LCI_DBG_Assert(current_bucket == nullptr, "\n");
         previous_bucket->control.next = new_bucket;
         first_empty_queue = new_bucket->get_queue_p(0);
+        first_empty_tag = &new_bucket->get_tags()[0];
       }
       // Create a queue from the empty queue.
       first_empty_queue->setup(key, type, value);
-      // first_empty_queue->is_empty = false;
-      // first_empty_queue->key = key;
-      // first_empty_queue->type = type;
-      // node_t* new_node = new node_t;
-      // new_node->values[0] = value;
-      // first_empty_queue->head = new_node;
-      // first_empty_queue->tail = new_node;
+      *first_empty_tag = tag;
+      nqueues_delta = 1;
     }
     master->control.lock.unlock();
-    LCI_DBG_Log(LOG_TRACE, "matchtable", "insert (%lx, %p, %d) return %p\n",
-                key, value, type, ret);
+    LCI_DBG_Log(LOG_TRACE, "matchtable",
+                "insert (bucket %u, %p, %d) return %p\n", bucket_idx, value,
+                type, ret);
+    if (nqueues_delta != 0) {
+      update_nqueues(hash, nqueues_delta);
+    }
     return ret;
   }
 
  private:
-  bucket_t* table;
+  // the number of master buckets of the segment
+  size_t get_segment_nbuckets(int segment_idx) const
+  {
+    return segment_idx == 0 ? base_nbuckets
+                            : (size_t)base_nbuckets << (segment_idx - 1);
+  }
+
+  void alloc_segment(int segment_idx)
+  {
+    size_t n = get_segment_nbuckets(segment_idx);
+    char* segment = (char*)alloc_memalign(n * bucket_t::size());
+    for (size_t i = 0; i < n; i++) {
+      new (segment + i * bucket_t::size()) bucket_t();
+    }
+    segments[segment_idx].store(segment, std::memory_order_release);
+  }
+
+  // the master bucket of a hash with nbuckets master buckets
+  static uint32_t get_bucket_idx(uint32_t hash, uint32_t nbuckets)
+  {
+    // The buckets below the split point have been split with the next bit.
+    uint32_t low = 1u << (31 - __builtin_clz(nbuckets));
+    uint32_t idx = hash & (low - 1);
+    if (idx < nbuckets - low) idx = hash & (2 * low - 1);
+    return idx;
+  }
+
+  bucket_t* lock_master_bucket(uint32_t hash, uint32_t* bucket_idx)
+  {
+    uint32_t nbuckets = current_nbuckets.load(std::memory_order_acquire);
+    while (true) {
+      *bucket_idx = get_bucket_idx(hash, nbuckets);
+      bucket_t* master = get_master_bucket(*bucket_idx);
+      master->control.lock.lock();
+      // A resize step holds the locks of the buckets whose queues it moves,
+      // so the bucket is still the right one if the current size maps the
+      // hash to it.
+      uint32_t new_nbuckets = current_nbuckets.load(std::memory_order_acquire);
+      if (new_nbuckets == nbuckets ||
+          get_bucket_idx(hash, new_nbuckets) == *bucket_idx) {
+        return master;
+      }
+      master->control.lock.unlock();
+      nbuckets = new_nbuckets;
+    }
+  }
+
+  void update_nqueues(uint32_t hash, int delta)
+  {
+    auto& counter = counters[hash >> (32 - __builtin_ctz(TABLE_NUM_COUNTERS))];
+    int64_t nqueues =
+        (counter.val.fetch_add(delta, std::memory_order_relaxed) + delta) *
+        TABLE_NUM_COUNTERS;
+    uint32_t nbuckets = current_nbuckets.load(std::memory_order_relaxed);
+    if (delta > 0 && nqueues > (int64_t)nbuckets * TABLE_MAX_LOAD &&
+        nbuckets < TABLE_MAX_NUM_BUCKETS) {
+      resize(true);
+    } else if (delta < 0 && nqueues * TABLE_MIN_LOAD_INV < (int64_t)nbuckets &&
+               nbuckets > base_nbuckets) {
+      resize(false);
+    }
+  }
+
+  // Find an empty queue in the chain of a locked master bucket.
+  queue_t* get_empty_queue(bucket_t* master, uint8_t** tag)
+  {
+    bucket_t* bucket = master;
+    while (true) {
+      for (int i = 0; i < bucket->control.nqueues; ++i) {
+        if (bucket->get_queue_p(i)->is_empty) {
+          *tag = &bucket->get_tags()[i];
+          return bucket->get_queue_p(i);
+        }
+      }
+      if (!bucket->control.next) break;
+      bucket = bucket->control.next;
+    }
+    bucket_t* new_bucket = bucket_t::alloc(bucket->control.nqueues * 2 + 1);
+    bucket->control.next = new_bucket;
+    *tag = &new_bucket->get_tags()[0];
+    return new_bucket->get_queue_p(0);
+  }
+
+  // Move the queues of a locked bucket that satisfy pred to another one.
+  template <typename Pred>
+  void move_queues(bucket_t* from, bucket_t* to, Pred pred)
+  {
+    for (bucket_t* bucket = from; bucket; bucket = bucket->control.next) {
+      for (int i = 0; i < bucket->control.nqueues; ++i) {
+        queue_t* queue = bucket->get_queue_p(i);
+        if (queue->is_empty || !pred(queue->key)) continue;
+        // the queue owns its linked nodes, so it can be moved bitwise
+        uint8_t* tag;
+        memcpy(static_cast<void*>(get_empty_queue(to, &tag)), queue,
+               sizeof(queue_t));
+        *tag = bucket->get_tags()[i];
+        bucket->get_tags()[i] = TAG_EMPTY;
+        queue->is_empty = true;
+        queue->is_queue = false;
+      }
+    }
+  }
+
+  // Split or merge up to TABLE_RESIZE_STEP buckets.
+  void resize(bool grow)
+  {
+    if (!resize_lock.try_lock()) return;
+    for (int i = 0; i < TABLE_RESIZE_STEP; i++) {
+      uint32_t nbuckets = current_nbuckets.load(std::memory_order_relaxed);
+      if (grow && nbuckets >= TABLE_MAX_NUM_BUCKETS) break;
+      if (!grow && nbuckets <= base_nbuckets) break;
+      // The last bucket was split from its partner and is merged into it.
+      uint32_t new_idx = grow ? nbuckets : nbuckets - 1;
+      uint32_t low = 1u << (31 - __builtin_clz(new_idx));
+      uint32_t partner_idx = new_idx - low;
+      if (grow && new_idx == low && new_idx >= base_nbuckets) {
+        int segment_idx = 31 - __builtin_clz(new_idx) - base_nbits + 1;
+        if (!segments[segment_idx].load(std::memory_order_relaxed)) {
+          alloc_segment(segment_idx);
+        }
+      }
+      bucket_t* partner = get_master_bucket(partner_idx);
+      bucket_t* bucket = get_master_bucket(new_idx);
+      partner->control.lock.lock();
+      bucket->control.lock.lock();
+      if (grow) {
+        move_queues(partner, bucket, [&](const K& key) {
+          return (hash_fn(key) & (2 * low - 1)) == new_idx;
+        });
+        current_nbuckets.store(nbuckets + 1, std::memory_order_release);
+      } else {
+        move_queues(bucket, partner, [](const K&) { return true; });
+        // the linked buckets are all empty now
+        bucket_t* bucket_p = bucket->control.next;
+        while (bucket_p) {
+          bucket_t* bucket_q = bucket_p;
+          bucket_p = bucket_p->control.next;
+          bucket_t::free(bucket_q);
+        }
+        bucket->control.next = nullptr;
+        current_nbuckets.store(nbuckets - 1, std::memory_order_release);
+      }
+      bucket->control.lock.unlock();
+      partner->control.lock.unlock();
+    }
+    resize_lock.unlock();
+  }
+
+  uint32_t base_nbuckets;
+  int base_nbits;
+  std::atomic<uint32_t> current_nbuckets;
+  std::atomic<char*> segments[TABLE_MAX_NUM_SEGMENTS];
+  padded_atomic_t<int64_t> counters[TABLE_NUM_COUNTERS];
+  spinlock_t resize_lock;
+};
+
+class matching_engine_map_t : public matching_engine_impl_t
+{
+ public:
+  matching_engine_map_t(attr_t attr)
+      : matching_engine_impl_t(attr), table(attr.nbuckets), wide_table(nullptr)
+  {
+  }
+
+  ~matching_engine_map_t() { delete wide_table.load(); }
+  using matching_engine_impl_t::insert;
+
+  val_t insert(key_t key, val_t value, insert_type_t type) override
+  {
+    return table.insert(key, value, type);
+  }
+
+  val_t insert_wide(wide_key_t key, val_t value, insert_type_t type) override
+  {
+    matching_table_t<wide_key_t>* p_table =
+        wide_table.load(std::memory_order_acquire);
+    if (LCT_unlikely(!p_table)) {
+      // The table of the wide keys is allocated on first use.
+      auto* new_table = new matching_table_t<wide_key_t>(attr.nbuckets);
+      if (wide_table.compare_exchange_strong(p_table, new_table,
+                                             std::memory_order_acq_rel)) {
+        p_table = new_table;
+      } else {
+        delete new_table;
+      }
+    }
+    return p_table->insert(key, value, type);
+  }
+
+  // the number of master buckets of the table of the narrow keys
+  size_t get_nbuckets() const { return table.get_nbuckets(); }
+
+ private:
+  matching_table_t<key_t> table;
+  std::atomic<matching_table_t<wide_key_t>*> wide_table;
 };
 
 }  // namespace lci
@@ -11,51 +11,83 @@ class matching_engine_queue_t : public matching_engine_impl_t
  public:
   matching_engine_queue_t(attr_t attr) : matching_engine_impl_t(attr) {}
   ~matching_engine_queue_t() = default;
+  using matching_engine_impl_t::insert;
   val_t insert(key_t key, val_t value, insert_type_t type) override
   {
-    val_t ret = nullptr;
-    entry_t entry = {key, value};
     lock.lock();
+    val_t ret = insert_impl(send_queue, recv_queue, key, value, type);
+    LCI_DBG_Log(LOG_TRACE, "matching_engine",
+                "insert: key=%lu, value=%p, type=%d, ret=%p\n", key, value,
+                (int)type, ret);
+    lock.unlock();
+    return ret;
+  }
+
+  val_t insert_wide(wide_key_t key, val_t value, insert_type_t type) override
+  {
+    lock.lock();
+    val_t ret =
+        insert_impl(wide_send_queue, wide_recv_queue, key, value, type);
+    LCI_DBG_Log(LOG_TRACE, "matching_engine",
+                "insert: key=(%lu, %lu), value=%p, type=%d, ret=%p\n",
+                key.rank, key.tag, value, (int)type, ret);
+    lock.unlock();
+    return ret;
+  }
+
+ private:
+  template <typename K>
+  struct entry_t {
+    K key;
+    val_t value;
+  };
+  template <typename K>
+  using queue_t = std::list<entry_t<K>>;
+  queue_t<key_t> send_queue;
+  queue_t<key_t> recv_queue;
+  // entries with wide keys are kept apart so that they do not slow down the
+  // search of the others
+  queue_t<wide_key_t> wide_send_queue;
+  queue_t<wide_key_t> wide_recv_queue;
+  LCIU_CACHE_PADDING(sizeof(queue_t<key_t>) * 4);  // padding for cache line
+  spinlock_t lock;
+  LCIU_CACHE_PADDING(sizeof(spinlock_t));
+
+  template <typename K>
+  val_t insert_impl(queue_t<K>& send_queue_, queue_t<K>& recv_queue_, K key,
+                    val_t value, insert_type_t type)
+  {
+    // the lock should be held by the caller
+    val_t ret = nullptr;
+    entry_t<K> entry = {key, value};
     if (type == insert_type_t::send) {
       // Search the posted recv queue for a matching entry
-      ret = search(recv_queue, key);
+      ret = search(recv_queue_, key);
       if (ret == nullptr) {
         // Did not find a matching posted recv
-        send_queue.push_back(entry);
+        send_queue_.push_back(entry);
       }
     } else {
       // Search the unexpected send queue for a matching entry
-      ret = search(send_queue, key);
+      ret = search(send_queue_, key);
       if (ret == nullptr) {
         // Did not find a matching incoming send
-        recv_queue.push_back(entry);
+        recv_queue_.push_back(entry);
       }
     }
-    LCI_DBG_Log(LOG_TRACE, "matching_engine",
-                "insert: key=%lu, value=%p, type=%d, ret=%p\n", key, value,
-                (int)type, ret);
-    lock.unlock();
     return ret;
   }
 
- private:
-  struct entry_t {
-    key_t key;
-    val_t value;
-  };
-  std::list<entry_t> send_queue;
-  std::list<entry_t> recv_queue;
-  LCIU_CACHE_PADDING(sizeof(std::list<entry_t>) * 2);  // padding for cache line
-  spinlock_t lock;
-  LCIU_CACHE_PADDING(sizeof(spinlock_t));
-  val_t search(std::list<entry_t>& queue, key_t key)
+  template <typename K>
+  val_t search(queue_t<K>& queue, K key)
   {
     // the lock should be held by the caller
     for (auto it = queue.begin(); it != queue.end(); it++) {
       if (it->key == key) {
         // remove the entry
+        val_t value = it->value;
         queue.erase(it);
-        return it->value;
+        return value;
       }
     }
     return nullptr;
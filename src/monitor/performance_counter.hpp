@@ -35,13 +35,26 @@ extern LCT_pcounter_ctx_t pcounter_ctx;
     _macro(net_read_post)                   \
     _macro(net_read_post_retry)             \
     _macro(net_read_comp)                   \
+    _macro(net_atomic_post)                 \
+    _macro(net_atomic_post_retry)           \
+    _macro(net_atomic_comp)                 \
+    _macro(net_batch_post)                  \
     _macro(net_remote_write_comp)           \
     _macro(packet_get)                      \
     _macro(packet_get_retry)                \
     _macro(packet_put)                      \
     _macro(packet_steal)                    \
+    _macro(packet_put_remote)               \
+    _macro(packet_pool_grow)                \
+    _macro(packet_pool_shrink)              \
+    _macro(object_pool_alloc)               \
+    _macro(object_pool_free)                \
+    _macro(object_pool_free_remote)         \
+    _macro(object_pool_reclaim)             \
+    _macro(object_pool_slab_alloc)          \
     _macro(comp_produce)                    \
     _macro(comp_consume)                    \
+    _macro(comp_block)                      \
     _macro(net_poll_cq_entry_count)         \
     _macro(backlog_queue_push)              \
     _macro(backlog_queue_pop)               \
@@ -51,6 +64,16 @@ extern LCT_pcounter_ctx_t pcounter_ctx;
     _macro(shm_recv)                        \
     _macro(shm_recv_bytes)                  \
     _macro(shm_ring_full)                   \
+    _macro(eager_rdma_send)                 \
+    _macro(eager_rdma_recv)                 \
+    _macro(eager_rdma_no_credit)            \
+    _macro(eager_rdma_ring_setup)           \
+    _macro(am_aggregation_push)             \
+    _macro(am_aggregation_send)             \
+    _macro(am_aggregation_recv)             \
+    _macro(get_signal_send)                 \
+    _macro(atomic_am_send)                  \
+    _macro(atomic_am_exec)                  \
     _macro(progress)
 
 #define LCI_PCOUNTER_TIMER_FOR_EACH(_macro)
@@ -41,6 +41,41 @@ inline error_t device_impl_t::post_recv(void* buffer, size_t size, mr_t mr,
   return error;
 }
 
+inline error_t device_impl_t::post_trecv(void* buffer, size_t size, mr_t mr,
+                                         uint64_t tag, uint64_t ignore,
+                                         void* user_context)
+{
+  error_t error = post_trecv_impl(buffer, size, mr, tag, ignore, user_context);
+  if (error.is_retry()) {
+    LCI_PCOUNTER_ADD(net_recv_post_retry, 1);
+  } else {
+    LCI_PCOUNTER_ADD(net_recv_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_trecv buffer %p size %lu mr %p tag %lx ignore %lx "
+              "user_context %p return %s\n",
+              buffer, size, mr.get_impl(), tag, ignore, user_context,
+              error.get_str());
+  return error;
+}
+
+inline bool device_impl_t::arm_comp()
+{
+  if (!attr.net_comp_channel) return false;
+  bool ret = arm_comp_impl();
+  LCI_DBG_Log(LOG_TRACE, "network", "arm_comp return %d\n", ret);
+  return ret;
+}
+
+inline bool device_impl_t::wait_comp(int timeout_ms)
+{
+  if (!attr.net_comp_channel) return false;
+  bool ret = wait_comp_impl(timeout_ms);
+  LCI_DBG_Log(LOG_TRACE, "network", "wait_comp timeout %d ms return %d\n",
+              timeout_ms, ret);
+  return ret;
+}
+
 inline size_t device_impl_t::post_recvs(void* buffers[], size_t size,
                                         size_t count, mr_t mr,
                                         void* user_contexts[])
@@ -97,11 +132,23 @@ inline void device_impl_t::destroy_reg_cache()
   }
 }
 
-inline bool device_impl_t::post_recv_packets()
+inline std::atomic<size_t>& device_impl_t::get_nrecvs_posted(int size_class)
+{
+  if (size_class < 0 ||
+      size_class == packet_pool.p_impl->get_nclasses() - 1) {
+    return nrecvs_posted;
+  }
+  return nclass_recvs_posted[size_class].val;
+}
+
+inline bool device_impl_t::post_recv_packets(int size_class)
 {
   mr_t mr;
   size_t size;
   error_t error;
+  if (size_class < 0) size_class = packet_pool.p_impl->get_nclasses() - 1;
+  const bool is_tagged = size_class < packet_pool.p_impl->get_nclasses() - 1;
+  std::atomic<size_t>& nrecvs_posted = get_nrecvs_posted(size_class);
   if (nrecvs_posted >= attr.net_max_recvs) {
     return false;
   }
@@ -116,20 +163,43 @@ inline bool device_impl_t::post_recv_packets()
   size_t nslots = std::min(attr.net_max_recvs - my_position, BATCH_SIZE);
   packet_t* packets[BATCH_SIZE];
 
-  size_t n_popped = packet_pool.p_impl->get_n(nslots, packets, false);
+  size_t n_popped =
+      packet_pool.p_impl->get_n(nslots, packets, false, size_class);
   if (n_popped == 0) {
     nrecvs_posted -= BATCH_SIZE;
     return false;
   }
 
-  mr = packet_pool.p_impl->get_or_register_mr(device);
-  size = packet_pool.p_impl->get_payload_size();
+  size = packet_pool.p_impl->get_payload_size(size_class);
   void* buffers[BATCH_SIZE];
   for (size_t i = 0; i < n_popped; i++) {
     buffers[i] = packets[i]->get_payload_address();
   }
-  size_t n_posted =
-      post_recvs((void**)buffers, size, n_popped, mr, (void**)packets);
+  size_t n_posted = 0;
+  while (n_posted < n_popped) {
+    // the packets of a grown pool can come from different slabs
+    mr = packets[n_posted]->get_mr(device);
+    size_t n = 1;
+    while (n_posted + n < n_popped &&
+           packets[n_posted + n]->get_mr(device).p_impl == mr.p_impl) {
+      ++n;
+    }
+    size_t ret = 0;
+    if (!is_tagged) {
+      ret = post_recvs((void**)buffers + n_posted, size, n, mr,
+                       (void**)packets + n_posted);
+    } else {
+      // only messages of this class match the receives
+      for (; ret < n; ret++) {
+        error = post_trecv(buffers[n_posted + ret], size, mr,
+                           make_size_class_net_tag(size_class, 0),
+                           (1ULL << 32) - 1, packets[n_posted + ret]);
+        if (error.is_retry()) break;
+      }
+    }
+    n_posted += ret;
+    if (ret < n) break;
+  }
   for (size_t i = n_posted; i < n_popped; i++) {
     packets[i]->put_back();
   }
@@ -139,11 +209,21 @@ inline bool device_impl_t::post_recv_packets()
   return n_posted > 0;
 }
 
+inline void device_impl_t::consume_recv(packet_t* packet)
+{
+  if (!use_size_classes) {
+    --nrecvs_posted;
+    return;
+  }
+  --get_nrecvs_posted(packet_pool.p_impl->get_size_class(packet));
+}
+
 inline bool device_impl_t::refill_recvs(bool is_blocking)
 {
   const double refill_threshold = 0.8;
   const int max_retries = 100000;
   bool ret = false;
+  packet_pool.p_impl->maybe_shrink();
   int nrecvs_posted = this->nrecvs_posted;
   int niters = 0;
   while (nrecvs_posted < attr.net_max_recvs * refill_threshold) {
@@ -174,6 +254,17 @@ inline bool device_impl_t::refill_recvs(bool is_blocking)
         "packet pool size %ld)\n",
         npackets);
   }
+  if (use_size_classes) {
+    // the smaller classes are best effort: the largest one can take any
+    // message
+    for (int i = 0; i < packet_pool.p_impl->get_nclasses() - 1; i++) {
+      while (nclass_recvs_posted[i].val <
+                 attr.net_max_recvs * refill_threshold &&
+             post_recv_packets(i)) {
+        ret = true;
+      }
+    }
+  }
   return ret;
 }
 
@@ -181,6 +272,8 @@ inline void device_impl_t::bind_packet_pool(packet_pool_t packet_pool_)
 {
   packet_pool = packet_pool_;
   packet_pool.p_impl->register_packets(device);
+  use_size_classes = packet_pool.p_impl->get_nclasses() > 1 &&
+                     net_context_attr.support_tagged;
   refill_recvs(true);
 }
 
@@ -190,6 +283,9 @@ inline void device_impl_t::unbind_packet_pool()
   if (packet_pool.p_impl) {
     packet_pool.p_impl->deregister_packets(device);
     packet_pool.p_impl->report_lost_packets(nrecvs_posted);
+    for (int i = 0; i < packet_pool.p_impl->get_nclasses() - 1; i++) {
+      packet_pool.p_impl->report_lost_packets(nclass_recvs_posted[i].val);
+    }
     packet_pool.p_impl = nullptr;
   }
 }
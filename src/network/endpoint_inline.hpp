@@ -6,6 +6,16 @@
 
 namespace lci
 {
+inline int endpoint_impl_t::get_send_size_class(size_t size) const
+{
+  device_impl_t* p_device = device.p_impl;
+  if (!p_device->use_size_classes) return -1;
+  packet_pool_impl_t* p_pool = p_device->packet_pool.p_impl;
+  int size_class = p_pool->get_size_class_for(size);
+  if (size_class < 0 || size_class == p_pool->get_nclasses() - 1) return -1;
+  return size_class;
+}
+
 inline error_t endpoint_impl_t::post_sends(int rank, void* buffer, size_t size,
                                            net_imm_data_t imm_data,
                                            void* user_context, bool allow_retry,
@@ -25,8 +35,15 @@ inline error_t endpoint_impl_t::post_sends(int rank, void* buffer, size_t size,
     error = errorcode_t::retry_backlog;
   } else {
     bool high_priority = !allow_retry || force_post;
-    error = post_sends_impl(rank, buffer, size, imm_data, user_context,
-                            high_priority);
+    int size_class = get_send_size_class(size);
+    if (size_class < 0) {
+      error = post_sends_impl(rank, buffer, size, imm_data, user_context,
+                              high_priority);
+    } else {
+      error = post_tsends_impl(rank, buffer, size,
+                               make_size_class_net_tag(size_class, imm_data),
+                               user_context, high_priority);
+    }
   }
   if (error.is_retry()) {
     if (error.errorcode == errorcode_t::retry_lock) {
@@ -62,8 +79,15 @@ inline error_t endpoint_impl_t::post_send(int rank, void* buffer, size_t size,
     error = errorcode_t::retry_backlog;
   } else {
     bool high_priority = !allow_retry || force_post;
-    error = post_send_impl(rank, buffer, size, mr, imm_data, user_context,
-                           high_priority);
+    int size_class = get_send_size_class(size);
+    if (size_class < 0) {
+      error = post_send_impl(rank, buffer, size, mr, imm_data, user_context,
+                             high_priority);
+    } else {
+      error = post_tsend_impl(rank, buffer, size, mr,
+                              make_size_class_net_tag(size_class, imm_data),
+                              user_context, high_priority);
+    }
   }
   if (error.is_retry()) {
     if (error.errorcode == errorcode_t::retry_lock) {
@@ -306,6 +330,330 @@ inline error_t endpoint_impl_t::post_get(int rank, void* buffer, size_t size,
   return error;
 }
 
+inline error_t endpoint_impl_t::post_sendv(int rank, const iovec_t* iov,
+                                           size_t count,
+                                           net_imm_data_t imm_data,
+                                           void* user_context, bool allow_retry,
+                                           bool force_post)
+{
+  LCI_DBG_Assert(count <= net_context_attr.max_iov,
+                 "Too many io vector entries %lu (max %lu)\n", count,
+                 net_context_attr.max_iov);
+  error_t error;
+  if (!force_post && !backlog_queue.is_empty(rank)) {
+    error = errorcode_t::retry_backlog;
+  } else {
+    bool high_priority = !allow_retry || force_post;
+    error = post_sendv_impl(rank, iov, count, imm_data, user_context,
+                            high_priority);
+  }
+  if (error.is_retry()) {
+    if (error.errorcode == errorcode_t::retry_lock) {
+      LCI_PCOUNTER_ADD(net_send_post_retry_lock, 1);
+    } else if (error.errorcode == errorcode_t::retry_nomem) {
+      LCI_PCOUNTER_ADD(net_send_post_retry_nomem, 1);
+    } else {
+      LCI_PCOUNTER_ADD(net_send_post_retry, 1);
+    }
+    if (!allow_retry) {
+      backlog_queue.push_sendv(this, rank, iov, count, imm_data, user_context);
+      error = errorcode_t::posted_backlog;
+    }
+  } else {
+    LCI_PCOUNTER_ADD(net_send_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_sendv rank %d iov %p count %lu imm_data %x user_context %p "
+              "allow_retry %d force_post %d return %s\n",
+              rank, iov, count, imm_data, user_context, allow_retry,
+              force_post, error.get_str());
+  return error;
+}
+
+inline error_t endpoint_impl_t::post_putv(int rank, const iovec_t* iov,
+                                          size_t count, uint64_t offset,
+                                          rmr_t rmr, void* user_context,
+                                          bool allow_retry, bool force_post)
+{
+  LCI_DBG_Assert(count <= net_context_attr.max_iov,
+                 "Too many io vector entries %lu (max %lu)\n", count,
+                 net_context_attr.max_iov);
+  error_t error;
+  if (!force_post && !backlog_queue.is_empty(rank)) {
+    error = errorcode_t::retry_backlog;
+  } else {
+    bool high_priority = !allow_retry || force_post;
+    error = post_putv_impl(rank, iov, count, offset, rmr, user_context,
+                           high_priority);
+  }
+  if (error.is_retry()) {
+    LCI_PCOUNTER_ADD(net_write_post_retry, 1);
+    if (!allow_retry) {
+      backlog_queue.push_putv(this, rank, iov, count, offset, rmr,
+                              user_context);
+      error = errorcode_t::posted_backlog;
+    }
+  } else {
+    LCI_PCOUNTER_ADD(net_write_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_putv rank %d iov %p count %lu offset %lu rmr %p "
+              "user_context %p allow_retry %d force_post %d return %s\n",
+              rank, iov, count, offset, rmr.base, user_context, allow_retry,
+              force_post, error.get_str());
+  return error;
+}
+
+inline error_t endpoint_impl_t::post_putImmv_fallback(
+    int rank, const iovec_t* iov, size_t count, uint64_t offset, rmr_t rmr,
+    net_imm_data_t imm_data, void* user_context, bool high_priority)
+{
+  // fallback to post_putv
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "fallback to post_putv imm_data %x user_context %p\n", imm_data,
+              user_context);
+  auto ctx = static_cast<internal_context_t*>(user_context);
+  if (ctx && ctx->is_extended) {
+    // The operation is part of a larger one. Send the immediate data once
+    // all operations of the extended context have completed.
+    auto ectx = reinterpret_cast<internal_context_extended_t*>(ctx);
+    LCI_DBG_Assert(ectx->imm_data_rank == -1, "Unexpected imm_data_rank\n");
+    ectx->imm_data_rank = rank;
+    ectx->imm_data = imm_data;
+    error_t error = post_putv_impl(rank, iov, count, offset, rmr, ectx,
+                                   high_priority);
+    if (error.is_retry()) {
+      ectx->imm_data_rank = -1;
+    }
+    return error;
+  }
+  internal_context_extended_t* ectx = new internal_context_extended_t;
+  ectx->imm_data_rank = rank;
+  ectx->imm_data = imm_data;
+  ectx->signal_count = 1;
+  ectx->internal_ctx = static_cast<internal_context_t*>(user_context);
+  error_t error = post_putv_impl(rank, iov, count, offset, rmr, ectx,
+                                 high_priority);
+  if (error.is_retry()) {
+    delete ectx;
+  }
+  return error;
+}
+
+inline error_t endpoint_impl_t::post_putImmv(int rank, const iovec_t* iov,
+                                             size_t count, uint64_t offset,
+                                             rmr_t rmr, net_imm_data_t imm_data,
+                                             void* user_context,
+                                             bool allow_retry, bool force_post)
+{
+  LCI_DBG_Assert(count <= net_context_attr.max_iov,
+                 "Too many io vector entries %lu (max %lu)\n", count,
+                 net_context_attr.max_iov);
+  error_t error;
+  if (!force_post && !backlog_queue.is_empty(rank)) {
+    error = errorcode_t::retry_backlog;
+  } else {
+    bool high_priority = !allow_retry || force_post;
+    if (net_context_attr.support_putimm) {
+      error = post_putImmv_impl(rank, iov, count, offset, rmr, imm_data,
+                                user_context, high_priority);
+    } else {
+      error = post_putImmv_fallback(rank, iov, count, offset, rmr, imm_data,
+                                    user_context, high_priority);
+    }
+  }
+  if (error.is_retry()) {
+    LCI_PCOUNTER_ADD(net_writeImm_post_retry, 1);
+    if (!allow_retry) {
+      backlog_queue.push_putImmv(this, rank, iov, count, offset, rmr, imm_data,
+                                 user_context);
+      error = errorcode_t::posted_backlog;
+    }
+  } else {
+    LCI_PCOUNTER_ADD(net_writeImm_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_putImmv rank %d iov %p count %lu offset %lu rmr %p "
+              "imm_data %x user_context %p allow_retry %d force_post %d "
+              "return %s\n",
+              rank, iov, count, offset, rmr.base, imm_data, user_context,
+              allow_retry, force_post, error.get_str());
+  return error;
+}
+
+inline error_t endpoint_impl_t::post_getv(int rank, const iovec_t* iov,
+                                          size_t count, uint64_t offset,
+                                          rmr_t rmr, void* user_context,
+                                          bool allow_retry, bool force_post)
+{
+  LCI_DBG_Assert(count <= net_context_attr.max_iov,
+                 "Too many io vector entries %lu (max %lu)\n", count,
+                 net_context_attr.max_iov);
+  error_t error;
+  if (!force_post && !backlog_queue.is_empty(rank)) {
+    error = errorcode_t::retry_backlog;
+  } else {
+    bool high_priority = !allow_retry || force_post;
+    error = post_getv_impl(rank, iov, count, offset, rmr, user_context,
+                           high_priority);
+  }
+  if (error.is_retry()) {
+    LCI_PCOUNTER_ADD(net_read_post_retry, 1);
+    if (!allow_retry) {
+      backlog_queue.push_getv(this, rank, iov, count, offset, rmr,
+                              user_context);
+      error = errorcode_t::posted_backlog;
+    }
+  } else {
+    LCI_PCOUNTER_ADD(net_read_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_getv rank %d iov %p count %lu offset %lu rmr %p "
+              "user_context %p allow_retry %d force_post %d return %s\n",
+              rank, iov, count, offset, rmr.base, user_context, allow_retry,
+              force_post, error.get_str());
+  return error;
+}
+
+inline error_t endpoint_impl_t::post_atomic(int rank, atomic_op_t op,
+                                            atomic_type_t type,
+                                            net_atomic_buffer_t* buffer,
+                                            mr_t mr, uint64_t offset, rmr_t rmr,
+                                            void* user_context,
+                                            bool allow_retry, bool force_post)
+{
+  error_t error;
+  if (!force_post && !backlog_queue.is_empty(rank)) {
+    error = errorcode_t::retry_backlog;
+  } else {
+    bool high_priority = !allow_retry || force_post;
+    error = post_atomic_impl(rank, op, type, buffer, mr, offset, rmr,
+                             user_context, high_priority);
+  }
+  if (error.is_retry()) {
+    LCI_PCOUNTER_ADD(net_atomic_post_retry, 1);
+    if (!allow_retry) {
+      backlog_queue.push_atomic(this, rank, op, type, buffer, mr, offset, rmr,
+                                user_context);
+      error = errorcode_t::posted_backlog;
+    }
+  } else {
+    LCI_PCOUNTER_ADD(net_atomic_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_atomic rank %d op %d type %d buffer %p offset %lu rmr %p "
+              "user_context %p allow_retry %d force_post %d return %s\n",
+              rank, static_cast<int>(op), static_cast<int>(type), buffer,
+              offset, rmr.base, user_context, allow_retry, force_post,
+              error.get_str());
+  return error;
+}
+
+inline error_t endpoint_impl_t::post_tsends(int rank, void* buffer,
+                                            size_t size, uint64_t tag,
+                                            void* user_context,
+                                            bool allow_retry, bool force_post)
+{
+  error_t error;
+  if (!force_post && !backlog_queue.is_empty(rank)) {
+    error = errorcode_t::retry_backlog;
+  } else {
+    bool high_priority = !allow_retry || force_post;
+    error = post_tsends_impl(rank, buffer, size, tag, user_context,
+                             high_priority);
+  }
+  if (error.is_retry()) {
+    LCI_PCOUNTER_ADD(net_send_post_retry, 1);
+    if (!allow_retry) {
+      backlog_queue.push_tsends(this, rank, buffer, size, tag, user_context);
+      error = errorcode_t::done_backlog;
+    }
+  } else {
+    LCI_PCOUNTER_ADD(net_send_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_tsends rank %d buffer %p size %lu tag %lx user_context %p "
+              "allow_retry %d force_post %d return %s\n",
+              rank, buffer, size, tag, user_context, allow_retry, force_post,
+              error.get_str());
+  return error;
+}
+
+inline error_t endpoint_impl_t::post_tsend(int rank, void* buffer, size_t size,
+                                           mr_t mr, uint64_t tag,
+                                           void* user_context, bool allow_retry,
+                                           bool force_post)
+{
+  error_t error;
+  if (!force_post && !backlog_queue.is_empty(rank)) {
+    error = errorcode_t::retry_backlog;
+  } else {
+    bool high_priority = !allow_retry || force_post;
+    error = post_tsend_impl(rank, buffer, size, mr, tag, user_context,
+                            high_priority);
+  }
+  if (error.is_retry()) {
+    LCI_PCOUNTER_ADD(net_send_post_retry, 1);
+    if (!allow_retry) {
+      backlog_queue.push_tsend(this, rank, buffer, size, mr, tag,
+                               user_context);
+      error = errorcode_t::posted_backlog;
+    }
+  } else {
+    LCI_PCOUNTER_ADD(net_send_post, 1);
+  }
+  LCI_DBG_Log(LOG_TRACE, "network",
+              "post_tsend rank %d buffer %p size %lu mr %p tag %lx "
+              "user_context %p allow_retry %d force_post %d return %s\n",
+              rank, buffer, size, mr.get_impl(), tag, user_context,
+              allow_retry, force_post, error.get_str());
+  return error;
+}
+
+inline size_t endpoint_impl_t::post_batch(net_batch_op_t* ops, size_t count,
+                                          bool allow_retry)
+{
+  // post the runs of operations to the same rank
+  size_t nposted = 0;
+  while (nposted < count) {
+    int rank = ops[nposted].rank;
+    size_t n = 1;
+    while (nposted + n < count && ops[nposted + n].rank == rank) ++n;
+    size_t ret = 0;
+    if (backlog_queue.is_empty(rank)) {
+      ret = post_batch_impl(rank, ops + nposted, n, !allow_retry);
+    }
+    LCI_PCOUNTER_ADD(net_batch_post, 1);
+    for (size_t i = nposted; i < nposted + ret; i++) {
+      switch (ops[i].type) {
+        case net_batch_op_t::type_t::send:
+          LCI_PCOUNTER_ADD(net_send_post, 1);
+          break;
+        case net_batch_op_t::type_t::put:
+          LCI_PCOUNTER_ADD(net_write_post, 1);
+          break;
+        case net_batch_op_t::type_t::putImm:
+          LCI_PCOUNTER_ADD(net_writeImm_post, 1);
+          break;
+        case net_batch_op_t::type_t::get:
+          LCI_PCOUNTER_ADD(net_read_post, 1);
+          break;
+      }
+    }
+    LCI_DBG_Log(LOG_TRACE, "network",
+                "post_batch rank %d count %lu allow_retry %d posted %lu\n",
+                rank, n, allow_retry, ret);
+    nposted += ret;
+    if (ret < n) break;
+  }
+  if (nposted < count && !allow_retry) {
+    // keep the order of the remaining operations
+    backlog_queue.push_batch(this, ops + nposted, count - nposted);
+    nposted = count;
+  }
+  return nposted;
+}
+
 }  // namespace lci
 
 #endif  // LCI_ENDPOINT_INLINE_HPP
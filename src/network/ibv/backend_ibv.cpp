@@ -3,6 +3,8 @@
 
 #include "lci_internal.hpp"
 #include "network/ibv/backend_ibv_detail.hpp"
+#include <fcntl.h>
+#include <poll.h>
 
 namespace lci
 {
@@ -75,6 +77,14 @@ ibv_net_context_impl_t::ibv_net_context_impl_t(runtime_t runtime_, attr_t attr_)
   rc = ibv_query_device_ex(ib_context, nullptr, &ib_dev_attrx);
   LCI_Assert(rc == 0, "Unable to query device for its extended features\n");
 
+  // Verbs atomics (fetch-and-add and compare-and-swap) are 64-bit only.
+  attr.support_atomic32 = false;
+  attr.support_atomic64 = ib_dev_attr.atomic_cap != IBV_ATOMIC_NONE;
+  emulate_atomic_swap = true;
+  // Send-recv is matched in software.
+  attr.support_tagged = false;
+  int remote_atomic_flag = attr.support_atomic64 ? IBV_ACCESS_REMOTE_ATOMIC : 0;
+
   // configure on-demand paging
   ib_odp_mr = nullptr;
   if (attr.ibv_odp_strategy == attr_ibv_odp_strategy_t::implicit_odp) {
@@ -89,7 +99,8 @@ ibv_net_context_impl_t::ibv_net_context_impl_t(runtime_t runtime_, attr_t attr_)
                "The device doesn't support implicit ODP\n");
     ib_odp_mr = ibv_reg_mr(ib_pd, nullptr, SIZE_MAX,
                            IBV_ACCESS_LOCAL_WRITE | IBV_ACCESS_REMOTE_READ |
-                               IBV_ACCESS_REMOTE_WRITE | IBV_ACCESS_ON_DEMAND);
+                               IBV_ACCESS_REMOTE_WRITE | IBV_ACCESS_ON_DEMAND |
+                               remote_atomic_flag);
     LCI_Assert(ib_odp_mr, "Couldn't register MR for ODP\n");
   }
 
@@ -113,6 +124,17 @@ ibv_net_context_impl_t::ibv_net_context_impl_t(runtime_t runtime_, attr_t attr_)
             attr.max_msg_size);
   }
 
+  // Check max_iov
+  size_t max_iov = std::min(static_cast<size_t>(ib_dev_attr.max_sge),
+                            static_cast<size_t>(LCI_BACKEND_MAX_IOV));
+  if (attr.max_iov > max_iov) {
+    attr.max_iov = max_iov;
+    LCI_Log(LOG_INFO, "ibv",
+            "Reduce max_iov to %lu as required by libibverbs max_sge\n",
+            attr.max_iov);
+  }
+  LCI_Assert(attr.max_iov > 0, "max_iov must be positive\n");
+
   // query the gid
   if (attr.ibv_gid_idx < 0 &&
       (attr.ibv_force_gid_auto_select ||
@@ -194,8 +216,18 @@ ibv_device_impl_t::ibv_device_impl_t(net_context_t net_context_,
   LCI_Assert(ib_srq, "Couldn't create SRQ\n");
 
   // Create completion queues.
+  ib_comp_channel = nullptr;
+  if (attr.net_comp_channel) {
+    ib_comp_channel = ibv_create_comp_channel(p_net_context->ib_context);
+    LCI_Assert(ib_comp_channel, "Couldn't create the completion channel\n");
+    // several threads may wait on the channel at the same time
+    int flags = fcntl(ib_comp_channel->fd, F_GETFL);
+    LCI_Assert(flags >= 0, "Couldn't get the completion channel flags\n");
+    int ret = fcntl(ib_comp_channel->fd, F_SETFL, flags | O_NONBLOCK);
+    LCI_Assert(ret == 0, "Couldn't make the completion channel nonblocking\n");
+  }
   ib_cq = ibv_create_cq(p_net_context->ib_context, attr.net_max_cqes, nullptr,
-                        nullptr, 0);
+                        ib_comp_channel, 0);
   LCI_Assert(ib_cq, "Couldn't create CQ\n");
 
   ib_pd = nullptr;
@@ -241,9 +273,37 @@ ibv_device_impl_t::~ibv_device_impl_t()
     --g_td_num;
   }
   IBV_SAFECALL(ibv_destroy_cq(ib_cq));
+  if (ib_comp_channel) {
+    IBV_SAFECALL(ibv_destroy_comp_channel(ib_comp_channel));
+  }
   IBV_SAFECALL(ibv_destroy_srq(ib_srq));
 }
 
+bool ibv_device_impl_t::arm_comp_impl()
+{
+  if (!ib_comp_channel) return false;
+  // Only the completions after this point generate an event.
+  IBV_SAFECALL(ibv_req_notify_cq(ib_cq, 0));
+  return true;
+}
+
+bool ibv_device_impl_t::wait_comp_impl(int timeout_ms)
+{
+  if (!ib_comp_channel) return false;
+  struct pollfd pfd;
+  pfd.fd = ib_comp_channel->fd;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+  if (poll(&pfd, 1, timeout_ms) <= 0) return true;
+  struct ibv_cq* ev_cq;
+  void* ev_ctx;
+  // another thread may have taken the event
+  if (ibv_get_cq_event(ib_comp_channel, &ev_cq, &ev_ctx) == 0) {
+    ibv_ack_cq_events(ev_cq, 1);
+  }
+  return true;
+}
+
 endpoint_t ibv_device_impl_t::alloc_endpoint_impl(endpoint_t::attr_t attr)
 {
   endpoint_t ret;
@@ -273,6 +333,9 @@ mr_t ibv_device_impl_t::register_memory_impl(void* buffer, size_t size)
       mr_flags = IBV_ACCESS_LOCAL_WRITE | IBV_ACCESS_REMOTE_READ |
                  IBV_ACCESS_REMOTE_WRITE;
     }
+    if (net_context_attr.support_atomic64) {
+      mr_flags |= IBV_ACCESS_REMOTE_ATOMIC;
+    }
 #if defined(LCI_USE_CUDA) || defined(LCI_USE_HIP)
     mr->acc_attr = accelerator::get_buffer_attr(buffer);
     mr->dmabuf_fd = -1;
@@ -433,7 +496,7 @@ ibv_endpoint_impl_t::ibv_endpoint_impl_t(device_t device_, attr_t attr_)
     init_attr.srq = p_ibv_device->ib_srq;
     init_attr.cap.max_send_wr = device_attr.net_max_sends;
     init_attr.cap.max_recv_wr = device_attr.net_max_recvs;
-    init_attr.cap.max_send_sge = max_sge_num;
+    init_attr.cap.max_send_sge = net_context_attr.max_iov;
     init_attr.cap.max_recv_sge = max_sge_num;
     init_attr.cap.max_inline_data = net_context_attr.max_inject_size;
     init_attr.qp_type = IBV_QPT_RC;
@@ -476,6 +539,9 @@ ibv_endpoint_impl_t::ibv_endpoint_impl_t(device_t device_, attr_t attr_)
     mod_attr.qp_state = IBV_QPS_INIT;
     mod_attr.qp_access_flags = IBV_ACCESS_LOCAL_WRITE | IBV_ACCESS_REMOTE_READ |
                                IBV_ACCESS_REMOTE_WRITE;
+    if (net_context_attr.support_atomic64) {
+      mod_attr.qp_access_flags |= IBV_ACCESS_REMOTE_ATOMIC;
+    }
     mod_attr.pkey_index = 0;
     mod_attr.port_num = p_net_context->ib_dev_port;
 
@@ -121,11 +121,15 @@ class ibv_device_impl_t : public lci::device_impl_t
                          void* user_context) override;
   size_t post_recvs_impl(void* buffers[], size_t size, size_t count, mr_t mrm,
                          void* usesr_contexts[]) override;
+  bool arm_comp_impl() override;
+  bool wait_comp_impl(int timeout_ms) override;
 
   // Connections O(N)
   struct ibv_td* ib_td;
   struct ibv_pd* ib_pd;
   struct ibv_cq* ib_cq;
+  // only with net_comp_channel
+  struct ibv_comp_channel* ib_comp_channel;
   struct ibv_srq* ib_srq;
   qp2rank_map_t qp2rank_map;
 
@@ -163,6 +167,24 @@ class ibv_endpoint_impl_t : public lci::endpoint_impl_t
   error_t post_get_impl(int rank, void* buffer, size_t size, mr_t mr,
                         uint64_t offset, rmr_t rmr, void* user_context,
                         bool high_priority) override;
+  error_t post_sendv_impl(int rank, const iovec_t* iov, size_t count,
+                          net_imm_data_t imm_data, void* user_context,
+                          bool high_priority) override;
+  error_t post_putv_impl(int rank, const iovec_t* iov, size_t count,
+                         uint64_t offset, rmr_t rmr, void* user_context,
+                         bool high_priority) override;
+  error_t post_putImmv_impl(int rank, const iovec_t* iov, size_t count,
+                            uint64_t offset, rmr_t rmr, net_imm_data_t imm_data,
+                            void* user_context, bool high_priority) override;
+  error_t post_getv_impl(int rank, const iovec_t* iov, size_t count,
+                         uint64_t offset, rmr_t rmr, void* user_context,
+                         bool high_priority) override;
+  error_t post_atomic_impl(int rank, atomic_op_t op, atomic_type_t type,
+                           net_atomic_buffer_t* buffer, mr_t mr,
+                           uint64_t offset, rmr_t rmr, void* user_context,
+                           bool high_priority) override;
+  size_t post_batch_impl(int rank, net_batch_op_t* ops, size_t count,
+                         bool high_priority) override;
 
   ibv_device_impl_t* p_ibv_device;
   std::vector<struct ibv_qp*> ib_qps;
@@ -175,6 +197,9 @@ class ibv_endpoint_impl_t : public lci::endpoint_impl_t
   void unlock_qp(int rank);
   bool try_acquire_slot(int rank, bool high_priority);
   void release_slot(int rank);
+  // post a work request with an sge list built from an io vector
+  error_t post_iov_wr(int rank, const iovec_t* iov, size_t count,
+                      struct ibv_send_wr* wr, bool high_priority);
 };
 
 }  // namespace lci
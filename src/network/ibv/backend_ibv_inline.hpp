@@ -153,12 +153,17 @@ inline size_t ibv_device_impl_t::poll_comp_impl(net_status_t* p_statuses,
         status.opcode = net_opcode_t::REMOTE_WRITE;
         status.user_context = (void*)wcs[i].wr_id;
         status.imm_data = wcs[i].imm_data;
+        status.rank = entry.rank;
       } else if (wcs[i].opcode == IBV_WC_SEND) {
         status.opcode = net_opcode_t::SEND;
         status.user_context = (void*)wcs[i].wr_id;
       } else if (wcs[i].opcode == IBV_WC_RDMA_WRITE) {
         status.opcode = net_opcode_t::WRITE;
         status.user_context = (void*)wcs[i].wr_id;
+      } else if (wcs[i].opcode == IBV_WC_FETCH_ADD ||
+                 wcs[i].opcode == IBV_WC_COMP_SWAP) {
+        status.opcode = net_opcode_t::ATOMIC;
+        status.user_context = (void*)wcs[i].wr_id;
       } else {
         LCI_Assert(wcs[i].opcode == IBV_WC_RDMA_READ,
                    "Unexpected IBV opcode!\n");
@@ -653,6 +658,206 @@ inline error_t ibv_endpoint_impl_t::post_get_impl(int rank, void* buffer,
   }
 }
 
+inline error_t ibv_endpoint_impl_t::post_iov_wr(int rank, const iovec_t* iov,
+                                                size_t count,
+                                                struct ibv_send_wr* wr,
+                                                bool high_priority)
+{
+  struct ibv_sge list[LCI_BACKEND_MAX_IOV];
+  int num_sge = 0;
+  for (size_t i = 0; i < count; i++) {
+    // skip empty entries (mlx4 treats a zero-length sge as 2GB)
+    if (iov[i].size == 0) continue;
+    list[num_sge].addr = (uint64_t)iov[i].buffer;
+    list[num_sge].length = iov[i].size;
+    list[num_sge].lkey = ibv_detail::get_mr_lkey(iov[i].mr);
+    ++num_sge;
+  }
+  wr->sg_list = num_sge > 0 ? list : NULL;
+  wr->num_sge = num_sge;
+  wr->next = NULL;
+  wr->send_flags = IBV_SEND_SIGNALED;
+
+  if (!try_acquire_slot(rank, high_priority)) {
+    return errorcode_t::retry_nomem;
+  }
+  struct ibv_send_wr* bad_wr;
+  if (!try_lock_qp(rank)) {
+    release_slot(rank);
+    return errorcode_t::retry_lock;
+  }
+  int ret = ibv_post_send(ib_qps[rank], wr, &bad_wr);
+  unlock_qp(rank);
+  if (ret == 0)
+    return errorcode_t::posted;
+  else if (ret == ENOMEM) {
+    release_slot(rank);
+    return errorcode_t::retry_nomem;  // exceed send queue capacity
+  } else {
+    release_slot(rank);
+    IBV_SAFECALL_RET(ret);
+  }
+}
+
+inline error_t ibv_endpoint_impl_t::post_sendv_impl(int rank,
+                                                    const iovec_t* iov,
+                                                    size_t count,
+                                                    net_imm_data_t imm_data,
+                                                    void* user_context,
+                                                    bool high_priority)
+{
+  struct ibv_send_wr wr;
+  wr.wr_id = (uintptr_t)user_context;
+  wr.opcode = IBV_WR_SEND_WITH_IMM;
+  wr.imm_data = imm_data;
+  return post_iov_wr(rank, iov, count, &wr, high_priority);
+}
+
+inline error_t ibv_endpoint_impl_t::post_putv_impl(int rank, const iovec_t* iov,
+                                                   size_t count,
+                                                   uint64_t offset, rmr_t rmr,
+                                                   void* user_context,
+                                                   bool high_priority)
+{
+  struct ibv_send_wr wr;
+  wr.wr_id = (uintptr_t)user_context;
+  wr.opcode = IBV_WR_RDMA_WRITE;
+  wr.wr.rdma.remote_addr = (uintptr_t)(rmr.base + offset);
+  wr.wr.rdma.rkey = rmr.opaque_rkey;
+  return post_iov_wr(rank, iov, count, &wr, high_priority);
+}
+
+inline error_t ibv_endpoint_impl_t::post_putImmv_impl(
+    int rank, const iovec_t* iov, size_t count, uint64_t offset, rmr_t rmr,
+    net_imm_data_t imm_data, void* user_context, bool high_priority)
+{
+  struct ibv_send_wr wr;
+  wr.wr_id = (uintptr_t)user_context;
+  wr.opcode = IBV_WR_RDMA_WRITE_WITH_IMM;
+  wr.imm_data = imm_data;
+  wr.wr.rdma.remote_addr = (uintptr_t)(rmr.base + offset);
+  wr.wr.rdma.rkey = rmr.opaque_rkey;
+  return post_iov_wr(rank, iov, count, &wr, high_priority);
+}
+
+inline error_t ibv_endpoint_impl_t::post_getv_impl(int rank, const iovec_t* iov,
+                                                   size_t count,
+                                                   uint64_t offset, rmr_t rmr,
+                                                   void* user_context,
+                                                   bool high_priority)
+{
+  struct ibv_send_wr wr;
+  wr.wr_id = (uintptr_t)user_context;
+  wr.opcode = IBV_WR_RDMA_READ;
+  wr.wr.rdma.remote_addr = (uintptr_t)(rmr.base + offset);
+  wr.wr.rdma.rkey = rmr.opaque_rkey;
+  return post_iov_wr(rank, iov, count, &wr, high_priority);
+}
+
+inline error_t ibv_endpoint_impl_t::post_atomic_impl(
+    int rank, atomic_op_t op, [[maybe_unused]] atomic_type_t type,
+    net_atomic_buffer_t* buffer, mr_t mr, uint64_t offset, rmr_t rmr,
+    void* user_context, bool high_priority)
+{
+  LCI_DBG_Assert(
+      type == atomic_type_t::int64 || type == atomic_type_t::uint64,
+      "Verbs atomics are 64-bit only\n");
+  LCI_DBG_Assert(op != atomic_op_t::swap, "Swap is emulated with cas\n");
+  struct ibv_send_wr wr;
+  wr.wr_id = (uintptr_t)user_context;
+  if (op == atomic_op_t::cas) {
+    wr.opcode = IBV_WR_ATOMIC_CMP_AND_SWP;
+    wr.wr.atomic.compare_add = buffer->compare;
+    wr.wr.atomic.swap = buffer->operand;
+  } else {
+    // the fetched value of a non-fetching add is simply ignored
+    wr.opcode = IBV_WR_ATOMIC_FETCH_AND_ADD;
+    wr.wr.atomic.compare_add = buffer->operand;
+  }
+  wr.wr.atomic.remote_addr = (uintptr_t)(rmr.base + offset);
+  wr.wr.atomic.rkey = rmr.opaque_rkey;
+  iovec_t iov(&buffer->result, sizeof(buffer->result), mr);
+  return post_iov_wr(rank, &iov, 1, &wr, high_priority);
+}
+
+inline size_t ibv_endpoint_impl_t::post_batch_impl(int rank,
+                                                   net_batch_op_t* ops,
+                                                   size_t count,
+                                                   bool high_priority)
+{
+  // Chain the work requests so that each ibv_post_send takes the QP lock
+  // and rings the doorbell once.
+  const size_t MAX_CHAIN = NET_BATCH_MAX_OPS;
+  struct ibv_sge lists[MAX_CHAIN];
+  struct ibv_send_wr wrs[MAX_CHAIN];
+  size_t nposted = 0;
+  while (nposted < count) {
+    size_t n = std::min(count - nposted, MAX_CHAIN);
+    size_t nslots = 0;
+    while (nslots < n && try_acquire_slot(rank, high_priority)) ++nslots;
+    if (nslots == 0) break;
+    n = nslots;
+    for (size_t i = 0; i < n; i++) {
+      const net_batch_op_t& op = ops[nposted + i];
+      struct ibv_send_wr& wr = wrs[i];
+      if (LCT_likely(op.size > 0)) {
+        lists[i].addr = (uint64_t)op.buffer;
+        lists[i].length = op.size;
+        lists[i].lkey = ibv_detail::get_mr_lkey(op.mr);
+        wr.sg_list = &lists[i];
+        wr.num_sge = 1;
+      } else {
+        // see post_send_impl
+        wr.sg_list = NULL;
+        wr.num_sge = 0;
+      }
+      wr.wr_id = (uintptr_t)op.user_context;
+      wr.next = i + 1 < n ? &wrs[i + 1] : NULL;
+      wr.send_flags = IBV_SEND_SIGNALED;
+      switch (op.type) {
+        case net_batch_op_t::type_t::send:
+          wr.opcode = IBV_WR_SEND_WITH_IMM;
+          wr.imm_data = op.imm_data;
+          break;
+        case net_batch_op_t::type_t::put:
+          wr.opcode = IBV_WR_RDMA_WRITE;
+          break;
+        case net_batch_op_t::type_t::putImm:
+          wr.opcode = IBV_WR_RDMA_WRITE_WITH_IMM;
+          wr.imm_data = op.imm_data;
+          break;
+        case net_batch_op_t::type_t::get:
+          wr.opcode = IBV_WR_RDMA_READ;
+          break;
+      }
+      if (op.type != net_batch_op_t::type_t::send) {
+        wr.wr.rdma.remote_addr = (uintptr_t)(op.rmr.base + op.offset);
+        wr.wr.rdma.rkey = op.rmr.opaque_rkey;
+      }
+    }
+    if (!try_lock_qp(rank)) {
+      for (size_t i = 0; i < n; i++) release_slot(rank);
+      break;
+    }
+    struct ibv_send_wr* bad_wr = NULL;
+    int ret = ibv_post_send(ib_qps[rank], wrs, &bad_wr);
+    unlock_qp(rank);
+    if (ret == 0) {
+      nposted += n;
+      continue;
+    }
+    // the work requests before bad_wr have been posted
+    size_t ngood = bad_wr ? bad_wr - wrs : 0;
+    for (size_t i = ngood; i < n; i++) release_slot(rank);
+    nposted += ngood;
+    if (ret != ENOMEM) {
+      IBV_SAFECALL(ret);
+    }
+    break;
+  }
+  return nposted;
+}
+
 }  // namespace lci
 
 #endif  // LCI_BACKEND_IBV_INLINE_HPP
@@ -22,6 +22,7 @@ device_impl_t::device_impl_t(net_context_t context_, attr_t attr_)
       next_endpoint_idx(0),
       nrecvs_posted(0)
 {
+  for (auto& n : nclass_recvs_posted) n.val = 0;
   attr.uid = g_ndevices++;
   runtime = net_context.p_impl->runtime;
   device.p_impl = this;
@@ -34,6 +35,17 @@ device_impl_t::device_impl_t(net_context_t context_, attr_t attr_)
 
 device_impl_t::~device_impl_t() { destroy_reg_cache(); }
 
+error_t device_impl_t::post_trecv_impl(void*, size_t, mr_t, uint64_t, uint64_t,
+                                       void*)
+{
+  LCI_Assert(false, "The network backend does not support tagged messages\n");
+  return errorcode_t::fatal;
+}
+
+bool device_impl_t::arm_comp_impl() { return false; }
+
+bool device_impl_t::wait_comp_impl(int) { return false; }
+
 endpoint_t device_impl_t::alloc_endpoint(endpoint_t::attr_t attr)
 {
   endpoint_t ret = alloc_endpoint_impl(attr);
@@ -44,8 +56,11 @@ endpoint_t device_impl_t::alloc_endpoint(endpoint_t::attr_t attr)
 
 void device_impl_t::free_endpoint(endpoint_t endpoint)
 {
+  LCI_Assert(endpoint.get_impl()->nopen_batches.load() == 0,
+             "The endpoint is freed with an open batch\n");
   int idx = endpoint.get_impl()->idx_in_device;
   endpoints.put(idx, endpoint_t());
+  delete endpoint.get_impl()->am_aggregator;
   delete endpoint.p_impl;
 }
 
@@ -61,14 +76,80 @@ endpoint_impl_t::endpoint_impl_t(device_t device_, attr_t attr_)
   endpoint.p_impl = this;
 }
 
+size_t endpoint_impl_t::post_batch_impl(int rank, net_batch_op_t* ops,
+                                        size_t count, bool high_priority)
+{
+  for (size_t i = 0; i < count; i++) {
+    net_batch_op_t& op = ops[i];
+    error_t error;
+    switch (op.type) {
+      case net_batch_op_t::type_t::send: {
+        int size_class = get_send_size_class(op.size);
+        if (size_class < 0) {
+          error = post_send_impl(rank, op.buffer, op.size, op.mr, op.imm_data,
+                                 op.user_context, high_priority);
+        } else {
+          error = post_tsend_impl(
+              rank, op.buffer, op.size, op.mr,
+              make_size_class_net_tag(size_class, op.imm_data),
+              op.user_context, high_priority);
+        }
+        break;
+      }
+      case net_batch_op_t::type_t::put:
+        error = post_put_impl(rank, op.buffer, op.size, op.mr, op.offset,
+                              op.rmr, op.user_context, high_priority);
+        break;
+      case net_batch_op_t::type_t::putImm:
+        if (net_context_attr.support_putimm) {
+          error =
+              post_putImm_impl(rank, op.buffer, op.size, op.mr, op.offset,
+                               op.rmr, op.imm_data, op.user_context,
+                               high_priority);
+        } else {
+          error = post_putImm_fallback(rank, op.buffer, op.size, op.mr,
+                                       op.offset, op.rmr, op.imm_data,
+                                       op.user_context);
+        }
+        break;
+      case net_batch_op_t::type_t::get:
+        error = post_get_impl(rank, op.buffer, op.size, op.mr, op.offset,
+                              op.rmr, op.user_context, high_priority);
+        break;
+      default:
+        LCI_Assert(false, "Unknown batch operation %d\n",
+                   static_cast<int>(op.type));
+    }
+    if (error.is_retry()) return i;
+    LCI_DBG_Assert(error.is_posted(), "Unexpected error %s\n",
+                   error.get_str());
+  }
+  return count;
+}
+
+error_t endpoint_impl_t::post_tsends_impl(int, void*, size_t, uint64_t, void*,
+                                          bool)
+{
+  LCI_Assert(false, "The network backend does not support tagged messages\n");
+  return errorcode_t::fatal;
+}
+
+error_t endpoint_impl_t::post_tsend_impl(int, void*, size_t, mr_t, uint64_t,
+                                         void*, bool)
+{
+  LCI_Assert(false, "The network backend does not support tagged messages\n");
+  return errorcode_t::fatal;
+}
+
 /*************************************************************************************
  * Interface implementations
  * **********************************************************************************/
 
 net_context_t alloc_net_context_x::call_impl(
     attr_backend_t backend, std::string ofi_provider_name, size_t max_msg_size,
-    size_t max_inject_size, int ibv_gid_idx, bool ibv_force_gid_auto_select,
-    std::string device_name, attr_ibv_odp_strategy_t ibv_odp_strategy,
+    size_t max_inject_size, size_t max_iov, int ibv_gid_idx,
+    bool ibv_force_gid_auto_select, std::string device_name,
+    attr_ibv_odp_strategy_t ibv_odp_strategy,
     attr_ibv_prefetch_strategy_t ibv_prefetch_strategy, bool use_dmabuf,
     const char* name, void* user_context, runtime_t runtime) const
 {
@@ -77,6 +158,7 @@ net_context_t alloc_net_context_x::call_impl(
   attr.ofi_provider_name = ofi_provider_name;
   attr.max_msg_size = max_msg_size;
   attr.max_inject_size = max_inject_size;
+  attr.max_iov = max_iov;
   attr.ibv_gid_idx = ibv_gid_idx;
   attr.ibv_force_gid_auto_select = ibv_force_gid_auto_select;
   attr.device_name = device_name;
@@ -127,12 +209,14 @@ device_t alloc_device_x::call_impl(
     size_t net_max_sends, size_t net_max_recvs, size_t net_max_cqes,
     double net_send_reserved_pct, uint64_t ofi_lock_mode,
     bool alloc_default_endpoint, bool alloc_progress_endpoint,
-    bool use_reg_cache, bool shm_enable, size_t shm_ring_size,
+    size_t am_aggregation_threshold, bool net_comp_channel, bool use_reg_cache,
+    bool shm_enable, size_t shm_ring_size,
     size_t shm_slot_size, size_t shm_producer_cas_attempts,
-    size_t shm_consumer_cas_attempts, size_t shm_max_polls,
-    attr_ibv_td_strategy_t ibv_td_strategy, const char* name,
-    void* user_context, runtime_t runtime, net_context_t net_context,
-    packet_pool_t packet_pool) const
+    size_t shm_consumer_cas_attempts, bool shm_huge_page,
+    size_t shm_max_polls, size_t eager_rdma_threshold, size_t eager_rdma_nslots,
+    size_t eager_rdma_slot_size, attr_ibv_td_strategy_t ibv_td_strategy,
+    const char* name, void* user_context, runtime_t runtime,
+    net_context_t net_context, packet_pool_t packet_pool) const
 {
   if (net_send_reserved_pct < 0.0 || net_send_reserved_pct >= 1.0) {
     LCI_Assert(false, "net_send_reserved_pct %.2f is out of range [0.0, 1.0)",
@@ -149,13 +233,19 @@ device_t alloc_device_x::call_impl(
   attr.ofi_lock_mode = ofi_lock_mode;
   attr.alloc_default_endpoint = alloc_default_endpoint;
   attr.alloc_progress_endpoint = alloc_progress_endpoint;
+  attr.am_aggregation_threshold = am_aggregation_threshold;
+  attr.net_comp_channel = net_comp_channel;
   attr.use_reg_cache = use_reg_cache;
   attr.shm_enable = shm_enable;
   attr.shm_ring_size = shm_ring_size;
   attr.shm_slot_size = shm_slot_size;
   attr.shm_producer_cas_attempts = shm_producer_cas_attempts;
   attr.shm_consumer_cas_attempts = shm_consumer_cas_attempts;
+  attr.shm_huge_page = shm_huge_page;
   attr.shm_max_polls = shm_max_polls;
+  attr.eager_rdma_threshold = eager_rdma_threshold;
+  attr.eager_rdma_nslots = eager_rdma_nslots;
+  attr.eager_rdma_slot_size = eager_rdma_slot_size;
   attr.ibv_td_strategy = ibv_td_strategy;
   attr.name = name;
   attr.user_context = user_context;
@@ -172,14 +262,31 @@ device_t alloc_device_x::call_impl(
   device.get_impl()->shm_device = shm::alloc_device(
       runtime.get_impl()->default_shm_context, device, attr.shm_enable,
       attr.shm_ring_size, attr.shm_slot_size, attr.shm_producer_cas_attempts,
-      attr.shm_consumer_cas_attempts);
+      attr.shm_consumer_cas_attempts, attr.shm_huge_page);
 #else
   LCI_Assert(!attr.shm_enable,
              "Shared-memory transport was not compiled into this build\n");
 #endif
+  if (attr.eager_rdma_threshold > 0) {
+    if (net_context.get_attr_support_putimm()) {
+      device.get_impl()->eager_rdma = new eager_rdma_t(
+          runtime, device, attr.eager_rdma_threshold, attr.eager_rdma_nslots,
+          attr.eager_rdma_slot_size);
+    } else {
+      LCI_Warn(
+          "Eager-RDMA is disabled as the network does not support put with "
+          "immediate data\n");
+    }
+  }
+  if (runtime.get_impl()->attr.rdv_pipeline) {
+    device.get_impl()->rdv_pipeline_queue = new rdv_pipeline_queue_t;
+  }
   if (attr.alloc_default_endpoint) {
     device.get_impl()->default_endpoint =
-        alloc_endpoint_x().runtime(runtime).device(device)();
+        alloc_endpoint_x()
+            .runtime(runtime)
+            .device(device)
+            .am_aggregation_threshold(attr.am_aggregation_threshold)();
     if (attr.alloc_progress_endpoint)
       device.get_impl()->progress_endpoint =
           alloc_endpoint_x().runtime(runtime).device(device)();
@@ -211,19 +318,29 @@ void free_device_x::call_impl(device_t* device, runtime_t runtime) const
     shm::free_device(&device->get_impl()->shm_device);
   }
 #endif
+  delete device->get_impl()->eager_rdma;
+  device->get_impl()->eager_rdma = nullptr;
+  delete device->get_impl()->rdv_pipeline_queue;
+  device->get_impl()->rdv_pipeline_queue = nullptr;
   device->get_impl()->unbind_packet_pool();
   device->get_impl()->destroy_reg_cache();
   delete device->p_impl;
   device->p_impl = nullptr;
 }
 
-endpoint_t alloc_endpoint_x::call_impl(const char* name, void* user_context,
+endpoint_t alloc_endpoint_x::call_impl(size_t am_aggregation_threshold,
+                                       const char* name, void* user_context,
                                        runtime_t, device_t device) const
 {
   endpoint_t::attr_t attr;
+  attr.am_aggregation_threshold = am_aggregation_threshold;
   attr.name = name;
   attr.user_context = user_context;
   auto endpoint = device.p_impl->alloc_endpoint(attr);
+  if (attr.am_aggregation_threshold > 0) {
+    endpoint.get_impl()->am_aggregator =
+        new am_aggregator_t(endpoint, attr.am_aggregation_threshold);
+  }
   if (!device.get_impl()->packet_pool.is_empty()) {
     barrier_x()
         .runtime(endpoint.get_impl()->runtime)
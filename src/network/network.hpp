@@ -19,8 +19,64 @@ class net_context_impl_t
   attr_t attr;
   net_context_t net_context;
   runtime_t runtime;
+  // Set by backends that execute fetch_add and cas but not swap natively, so
+  // that swap is executed as a loop of compare-and-swap operations.
+  bool emulate_atomic_swap = false;
 };
 
+// The registered local buffer of a network atomic operation. The operands and
+// the fetched value are stored in the first bytes of each word.
+struct net_atomic_buffer_t {
+  uint64_t result;
+  uint64_t operand;
+  uint64_t compare;
+};
+
+// A message sent to the receives of a smaller packet size class is a tagged
+// message, so that the network puts it into a buffer of the right size:
+// 0xfff (12) ; unused (16) ; size class (4) ; imm_data (32)
+// Network-matched send-recvs never use 0xfff as the remote handler.
+const uint64_t NET_TAG_SIZE_CLASS_PREFIX = 0xfffULL << 52;
+
+inline uint64_t make_size_class_net_tag(int size_class, uint32_t imm_data)
+{
+  return set_bits64(NET_TAG_SIZE_CLASS_PREFIX | imm_data, size_class, 4, 32);
+}
+
+inline bool is_size_class_net_tag(uint64_t tag)
+{
+  return (tag & NET_TAG_SIZE_CLASS_PREFIX) == NET_TAG_SIZE_CLASS_PREFIX;
+}
+
+// The number of operations the backends chain into one post. Callers build
+// batches of at most this many operations on the stack.
+const size_t NET_BATCH_MAX_OPS = 32;
+
+// One operation of a batch posted by endpoint_impl_t::post_batch. Only
+// operations on registered contiguous buffers can be batched.
+struct net_batch_op_t {
+  enum class type_t {
+    send,
+    put,
+    putImm,
+    get,
+  };
+  type_t type;
+  int rank;
+  void* buffer;
+  size_t size;
+  mr_t mr;
+  uint64_t offset;
+  rmr_t rmr;
+  net_imm_data_t imm_data;
+  void* user_context;
+};
+
+class eager_rdma_t;
+class rdv_pipeline_queue_t;
+class am_aggregator_t;
+struct packet_t;
+
 class device_impl_t
 {
  public:
@@ -38,6 +94,21 @@ class device_impl_t
                                  void* user_context) = 0;
   virtual size_t post_recvs_impl(void* buffers[], size_t size, size_t count,
                                  mr_t mr, void* usesr_contexts[]) = 0;
+  // Only called if the net context supports tagged messages. Receive a tagged
+  // message whose tag matches `tag` on all bits not set in `ignore`. It
+  // completes with net_opcode_t::TAGGED_RECV.
+  virtual error_t post_trecv_impl(void* buffer, size_t size, mr_t mr,
+                                  uint64_t tag, uint64_t ignore,
+                                  void* user_context);
+  // Only called if the device has a completion channel (net_comp_channel).
+  // Arm the completion channel so that the next completion raises an event.
+  // The caller must poll the network once more before waiting, as the
+  // completions that arrived before the arm raise no event. Return false if
+  // the backend has no completion channel.
+  virtual bool arm_comp_impl();
+  // Only called after arm_comp_impl returned true. Sleep until the network
+  // completes something or for at most timeout_ms milliseconds.
+  virtual bool wait_comp_impl(int timeout_ms);
 
   // wrapper functions
   endpoint_t alloc_endpoint(endpoint_t::attr_t attr);
@@ -46,17 +117,25 @@ class device_impl_t
   inline void deregister_memory(mr_impl_t* mr);
   inline void destroy_reg_cache();
   inline size_t poll_comp(net_status_t* p_statuses, size_t max_polls);
+  inline bool arm_comp();
   inline error_t post_recv(void* buffer, size_t size, mr_t mr,
                            void* user_context);
   inline size_t post_recvs(void* buffers[], size_t size, size_t count, mr_t mr,
                            void* usesr_contexts[]);
+  inline error_t post_trecv(void* buffer, size_t size, mr_t mr, uint64_t tag,
+                            uint64_t ignore, void* user_context);
+  inline bool wait_comp(int timeout_ms);
 
   // LCI layer functions
   inline void bind_packet_pool(packet_pool_t packet_pool_);
   inline void unbind_packet_pool();
-  inline bool post_recv_packets();
+  // Post a batch of packets of a size class (the largest one by default).
+  // The smaller classes are posted as tagged receives.
+  inline bool post_recv_packets(int size_class = -1);
   inline bool refill_recvs(bool is_blocking = false);
   inline void consume_recvs(int n) { nrecvs_posted -= n; }
+  // A receive of a packet has completed
+  inline void consume_recv(packet_t* packet);
   inline void mark_network_failed()
   {
     network_failed.store(true, std::memory_order_relaxed);
@@ -83,8 +162,15 @@ class device_impl_t
   mpmc_array_t<endpoint_t> endpoints;
   std::atomic<int> next_endpoint_idx;
   packet_pool_t packet_pool;
+  eager_rdma_t* eager_rdma = nullptr;
+  // the pipelined rendezvous messages still being registered
+  rdv_pipeline_queue_t* rdv_pipeline_queue = nullptr;
+  // Whether the smaller packet size classes have receives of their own. It
+  // needs tagged messages; otherwise all receives use the largest class.
+  bool use_size_classes = false;
 
-  LCIU_CACHE_PADDING(sizeof(packet_pool_t));
+  LCIU_CACHE_PADDING(sizeof(packet_pool_t) + sizeof(eager_rdma_t*) +
+                     sizeof(rdv_pipeline_queue_t*) + sizeof(bool));
 
   RegCache* rcache_handle = nullptr;
 
@@ -94,6 +180,10 @@ class device_impl_t
   std::atomic<size_t> nrecvs_posted;
   std::atomic<bool> network_failed{false};
   LCIU_CACHE_PADDING(sizeof(std::atomic<size_t>) + sizeof(std::atomic<bool>));
+  // the receives posted for the smaller packet size classes
+  padded_atomic_t<size_t> nclass_recvs_posted[LCI_PACKET_MAX_SIZE_CLASSES];
+
+  inline std::atomic<size_t>& get_nrecvs_posted(int size_class);
 };
 
 class mr_impl_t
@@ -151,6 +241,42 @@ class endpoint_impl_t
   virtual error_t post_get_impl(int rank, void* buffer, size_t size, mr_t mr,
                                 uint64_t offset, rmr_t rmr, void* user_context,
                                 bool high_priority) = 0;
+  // io vector variants: at most net_context max_iov entries, the total size
+  // is at most net_context max_msg_size.
+  virtual error_t post_sendv_impl(int rank, const iovec_t* iov, size_t count,
+                                  net_imm_data_t imm_data, void* user_context,
+                                  bool high_priority) = 0;
+  virtual error_t post_putv_impl(int rank, const iovec_t* iov, size_t count,
+                                 uint64_t offset, rmr_t rmr, void* user_context,
+                                 bool high_priority) = 0;
+  virtual error_t post_putImmv_impl(int rank, const iovec_t* iov, size_t count,
+                                    uint64_t offset, rmr_t rmr,
+                                    net_imm_data_t imm_data, void* user_context,
+                                    bool high_priority) = 0;
+  virtual error_t post_getv_impl(int rank, const iovec_t* iov, size_t count,
+                                 uint64_t offset, rmr_t rmr, void* user_context,
+                                 bool high_priority) = 0;
+  // Only called if the net context supports atomics on this type. The remote
+  // address has to be aligned to the size of the type.
+  virtual error_t post_atomic_impl(int rank, atomic_op_t op, atomic_type_t type,
+                                   net_atomic_buffer_t* buffer, mr_t mr,
+                                   uint64_t offset, rmr_t rmr,
+                                   void* user_context, bool high_priority) = 0;
+  // Post operations to the same rank, ringing the doorbell once if the backend
+  // can. Return the number of operations posted; they are posted in order, so
+  // the remaining ones have to be retried. The default implementation posts
+  // them one by one.
+  virtual size_t post_batch_impl(int rank, net_batch_op_t* ops, size_t count,
+                                 bool high_priority);
+  // Only called if the net context supports tagged messages. Send a message
+  // that is matched by the tagged receives of the target (the `s` variant
+  // injects it).
+  virtual error_t post_tsends_impl(int rank, void* buffer, size_t size,
+                                   uint64_t tag, void* user_context,
+                                   bool high_priority);
+  virtual error_t post_tsend_impl(int rank, void* buffer, size_t size, mr_t mr,
+                                  uint64_t tag, void* user_context,
+                                  bool high_priority);
 
   // wrapper functions
   inline error_t post_sends(int rank, void* buffer, size_t size,
@@ -176,6 +302,37 @@ class endpoint_impl_t
   inline error_t post_get(int rank, void* buffer, size_t size, mr_t mr,
                           uint64_t offset, rmr_t rmr, void* user_context,
                           bool allow_retry = true, bool force_post = false);
+  inline error_t post_sendv(int rank, const iovec_t* iov, size_t count,
+                            net_imm_data_t imm_data, void* user_context,
+                            bool allow_retry = true, bool force_post = false);
+  inline error_t post_putv(int rank, const iovec_t* iov, size_t count,
+                           uint64_t offset, rmr_t rmr, void* user_context,
+                           bool allow_retry = true, bool force_post = false);
+  inline error_t post_putImmv(int rank, const iovec_t* iov, size_t count,
+                              uint64_t offset, rmr_t rmr,
+                              net_imm_data_t imm_data, void* user_context,
+                              bool allow_retry = true, bool force_post = false);
+  inline error_t post_getv(int rank, const iovec_t* iov, size_t count,
+                           uint64_t offset, rmr_t rmr, void* user_context,
+                           bool allow_retry = true, bool force_post = false);
+  inline error_t post_atomic(int rank, atomic_op_t op, atomic_type_t type,
+                             net_atomic_buffer_t* buffer, mr_t mr,
+                             uint64_t offset, rmr_t rmr, void* user_context,
+                             bool allow_retry = true, bool force_post = false);
+  inline error_t post_tsends(int rank, void* buffer, size_t size, uint64_t tag,
+                             void* user_context, bool allow_retry = true,
+                             bool force_post = false);
+  inline error_t post_tsend(int rank, void* buffer, size_t size, mr_t mr,
+                            uint64_t tag, void* user_context,
+                            bool allow_retry = true, bool force_post = false);
+  // The smaller packet size class whose receives a message of `size` bytes
+  // goes to, or -1 if it goes to the receives of the largest class.
+  inline int get_send_size_class(size_t size) const;
+  // Post operations to any ranks. Return the number of operations posted. If
+  // allow_retry is false, the operations that cannot be posted are pushed to
+  // the backlog queue and all operations are considered posted.
+  inline size_t post_batch(net_batch_op_t* ops, size_t count,
+                           bool allow_retry = true);
   inline error_t post_putImms_fallback(int rank, void* buffer, size_t size,
                                        uint64_t offset, rmr_t rmr,
                                        net_imm_data_t imm_data,
@@ -184,6 +341,10 @@ class endpoint_impl_t
                                       mr_t mr, uint64_t offset, rmr_t rmr,
                                       net_imm_data_t imm_data,
                                       void* user_context);
+  inline error_t post_putImmv_fallback(int rank, const iovec_t* iov,
+                                       size_t count, uint64_t offset, rmr_t rmr,
+                                       net_imm_data_t imm_data,
+                                       void* user_context, bool high_priority);
   inline bool progress_backlog_queue() { return backlog_queue.progress(); }
   inline bool is_backlog_queue_empty() const
   {
@@ -221,6 +382,9 @@ class endpoint_impl_t
   net_context_attr_t net_context_attr;
   device_attr_t device_attr;
   int idx_in_device;
+  am_aggregator_t* am_aggregator = nullptr;
+  // the number of threads with an open batch (begin_batch) on the endpoint
+  std::atomic<int> nopen_batches{0};
 
  private:
   static std::atomic<int> g_nendpoints;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: NCSA
 
 #include "lci_internal.hpp"
+#include <poll.h>
 
 namespace lci
 {
@@ -52,6 +53,16 @@ struct fi_info* select_info(struct fi_info* ofi_info,
   }
   return first_match;
 }
+
+// Whether all the atomic operations LCI uses are valid on this type.
+bool check_atomic(struct fid_ep* ep, enum fi_datatype datatype)
+{
+  size_t count;
+  return fi_atomicvalid(ep, datatype, FI_SUM, &count) == 0 &&
+         fi_fetch_atomicvalid(ep, datatype, FI_SUM, &count) == 0 &&
+         fi_fetch_atomicvalid(ep, datatype, FI_ATOMIC_WRITE, &count) == 0 &&
+         fi_compare_atomicvalid(ep, datatype, FI_CSWAP, &count) == 0;
+}
 }  // namespace
 
 bool ofi_net_context_impl_t::check_availability()
@@ -102,9 +113,18 @@ ofi_net_context_impl_t::ofi_net_context_impl_t(runtime_t runtime_, attr_t attr_)
 #endif  // LCI_USE_CUDA || LCI_USE_HIP
 
   // Create ofi_info.
+  // Ask for atomics and tagged messages first, and fall back to a provider
+  // without them.
+  const uint64_t required_caps = hints->caps;
+  const uint64_t optional_caps[] = {FI_ATOMIC | FI_TAGGED, FI_ATOMIC,
+                                    FI_TAGGED, 0};
   struct fi_info* all_infos;
-  int ret =
-      fi_getinfo(FI_VERSION(1, 6), nullptr, nullptr, 0, hints, &all_infos);
+  int ret = -FI_ENODATA;
+  for (uint64_t caps : optional_caps) {
+    hints->caps = required_caps | caps;
+    ret = fi_getinfo(FI_VERSION(1, 6), nullptr, nullptr, 0, hints, &all_infos);
+    if (ret != -FI_ENODATA) break;
+  }
   if (ret) {
     int err = ret < 0 ? -ret : ret;
     if (!attr.device_name.empty()) {
@@ -172,6 +192,17 @@ ofi_net_context_impl_t::ofi_net_context_impl_t(runtime_t runtime_, attr_t attr_)
     attr.max_inject_size = ofi_info->tx_attr->inject_size;
   }
 
+  size_t max_iov = std::min(ofi_info->tx_attr->iov_limit,
+                            static_cast<size_t>(LCI_BACKEND_MAX_IOV));
+  if (attr.max_iov > max_iov) {
+    LCI_Log(LOG_INFO, "ofi",
+            "Reduce max_iov to %lu "
+            "as required by the libfabric iov_limit attribute\n",
+            max_iov);
+    attr.max_iov = max_iov;
+  }
+  LCI_Assert(attr.max_iov > 0, "max_iov must be positive\n");
+
   // Create libfabric obj.
   FI_SAFECALL(fi_fabric(ofi_info->fabric_attr, &ofi_fabric, nullptr));
 
@@ -184,6 +215,10 @@ ofi_net_context_impl_t::ofi_net_context_impl_t(runtime_t runtime_, attr_t attr_)
         "warning by `export LCI_MAX_SINGLE_MESSAGE_SIZE=%lu`\n",
         attr.max_msg_size, attr.max_msg_size);
   }
+  // The device checks the atomic operations on each type again.
+  attr.support_atomic32 = ofi_info->caps & FI_ATOMIC;
+  attr.support_atomic64 = ofi_info->caps & FI_ATOMIC;
+  attr.support_tagged = ofi_info->caps & FI_TAGGED;
   // Check put with immediate support.
   attr.support_putimm = true;
   std::string prov_name = ofi_info->fabric_attr->prov_name;
@@ -258,9 +293,26 @@ ofi_device_impl_t::ofi_device_impl_t(net_context_t context_,
   // Create cq.
   struct fi_cq_attr cq_attr;
   memset(&cq_attr, 0, sizeof(struct fi_cq_attr));
-  cq_attr.format = FI_CQ_FORMAT_DATA;
+  // the tagged format also reports the tag of tagged receives
+  cq_attr.format = FI_CQ_FORMAT_TAGGED;
   cq_attr.size = attr.net_max_cqes;
-  FI_SAFECALL(fi_cq_open(ofi_domain, &cq_attr, &ofi_cq, nullptr));
+  ofi_fabric = p_ofi_context->ofi_fabric;
+  ofi_wait_fd = -1;
+  if (attr.net_comp_channel) {
+    cq_attr.wait_obj = FI_WAIT_FD;
+    int ret = fi_cq_open(ofi_domain, &cq_attr, &ofi_cq, nullptr);
+    if (ret == 0) {
+      FI_SAFECALL(fi_control(&ofi_cq->fid, FI_GETWAIT, &ofi_wait_fd));
+    } else {
+      LCI_Warn("The provider has no file descriptor wait object (%s); "
+               "blocking waits will not sleep on the network\n",
+               fi_strerror(-ret));
+      cq_attr.wait_obj = FI_WAIT_NONE;
+    }
+  }
+  if (ofi_wait_fd < 0) {
+    FI_SAFECALL(fi_cq_open(ofi_domain, &cq_attr, &ofi_cq, nullptr));
+  }
 
   // Bind my ep to cq.
   FI_SAFECALL(fi_ep_bind(ofi_ep, (fid_t)ofi_cq, FI_TRANSMIT | FI_RECV));
@@ -272,6 +324,21 @@ ofi_device_impl_t::ofi_device_impl_t(net_context_t context_,
   FI_SAFECALL(fi_ep_bind(ofi_ep, (fid_t)ofi_av, 0));
   FI_SAFECALL(fi_enable(ofi_ep));
 
+  // Check the atomic operations. The target of a failed check falls back to
+  // the atomics executed by the progress engine.
+  if (net_context_attr.support_atomic32) {
+    net_context_attr.support_atomic32 =
+        check_atomic(ofi_ep, FI_INT32) &&
+        check_atomic(ofi_ep, FI_UINT32);
+  }
+  if (net_context_attr.support_atomic64) {
+    net_context_attr.support_atomic64 =
+        check_atomic(ofi_ep, FI_INT64) &&
+        check_atomic(ofi_ep, FI_UINT64);
+  }
+  LCI_Log(LOG_INFO, "ofi", "Native atomics: 32-bit %d 64-bit %d\n",
+          net_context_attr.support_atomic32, net_context_attr.support_atomic64);
+
   // Now exchange end-point address.
   // assume the size of the raw address no larger than 128 bits.
   const int EP_ADDR_LEN = 6;
@@ -339,6 +406,27 @@ ofi_device_impl_t::~ofi_device_impl_t()
   FI_SAFECALL(fi_close((struct fid*)&ofi_domain->fid));
 }
 
+bool ofi_device_impl_t::arm_comp_impl()
+{
+  // fi_trywait in wait_comp_impl arms the wait object and checks for
+  // pending completions at once
+  return ofi_wait_fd >= 0;
+}
+
+bool ofi_device_impl_t::wait_comp_impl(int timeout_ms)
+{
+  if (ofi_wait_fd < 0) return false;
+  struct fid* fids[1] = {&ofi_cq->fid};
+  // fails if there are completions to read already
+  if (fi_trywait(ofi_fabric, fids, 1) != FI_SUCCESS) return true;
+  struct pollfd pfd;
+  pfd.fd = ofi_wait_fd;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+  poll(&pfd, 1, timeout_ms);
+  return true;
+}
+
 endpoint_t ofi_device_impl_t::alloc_endpoint_impl(endpoint_t::attr_t attr)
 {
   endpoint_t ret;
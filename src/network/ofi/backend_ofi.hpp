@@ -11,6 +11,7 @@
 #include <rdma/fi_cm.h>
 #include <rdma/fi_errno.h>
 #include <rdma/fi_rma.h>
+#include <rdma/fi_atomic.h>
 #include <mutex>
 
 #define FI_SAFECALL(x)                                                    \
@@ -97,11 +98,18 @@ class ofi_device_impl_t : public lci::device_impl_t
                          void* user_context) override;
   size_t post_recvs_impl(void* buffers[], size_t size, size_t count, mr_t mr,
                          void* usesr_contexts[]) override;
+  error_t post_trecv_impl(void* buffer, size_t size, mr_t mr, uint64_t tag,
+                          uint64_t ignore, void* user_context) override;
+  bool arm_comp_impl() override;
+  bool wait_comp_impl(int timeout_ms) override;
 
   struct fi_domain_attr* ofi_domain_attr;
+  struct fid_fabric* ofi_fabric;
   struct fid_domain* ofi_domain;
   struct fid_ep* ofi_ep;
   struct fid_cq* ofi_cq;
+  // the wait object of the completion queue (only with net_comp_channel)
+  int ofi_wait_fd;
   struct fid_av* ofi_av;
   std::vector<fi_addr_t> peer_addrs;
   bool use_cxi_writedata;
@@ -146,6 +154,29 @@ class ofi_endpoint_impl_t : public lci::endpoint_impl_t
   error_t post_get_impl(int rank, void* buffer, size_t size, mr_t mr,
                         uint64_t offset, rmr_t rmr, void* user_context,
                         bool high_priority) override;
+  error_t post_sendv_impl(int rank, const iovec_t* iov, size_t count,
+                          net_imm_data_t imm_data, void* user_context,
+                          bool high_priority) override;
+  error_t post_putv_impl(int rank, const iovec_t* iov, size_t count,
+                         uint64_t offset, rmr_t rmr, void* user_context,
+                         bool high_priority) override;
+  error_t post_putImmv_impl(int rank, const iovec_t* iov, size_t count,
+                            uint64_t offset, rmr_t rmr, net_imm_data_t imm_data,
+                            void* user_context, bool high_priority) override;
+  error_t post_getv_impl(int rank, const iovec_t* iov, size_t count,
+                         uint64_t offset, rmr_t rmr, void* user_context,
+                         bool high_priority) override;
+  error_t post_atomic_impl(int rank, atomic_op_t op, atomic_type_t type,
+                           net_atomic_buffer_t* buffer, mr_t mr,
+                           uint64_t offset, rmr_t rmr, void* user_context,
+                           bool high_priority) override;
+  size_t post_batch_impl(int rank, net_batch_op_t* ops, size_t count,
+                         bool high_priority) override;
+  error_t post_tsends_impl(int rank, void* buffer, size_t size, uint64_t tag,
+                           void* user_context, bool high_priority) override;
+  error_t post_tsend_impl(int rank, void* buffer, size_t size, mr_t mr,
+                          uint64_t tag, void* user_context,
+                          bool high_priority) override;
 
   ofi_device_impl_t* p_ofi_device;
   int my_rank;
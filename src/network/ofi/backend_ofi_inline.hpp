@@ -15,7 +15,7 @@ inline uint64_t ofi_device_impl_t::get_rkey(mr_impl_t* mr)
 inline size_t ofi_device_impl_t::poll_comp_impl(net_status_t* p_statuses,
                                                 size_t max_polls)
 {
-  struct fi_cq_data_entry fi_entries[LCI_BACKEND_MAX_POLLS];
+  struct fi_cq_tagged_entry fi_entries[LCI_BACKEND_MAX_POLLS];
 
   // Keep the configured polling lock across both reads so another poller
   // cannot consume the error entry reported by fi_cq_read.
@@ -31,7 +31,18 @@ inline size_t ofi_device_impl_t::poll_comp_impl(net_status_t* p_statuses,
       if (p_statuses) {
         net_status_t& status = p_statuses[j];
         memset(&status, 0, sizeof(status));
-        if (fi_entries[j].flags & FI_RECV) {
+        if ((fi_entries[j].flags & (FI_RECV | FI_TAGGED)) ==
+            (FI_RECV | FI_TAGGED)) {
+          // the receives of the smaller packet size classes are untagged
+          // receives for the upper layer
+          status.opcode = is_size_class_net_tag(fi_entries[j].tag)
+                              ? net_opcode_t::RECV
+                              : net_opcode_t::TAGGED_RECV;
+          status.user_context = fi_entries[j].op_context;
+          status.length = fi_entries[j].len;
+          status.imm_data = fi_entries[j].tag & ((1ULL << 32) - 1);
+          status.rank = (int)(fi_entries[j].data >> 32);
+        } else if (fi_entries[j].flags & FI_RECV) {
           status.opcode = net_opcode_t::RECV;
           status.user_context = fi_entries[j].op_context;
           status.length = fi_entries[j].len;
@@ -40,7 +51,12 @@ inline size_t ofi_device_impl_t::poll_comp_impl(net_status_t* p_statuses,
         } else if (fi_entries[j].flags & FI_REMOTE_WRITE) {
           status.opcode = net_opcode_t::REMOTE_WRITE;
           status.user_context = NULL;
-          status.imm_data = fi_entries[j].data;
+          status.imm_data = fi_entries[j].data & ((1ULL << 32) - 1);
+          status.rank = (int)(fi_entries[j].data >> 32);
+        } else if (fi_entries[j].flags & FI_ATOMIC) {
+          // checked before FI_WRITE/FI_READ, which are also set
+          status.opcode = net_opcode_t::ATOMIC;
+          status.user_context = fi_entries[j].op_context;
         } else if (fi_entries[j].flags & FI_SEND) {
           status.opcode = net_opcode_t::SEND;
           status.user_context = fi_entries[j].op_context;
@@ -76,7 +92,7 @@ inline size_t ofi_device_impl_t::poll_comp_impl(net_status_t* p_statuses,
         status.opcode = net_opcode_t::ERROR;
         status.rank = -1;
         const bool is_outgoing =
-            (error.flags & (FI_SEND | FI_WRITE | FI_READ)) != 0 &&
+            (error.flags & (FI_SEND | FI_WRITE | FI_READ | FI_ATOMIC)) != 0 &&
             (error.flags & (FI_RECV | FI_REMOTE_WRITE)) == 0;
         status.user_context = is_outgoing ? error.op_context : nullptr;
       }
@@ -120,6 +136,24 @@ inline error_t ofi_device_impl_t::post_recv_impl(void* buffer, size_t size,
   }
 }
 
+inline error_t ofi_device_impl_t::post_trecv_impl(void* buffer, size_t size,
+                                                  mr_t mr, uint64_t tag,
+                                                  uint64_t ignore,
+                                                  void* user_context)
+{
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_RECV, errorcode_t::retry_lock);
+  ssize_t ret = fi_trecv(ofi_ep, buffer, size, ofi_detail::get_mr_desc(mr),
+                         FI_ADDR_UNSPEC, tag, ignore, user_context);
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_RECV);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::posted;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
 inline size_t ofi_device_impl_t::post_recvs_impl(void* buffers[], size_t size,
                                                  size_t count, mr_t mr,
                                                  void* user_contexts[])
@@ -199,6 +233,56 @@ inline error_t ofi_endpoint_impl_t::post_send_impl(int rank, void* buffer,
   }
 }
 
+inline error_t ofi_endpoint_impl_t::post_tsends_impl(int rank, void* buffer,
+                                                     size_t size, uint64_t tag,
+                                                     void* user_context,
+                                                     bool /*high_priority*/)
+{
+  struct iovec iov;
+  iov.iov_base = buffer;
+  iov.iov_len = size;
+  struct fi_msg_tagged msg;
+  msg.msg_iov = &iov;
+  msg.desc = nullptr;
+  msg.iov_count = 1;
+  msg.addr = peer_addrs[rank];
+  msg.tag = tag;
+  msg.ignore = 0;
+  msg.context = user_context;
+  msg.data = (uint64_t)my_rank << 32;
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
+  ssize_t ret =
+      fi_tsendmsg(ofi_ep, &msg, FI_INJECT | FI_COMPLETION | FI_REMOTE_CQ_DATA);
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::done;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
+inline error_t ofi_endpoint_impl_t::post_tsend_impl(int rank, void* buffer,
+                                                    size_t size, mr_t mr,
+                                                    uint64_t tag,
+                                                    void* user_context,
+                                                    bool /*high_priority*/)
+{
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
+  ssize_t ret = fi_tsenddata(ofi_ep, buffer, size, ofi_detail::get_mr_desc(mr),
+                             (uint64_t)my_rank << 32, peer_addrs[rank], tag,
+                             user_context);
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::posted;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
 inline error_t ofi_endpoint_impl_t::post_puts_impl(int rank, void* buffer,
                                                    size_t size, uint64_t offset,
                                                    rmr_t rmr,
@@ -280,7 +364,8 @@ inline error_t ofi_endpoint_impl_t::cxi_inject_writedata_workaround(
   uintptr_t addr =
       ofi_detail::get_remote_addr(rmr, offset, ofi_domain_attr->mr_mode);
   LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
-  ssize_t ret = fi_inject_writedata(ofi_ep, buffer, size, imm_data,
+  ssize_t ret = fi_inject_writedata(ofi_ep, buffer, size,
+                                    (uint64_t)my_rank << 32 | imm_data,
                                     peer_addrs[rank], addr, rmr.opaque_rkey);
   LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
   if (ret == FI_SUCCESS) {
@@ -323,7 +408,7 @@ inline error_t ofi_endpoint_impl_t::post_putImms_impl(
   msg.rma_iov = &riov;
   msg.rma_iov_count = 1;
   msg.context = user_context;
-  msg.data = imm_data;
+  msg.data = (uint64_t)my_rank << 32 | imm_data;
   LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
   ssize_t ret = fi_writemsg(
       ofi_ep, &msg,
@@ -346,8 +431,9 @@ inline error_t ofi_endpoint_impl_t::cxi_writedata_workaround(
       ofi_detail::get_remote_addr(rmr, offset, ofi_domain_attr->mr_mode);
   LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
   ssize_t ret =
-      fi_writedata(ofi_ep, buffer, size, ofi_detail::get_mr_desc(mr), imm_data,
-                   peer_addrs[rank], addr, rmr.opaque_rkey, user_context);
+      fi_writedata(ofi_ep, buffer, size, ofi_detail::get_mr_desc(mr),
+                   (uint64_t)my_rank << 32 | imm_data, peer_addrs[rank], addr,
+                   rmr.opaque_rkey, user_context);
   LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
   if (ret == FI_SUCCESS)
     return errorcode_t::posted;
@@ -384,7 +470,7 @@ inline error_t ofi_endpoint_impl_t::post_putImm_impl(
   msg.rma_iov = &riov;
   msg.rma_iov_count = 1;
   msg.context = user_context;
-  msg.data = imm_data;
+  msg.data = (uint64_t)my_rank << 32 | imm_data;
   LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
   ssize_t ret = fi_writemsg(
       ofi_ep, &msg, FI_COMPLETION | FI_DELIVERY_COMPLETE | FI_REMOTE_CQ_DATA);
@@ -437,6 +523,296 @@ inline error_t ofi_endpoint_impl_t::post_get_impl(int rank, void* buffer,
     FI_SAFECALL_RET(ret);
   }
 }
+
+namespace ofi_detail
+{
+// Convert an io vector into the libfabric representation. Return the total
+// size.
+inline size_t get_iov(const iovec_t* iov, size_t count, struct iovec* msg_iov,
+                      void** desc)
+{
+  size_t size = 0;
+  for (size_t i = 0; i < count; i++) {
+    msg_iov[i].iov_base = iov[i].buffer;
+    msg_iov[i].iov_len = iov[i].size;
+    desc[i] = get_mr_desc(iov[i].mr);
+    size += iov[i].size;
+  }
+  return size;
+}
+}  // namespace ofi_detail
+
+inline error_t ofi_endpoint_impl_t::post_sendv_impl(int rank,
+                                                    const iovec_t* iov,
+                                                    size_t count,
+                                                    net_imm_data_t imm_data,
+                                                    void* user_context,
+                                                    bool /*high_priority*/)
+{
+  struct iovec msg_iov[LCI_BACKEND_MAX_IOV];
+  void* desc[LCI_BACKEND_MAX_IOV];
+  ofi_detail::get_iov(iov, count, msg_iov, desc);
+  struct fi_msg msg;
+  msg.msg_iov = msg_iov;
+  msg.desc = desc;
+  msg.iov_count = count;
+  msg.addr = peer_addrs[rank];
+  msg.context = user_context;
+  msg.data = (uint64_t)my_rank << 32 | imm_data;
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
+  ssize_t ret = fi_sendmsg(ofi_ep, &msg, FI_COMPLETION | FI_REMOTE_CQ_DATA);
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::posted;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
+inline error_t ofi_endpoint_impl_t::post_putv_impl(int rank, const iovec_t* iov,
+                                                   size_t count,
+                                                   uint64_t offset, rmr_t rmr,
+                                                   void* user_context,
+                                                   bool /*high_priority*/)
+{
+  struct iovec msg_iov[LCI_BACKEND_MAX_IOV];
+  void* desc[LCI_BACKEND_MAX_IOV];
+  struct fi_rma_iov riov;
+  struct fi_msg_rma msg;
+  riov.addr =
+      ofi_detail::get_remote_addr(rmr, offset, ofi_domain_attr->mr_mode);
+  riov.len = ofi_detail::get_iov(iov, count, msg_iov, desc);
+  riov.key = rmr.opaque_rkey;
+  msg.msg_iov = msg_iov;
+  msg.desc = desc;
+  msg.iov_count = count;
+  msg.addr = peer_addrs[rank];
+  msg.rma_iov = &riov;
+  msg.rma_iov_count = 1;
+  msg.context = user_context;
+  msg.data = 0;
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
+  ssize_t ret = fi_writemsg(ofi_ep, &msg, FI_COMPLETION | FI_DELIVERY_COMPLETE);
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::posted;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
+inline error_t ofi_endpoint_impl_t::post_putImmv_impl(
+    int rank, const iovec_t* iov, size_t count, uint64_t offset, rmr_t rmr,
+    net_imm_data_t imm_data, void* user_context, bool high_priority)
+{
+  if (p_ofi_device->use_cxi_writedata) {
+    if (count == 1) {
+      return cxi_writedata_workaround(rank, iov[0].buffer, iov[0].size,
+                                      iov[0].mr, offset, rmr, imm_data,
+                                      user_context);
+    }
+    // fi_writedata only takes one buffer
+    return post_putImmv_fallback(rank, iov, count, offset, rmr, imm_data,
+                                 user_context, high_priority);
+  }
+  struct iovec msg_iov[LCI_BACKEND_MAX_IOV];
+  void* desc[LCI_BACKEND_MAX_IOV];
+  struct fi_rma_iov riov;
+  struct fi_msg_rma msg;
+  riov.addr =
+      ofi_detail::get_remote_addr(rmr, offset, ofi_domain_attr->mr_mode);
+  riov.len = ofi_detail::get_iov(iov, count, msg_iov, desc);
+  riov.key = rmr.opaque_rkey;
+  msg.msg_iov = msg_iov;
+  msg.desc = desc;
+  msg.iov_count = count;
+  msg.addr = peer_addrs[rank];
+  msg.rma_iov = &riov;
+  msg.rma_iov_count = 1;
+  msg.context = user_context;
+  msg.data = (uint64_t)my_rank << 32 | imm_data;
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
+  ssize_t ret = fi_writemsg(
+      ofi_ep, &msg, FI_COMPLETION | FI_DELIVERY_COMPLETE | FI_REMOTE_CQ_DATA);
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::posted;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
+inline error_t ofi_endpoint_impl_t::post_getv_impl(int rank, const iovec_t* iov,
+                                                   size_t count,
+                                                   uint64_t offset, rmr_t rmr,
+                                                   void* user_context,
+                                                   bool /*high_priority*/)
+{
+  struct iovec msg_iov[LCI_BACKEND_MAX_IOV];
+  void* desc[LCI_BACKEND_MAX_IOV];
+  struct fi_rma_iov riov;
+  struct fi_msg_rma msg;
+  riov.addr =
+      ofi_detail::get_remote_addr(rmr, offset, ofi_domain_attr->mr_mode);
+  riov.len = ofi_detail::get_iov(iov, count, msg_iov, desc);
+  riov.key = rmr.opaque_rkey;
+  msg.msg_iov = msg_iov;
+  msg.desc = desc;
+  msg.iov_count = count;
+  msg.addr = peer_addrs[rank];
+  msg.rma_iov = &riov;
+  msg.rma_iov_count = 1;
+  msg.context = user_context;
+  msg.data = 0;
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
+  ssize_t ret = fi_readmsg(ofi_ep, &msg, FI_COMPLETION);
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::posted;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
+inline error_t ofi_endpoint_impl_t::post_atomic_impl(
+    int rank, atomic_op_t op, atomic_type_t type, net_atomic_buffer_t* buffer,
+    mr_t mr, uint64_t offset, rmr_t rmr, void* user_context,
+    bool /*high_priority*/)
+{
+  static const enum fi_datatype datatypes[] = {FI_INT32, FI_UINT32, FI_INT64,
+                                               FI_UINT64};
+  enum fi_datatype datatype = datatypes[static_cast<int>(type)];
+  uintptr_t addr =
+      ofi_detail::get_remote_addr(rmr, offset, ofi_domain_attr->mr_mode);
+  void* desc = ofi_detail::get_mr_desc(mr);
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, errorcode_t::retry_lock);
+  ssize_t ret;
+  switch (op) {
+    case atomic_op_t::add:
+      ret = fi_atomic(ofi_ep, &buffer->operand, 1, desc, peer_addrs[rank],
+                      addr, rmr.opaque_rkey, datatype, FI_SUM, user_context);
+      break;
+    case atomic_op_t::fetch_add:
+    case atomic_op_t::swap:
+      ret = fi_fetch_atomic(
+          ofi_ep, &buffer->operand, 1, desc, &buffer->result, desc,
+          peer_addrs[rank], addr, rmr.opaque_rkey, datatype,
+          op == atomic_op_t::swap ? FI_ATOMIC_WRITE : FI_SUM, user_context);
+      break;
+    case atomic_op_t::cas:
+      ret = fi_compare_atomic(ofi_ep, &buffer->operand, 1, desc,
+                              &buffer->compare, desc, &buffer->result, desc,
+                              peer_addrs[rank], addr, rmr.opaque_rkey,
+                              datatype, FI_CSWAP, user_context);
+      break;
+    default:
+      LCI_Assert(false, "Unknown atomic operation %d\n", static_cast<int>(op));
+      ret = -FI_EINVAL;
+  }
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  if (ret == FI_SUCCESS)
+    return errorcode_t::posted;
+  else if (ret == -FI_EAGAIN)
+    return errorcode_t::retry_nomem;
+  else {
+    FI_SAFECALL_RET(ret);
+  }
+}
+
+inline size_t ofi_endpoint_impl_t::post_batch_impl(int rank,
+                                                   net_batch_op_t* ops,
+                                                   size_t count,
+                                                   bool high_priority)
+{
+  if (p_ofi_device->use_cxi_writedata || !net_context_attr.support_putimm) {
+    for (size_t i = 0; i < count; i++) {
+      if (ops[i].type == net_batch_op_t::type_t::putImm) {
+        // the write with immediate data needs a workaround
+        return endpoint_impl_t::post_batch_impl(rank, ops, count,
+                                                high_priority);
+      }
+    }
+  }
+  // Take the lock once and hint the provider with FI_MORE that more
+  // operations follow, so that it can ring the doorbell only once.
+  LCI_OFI_CS_TRY_ENTER(LCI_NET_TRYLOCK_SEND, 0);
+  size_t nposted = 0;
+  for (; nposted < count; nposted++) {
+    const net_batch_op_t& op = ops[nposted];
+    uint64_t flags = FI_COMPLETION;
+    if (nposted + 1 < count) flags |= FI_MORE;
+    struct iovec iov;
+    void* desc = ofi_detail::get_mr_desc(op.mr);
+    iov.iov_base = op.buffer;
+    iov.iov_len = op.size;
+    ssize_t ret;
+    int size_class = op.type == net_batch_op_t::type_t::send
+                         ? get_send_size_class(op.size)
+                         : -1;
+    if (size_class >= 0) {
+      struct fi_msg_tagged msg;
+      msg.msg_iov = &iov;
+      msg.desc = &desc;
+      msg.iov_count = 1;
+      msg.addr = peer_addrs[rank];
+      msg.tag = make_size_class_net_tag(size_class, op.imm_data);
+      msg.ignore = 0;
+      msg.context = op.user_context;
+      msg.data = (uint64_t)my_rank << 32;
+      ret = fi_tsendmsg(ofi_ep, &msg, flags | FI_REMOTE_CQ_DATA);
+    } else if (op.type == net_batch_op_t::type_t::send) {
+      struct fi_msg msg;
+      msg.msg_iov = &iov;
+      msg.desc = &desc;
+      msg.iov_count = 1;
+      msg.addr = peer_addrs[rank];
+      msg.context = op.user_context;
+      msg.data = (uint64_t)my_rank << 32 | op.imm_data;
+      ret = fi_sendmsg(ofi_ep, &msg, flags | FI_REMOTE_CQ_DATA);
+    } else {
+      struct fi_rma_iov riov;
+      struct fi_msg_rma msg;
+      riov.addr = ofi_detail::get_remote_addr(op.rmr, op.offset,
+                                              ofi_domain_attr->mr_mode);
+      riov.len = op.size;
+      riov.key = op.rmr.opaque_rkey;
+      msg.msg_iov = &iov;
+      msg.desc = &desc;
+      msg.iov_count = 1;
+      msg.addr = peer_addrs[rank];
+      msg.rma_iov = &riov;
+      msg.rma_iov_count = 1;
+      msg.context = op.user_context;
+      msg.data = 0;
+      if (op.type == net_batch_op_t::type_t::get) {
+        ret = fi_readmsg(ofi_ep, &msg, flags);
+      } else if (op.type == net_batch_op_t::type_t::put) {
+        ret = fi_writemsg(ofi_ep, &msg, flags | FI_DELIVERY_COMPLETE);
+      } else {
+        msg.data = (uint64_t)my_rank << 32 | op.imm_data;
+        ret = fi_writemsg(ofi_ep, &msg,
+                          flags | FI_DELIVERY_COMPLETE | FI_REMOTE_CQ_DATA);
+      }
+    }
+    if (ret == -FI_EAGAIN) {
+      // The operations posted with FI_MORE are flushed by the next one
+      // posted, e.g. the retry of this one.
+      break;
+    } else if (ret != FI_SUCCESS) {
+      FI_SAFECALL(ret);
+    }
+  }
+  LCI_OFI_CS_EXIT(LCI_NET_TRYLOCK_SEND);
+  return nposted;
+}
 }  // namespace lci
 
 #endif  // LCI_BACKEND_OFI_BACKEND_OFI_INLINE_HPP
@@ -10,13 +10,13 @@ inline void packet_t::put_back() { local_context.packet_pool_impl->put(this); }
 
 inline mr_t packet_t::get_mr(device_t device)
 {
-  return local_context.packet_pool_impl->get_or_register_mr(device);
+  return local_context.packet_pool_impl->get_or_register_mr(device, this);
 }
 
 inline mr_t packet_t::get_mr(endpoint_t endpoint)
 {
   device_t device = endpoint.p_impl->device;
-  return local_context.packet_pool_impl->get_or_register_mr(device);
+  return local_context.packet_pool_impl->get_or_register_mr(device, this);
 }
 
 inline void free_ctx_and_signal_comp(internal_context_t* internal_ctx)
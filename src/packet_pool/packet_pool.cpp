@@ -8,93 +8,357 @@ namespace lci
 {
 packet_pool_impl_t::packet_pool_impl_t(const attr_t& attr_)
     : attr(attr_),
-      pool(),
+      nnodes(attr_.numa_aware ? get_numa_node_count() : 1),
+      nclasses(0),
       heap(nullptr),
-      base_packet_p(nullptr),
       heap_size(0),
+      heap_alloc_size(0),
+      slab_size(0),
+      max_nslabs(1),
+      nslabs(0),
+      nretiring(0),
+      last_pressure_time(0),
       mrs(64),
       npacket_lost(0)
 {
+  LCI_Assert(attr.packet_size > LCI_CACHE_LINE &&
+                 attr.packet_size % LCI_CACHE_LINE == 0,
+             "The packet size (%lu) should be a multiple of %d larger than "
+             "it\n",
+             attr.packet_size, LCI_CACHE_LINE);
+  // the size classes, from the smallest to the largest
+  size_t packet_sizes[LCI_PACKET_MAX_SIZE_CLASSES];
+  size_t packet_size = attr.packet_size;
+  const size_t min_packet_size =
+      std::max(attr.min_packet_size, static_cast<size_t>(2 * LCI_CACHE_LINE));
+  do {
+    packet_sizes[nclasses++] = packet_size;
+    packet_size = packet_size / 4 / LCI_CACHE_LINE * LCI_CACHE_LINE;
+  } while (attr.min_packet_size > 0 && packet_size >= min_packet_size &&
+           nclasses < LCI_PACKET_MAX_SIZE_CLASSES);
+  std::reverse(packet_sizes, packet_sizes + nclasses);
+
+  LCI_Assert(attr.npackets == 0 || attr.npackets >= (size_t)nclasses,
+             "The pool needs at least one packet per size class (%lu < %d)\n",
+             attr.npackets, nclasses);
+  // The packets are split evenly across the classes; the largest class
+  // takes the remainder. Every class of a slab starts at a page boundary.
+  size_t page_size = attr.huge_page ? get_huge_page_size() : get_page_size();
+  for (int i = 0; i < nclasses; i++) {
+    size_class_t& c = classes[i];
+    c.packet_size = packet_sizes[i];
+    c.offset = slab_size + LCI_CACHE_LINE - sizeof(packet_local_context_t);
+    c.npackets = attr.npackets / nclasses;
+    if (i == nclasses - 1) c.npackets += attr.npackets % nclasses;
+    c.npackets_per_node = c.npackets;
+    if (nnodes > 1) {
+      c.npackets_per_node = (c.npackets + nnodes - 1) / nnodes;
+    }
+    c.pool.reset(new mpmc_set_t(256, 1024, nnodes));
+    size_t class_size = c.npackets * c.packet_size + LCI_CACHE_LINE;
+    slab_size += (class_size + page_size - 1) / page_size * page_size;
+  }
+  if (attr.npackets > 0 && attr.npackets_max > attr.npackets) {
+    max_nslabs = (attr.npackets_max + attr.npackets - 1) / attr.npackets;
+  }
+  slabs.reset(new slab_t[max_nslabs]);
+  for (int i = 0; i < max_nslabs; i++) {
+    slabs[i].state = slab_state_t::free;
+    slabs[i].ncollected = 0;
+  }
+  if (attr.npackets == 0) return;
+  heap_size = max_nslabs * slab_size;
+  if (max_nslabs > 1) {
+    // only the slabs in use are backed by memory
+    heap = reserve_pages(heap_size, attr.huge_page, &heap_alloc_size);
+  } else if (attr.huge_page) {
+    heap = alloc_huge_pages(heap_size, &heap_alloc_size);
+  } else {
+    heap = alloc_memalign(heap_size, page_size);
+  }
+  add_slab(0);
+}
+
+packet_pool_impl_t::~packet_pool_impl_t()
+{
+  // check whether there are any packets missing
   if (attr.npackets > 0) {
-    heap_size = attr.npackets * attr.packet_size + LCI_CACHE_LINE;
-    heap = alloc_memalign(heap_size, get_page_size());
-    base_packet_p =
-        (char*)heap + LCI_CACHE_LINE - sizeof(packet_local_context_t);
-    for (size_t i = 0; i < attr.npackets; i++) {
-      packet_t* packet =
-          (packet_t*)((char*)base_packet_p + i * attr.packet_size);
+    size_t expected = 0;
+    for (int i = 0; i < max_nslabs; i++) {
+      if (slabs[i].state != slab_state_t::free) {
+        expected += attr.npackets - slabs[i].ncollected;
+      }
+    }
+    size_t total = get_size() + npacket_lost;
+    if (total != expected) {
+      LCI_Warn("Lost %d packets\n", expected - total);
+    }
+  }
+  for (size_t i = 0; i < mrs.get_size(); i++) {
+    device_mrs_t* p_mrs = mrs.get(i);
+    if (!p_mrs) continue;
+    for (int slab = 0; slab < max_nslabs; slab++) {
+      mr_t mr;
+      mr.p_impl = p_mrs->slab_mrs[slab];
+      if (mr.p_impl) deregister_memory_x(&mr).call();
+    }
+    delete p_mrs;
+  }
+  if (heap_alloc_size > 0) {
+    free_huge_pages(heap, heap_alloc_size);
+  } else {
+    free(heap);
+  }
+}
+
+void packet_pool_impl_t::add_slab(int slab)
+{
+  void* slab_address = get_slab_address(slab);
+  size_t page_size = attr.huge_page ? get_huge_page_size() : get_page_size();
+  if (nnodes > 1) {
+    // One contiguous sub-heap per NUMA node in every class, so that the slab
+    // can still be registered as a single memory region. The pages are not
+    // touched yet, so binding them decides where they will be allocated.
+    for (int i = 0; i < nclasses; i++) {
+      const size_class_t& c = classes[i];
+      uintptr_t base = (uintptr_t)slab_address + c.offset;
+      for (int node = 0; node < nnodes; node++) {
+        size_t first = std::min(node * c.npackets_per_node, c.npackets);
+        size_t last = std::min(first + c.npackets_per_node, c.npackets);
+        if (first == last) break;
+        uintptr_t start = base + first * c.packet_size;
+        uintptr_t end = base + last * c.packet_size;
+        // A page shared by two sub-heaps goes to the earlier one, so that
+        // every page is bound exactly once. The class is page-aligned and
+        // padded to whole pages, so the rounding stays inside it.
+        if (node == 0) {
+          start = start / page_size * page_size;
+        } else {
+          start = (start + page_size - 1) / page_size * page_size;
+        }
+        end = (end + page_size - 1) / page_size * page_size;
+        if (start < end) {
+          bind_memory_to_numa_node((void*)start, end - start, node);
+        }
+      }
+    }
+  }
+  // register the slab before its packets can be used
+  for (size_t i = 0; i < mrs.get_size(); i++) {
+    device_mrs_t* p_mrs = mrs.get(i);
+    if (p_mrs) register_slab(p_mrs, slab);
+  }
+  for (int i = 0; i < nclasses; i++) {
+    const size_class_t& c = classes[i];
+    char* base = (char*)slab_address + c.offset;
+    for (size_t j = 0; j < c.npackets; j++) {
+      packet_t* packet = (packet_t*)(base + j * c.packet_size);
       LCI_DBG_Assert(
           ((uint64_t)packet->get_payload_address()) % LCI_CACHE_LINE == 0,
           "packet.data is not well-aligned %p\n",
           packet->get_payload_address());
-      LCI_DBG_Assert(is_packet(packet->get_payload_address()),
+      LCI_DBG_Assert(is_packet(packet->get_payload_address()) &&
+                         get_size_class(packet) == i &&
+                         get_slab(packet) == slab,
                      "Not a packet. The computation is wrong!\n");
-      pool.put(packet);
+      packet->local_context.isInPool = true;
+      if (nnodes > 1) {
+        c.pool->put_to_node(packet, get_numa_node(packet, i));
+      } else {
+        c.pool->put(packet);
+      }
     }
   }
+  slabs[slab].ncollected = 0;
+  slabs[slab].state = slab_state_t::active;
+  ++nslabs;
 }
 
-packet_pool_impl_t::~packet_pool_impl_t()
+void packet_pool_impl_t::release_slab(int slab)
 {
-  // check whether there are any packets missing
-  if (attr.npackets > 0) {
-    size_t total = pool.size() + npacket_lost;
-    if (total != attr.npackets) {
-      LCI_Warn("Lost %d packets\n", attr.npackets - total);
+  for (size_t i = 0; i < mrs.get_size(); i++) {
+    device_mrs_t* p_mrs = mrs.get(i);
+    if (!p_mrs) continue;
+    mr_t mr;
+    mr.p_impl = p_mrs->slab_mrs[slab].exchange(nullptr);
+    if (mr.p_impl) deregister_memory_x(&mr).call();
+  }
+  discard_pages(get_slab_address(slab), slab_size);
+  slabs[slab].state = slab_state_t::free;
+  --nretiring;
+  --nslabs;
+  LCI_PCOUNTER_ADD(packet_pool_shrink, 1);
+  LCI_Log(LOG_INFO, "packet_pool", "Returned slab %d (%d slabs left)\n", slab,
+          nslabs.load());
+}
+
+bool packet_pool_impl_t::grow(int size_class)
+{
+  last_pressure_time = LCT_now();
+  // The get might have failed to steal packets that are there
+  if (classes[size_class].pool->size() > 0) return false;
+  if (nslabs.load(std::memory_order_relaxed) -
+          nretiring.load(std::memory_order_relaxed) >=
+      max_nslabs) {
+    return false;
+  }
+  // another thread is growing the pool
+  if (!slab_lock.try_lock()) return false;
+  bool ret = false;
+  for (int slab = 1; slab < max_nslabs; slab++) {
+    if (slabs[slab].state == slab_state_t::free) {
+      add_slab(slab);
+      LCI_PCOUNTER_ADD(packet_pool_grow, 1);
+      LCI_Log(LOG_INFO, "packet_pool", "Added slab %d (%d slabs)\n", slab,
+              nslabs.load());
+      ret = true;
+      break;
     }
   }
-  for (size_t i = 0; i < mrs.get_size(); i++) {
-    mr_impl_t* p_mr = static_cast<mr_impl_t*>(mrs.get(i));
-    if (p_mr) {
-      mr_t mr;
-      mr.p_impl = p_mr;
-      deregister_memory_x(&mr).call();
+  slab_lock.unlock();
+  return ret;
+}
+
+void packet_pool_impl_t::shrink()
+{
+  if (!slab_lock.try_lock()) return;
+  // retire the newest slab if the pool has not run out of packets for a
+  // while and has a slab worth of free packets in every class
+  bool idle = nslabs - nretiring > 1 &&
+              LCT_time_to_ms(LCT_now() - last_pressure_time) >=
+                  attr.slab_cooldown;
+  for (int i = 0; idle && i < nclasses; i++) {
+    idle = classes[i].pool->size() >= classes[i].npackets;
+  }
+  if (idle) {
+    for (int slab = max_nslabs - 1; slab > 0; slab--) {
+      if (slabs[slab].state == slab_state_t::active) {
+        ++nretiring;
+        slabs[slab].state = slab_state_t::retiring;
+        break;
+      }
+    }
+  }
+  if (nretiring > 0) {
+    drain_retiring_slabs();
+    // return the slabs whose packets have all been collected
+    for (int slab = 1; slab < max_nslabs; slab++) {
+      if (slabs[slab].state == slab_state_t::retiring &&
+          slabs[slab].ncollected == attr.npackets) {
+        release_slab(slab);
+      }
+    }
+  }
+  slab_lock.unlock();
+}
+
+void packet_pool_impl_t::drain_retiring_slabs()
+{
+  // Take all free packets out of the pool, collect the ones of the retiring
+  // slabs, and put the others back. Taking them all first makes sure we do
+  // not see the same packets again.
+  std::vector<packet_t*> packets;
+  for (int i = 0; i < nclasses; i++) {
+    mpmc_set_t* pool = classes[i].pool.get();
+    packets.resize(pool->size());
+    size_t n = 0;
+    while (n < packets.size()) {
+      size_t ret = pool->get_n(packets.size() - n, (void**)&packets[n]);
+      if (ret == 0) break;
+      n += ret;
+    }
+    n = collect_retiring(packets.data(), n);
+    for (size_t j = 0; j < n; j++) {
+      pool->put(packets[j], mpmc_set_t::LOCAL_SET_ID_NULL,
+                nnodes > 1 ? get_numa_node(packets[j], i) : -1);
     }
   }
-  free(heap);
+}
+
+void packet_pool_impl_t::register_slab(device_mrs_t* p_mrs, int slab)
+{
+  if (p_mrs->slab_mrs[slab]) return;
+  mr_t mr = register_memory_x(get_slab_address(slab), slab_size)
+                .device(p_mrs->device)();
+  p_mrs->slab_mrs[slab] = mr.p_impl;
 }
 
 mr_t packet_pool_impl_t::register_packets(device_t device)
 {
   mr_t mr;
-  if (heap) {
-    mr = register_memory_x(heap, heap_size).device(device)();
-    mrs.put(device.get_attr_uid(), mr.p_impl);
+  if (!heap) return mr;
+  slab_lock.lock();
+  device_mrs_t* p_mrs = mrs.get(device.get_attr_uid());
+  if (!p_mrs) {
+    p_mrs = new device_mrs_t;
+    p_mrs->device = device;
+    p_mrs->slab_mrs.reset(new std::atomic<mr_impl_t*>[max_nslabs]);
+    for (int slab = 0; slab < max_nslabs; slab++) {
+      p_mrs->slab_mrs[slab] = nullptr;
+    }
+    mrs.put(device.get_attr_uid(), p_mrs);
   }
+  for (int slab = 0; slab < max_nslabs; slab++) {
+    if (slabs[slab].state != slab_state_t::free) register_slab(p_mrs, slab);
+  }
+  mr.p_impl = p_mrs->slab_mrs[0];
+  slab_lock.unlock();
   return mr;
 }
 
 void packet_pool_impl_t::deregister_packets(device_t device)
 {
-  mr_impl_t* p_mr = static_cast<mr_impl_t*>(mrs.get(device.get_attr_uid()));
-  if (p_mr) {
-    mr_t mr;
-    mr.p_impl = p_mr;
-    deregister_memory_x(&mr).call();
+  slab_lock.lock();
+  device_mrs_t* p_mrs = mrs.get(device.get_attr_uid());
+  if (p_mrs) {
     mrs.put(device.get_attr_uid(), nullptr);
+    for (int slab = 0; slab < max_nslabs; slab++) {
+      mr_t mr;
+      mr.p_impl = p_mrs->slab_mrs[slab];
+      if (mr.p_impl) deregister_memory_x(&mr).call();
+    }
+    delete p_mrs;
   }
+  slab_lock.unlock();
 }
 
 mr_t packet_pool_impl_t::get_or_register_mr(device_t device)
+{
+  return get_or_register_mr(device, static_cast<packet_t*>(heap));
+}
+
+mr_t packet_pool_impl_t::get_or_register_mr(device_t device, packet_t* packet)
 {
   mr_t mr;
-  void* p = mrs.get(device.get_attr_uid());
-  if (!p) {
-    mr = register_packets(device);
-  } else {
-    mr.p_impl = static_cast<mr_impl_t*>(p);
+  int slab = get_slab(packet);
+  device_mrs_t* p_mrs = mrs.get(device.get_attr_uid());
+  if (p_mrs) mr.p_impl = p_mrs->slab_mrs[slab];
+  if (!mr.p_impl) {
+    register_packets(device);
+    p_mrs = mrs.get(device.get_attr_uid());
+    if (p_mrs) mr.p_impl = p_mrs->slab_mrs[slab];
   }
   return mr;
 }
 
 packet_pool_t alloc_packet_pool_x::call_impl(size_t packet_size,
-                                             size_t npackets, const char* name,
+                                             size_t npackets,
+                                             size_t min_packet_size,
+                                             bool numa_aware, bool huge_page,
+                                             size_t npackets_max,
+                                             int slab_cooldown,
+                                             const char* name,
                                              void* user_context,
                                              runtime_t) const
 {
   packet_pool_attr_t attr;
   attr.packet_size = packet_size;
   attr.npackets = npackets;
+  attr.min_packet_size = min_packet_size;
+  attr.numa_aware = numa_aware;
+  attr.huge_page = huge_page;
+  attr.npackets_max = npackets_max;
+  attr.slab_cooldown = slab_cooldown;
   attr.name = name;
   attr.user_context = user_context;
   packet_pool_t packet_pool;
@@ -6,6 +6,20 @@
 
 namespace lci
 {
+// A packet pool has up to LCI_PACKET_MAX_SIZE_CLASSES size classes. Each class
+// has its own mpmc set of `npackets` packets; the last class has
+// `packet_size` packets and every other class is 4 times smaller than the
+// next one.
+//
+// The packets live in slabs of `npackets` packets of every class. A pool
+// starts with one slab and, if `npackets_max` allows, grows by one slab
+// whenever a class runs out. The address range of all slabs is reserved up
+// front, so the slab of a packet is a matter of arithmetic. Every slab is
+// registered to all devices the pool has been registered to. Once the pool
+// has gone `slab_cooldown` ms without running out, the newest slab retires:
+// its packets are taken out of circulation as they show up, and the slab is
+// deregistered and its memory returned once all of them have.
+
 class packet_pool_impl_t
 {
  public:
@@ -17,38 +31,157 @@ class packet_pool_impl_t
   mr_t register_packets(device_t device);
   // Deregister all packets from the device
   void deregister_packets(device_t device);
-  // Get the memory region of all packets
+  // Get the memory region of the first slab
   mr_t get_or_register_mr(device_t device);
-  // Get a packet from the pool
+  // Get the memory region of the slab of a packet
+  mr_t get_or_register_mr(device_t device, packet_t* packet);
+  // Get a packet of the largest class from the pool
   packet_t* get(bool blocking = false);
-  // Get multiple packets from the pool
-  size_t get_n(size_t n, packet_t* buf_out[], bool blocking = false);
+  // Get a packet of the smallest class whose payload fits `size`. Fall back
+  // to larger classes if it is empty.
+  packet_t* get_for_size(size_t size, bool blocking = false);
+  // Get multiple packets of a class (the largest one by default)
+  size_t get_n(size_t n, packet_t* buf_out[], bool blocking = false,
+               int size_class = -1);
   // Put a packet back to the pool
   void put(packet_t* p_packet);
   // Check if an address is a packet
   bool is_packet(void* address, bool include_lcontext = false);
-  // Get the payload size of a packet
-  size_t get_payload_size() const
+  // Get the size class of a packet
+  int get_size_class(packet_t* packet) const
+  {
+    size_t offset = get_slab_offset(packet);
+    for (int i = 0; i < nclasses - 1; i++) {
+      if (offset < classes[i + 1].offset) return i;
+    }
+    return nclasses - 1;
+  }
+  // Get the smallest size class whose payload fits `size`, or -1
+  int get_size_class_for(size_t size) const
+  {
+    for (int i = 0; i < nclasses; i++) {
+      if (size <= get_payload_size(i)) return i;
+    }
+    return -1;
+  }
+  // Get the NUMA node whose sub-heap a packet is in
+  int get_numa_node(packet_t* packet, int size_class) const
+  {
+    const size_class_t& c = classes[size_class];
+    size_t idx = (get_slab_offset(packet) - c.offset) / c.packet_size;
+    return idx / c.npackets_per_node;
+  }
+  // Get the payload size of a packet of a class (the largest one by default)
+  size_t get_payload_size(int size_class = -1) const
   {
     static_assert(
         sizeof(packet_local_context_t) <= LCI_CACHE_LINE,
         "The packet local context should be smaller than a cache line");
-    return attr.packet_size - LCI_CACHE_LINE;
+    if (size_class < 0) size_class = nclasses - 1;
+    return classes[size_class].packet_size - LCI_CACHE_LINE;
+  }
+  size_t get_payload_size(packet_t* packet) const
+  {
+    return get_payload_size(get_size_class(packet));
   }
-  size_t get_size() const { return pool.size(); }
-  int get_local_id() const { return pool.get_local_set_id(); }
+  int get_nclasses() const { return nclasses; }
+  // Get the number of packets a slab has in a class (the largest by default)
+  size_t get_npackets(int size_class = -1) const
+  {
+    if (size_class < 0) size_class = nclasses - 1;
+    return classes[size_class].npackets;
+  }
+  size_t get_size() const
+  {
+    size_t total = 0;
+    for (int i = 0; i < nclasses; i++) total += classes[i].pool->size();
+    return total;
+  }
+  int get_local_id() const { return classes[0].pool->get_local_set_id(); }
+  // Get the number of slabs in use, including the retiring ones
+  int get_nslabs() const { return nslabs.load(std::memory_order_relaxed); }
+  // Return the slabs that are no longer needed. Called regularly by the
+  // progress engine.
+  void maybe_shrink();
   // Report lost packets
   void report_lost_packets(int npackets) { npacket_lost += npackets; }
 
   attr_t attr;
 
  private:
-  mpmc_set_t pool;
+  struct size_class_t {
+    size_t packet_size;
+    // the offset of the local context of the first packet in a slab
+    size_t offset;
+    // the packets of the class in a slab
+    size_t npackets;
+    size_t npackets_per_node;
+    std::unique_ptr<mpmc_set_t> pool;
+  };
+  enum class slab_state_t {
+    free,
+    active,
+    retiring,
+  };
+  struct slab_t {
+    std::atomic<slab_state_t> state;
+    // the packets taken out of circulation since the slab started retiring
+    std::atomic<size_t> ncollected;
+  };
+  // the memory regions of the slabs on a device
+  struct device_mrs_t {
+    device_t device;
+    std::unique_ptr<std::atomic<mr_impl_t*>[]> slab_mrs;
+  };
+  // the number of NUMA sub-heaps of every class
+  int nnodes;
+  int nclasses;
+  size_class_t classes[LCI_PACKET_MAX_SIZE_CLASSES];
   void* heap;
-  void* base_packet_p;
+  // the size reserved for all slabs
   size_t heap_size;
-  mpmc_array_t<mr_impl_t*> mrs;
+  // the size of the mapping, or 0 if the heap is from malloc
+  size_t heap_alloc_size;
+  size_t slab_size;
+  int max_nslabs;
+  std::unique_ptr<slab_t[]> slabs;
+  std::atomic<int> nslabs;
+  std::atomic<int> nretiring;
+  // when the pool last ran out of packets
+  std::atomic<LCT_time_t> last_pressure_time;
+  // serialize growing, retiring and (de)registering the slabs
+  spinlock_t slab_lock;
+  mpmc_array_t<device_mrs_t*> mrs;
   std::atomic<size_t> npacket_lost;
+
+  size_t get_slab_offset(void* packet) const
+  {
+    size_t offset = (uintptr_t)packet - (uintptr_t)heap;
+    if (offset >= slab_size) offset %= slab_size;
+    return offset;
+  }
+  int get_slab(void* packet) const
+  {
+    if (max_nslabs == 1) return 0;
+    return ((uintptr_t)packet - (uintptr_t)heap) / slab_size;
+  }
+  void* get_slab_address(int slab) const
+  {
+    return (char*)heap + slab * slab_size;
+  }
+  // Add a slab when a class runs out. Return false if the pool cannot grow
+  // right now.
+  bool grow(int size_class);
+  void shrink();
+  // The following functions need the slab lock.
+  void add_slab(int slab);
+  void release_slab(int slab);
+  void register_slab(device_mrs_t* p_mrs, int slab);
+  // Take the free packets of the retiring slabs out of the pool
+  void drain_retiring_slabs();
+  // Take the packets of the retiring slabs out of an array of packets.
+  // Return the number of packets left.
+  size_t collect_retiring(packet_t* packets[], size_t n);
 };
 
 inline packet_t* packet_pool_impl_t::get(bool blocking)
@@ -58,15 +191,38 @@ inline packet_t* packet_pool_impl_t::get(bool blocking)
   return packet;
 }
 
+inline packet_t* packet_pool_impl_t::get_for_size(size_t size, bool blocking)
+{
+  packet_t* packet = nullptr;
+  int size_class = get_size_class_for(size);
+  LCI_DBG_Assert(size_class >= 0, "No packet fits %lu bytes\n", size);
+  for (; size_class < nclasses - 1; size_class++) {
+    if (get_n(1, &packet, false, size_class)) return packet;
+  }
+  get_n(1, &packet, blocking, nclasses - 1);
+  return packet;
+}
+
 inline size_t packet_pool_impl_t::get_n(size_t n, packet_t* buf_out[],
-                                        bool blocking)
+                                        bool blocking, int size_class)
 {
-  int nattempts = 1;
-  if (blocking) {
+  if (size_class < 0) size_class = nclasses - 1;
+  mpmc_set_t* pool = classes[size_class].pool.get();
+  size_t n_popped = pool->get_n(n, (void**)buf_out);
+  if (n_popped == 0 && max_nslabs > 1 && grow(size_class)) {
+    n_popped = pool->get_n(n, (void**)buf_out);
+  }
+  if (n_popped == 0 && blocking) {
     // Should only take a few seconds
-    nattempts = 1000000;
+    n_popped = pool->get_n(n, (void**)buf_out, 1000000);
+  }
+  if (n_popped > 0 && nretiring.load(std::memory_order_relaxed) > 0) {
+    n_popped = collect_retiring(buf_out, n_popped);
+    if (n_popped == 0 && blocking) {
+      // a retiring slab only has so many packets
+      return get_n(n, buf_out, blocking, size_class);
+    }
   }
-  size_t n_popped = pool.get_n(n, (void**)buf_out, nattempts);
   LCI_Assert(n_popped || !blocking,
              "Failed to get a packet in a blocking get! We are likely run "
              "out of packets\n");
@@ -95,7 +251,14 @@ inline void packet_pool_impl_t::put(packet_t* p_packet)
   LCI_Assert(!packet->local_context.isInPool,
              "This packet has already been freed!\n");
   packet->local_context.isInPool = true;
-  pool.put(packet, packet->local_context.local_id);
+  if (nretiring.load(std::memory_order_relaxed) > 0 &&
+      collect_retiring(&packet, 1) == 0) {
+    return;
+  }
+  int size_class = get_size_class(packet);
+  classes[size_class].pool->put(
+      packet, packet->local_context.local_id,
+      nnodes > 1 ? get_numa_node(packet, size_class) : -1);
   LCI_PCOUNTER_ADD(packet_put, 1);
 }
 
@@ -110,10 +273,40 @@ inline bool packet_pool_impl_t::is_packet(void* address, bool include_lcontext)
   } else {
     packet_address = address;
   }
-  uintptr_t offset = (uintptr_t)packet_address - (uintptr_t)base_packet_p;
-  return (uintptr_t)packet_address >= (uintptr_t)base_packet_p &&
-         offset % attr.packet_size == 0 &&
-         offset / attr.packet_size < attr.npackets;
+  // most addresses are not in the heap at all
+  if ((uintptr_t)packet_address < (uintptr_t)heap ||
+      (uintptr_t)packet_address >= (uintptr_t)heap + heap_size)
+    return false;
+  size_t slab_offset = get_slab_offset(packet_address);
+  const size_class_t& c = classes[get_size_class((packet_t*)packet_address)];
+  size_t offset = slab_offset - c.offset;
+  return slab_offset >= c.offset && offset % c.packet_size == 0 &&
+         offset / c.packet_size < c.npackets;
+}
+
+inline size_t packet_pool_impl_t::collect_retiring(packet_t* packets[],
+                                                   size_t n)
+{
+  size_t nleft = 0;
+  for (size_t i = 0; i < n; i++) {
+    slab_t& slab = slabs[get_slab(packets[i])];
+    if (slab.state.load(std::memory_order_relaxed) ==
+        slab_state_t::retiring) {
+      ++slab.ncollected;
+    } else {
+      packets[nleft++] = packets[i];
+    }
+  }
+  return nleft;
+}
+
+inline void packet_pool_impl_t::maybe_shrink()
+{
+  if (nslabs.load(std::memory_order_relaxed) <= 1) return;
+  // only check once in a while
+  static thread_local int ncalls = 0;
+  if (++ncalls % 1024 != 0) return;
+  shrink();
 }
 
 }  // namespace lci
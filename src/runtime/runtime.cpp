@@ -3,6 +3,9 @@
 
 #include "lci_internal.hpp"
 
+#include <fstream>
+#include <sstream>
+
 namespace lci
 {
 /*************************************************************
@@ -11,7 +14,10 @@ namespace lci
 
 runtime_t alloc_runtime_x::call_impl(
     size_t packet_return_threshold, int imm_nbits_tag, int imm_nbits_rcomp,
-    attr_rdv_protocol_t rdv_protocol, bool alloc_default_device,
+    attr_rdv_protocol_t rdv_protocol, size_t rdv_read_threshold,
+    bool rdv_pipeline, size_t rdv_pipeline_chunk_size,
+    size_t inject_threshold, size_t eager_threshold, size_t zcopy_threshold,
+    std::string tuning_profile, bool alloc_default_device,
     bool alloc_default_packet_pool, bool alloc_default_matching_engine,
     const char* name, void* user_context, std::string device_name) const
 {
@@ -20,6 +26,13 @@ runtime_t alloc_runtime_x::call_impl(
   attr.imm_nbits_tag = imm_nbits_tag;
   attr.imm_nbits_rcomp = imm_nbits_rcomp;
   attr.rdv_protocol = rdv_protocol;
+  attr.rdv_read_threshold = rdv_read_threshold;
+  attr.rdv_pipeline = rdv_pipeline;
+  attr.rdv_pipeline_chunk_size = rdv_pipeline_chunk_size;
+  attr.inject_threshold = inject_threshold;
+  attr.eager_threshold = eager_threshold;
+  attr.zcopy_threshold = zcopy_threshold;
+  attr.tuning_profile = tuning_profile;
   attr.alloc_default_device = alloc_default_device;
   attr.alloc_default_packet_pool = alloc_default_packet_pool;
   attr.alloc_default_matching_engine = alloc_default_matching_engine;
@@ -27,6 +40,8 @@ runtime_t alloc_runtime_x::call_impl(
   attr.user_context = user_context;
   LCI_Assert(attr.imm_nbits_tag + attr.imm_nbits_rcomp <= 31,
              "imm_nbits_tag + imm_nbits_rcomp should be less than 31!\n");
+  LCI_Assert(attr.rdv_pipeline_chunk_size > 0,
+             "rdv_pipeline_chunk_size should be positive!\n");
   runtime_t runtime;
   runtime.p_impl = new runtime_impl_t(attr);
   runtime.get_impl()->default_net_context_device_name = device_name;
@@ -42,7 +57,10 @@ void free_runtime_x::call_impl(runtime_t* runtime) const
 
 runtime_t g_runtime_init_x::call_impl(
     size_t packet_return_threshold, int imm_nbits_tag, int imm_nbits_rcomp,
-    attr_rdv_protocol_t rdv_protocol, bool alloc_default_device,
+    attr_rdv_protocol_t rdv_protocol, size_t rdv_read_threshold,
+    bool rdv_pipeline, size_t rdv_pipeline_chunk_size,
+    size_t inject_threshold, size_t eager_threshold, size_t zcopy_threshold,
+    std::string tuning_profile, bool alloc_default_device,
     bool alloc_default_packet_pool, bool alloc_default_matching_engine,
     const char* name, void* user_context, std::string device_name) const
 {
@@ -51,6 +69,13 @@ runtime_t g_runtime_init_x::call_impl(
   attr.imm_nbits_tag = imm_nbits_tag;
   attr.imm_nbits_rcomp = imm_nbits_rcomp;
   attr.rdv_protocol = rdv_protocol;
+  attr.rdv_read_threshold = rdv_read_threshold;
+  attr.rdv_pipeline = rdv_pipeline;
+  attr.rdv_pipeline_chunk_size = rdv_pipeline_chunk_size;
+  attr.inject_threshold = inject_threshold;
+  attr.eager_threshold = eager_threshold;
+  attr.zcopy_threshold = zcopy_threshold;
+  attr.tuning_profile = tuning_profile;
   attr.alloc_default_device = alloc_default_device;
   attr.alloc_default_packet_pool = alloc_default_packet_pool;
   attr.alloc_default_matching_engine = alloc_default_matching_engine;
@@ -64,6 +89,8 @@ runtime_t g_runtime_init_x::call_impl(
   }
   LCI_Assert(attr.imm_nbits_tag + attr.imm_nbits_rcomp <= 31,
              "imm_nbits_tag + imm_nbits_rcomp should be less than 31!\n");
+  LCI_Assert(attr.rdv_pipeline_chunk_size > 0,
+             "rdv_pipeline_chunk_size should be positive!\n");
   g_default_runtime.p_impl = new runtime_impl_t(attr);
   g_default_runtime.get_impl()->default_net_context_device_name = device_name;
   g_default_runtime.get_impl()->initialize();
@@ -81,6 +108,48 @@ runtime_t get_g_runtime_x::call_impl() const { return g_default_runtime; }
 /*************************************************************
  * runtime implementation
  *************************************************************/
+namespace
+{
+// A tuning profile has one `key = value` line per threshold. `#` starts a
+// comment.
+void load_tuning_profile(const std::string& path, runtime_t::attr_t* attr)
+{
+  std::ifstream file(path);
+  if (!file) {
+    LCI_Warn("Cannot open the tuning profile %s\n", path.c_str());
+    return;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream iss(line);
+    std::string key, eq;
+    unsigned long long value;
+    if (!(iss >> key)) continue;
+    if (!(iss >> eq >> value) || eq != "=") {
+      LCI_Warn("Ignore the malformed line \"%s\" in the tuning profile %s\n",
+               line.c_str(), path.c_str());
+      continue;
+    }
+    if (key == "inject_threshold") {
+      attr->inject_threshold = value;
+    } else if (key == "eager_threshold") {
+      attr->eager_threshold = value;
+    } else if (key == "zcopy_threshold") {
+      attr->zcopy_threshold = value;
+    } else if (key == "rdv_read_threshold") {
+      attr->rdv_read_threshold = value;
+    } else {
+      LCI_Warn("Ignore the unknown key %s in the tuning profile %s\n",
+               key.c_str(), path.c_str());
+      continue;
+    }
+    LCI_Log(LOG_INFO, "runtime", "tuning profile: set %s to be %llu\n",
+            key.c_str(), value);
+  }
+}
+}  // namespace
+
 runtime_impl_t::runtime_impl_t(attr_t attr_) : attr(attr_), rdv_imm_archive(16)
 {
   runtime.p_impl = this;
@@ -88,24 +157,29 @@ runtime_impl_t::runtime_impl_t(attr_t attr_) : attr(attr_), rdv_imm_archive(16)
 
 void runtime_impl_t::initialize()
 {
+  if (!attr.tuning_profile.empty()) {
+    load_tuning_profile(attr.tuning_profile, &attr);
+  }
   attr.max_imm_tag = (1ULL << attr.imm_nbits_tag) - 1;
   attr.max_imm_rcomp = (1ULL << attr.imm_nbits_rcomp) - 1;
-  // We can support up to 32-bit tag for now.
-  // TODO: technically we can support up to 64-bit tag, but we need to change
-  // the matching engine key format.
-  attr.max_tag = std::numeric_limits<uint32_t>::max();
+  // Tags larger than 32 bits go through the wide keys of the matching engine.
+  // The largest tag is reserved for ANY_TAG.
+  attr.max_tag = ANY_TAG - 1;
   attr.max_rcomp = std::numeric_limits<rcomp_t>::max();
   default_net_context = alloc_net_context_x().runtime(runtime).device_name(
       default_net_context_device_name)();
-  if (attr.rdv_protocol == attr_rdv_protocol_t::auto_select) {
+  if (attr.rdv_protocol == attr_rdv_protocol_t::write ||
+      attr.rdv_protocol == attr_rdv_protocol_t::writeimm) {
+    rdv_write_protocol = attr.rdv_protocol;
+  } else {
     bool support_putimm = true;
     if (!default_net_context.is_empty()) {
       support_putimm = default_net_context.get_attr_support_putimm();
     }
-    attr.rdv_protocol = support_putimm ? attr_rdv_protocol_t::writeimm
-                                       : attr_rdv_protocol_t::write;
+    rdv_write_protocol = support_putimm ? attr_rdv_protocol_t::writeimm
+                                        : attr_rdv_protocol_t::write;
     LCI_Log(LOG_INFO, "runtime",
-            "RDV protocol auto-selected to %s (support_putimm=%d)\n",
+            "RDV write protocol auto-selected to %s (support_putimm=%d)\n",
             support_putimm ? "writeimm" : "write",
             static_cast<int>(support_putimm));
   }
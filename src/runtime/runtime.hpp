@@ -29,6 +29,9 @@ class runtime_impl_t
   matching_engine_t default_matching_engine;
   matching_engine_t default_coll_matching_engine;
   imm_tag_archive_t rdv_imm_archive;
+  // The protocol (write or writeimm) used by rendezvous messages that do not
+  // go through the read protocol.
+  attr_rdv_protocol_t rdv_write_protocol = attr_rdv_protocol_t::write;
   allocator_base_t* allocator = &g_allocator_default;
 };
 }  // namespace lci
@@ -249,7 +249,7 @@ std::unique_ptr<posix_owner_mapping_t> posix_owner_mapping_t::create(
     const std::string& name, int owner_global_rank, uint64_t device_uid,
     size_t slot_count, size_t slot_size, size_t max_message_size,
     size_t producer_cas_attempts, size_t consumer_cas_attempts,
-    std::string* error)
+    std::string* error, bool huge_page)
 {
   if (error != nullptr) error->clear();
   if (name.size() >= posix_ring_name_capacity ||
@@ -287,6 +287,9 @@ std::unique_ptr<posix_owner_mapping_t> posix_owner_mapping_t::create(
                   PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
     if (region == MAP_FAILED) set_errno_error(error, "mmap(owner)");
   }
+  // before ring_t::initialize touches the pages
+  if (region != MAP_FAILED && huge_page)
+    advise_huge_pages(region, static_cast<size_t>(handle.mapping_size));
   const int close_result = close(fd);
   if (region == MAP_FAILED) {
     shm_unlink(handle.name);
@@ -347,7 +350,7 @@ posix_peer_mapping_t::posix_peer_mapping_t(void* region, size_t region_size,
 std::unique_ptr<posix_peer_mapping_t> posix_peer_mapping_t::attach(
     const posix_ring_handle_t& handle, const posix_ring_expected_t& expected,
     size_t producer_cas_attempts, size_t consumer_cas_attempts,
-    std::string* error)
+    std::string* error, bool huge_page)
 {
   if (error != nullptr) error->clear();
   if (!validate_posix_ring_handle(handle, expected, error)) {
@@ -380,6 +383,8 @@ std::unique_ptr<posix_peer_mapping_t> posix_peer_mapping_t::attach(
     close(fd);
     return nullptr;
   }
+  if (huge_page)
+    advise_huge_pages(region, static_cast<size_t>(handle.mapping_size));
   if (close(fd) != 0) {
     set_errno_error(error, "close(peer fd)");
     munmap(region, static_cast<size_t>(handle.mapping_size));
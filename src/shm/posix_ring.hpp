@@ -63,6 +63,9 @@ std::string make_posix_ring_name(const std::array<uint64_t, 2>& job_nonce,
 
 // Owns the receiver's inbound mapping and its still-linked POSIX object name.
 // Destruction unlinks the name if unlink_name() was not already called.
+// With huge_page, both the owner and the peers advise the kernel to back their
+// mappings with transparent huge pages (shmem_enabled=advise); it is only a
+// hint and the geometry is unchanged.
 class posix_owner_mapping_t
 {
  public:
@@ -70,7 +73,7 @@ class posix_owner_mapping_t
       const std::string& name, int owner_global_rank, uint64_t device_uid,
       size_t slot_count, size_t slot_size, size_t max_message_size,
       size_t producer_cas_attempts, size_t consumer_cas_attempts,
-      std::string* error);
+      std::string* error, bool huge_page = false);
 
   ~posix_owner_mapping_t();
   posix_owner_mapping_t(const posix_owner_mapping_t&) = delete;
@@ -103,7 +106,7 @@ class posix_peer_mapping_t
   static std::unique_ptr<posix_peer_mapping_t> attach(
       const posix_ring_handle_t& handle, const posix_ring_expected_t& expected,
       size_t producer_cas_attempts, size_t consumer_cas_attempts,
-      std::string* error);
+      std::string* error, bool huge_page = false);
 
   ~posix_peer_mapping_t();
   posix_peer_mapping_t(const posix_peer_mapping_t&) = delete;
@@ -259,7 +259,7 @@ void free_context(context_t* context)
 device_t alloc_device(context_t context, lci::device_t core_device, bool enable,
                       size_t ring_size, size_t slot_size,
                       size_t producer_cas_attempts,
-                      size_t consumer_cas_attempts)
+                      size_t consumer_cas_attempts, bool huge_page)
 {
   device_t device;
   device.p_impl = new device_impl_t;
@@ -332,7 +332,8 @@ device_t alloc_device(context_t context, lci::device_t core_device, bool enable,
         make_object_name(context_impl, device_uid, global_rank);
     device.p_impl->owner = posix_owner_mapping_t::create(
         owner_name, global_rank, device_uid, slot_count, slot_size,
-        effective_max, producer_cas_attempts, consumer_cas_attempts, &error);
+        effective_max, producer_cas_attempts, consumer_cas_attempts, &error,
+        huge_page);
     if (!device.p_impl->owner) {
       local_init_ok = false;
     }
@@ -357,7 +358,8 @@ device_t alloc_device(context_t context, lci::device_t core_device, bool enable,
     error.clear();
     auto peer = posix_peer_mapping_t::attach(recv_handles[peer_rank], expected,
                                              producer_cas_attempts,
-                                             consumer_cas_attempts, &error);
+                                             consumer_cas_attempts, &error,
+                                             huge_page);
     if (!peer) {
       local_init_ok = false;
       break;
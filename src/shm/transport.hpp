@@ -63,7 +63,7 @@ void free_context(context_t* context);
 device_t alloc_device(context_t context, lci::device_t core_device, bool enable,
                       size_t ring_size, size_t slot_size,
                       size_t producer_cas_attempts,
-                      size_t consumer_cas_attempts);
+                      size_t consumer_cas_attempts, bool huge_page = false);
 void free_device(device_t* device);
 
 bool is_enabled(device_t device);
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#include "lci_internal.hpp"
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <climits>
+#include <ctime>
+#else
+#include <thread>
+#endif
+
+namespace lci
+{
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "A futex has to be a plain 32-bit integer");
+
+void futex_wait(std::atomic<uint32_t>* address, uint32_t expected,
+                int timeout_ms)
+{
+#ifdef __linux__
+  struct timespec timeout;
+  struct timespec* p_timeout = nullptr;
+  if (timeout_ms >= 0) {
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_nsec = (timeout_ms % 1000) * 1000000L;
+    p_timeout = &timeout;
+  }
+  // EAGAIN (the value has changed), EINTR and ETIMEDOUT are all fine
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(address), FUTEX_WAIT_PRIVATE,
+          expected, p_timeout, nullptr, 0);
+#else
+  (void)timeout_ms;
+  if (address->load(std::memory_order_acquire) == expected)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#endif
+}
+
+void futex_wake(std::atomic<uint32_t>* address)
+{
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(address), FUTEX_WAKE_PRIVATE,
+          INT_MAX, nullptr, nullptr, 0);
+#else
+  (void)address;
+#endif
+}
+}  // namespace lci
@@ -0,0 +1,18 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_UTIL_FUTEX_HPP
+#define LCI_UTIL_FUTEX_HPP
+
+namespace lci
+{
+// Sleep while *address equals expected, until woken up by futex_wake or for
+// at most timeout_ms milliseconds (forever if negative). Spurious wake-ups
+// are possible. Without futexes (non-Linux), just sleep for a millisecond.
+void futex_wait(std::atomic<uint32_t>* address, uint32_t expected,
+                int timeout_ms = -1);
+// Wake up all threads sleeping on an address.
+void futex_wake(std::atomic<uint32_t>* address);
+}  // namespace lci
+
+#endif  // LCI_UTIL_FUTEX_HPP
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#include "lci_internal.hpp"
+#include <sys/mman.h>
+
+namespace lci
+{
+size_t get_huge_page_size()
+{
+  static size_t huge_page_size = []() {
+    size_t size = 2 * 1024 * 1024;
+    FILE* file = fopen("/proc/meminfo", "r");
+    if (file) {
+      char line[128];
+      size_t kb;
+      while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "Hugepagesize: %lu kB", &kb) == 1) {
+          size = kb * 1024;
+          break;
+        }
+      }
+      fclose(file);
+    }
+    return size;
+  }();
+  return huge_page_size;
+}
+
+bool advise_huge_pages(void* address, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+  if (madvise(address, size, MADV_HUGEPAGE) == 0) return true;
+  LCI_Log(LOG_INFO, "memory", "madvise(%p, %lu, MADV_HUGEPAGE) failed: %s\n",
+          address, size, strerror(errno));
+#else
+  (void)address;
+  (void)size;
+#endif
+  return false;
+}
+
+namespace
+{
+// mmap a region aligned to `alignment` by over-allocating and trimming
+void* map_aligned(size_t size, size_t alignment, int flags)
+{
+  void* address = mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  LCI_Assert(address != MAP_FAILED, "mmap(%lu) failed: %s\n",
+             size + alignment, strerror(errno));
+  uintptr_t start = (uintptr_t)address;
+  uintptr_t aligned_start = (start + alignment - 1) / alignment * alignment;
+  if (aligned_start > start) munmap(address, aligned_start - start);
+  uintptr_t end = start + size + alignment;
+  if (end > aligned_start + size)
+    munmap((void*)(aligned_start + size), end - aligned_start - size);
+  return (void*)aligned_start;
+}
+}  // namespace
+
+void* alloc_huge_pages(size_t size, size_t* alloc_size)
+{
+  const size_t huge_page_size = get_huge_page_size();
+  size = (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+  *alloc_size = size;
+  void* address;
+#ifdef MAP_HUGETLB
+  address = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (address != MAP_FAILED) {
+    LCI_Log(LOG_INFO, "memory", "Allocated %lu bytes of explicit huge pages\n",
+            size);
+    return address;
+  }
+  LCI_Log(LOG_INFO, "memory", "mmap(MAP_HUGETLB, %lu) failed: %s\n", size,
+          strerror(errno));
+#endif
+  address = map_aligned(size, huge_page_size, 0);
+  advise_huge_pages(address, size);
+  return address;
+}
+
+void* reserve_pages(size_t size, bool huge_page, size_t* alloc_size)
+{
+  const size_t page_size = huge_page ? get_huge_page_size() : get_page_size();
+  size = (size + page_size - 1) / page_size * page_size;
+  *alloc_size = size;
+  void* address = map_aligned(size, page_size, MAP_NORESERVE);
+  if (huge_page) advise_huge_pages(address, size);
+  return address;
+}
+
+void discard_pages(void* address, size_t size)
+{
+  if (madvise(address, size, MADV_DONTNEED) != 0) {
+    LCI_Log(LOG_INFO, "memory", "madvise(%p, %lu, MADV_DONTNEED) failed: %s\n",
+            address, size, strerror(errno));
+  }
+}
+
+void free_huge_pages(void* address, size_t alloc_size)
+{
+  [[maybe_unused]] int ret = munmap(address, alloc_size);
+  LCI_Assert(ret == 0, "munmap(%p, %lu) failed: %s\n", address, alloc_size,
+             strerror(errno));
+}
+}  // namespace lci
@@ -0,0 +1,29 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_UTIL_HUGE_PAGE_HPP
+#define LCI_UTIL_HUGE_PAGE_HPP
+
+namespace lci
+{
+// The default huge page size of the system (2 MB if unknown).
+size_t get_huge_page_size();
+// Allocate memory aligned to the huge page size, backed by explicit huge
+// pages (MAP_HUGETLB) if any are reserved, otherwise by transparent huge pages
+// (MADV_HUGEPAGE) if the kernel allows, otherwise by ordinary pages.
+// The allocated size is rounded up to the huge page size and returned in
+// alloc_size. Free the memory with free_huge_pages.
+void* alloc_huge_pages(size_t size, size_t* alloc_size);
+void free_huge_pages(void* address, size_t alloc_size);
+// Ask the kernel to back an existing mapping with transparent huge pages.
+bool advise_huge_pages(void* address, size_t size);
+// Map memory without reserving it: pages are only allocated when touched.
+// The mapping is aligned to the huge page size and backed by transparent huge
+// pages if huge_page is set. Free the memory with free_huge_pages.
+void* reserve_pages(size_t size, bool huge_page, size_t* alloc_size);
+// Give the pages of a range back to the kernel. The range stays mapped and
+// reads as zeros afterwards.
+void discard_pages(void* address, size_t size);
+}  // namespace lci
+
+#endif  // LCI_UTIL_HUGE_PAGE_HPP
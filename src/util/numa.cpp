@@ -0,0 +1,90 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#include "lci_internal.hpp"
+#include <sched.h>
+#include <sys/syscall.h>
+
+namespace lci
+{
+namespace
+{
+struct numa_topology_t {
+  int nnodes;
+  // the NUMA node of every CPU
+  std::vector<int> cpu_to_node;
+
+  numa_topology_t() : nnodes(0)
+  {
+    for (;; ++nnodes) {
+      char path[64];
+      snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+               nnodes);
+      FILE* file = fopen(path, "r");
+      if (!file) break;
+      // the list looks like "0-3,8-11"
+      int first, last;
+      while (fscanf(file, "%d", &first) == 1) {
+        last = first;
+        int c = fgetc(file);
+        if (c == '-') {
+          if (fscanf(file, "%d", &last) != 1) break;
+          c = fgetc(file);
+        }
+        if (static_cast<int>(cpu_to_node.size()) <= last)
+          cpu_to_node.resize(last + 1, 0);
+        for (int cpu = first; cpu <= last; ++cpu) cpu_to_node[cpu] = nnodes;
+        if (c != ',') break;
+      }
+      fclose(file);
+    }
+    if (nnodes == 0) nnodes = 1;
+  }
+};
+
+const numa_topology_t& get_numa_topology()
+{
+  static numa_topology_t topology;
+  return topology;
+}
+}  // namespace
+
+int get_numa_node_count() { return get_numa_topology().nnodes; }
+
+int get_current_numa_node()
+{
+  const numa_topology_t& topology = get_numa_topology();
+  if (topology.nnodes == 1) return 0;
+  int cpu = sched_getcpu();
+  if (cpu < 0 || cpu >= static_cast<int>(topology.cpu_to_node.size()))
+    return 0;
+  return topology.cpu_to_node[cpu];
+}
+
+bool bind_memory_to_numa_node(void* address, size_t size, int node)
+{
+#ifdef SYS_mbind
+  // from linux/mempolicy.h; we do not depend on libnuma
+  const int mpol_preferred = 1;
+  const unsigned mpol_mf_move = 1 << 1;
+  const int nbits = sizeof(unsigned long) * 8;
+  unsigned long nodemask[1024 / nbits] = {};
+  if (node < 0 || node >= 1024) return false;
+  nodemask[node / nbits] = 1UL << (node % nbits);
+  // the kernel reads maxnode - 1 bits
+  long ret = syscall(SYS_mbind, address, size, mpol_preferred, nodemask,
+                     sizeof(nodemask) * 8 + 1, mpol_mf_move);
+  if (ret != 0) {
+    LCI_Log(LOG_INFO, "numa", "mbind(%p, %lu, node %d) failed: %s\n",
+            address, size, node, strerror(errno));
+    return false;
+  }
+  return true;
+#else
+  (void)address;
+  (void)size;
+  (void)node;
+  return false;
+#endif
+}
+}  // namespace lci
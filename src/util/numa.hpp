@@ -0,0 +1,18 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+#ifndef LCI_UTIL_NUMA_HPP
+#define LCI_UTIL_NUMA_HPP
+
+namespace lci
+{
+// The NUMA topology is read from sysfs. Without it, we assume a single node.
+int get_numa_node_count();
+// The NUMA node of the CPU the calling thread is running on.
+int get_current_numa_node();
+// Ask the kernel to place the pages of a page-aligned memory range on a NUMA
+// node. Return false if it does not support memory policies.
+bool bind_memory_to_numa_node(void* address, size_t size, int node);
+}  // namespace lci
+
+#endif  // LCI_UTIL_NUMA_HPP
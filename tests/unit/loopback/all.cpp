@@ -6,6 +6,7 @@
 #include <vector>
 #include <random>
 #include <iterator>
+#include <fstream>
 #include "lci.hpp"
 #include "lci_internal.hpp"
 #include "util.hpp"
@@ -33,6 +34,11 @@
 #include "test_matching_policy.hpp"
 #include "test_rdv_protocol.hpp"
 #include "test_reg_cache.hpp"
+#include "test_iovec.hpp"
+#include "test_datatype.hpp"
+#include "test_atomic.hpp"
+#include "test_persistent.hpp"
+#include "test_batch.hpp"
 
 int main(int argc, char** argv)
 {
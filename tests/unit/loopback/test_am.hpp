@@ -92,4 +92,75 @@ TEST(COMM_AM, am)
   lci::g_runtime_fina();
 }
 
+void test_am_aggregation_worker_fn(int thread_id, int nmsgs, size_t msg_size,
+                                   lci::endpoint_t endpoint, bool flush)
+{
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = thread_id;
+
+  lci::comp_t rcq = lci::alloc_cq();
+  lci::rcomp_t rcomp = lci::register_rcomp(rcq);
+
+  std::vector<char> send_buffer(msg_size + 1);
+  util::write_buffer(send_buffer.data(), msg_size, 'a');
+
+  // post all messages first so that they can be aggregated
+  for (int i = 0; i < nmsgs; i++) {
+    lci::status_t status;
+    KEEP_RETRY(status, lci::post_am_x(rank, send_buffer.data(), msg_size,
+                                      lci::COMP_NULL_RETRY, rcomp)
+                           .endpoint(endpoint)
+                           .tag(tag)());
+    ASSERT_TRUE(status.is_done());
+  }
+  if (flush) {
+    lci::flush_x().endpoint(endpoint)();
+  }
+  // otherwise, the progress engine flushes the messages once idle
+  for (int i = 0; i < nmsgs; i++) {
+    lci::status_t status;
+    do {
+      lci::progress();
+      status = lci::cq_pop(rcq);
+    } while (status.is_retry());
+    ASSERT_EQ(status.tag, tag);
+    ASSERT_EQ(status.size, msg_size);
+    util::check_buffer(status.buffer, msg_size, 'a');
+    free(status.buffer);
+  }
+
+  lci::deregister_rcomp(rcomp);
+  lci::free_comp(&rcq);
+}
+
+TEST(COMM_AM, am_aggregation)
+{
+  lci::g_runtime_init();
+  lci::endpoint_t endpoint =
+      lci::alloc_endpoint_x().am_aggregation_threshold(128)();
+
+  const int nmsgs_total = util::NITERS_SMALL;
+  std::vector<size_t> msg_sizes = {0, 16, 128, 129};
+  std::vector<int> nthreads = {1, util::NTHREADS};
+  for (auto& nthread : nthreads) {
+    for (auto& msg_size : msg_sizes) {
+      int nmsgs = nmsgs_total / nthread;
+      util::spawn_threads(nthread, test_am_aggregation_worker_fn, nmsgs,
+                          msg_size, endpoint, true);
+      util::spawn_threads(nthread, test_am_aggregation_worker_fn, nmsgs,
+                          msg_size, endpoint, false);
+    }
+  }
+
+  lci::free_endpoint(&endpoint);
+
+  // the device forwards the threshold to its default endpoint
+  lci::device_t device = lci::alloc_device_x().am_aggregation_threshold(128)();
+  lci::endpoint_t default_endpoint =
+      lci::get_default_endpoint_x().device(device)();
+  ASSERT_EQ(default_endpoint.get_attr_am_aggregation_threshold(), 128u);
+  lci::free_device(&device);
+  lci::g_runtime_fina();
+}
+
 }  // namespace test_comm_am
\ No newline at end of file
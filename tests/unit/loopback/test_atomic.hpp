@@ -0,0 +1,148 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+namespace test_comm_atomic
+{
+template <typename T>
+void test_execute_atomic(lci::atomic_type_t type)
+{
+  T value = 5;
+  uintptr_t address = reinterpret_cast<uintptr_t>(&value);
+  auto word = [&](T v) { return lci::make_atomic_word(type, v); };
+  auto old = [&](uint64_t w) {
+    T v;
+    memcpy(&v, &w, sizeof(T));
+    return v;
+  };
+  ASSERT_EQ(old(lci::execute_atomic(lci::atomic_op_t::fetch_add, type, address,
+                                    word(-2), 0)),
+            T(5));
+  ASSERT_EQ(value, T(3));
+  lci::execute_atomic(lci::atomic_op_t::add, type, address, word(4), 0);
+  ASSERT_EQ(value, T(7));
+  ASSERT_EQ(old(lci::execute_atomic(lci::atomic_op_t::swap, type, address,
+                                    word(11), 0)),
+            T(7));
+  ASSERT_EQ(value, T(11));
+  // failed compare-and-swap
+  ASSERT_EQ(old(lci::execute_atomic(lci::atomic_op_t::cas, type, address,
+                                    word(13), word(12))),
+            T(11));
+  ASSERT_EQ(value, T(11));
+  ASSERT_EQ(old(lci::execute_atomic(lci::atomic_op_t::cas, type, address,
+                                    word(13), word(11))),
+            T(11));
+  ASSERT_EQ(value, T(13));
+}
+
+TEST(ATOMIC, execute)
+{
+  test_execute_atomic<int32_t>(lci::atomic_type_t::int32);
+  test_execute_atomic<uint32_t>(lci::atomic_type_t::uint32);
+  test_execute_atomic<int64_t>(lci::atomic_type_t::int64);
+  test_execute_atomic<uint64_t>(lci::atomic_type_t::uint64);
+}
+
+template <typename T>
+void test_atomic_ops(lci::atomic_type_t type)
+{
+  int rank = lci::get_rank_me();
+  lci::comp_t cq = lci::alloc_cq();
+  T target[2] = {0, 100};
+  lci::mr_t mr = lci::register_memory(target, sizeof(target));
+  lci::rmr_t rmr = lci::get_rmr(mr);
+  const uintptr_t disp = sizeof(T);
+  T result = 0;
+  lci::status_t status;
+
+  // fetch_add with a negative operand
+  KEEP_RETRY(status,
+             lci::post_atomic_x(rank, lci::atomic_op_t::fetch_add,
+                                static_cast<uint64_t>(T(-1)), &result, cq,
+                                disp, rmr)
+                 .type(type)());
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  ASSERT_EQ(status.buffer, &result);
+  ASSERT_EQ(status.size, sizeof(T));
+  ASSERT_EQ(result, T(100));
+  ASSERT_EQ(target[1], T(99));
+
+  // add
+  KEEP_RETRY(status, lci::post_atomic_x(rank, lci::atomic_op_t::add, 3,
+                                        nullptr, cq, disp, rmr)
+                         .type(type)());
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  ASSERT_EQ(target[1], T(102));
+
+  // swap
+  KEEP_RETRY(status, lci::post_atomic_x(rank, lci::atomic_op_t::swap, 7,
+                                        &result, cq, disp, rmr)
+                         .type(type)());
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  ASSERT_EQ(result, T(102));
+  ASSERT_EQ(target[1], T(7));
+
+  // failed and successful compare-and-swap
+  KEEP_RETRY(status, lci::post_atomic_x(rank, lci::atomic_op_t::cas, 9,
+                                        &result, cq, disp, rmr)
+                         .compare(8)
+                         .type(type)());
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  ASSERT_EQ(result, T(7));
+  ASSERT_EQ(target[1], T(7));
+  // blocking
+  lci::post_atomic_x(rank, lci::atomic_op_t::cas, 9, &result, lci::COMP_NULL,
+                     disp, rmr)
+      .compare(7)
+      .type(type)();
+  ASSERT_EQ(result, T(7));
+  ASSERT_EQ(target[1], T(9));
+  // the neighbor is untouched
+  ASSERT_EQ(target[0], T(0));
+
+  lci::deregister_memory(&mr);
+  lci::free_comp(&cq);
+}
+
+void test_atomic_counter_worker_fn(int, int nmsgs, int total, lci::rmr_t rmr,
+                                   std::atomic<bool>* seen)
+{
+  int rank = lci::get_rank_me();
+  lci::comp_t cq = lci::alloc_cq();
+  for (int i = 0; i < nmsgs; i++) {
+    uint64_t result;
+    lci::status_t status;
+    KEEP_RETRY(status, lci::post_atomic(rank, lci::atomic_op_t::fetch_add, 1,
+                                        &result, cq, 0, rmr));
+    if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+    ASSERT_LT(result, static_cast<uint64_t>(total));
+    // every fetched value is unique
+    ASSERT_FALSE(seen[result].exchange(true));
+  }
+  lci::free_comp(&cq);
+}
+
+TEST(COMM_ATOMIC, atomic)
+{
+  lci::g_runtime_init();
+
+  test_atomic_ops<int32_t>(lci::atomic_type_t::int32);
+  test_atomic_ops<uint32_t>(lci::atomic_type_t::uint32);
+  test_atomic_ops<int64_t>(lci::atomic_type_t::int64);
+  test_atomic_ops<uint64_t>(lci::atomic_type_t::uint64);
+
+  // a shared counter
+  const int nmsgs = util::NITERS_SMALL / util::NTHREADS;
+  const int total = nmsgs * util::NTHREADS;
+  uint64_t counter = 0;
+  lci::mr_t mr = lci::register_memory(&counter, sizeof(counter));
+  lci::rmr_t rmr = lci::get_rmr(mr);
+  std::vector<std::atomic<bool>> seen(total);
+  util::spawn_threads(util::NTHREADS, test_atomic_counter_worker_fn, nmsgs,
+                      total, rmr, seen.data());
+  ASSERT_EQ(counter, static_cast<uint64_t>(total));
+  lci::deregister_memory(&mr);
+
+  lci::g_runtime_fina();
+}
+}  // namespace test_comm_atomic
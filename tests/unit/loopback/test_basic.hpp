@@ -23,4 +23,44 @@ TEST(AllocFree, endpoint)
   lci::free_endpoint(&endpoint);
   ASSERT_TRUE(endpoint.is_empty());
   lci::g_runtime_fina();
-}
\ No newline at end of file
+}
+TEST(AllocFree, runtime_tuning_profile)
+{
+  char path[] = "/tmp/lci_tuning_profile_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  {
+    std::ofstream file(path);
+    file << "# a comment\n"
+         << "inject_threshold = 16\n"
+         << "zcopy_threshold = 1024 # a trailing comment\n"
+         << "eager_threshold = 2048\n"
+         << "unknown_threshold = 1\n"
+         << "rdv_read_threshold = 65536\n";
+  }
+  lci::g_runtime_init_x().tuning_profile(path)();
+  lci::runtime_t runtime = lci::get_g_runtime();
+  ASSERT_EQ(runtime.get_attr_inject_threshold(), 16);
+  ASSERT_EQ(runtime.get_attr_zcopy_threshold(), 1024);
+  ASSERT_EQ(runtime.get_attr_eager_threshold(), 2048);
+  ASSERT_EQ(runtime.get_attr_rdv_read_threshold(), 65536);
+  // a message above the eager threshold goes through the rendezvous protocol
+  int rank = lci::get_rank_me();
+  size_t size = 4096;
+  std::vector<char> send_buffer(size, 'a');
+  std::vector<char> recv_buffer(size, 'b');
+  lci::comp_t cq = lci::alloc_cq();
+  lci::status_t recv_status, send_status;
+  KEEP_RETRY(recv_status,
+             lci::post_recv(rank, recv_buffer.data(), size, 0, cq));
+  KEEP_RETRY(send_status,
+             lci::post_send(rank, send_buffer.data(), size, 0, cq));
+  ASSERT_TRUE(send_status.is_posted());
+  lci::status_t status;
+  for (int i = 0; i < 2; i++) KEEP_RETRY(status, lci::cq_pop(cq));
+  util::check_buffer(recv_buffer.data(), size, 'a');
+  lci::free_comp(&cq);
+  lci::g_runtime_fina();
+  unlink(path);
+}
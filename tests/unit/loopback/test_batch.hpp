@@ -0,0 +1,111 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+namespace test_comm_batch
+{
+void test_batch_worker_fn(int thread_id, int nmsgs, size_t msg_size)
+{
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = thread_id;
+  lci::comp_t cq = lci::alloc_cq();
+  // one slot per message for each of the puts, gets and sends
+  std::vector<char> local_buffer(msg_size * nmsgs);
+  std::vector<char> remote_buffer(msg_size * nmsgs);
+  std::vector<char> get_buffer(msg_size * nmsgs);
+  std::vector<char> recv_buffer(msg_size * nmsgs);
+  lci::mr_t local_mr = lci::register_memory(local_buffer.data(),
+                                            local_buffer.size());
+  lci::mr_t get_mr = lci::register_memory(get_buffer.data(),
+                                          get_buffer.size());
+  lci::mr_t remote_mr = lci::register_memory(remote_buffer.data(),
+                                             remote_buffer.size());
+  lci::rmr_t rmr = lci::get_rmr(remote_mr);
+  for (int i = 0; i < nmsgs; i++) {
+    util::write_buffer(&local_buffer[i * msg_size], msg_size, 'a' + i % 26);
+  }
+
+  // batched puts and sends
+  lci::status_t status;
+  for (int i = 0; i < nmsgs; i++) {
+    KEEP_RETRY(status, lci::post_recv(rank, &recv_buffer[i * msg_size],
+                                      msg_size, tag, cq));
+    ASSERT_TRUE(status.is_posted());
+  }
+  lci::begin_batch();
+  for (int i = 0; i < nmsgs; i++) {
+    char* address = &local_buffer[i * msg_size];
+    KEEP_RETRY(status, lci::post_put_x(rank, address, msg_size, cq,
+                                       i * msg_size, rmr)
+                           .mr(local_mr)());
+    if (status.is_done()) lci::comp_signal(cq, status);
+    KEEP_RETRY(status, lci::post_send_x(rank, address, msg_size, tag, cq)
+                           .mr(local_mr)());
+    if (status.is_done()) lci::comp_signal(cq, status);
+  }
+  lci::flush_batch();
+  for (int i = 0; i < nmsgs * 3; i++) {
+    KEEP_RETRY(status, lci::cq_pop(cq));
+  }
+  for (int i = 0; i < nmsgs; i++) {
+    util::check_buffer(&remote_buffer[i * msg_size], msg_size, 'a' + i % 26);
+  }
+  // the messages of the same tag may match in any order
+  std::vector<int> counts(26, 0);
+  for (int i = 0; i < nmsgs; i++) {
+    if (msg_size > 0) ++counts[recv_buffer[i * msg_size] - 'a'];
+  }
+  for (int i = 0; i < nmsgs && msg_size > 0; i++) {
+    --counts[i % 26];
+  }
+  for (int count : counts) ASSERT_EQ(count, 0);
+
+  // batched gets, flushed by a blocking operation
+  lci::begin_batch();
+  for (int i = 0; i < nmsgs; i++) {
+    KEEP_RETRY(status, lci::post_get_x(rank, &get_buffer[i * msg_size],
+                                       msg_size, cq, i * msg_size, rmr)
+                           .mr(get_mr)());
+    if (status.is_done()) lci::comp_signal(cq, status);
+  }
+  lci::post_put_x(rank, local_buffer.data(), msg_size, lci::COMP_NULL, 0, rmr)
+      .mr(local_mr)();
+  lci::flush_batch();
+  for (int i = 0; i < nmsgs; i++) {
+    KEEP_RETRY(status, lci::cq_pop(cq));
+  }
+  for (int i = 0; i < nmsgs; i++) {
+    util::check_buffer(&get_buffer[i * msg_size], msg_size, 'a' + i % 26);
+  }
+
+  // batched gets, flushed by the progress engine while the batch is open
+  lci::begin_batch();
+  for (int i = 0; i < nmsgs; i++) {
+    KEEP_RETRY(status, lci::post_get_x(rank, &get_buffer[i * msg_size],
+                                       msg_size, cq, i * msg_size, rmr)
+                           .mr(get_mr)());
+    if (status.is_done()) lci::comp_signal(cq, status);
+  }
+  for (int i = 0; i < nmsgs; i++) {
+    KEEP_RETRY(status, lci::cq_pop(cq));
+  }
+  lci::flush_batch();
+
+  lci::deregister_memory(&remote_mr);
+  lci::deregister_memory(&get_mr);
+  lci::deregister_memory(&local_mr);
+  lci::free_comp(&cq);
+}
+
+TEST(COMM_BATCH, batch)
+{
+  lci::g_runtime_init();
+  const int nmsgs = 64;
+  const size_t max_bcopy_size = lci::get_max_bcopy_size();
+  for (size_t msg_size : {size_t(8), max_bcopy_size, size_t(65536)}) {
+    for (int nthreads : {1, util::NTHREADS}) {
+      util::spawn_threads(nthreads, test_batch_worker_fn, nmsgs, msg_size);
+    }
+  }
+  lci::g_runtime_fina();
+}
+}  // namespace test_comm_batch
@@ -60,4 +60,31 @@ TEST(COUNTER, multithread0)
   lci::g_runtime_fina();
 }
 
+// the main thread sleeps until the other threads are done
+TEST(COUNTER, blocking)
+{
+  lci::g_runtime_init();
+  const int num_threads = util::NTHREADS;
+  const int num_iters_per_thread = util::NITERS_SMALL;
+  lci::comp_t comp = lci::alloc_counter_x().blocking(true)();
+
+  for (bool do_progress : {false, true}) {
+    lci::counter_set(comp, 0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; i++) {
+      std::thread t(test_multithread0, comp, num_iters_per_thread);
+      threads.push_back(std::move(t));
+    }
+    lci::counter_wait_x(comp, num_threads * num_iters_per_thread)
+        .do_progress(do_progress)();
+    ASSERT_EQ(lci::counter_get(comp), num_threads * num_iters_per_thread);
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+
+  lci::free_comp(&comp);
+  lci::g_runtime_fina();
+}
+
 }  // namespace test_counter
\ No newline at end of file
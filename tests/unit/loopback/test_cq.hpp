@@ -74,4 +74,93 @@ TEST(CQ, multithread0)
   lci::g_runtime_fina();
 }
 
+// pop in batches from a ring smaller than the number of statuses
+TEST(CQ, pop_n)
+{
+  const int n = 100;
+  const size_t batch = 8;
+  lci::g_runtime_init();
+  lci::comp_t comp = lci::alloc_cq_x().default_length(16)();
+  bool flags[n];
+  memset(flags, 0, sizeof(flags));
+  for (uint64_t i = 0; i < n; i++) {
+    my_cq_push(comp, i);
+  }
+  lci::status_t statuses[batch];
+  int npopped = 0;
+  while (npopped < n) {
+    size_t count = lci::cq_pop_n(comp, batch, statuses);
+    ASSERT_LE(count, batch);
+    for (size_t i = 0; i < count; i++) {
+      ASSERT_TRUE(statuses[i].is_done());
+      uint64_t idx = reinterpret_cast<uint64_t>(statuses[i].user_context) - 1;
+      ASSERT_EQ(flags[idx], false);
+      flags[idx] = true;
+    }
+    npopped += count;
+  }
+  ASSERT_EQ(lci::cq_pop_n(comp, batch, statuses), 0);
+  ASSERT_TRUE(lci::cq_pop(comp).is_retry());
+  lci::free_comp(&comp);
+  lci::g_runtime_fina();
+}
+
+// statuses pushed while the ring is full keep their order
+TEST(CQ, overflow_order)
+{
+  const int n = 100;
+  lci::g_runtime_init();
+  lci::comp_t comp = lci::alloc_cq_x().default_length(4)();
+  uint64_t next_push = 0, next_pop = 0;
+  while (next_pop < n) {
+    // push three, pop two, so the ring fills and frees up repeatedly
+    for (int i = 0; i < 3 && next_push < n; i++) {
+      my_cq_push(comp, next_push++);
+    }
+    for (int i = 0; i < 2 || next_push == n; i++) {
+      if (next_pop == n) break;
+      ASSERT_EQ(my_cq_pop(comp), next_pop++);
+    }
+  }
+  ASSERT_TRUE(lci::cq_pop(comp).is_retry());
+  lci::free_comp(&comp);
+  lci::g_runtime_fina();
+}
+
+// the main thread sleeps until the other threads push
+TEST(CQ, blocking)
+{
+  lci::g_runtime_init();
+  const int nthreads = util::NTHREADS;
+  const int n = util::NITERS;
+  ASSERT_EQ(n % nthreads, 0);
+  const int n_per_thread = n / nthreads;
+  lci::comp_t comp = lci::alloc_cq_x().blocking(true)();
+  for (bool do_progress : {false, true}) {
+    bool flags[n];
+    memset(flags, 0, sizeof(flags));
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nthreads; i++) {
+      std::thread t([=]() {
+        for (int j = 0; j < n_per_thread; j++) {
+          my_cq_push(comp, i * n_per_thread + j);
+        }
+      });
+      threads.push_back(std::move(t));
+    }
+    for (int i = 0; i < n; i++) {
+      lci::status_t status = lci::cq_wait_x(comp).do_progress(do_progress)();
+      ASSERT_TRUE(status.is_done());
+      uint64_t idx = reinterpret_cast<uint64_t>(status.user_context) - 1;
+      ASSERT_EQ(flags[idx], false);
+      flags[idx] = true;
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+  lci::free_comp(&comp);
+  lci::g_runtime_fina();
+}
+
 }  // namespace test_cq
\ No newline at end of file
@@ -0,0 +1,179 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+namespace test_datatype
+{
+// A 3D array of 8 x 9 x 10 elements and some of its strided faces.
+const size_t sizes[] = {8, 9, 10};
+
+std::vector<lci::datatype_t> get_datatypes(size_t elem_size)
+{
+  static const size_t displacements[] = {3, 50, 7, 120, 64};
+  const size_t x_face_subsizes[] = {8, 9, 1};
+  const size_t x_face_starts[] = {0, 0, 9};
+  const size_t y_face_subsizes[] = {8, 1, 10};
+  const size_t y_face_starts[] = {0, 4, 0};
+  const size_t box_subsizes[] = {3, 4, 5};
+  const size_t box_starts[] = {2, 3, 4};
+  return {
+      lci::datatype_t::contiguous(100, elem_size),
+      lci::datatype_t::vector(72, 1, 10, elem_size),
+      lci::datatype_t::vector(9, 3, 7, elem_size),
+      lci::datatype_t::subarray(3, sizes, x_face_subsizes, x_face_starts,
+                                elem_size),
+      lci::datatype_t::subarray(3, sizes, y_face_subsizes, y_face_starts,
+                                elem_size),
+      lci::datatype_t::subarray(3, sizes, box_subsizes, box_starts,
+                                elem_size),
+      lci::datatype_t::indexed_block(5, 6, displacements, elem_size),
+  };
+}
+
+size_t get_array_size(size_t elem_size)
+{
+  return sizes[0] * sizes[1] * sizes[2] * elem_size;
+}
+
+// Naive reference: the offset of every packed byte in the array
+std::vector<size_t> get_byte_offsets(const lci::datatype_t& datatype)
+{
+  std::vector<size_t> offsets;
+  const size_t e = datatype.elem_size;
+  auto push_block = [&](size_t start, size_t nelems) {
+    for (size_t k = 0; k < nelems * e; k++) offsets.push_back(start * e + k);
+  };
+  switch (datatype.type) {
+    case lci::datatype_t::type_t::contiguous:
+      push_block(0, datatype.blocklength);
+      break;
+    case lci::datatype_t::type_t::vector:
+      for (size_t i = 0; i < datatype.count; i++)
+        push_block(i * datatype.stride, datatype.blocklength);
+      break;
+    case lci::datatype_t::type_t::indexed_block:
+      for (size_t i = 0; i < datatype.count; i++)
+        push_block(datatype.displacements[i], datatype.blocklength);
+      break;
+    case lci::datatype_t::type_t::subarray:
+      for (size_t i = 0; i < datatype.subsizes[0]; i++)
+        for (size_t j = 0; j < datatype.subsizes[1]; j++)
+          push_block(((datatype.starts[0] + i) * datatype.sizes[1] +
+                      datatype.starts[1] + j) *
+                             datatype.sizes[2] +
+                         datatype.starts[2],
+                     datatype.subsizes[2]);
+      break;
+  }
+  return offsets;
+}
+
+void fill(char* buffer, size_t size)
+{
+  for (size_t i = 0; i < size; i++) buffer[i] = static_cast<char>(i % 251);
+}
+
+TEST(DATATYPE, pack_unpack)
+{
+  for (size_t elem_size : {1, 4, 8, 16, 24}) {
+    for (auto& datatype : get_datatypes(elem_size)) {
+      std::vector<char> array(get_array_size(elem_size));
+      fill(array.data(), array.size());
+      auto offsets = get_byte_offsets(datatype);
+      ASSERT_EQ(lci::get_datatype_size(datatype), offsets.size());
+      // pack in chunks of odd sizes to cover partial blocks
+      std::vector<char> packed(offsets.size());
+      for (size_t chunk : {offsets.size(), size_t(7), size_t(64)}) {
+        std::fill(packed.begin(), packed.end(), 0);
+        for (size_t offset = 0; offset < packed.size(); offset += chunk) {
+          size_t length = std::min(chunk, packed.size() - offset);
+          lci::datatype_pack(datatype, array.data(), offset,
+                             packed.data() + offset, length);
+        }
+        for (size_t i = 0; i < offsets.size(); i++) {
+          ASSERT_EQ(packed[i], array[offsets[i]]);
+        }
+      }
+      std::vector<char> unpacked(array.size(), 0);
+      lci::datatype_unpack(datatype, unpacked.data(), 0, packed.data(),
+                           packed.size());
+      for (size_t i = 0; i < offsets.size(); i++) {
+        ASSERT_EQ(unpacked[offsets[i]], array[offsets[i]]);
+      }
+    }
+  }
+}
+
+void test_datatype_comm(const lci::datatype_t& datatype)
+{
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = 0;
+  lci::comp_t cq = lci::alloc_cq();
+  lci::comp_t rcq = lci::alloc_cq();
+  lci::rcomp_t rcomp = lci::register_rcomp(rcq);
+  const size_t size = lci::get_datatype_size(datatype);
+  std::vector<char> array(get_array_size(datatype.elem_size));
+  std::vector<char> expected(size);
+  std::vector<char> recv_buffer(size + 1);
+  fill(array.data(), array.size());
+  lci::datatype_pack(datatype, array.data(), 0, expected.data(), size);
+  lci::status_t status;
+
+  // send/recv
+  lci::status_t recv_status;
+  KEEP_RETRY(recv_status,
+             lci::post_recv(rank, recv_buffer.data(), size, tag, cq));
+  KEEP_RETRY(status, lci::post_send_x(rank, array.data(), 0, tag, cq)
+                         .datatype(&datatype)());
+  ASSERT_EQ(status.size, size);
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  if (recv_status.is_posted()) KEEP_RETRY(recv_status, lci::cq_pop(cq));
+  ASSERT_EQ(recv_status.size, size);
+  ASSERT_EQ(memcmp(recv_buffer.data(), expected.data(), size), 0);
+
+  // am
+  KEEP_RETRY(status, lci::post_am_x(rank, array.data(), 0, cq, rcomp)
+                         .datatype(&datatype)());
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  KEEP_RETRY(status, lci::cq_pop(rcq));
+  ASSERT_EQ(status.size, size);
+  ASSERT_EQ(memcmp(status.buffer, expected.data(), size), 0);
+  free(status.buffer);
+
+  // put
+  lci::mr_t mr = lci::register_memory(recv_buffer.data(), size + 1);
+  lci::rmr_t rmr = lci::get_rmr(mr);
+  memset(recv_buffer.data(), 0, size);
+  KEEP_RETRY(status, lci::post_put_x(rank, array.data(), 0, cq, 0, rmr)
+                         .datatype(&datatype)());
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  ASSERT_EQ(memcmp(recv_buffer.data(), expected.data(), size), 0);
+
+  // get
+  std::vector<char> array2(array.size(), 0);
+  KEEP_RETRY(status, lci::post_get_x(rank, array2.data(), 0, cq, 0, rmr)
+                         .datatype(&datatype)());
+  if (status.is_posted()) KEEP_RETRY(status, lci::cq_pop(cq));
+  auto offsets = get_byte_offsets(datatype);
+  for (size_t i = 0; i < offsets.size(); i++) {
+    ASSERT_EQ(array2[offsets[i]], array[offsets[i]]);
+  }
+
+  lci::deregister_memory(&mr);
+  lci::deregister_rcomp(rcomp);
+  lci::free_comp(&rcq);
+  lci::free_comp(&cq);
+}
+
+TEST(DATATYPE, comm)
+{
+  lci::g_runtime_init();
+  // the large element sizes make the faces go through the rendezvous and
+  // staging-buffer protocols
+  for (size_t elem_size : {8, 1024}) {
+    for (auto& datatype : get_datatypes(elem_size)) {
+      test_datatype_comm(datatype);
+    }
+  }
+  lci::g_runtime_fina();
+}
+}  // namespace test_datatype
@@ -65,4 +65,54 @@ TEST(COMM_GET, get)
   lci::g_runtime_fina();
 }
 
+TEST(COMM_GET, get_signal)
+{
+  lci::g_runtime_init();
+
+  int rank = lci::get_rank_me();
+  const size_t max_bcopy_size = lci::get_max_bcopy_size();
+  std::vector<size_t> msg_sizes = {0, 8, max_bcopy_size + 1, 65536};
+  // the last tag does not fit into the immediate data
+  std::vector<lci::tag_t> tags = {
+      0, 17, lci::get_g_runtime().get_attr_max_imm_tag() + 1};
+
+  lci::comp_t cq = lci::alloc_cq();
+  lci::comp_t rcq = lci::alloc_cq();
+  lci::rcomp_t rcomp = lci::register_rcomp(rcq);
+  for (auto& msg_size : msg_sizes) {
+    for (auto& tag : tags) {
+      void* send_buffer = malloc(msg_size);
+      void* recv_buffer = malloc(msg_size);
+      util::write_buffer(send_buffer, msg_size, 'a');
+      lci::mr_t mr = lci::register_memory(send_buffer, msg_size);
+      lci::rmr_t rmr = lci::get_rmr(mr);
+
+      lci::status_t status;
+      KEEP_RETRY(status, lci::post_get_x(rank, recv_buffer, msg_size, cq, 0,
+                                         rmr)
+                             .tag(tag)
+                             .remote_comp(rcomp)());
+      if (status.is_posted()) {
+        KEEP_RETRY(status, lci::cq_pop(cq));
+      }
+      util::check_buffer(recv_buffer, msg_size, 'a');
+      // the target is signaled once the data has been read
+      KEEP_RETRY(status, lci::cq_pop(rcq));
+      ASSERT_EQ(status.rank, rank);
+      ASSERT_EQ(status.tag, tag);
+      ASSERT_EQ(status.size, 0);
+      free(status.buffer);
+
+      lci::deregister_memory(&mr);
+      free(send_buffer);
+      free(recv_buffer);
+    }
+  }
+  lci::deregister_rcomp(rcomp);
+  lci::free_comp(&rcq);
+  lci::free_comp(&cq);
+
+  lci::g_runtime_fina();
+}
+
 }  // namespace test_comm_get
\ No newline at end of file
@@ -0,0 +1,134 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+namespace test_comm_iovec
+{
+// Split buffer into count entries of roughly the same size. The first entry
+// is empty to make sure empty entries are skipped.
+std::vector<lci::iovec_t> make_iov(char* buffer, size_t size, size_t count,
+                                   lci::mr_t* mrs = nullptr)
+{
+  std::vector<lci::iovec_t> iov(count + 1);
+  iov[0] = lci::iovec_t(buffer, 0);
+  size_t offset = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t length = size / count + (i < size % count ? 1 : 0);
+    iov[i + 1] = lci::iovec_t(buffer + offset, length);
+    if (mrs && length > 0) {
+      mrs[i] = lci::register_memory(buffer + offset, length);
+      iov[i + 1].mr = mrs[i];
+    }
+    offset += length;
+  }
+  return iov;
+}
+
+void fill(char* buffer, size_t size)
+{
+  for (size_t i = 0; i < size; i++) buffer[i] = static_cast<char>(i % 251);
+}
+
+void check(const char* buffer, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    ASSERT_EQ(buffer[i], static_cast<char>(i % 251));
+  }
+}
+
+void wait(lci::comp_t cq, lci::status_t status)
+{
+  if (status.is_posted()) {
+    KEEP_RETRY(status, lci::cq_pop(cq));
+  }
+}
+
+void test_iovec_common(size_t msg_size, size_t count, bool registered)
+{
+  fprintf(stderr,
+          "test_iovec_common: msg_size=%ld count=%ld registered=%d\n",
+          msg_size, count, registered);
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = 0;
+  lci::comp_t cq = lci::alloc_cq();
+  lci::comp_t rcq = lci::alloc_cq();
+  lci::rcomp_t rcomp = lci::register_rcomp(rcq);
+  std::vector<char> send_buffer(msg_size + 1);
+  std::vector<char> recv_buffer(msg_size + 1);
+  std::vector<lci::mr_t> mrs(count);
+  fill(send_buffer.data(), msg_size);
+  auto iov = make_iov(send_buffer.data(), msg_size, count,
+                      registered ? mrs.data() : nullptr);
+  lci::status_t status;
+
+  // sendv/recv
+  KEEP_RETRY(status, lci::post_recv(rank, recv_buffer.data(), msg_size, tag,
+                                    cq));
+  lci::status_t recv_status = status;
+  KEEP_RETRY(status, lci::post_sendv(rank, iov.data(), iov.size(), tag, cq));
+  ASSERT_EQ(status.size, msg_size);
+  wait(cq, status);
+  if (recv_status.is_posted()) {
+    KEEP_RETRY(recv_status, lci::cq_pop(cq));
+  }
+  ASSERT_EQ(recv_status.size, msg_size);
+  check(recv_buffer.data(), msg_size);
+
+  // amv
+  KEEP_RETRY(status, lci::post_amv(rank, iov.data(), iov.size(), cq, rcomp));
+  wait(cq, status);
+  KEEP_RETRY(status, lci::cq_pop(rcq));
+  ASSERT_EQ(status.size, msg_size);
+  check(static_cast<char*>(status.buffer), msg_size);
+  free(status.buffer);
+
+  // putv
+  lci::mr_t mr = lci::register_memory(recv_buffer.data(), msg_size + 1);
+  lci::rmr_t rmr = lci::get_rmr(mr);
+  memset(recv_buffer.data(), 0, msg_size);
+  KEEP_RETRY(status, lci::post_putv(rank, iov.data(), iov.size(), cq, 0, rmr));
+  wait(cq, status);
+  check(recv_buffer.data(), msg_size);
+
+  // putv with signal
+  memset(recv_buffer.data(), 0, msg_size);
+  KEEP_RETRY(status, lci::post_putv_x(rank, iov.data(), iov.size(), cq, 0, rmr)
+                         .remote_comp(rcomp)());
+  wait(cq, status);
+  KEEP_RETRY(status, lci::cq_pop(rcq));
+  check(recv_buffer.data(), msg_size);
+
+  // getv
+  memset(send_buffer.data(), 0, msg_size);
+  fill(recv_buffer.data(), msg_size);
+  KEEP_RETRY(status, lci::post_getv(rank, iov.data(), iov.size(), cq, 0, rmr));
+  wait(cq, status);
+  check(send_buffer.data(), msg_size);
+
+  lci::deregister_memory(&mr);
+  for (auto& entry_mr : mrs) {
+    if (!entry_mr.is_empty()) lci::deregister_memory(&entry_mr);
+  }
+  lci::deregister_rcomp(rcomp);
+  lci::free_comp(&rcq);
+  lci::free_comp(&cq);
+}
+
+TEST(COMM_IOVEC, iovec)
+{
+  lci::g_runtime_init();
+
+  const size_t max_bcopy_size = lci::get_max_bcopy_size();
+  std::vector<size_t> msg_sizes = {8, max_bcopy_size, max_bcopy_size + 1,
+                                   65536};
+  std::vector<size_t> counts = {1, 3, LCI_BACKEND_MAX_IOV + 1};
+
+  for (auto& msg_size : msg_sizes) {
+    for (auto& count : counts) {
+      test_iovec_common(msg_size, count, false);
+      test_iovec_common(msg_size, count, true);
+    }
+  }
+
+  lci::g_runtime_fina();
+}
+}  // namespace test_comm_iovec
@@ -12,7 +12,7 @@ using matching_engine_t = lci::matching_engine_map_t;
 TEST(MATCHING_ENGINE, singlethread0)
 {
   lci::g_runtime_init();
-  lci::matching_engine_attr_t attr;
+  lci::matching_engine_attr_t attr = {};
   matching_engine_t mengine(attr);
   const int n = 1000;
   for (int i = 0; i < n; i++) {
@@ -31,7 +31,7 @@ TEST(MATCHING_ENGINE, singlethread0)
 TEST(MATCHING_ENGINE, singlethread1)
 {
   lci::g_runtime_init();
-  lci::matching_engine_attr_t attr;
+  lci::matching_engine_attr_t attr = {};
   matching_engine_t mengine(attr);
   const int n = 10;
   const int repeat = 100;
@@ -52,6 +52,93 @@ TEST(MATCHING_ENGINE, singlethread1)
   lci::g_runtime_fina();
 }
 
+template <typename engine_t>
+void test_wide_key()
+{
+  lci::matching_engine_attr_t attr = {};
+  engine_t mengine(attr);
+  const auto send = lci::matching_engine_impl_t::insert_type_t::send;
+  const auto recv = lci::matching_engine_impl_t::insert_type_t::recv;
+  const auto policy = lci::matching_policy_t::rank_tag;
+  const int n = 100;
+  // the tags only differ above the low 32 bits
+  auto get_tag = [](int i) {
+    return (static_cast<lci::tag_t>(i + 1) << 32) | 7;
+  };
+  for (int i = 0; i < n; i++) {
+    mengine.insert(3, get_tag(i), policy, reinterpret_cast<void*>(i + 1),
+                   send);
+  }
+  // the same low 32 bits with a narrow tag or another rank
+  ASSERT_EQ(mengine.insert(3, 7, policy, reinterpret_cast<void*>(1), recv),
+            nullptr);
+  ASSERT_EQ(mengine.insert(4, get_tag(0), policy, reinterpret_cast<void*>(1),
+                           recv),
+            nullptr);
+  for (int i = n - 1; i >= 0; i--) {
+    void* val =
+        mengine.insert(3, get_tag(i), policy, reinterpret_cast<void*>(1), recv);
+    ASSERT_EQ(reinterpret_cast<uint64_t>(val), i + 1);
+  }
+}
+
+TEST(MATCHING_ENGINE, wide_key)
+{
+  test_wide_key<lci::matching_engine_map_t>();
+  test_wide_key<lci::matching_engine_queue_t>();
+}
+
+void test_resize_worker_fn(lci::matching_engine_map_t& mengine, int thread_id,
+                           int n)
+{
+  const auto send = lci::matching_engine_impl_t::insert_type_t::send;
+  const auto recv = lci::matching_engine_impl_t::insert_type_t::recv;
+  std::vector<uint64_t> keys(n);
+  for (int i = 0; i < n; i++) {
+    keys[i] = static_cast<uint64_t>(thread_id) * n + i;
+    mengine.insert(keys[i], reinterpret_cast<void*>(keys[i] + 1), send);
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(thread_id));
+  for (auto key : keys) {
+    void* val = mengine.insert(key, reinterpret_cast<void*>(1), recv);
+    ASSERT_EQ(reinterpret_cast<uint64_t>(val), key + 1);
+  }
+}
+
+TEST(MATCHING_ENGINE, resize)
+{
+  lci::matching_engine_attr_t attr = {};
+  attr.nbuckets = 16;
+  lci::matching_engine_map_t mengine(attr);
+  const size_t min_nbuckets = mengine.get_nbuckets();
+  ASSERT_EQ(min_nbuckets, 16);
+  const int n = 100000;
+  const auto send = lci::matching_engine_impl_t::insert_type_t::send;
+  const auto recv = lci::matching_engine_impl_t::insert_type_t::recv;
+  for (int i = 0; i < n; i++) {
+    mengine.insert(i, reinterpret_cast<void*>(i + 1), send);
+  }
+  // the table grows with the number of keys
+  ASSERT_GT(mengine.get_nbuckets(), n / 4);
+  for (int i = 0; i < n; i++) {
+    void* val = mengine.insert(i, reinterpret_cast<void*>(1), recv);
+    ASSERT_EQ(reinterpret_cast<uint64_t>(val), i + 1);
+  }
+  // and shrinks back once they are gone
+  ASSERT_LT(mengine.get_nbuckets(), 256);
+
+  // resize while other threads insert
+  std::vector<std::thread> threads;
+  for (int i = 0; i < util::NTHREADS; i++) {
+    threads.emplace_back(test_resize_worker_fn, std::ref(mengine), i,
+                         n / util::NTHREADS);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  ASSERT_GE(mengine.get_nbuckets(), min_nbuckets);
+}
+
 // all threads put and get
 void test_multithread0(matching_engine_t& mengine, const std::vector<int>& in,
                        int start, int n, bool out[])
@@ -80,7 +167,7 @@ TEST(MATCHING_ENGINE, multithread0)
   ASSERT_EQ(n % nthreads, 0);
   const int n_per_thread = 2 * n / nthreads;
 
-  lci::matching_engine_attr_t attr;
+  lci::matching_engine_attr_t attr = {};
   matching_engine_t mengine(attr);
 
   std::vector<int> in(2 * n);
@@ -135,7 +222,7 @@ TEST(MATCHING_ENGINE, multithread1)
   const int n = 10;
   const int repeat = 100;
 
-  lci::matching_engine_attr_t attr;
+  lci::matching_engine_attr_t attr = {};
   matching_engine_t mengine(attr);
 
   std::vector<int> in(2 * repeat * n);
@@ -34,6 +34,39 @@ TEST(MATCHING_POLICY, test_rank_tag)
   lci::g_runtime_fina();
 }
 
+TEST(MATCHING_POLICY, test_rank_tag_64bit)
+{
+  lci::g_runtime_init();
+  ASSERT_EQ(lci::get_g_runtime().get_attr_max_tag(), lci::ANY_TAG - 1);
+  const int n = 100;
+  // the tags only differ above the low 32 bits
+  std::vector<lci::tag_t> tags(n);
+  for (int i = 0; i < n; i++) {
+    tags[i] = (static_cast<lci::tag_t>(i) << 32) | 0x1234;
+  }
+  std::random_device rd;
+  std::mt19937 g(rd());
+  std::shuffle(tags.begin(), tags.end(), g);
+
+  uint64_t data[n];
+  for (int i = 0; i < n; ++i) {
+    data[i] = tags[i];
+    lci::status_t status =
+        lci::post_send(0, &data[i], sizeof(data[i]), tags[i], lci::COMP_NULL);
+    ASSERT_EQ(status.is_done(), true);
+  }
+  for (int i = n - 1; i >= 0; --i) {
+    uint64_t recv_data = 0;
+    lci::status_t status = lci::post_recv(0, &recv_data, sizeof(recv_data),
+                                          tags[i], lci::COMP_NULL);
+    ASSERT_EQ(status.is_done(), true);
+    ASSERT_EQ(status.tag, tags[i]);
+    ASSERT_EQ(recv_data, tags[i]);
+  }
+
+  lci::g_runtime_fina();
+}
+
 TEST(MATCHING_POLICY, test_rank_only)
 {
   lci::g_runtime_init();
@@ -27,6 +27,43 @@ TEST(MPMC_SET, singlethread)
   lci::global_finalize();
 }
 
+// the packets of two NUMA nodes
+TEST(MPMC_SET, numa_nodes)
+{
+  lci::global_initialize();
+  lci::mpmc_set_t pool(0, 1, 2);
+  const int n = 1000;
+  bool flags[n];
+  memset(flags, 0, sizeof(flags));
+  for (int i = 0; i < n; i++) {
+    pool.put_to_node(reinterpret_cast<void*>(i + 1), i % 2);
+  }
+  ASSERT_EQ(pool.size(), n);
+  // the packets put back to either node are found again
+  for (int i = 0; i < n; i++) {
+    void* val;
+    do {
+      val = pool.get();
+    } while (!val);
+    uint64_t idx = reinterpret_cast<uint64_t>(val) - 1;
+    pool.put(val, lci::mpmc_set_t::LOCAL_SET_ID_NULL, idx % 2);
+  }
+  ASSERT_EQ(pool.size(), n);
+  for (int i = 0; i < n; i++) {
+    void* val;
+    do {
+      val = pool.get();
+    } while (!val);
+    uint64_t idx = reinterpret_cast<uint64_t>(val) - 1;
+    ASSERT_EQ(flags[idx], false);
+    flags[idx] = true;
+  }
+  for (int i = 0; i < n; i++) {
+    ASSERT_EQ(flags[i], true);
+  }
+  lci::global_finalize();
+}
+
 // all threads put and get
 void test_multithread0(lci::mpmc_set_t& pool, int start, int n, bool flags[])
 {
@@ -225,4 +262,140 @@ TEST(MPMC_SET, multithread3)
   }
   lci::global_finalize();
 }
+
+// all threads return packets to the main thread (testing the mailbox)
+void test_mailbox(lci::mpmc_set_t& pool, int tid, int start, int n)
+{
+  for (size_t i = 0; i < static_cast<size_t>(n); i++) {
+    pool.put(reinterpret_cast<void*>(start + i + 1), tid, -1);
+  }
+}
+
+TEST(MPMC_SET, mailbox)
+{
+  lci::global_initialize();
+  const int nthreads = util::NTHREADS;
+  const int n = util::NITERS_LARGE;
+  ASSERT_EQ(n % nthreads, 0);
+  const int n_per_thread = n / nthreads;
+  bool flags[n];
+  memset(flags, 0, sizeof(flags));
+  lci::mpmc_set_t pool(0, 1);
+  // make sure the main thread has a local set
+  ASSERT_EQ(pool.get(), nullptr);
+  int tid = pool.get_local_set_id();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < nthreads; i++) {
+    std::thread t(test_mailbox, std::ref(pool), tid, i * n_per_thread,
+                  n_per_thread);
+    threads.push_back(std::move(t));
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  ASSERT_EQ(pool.size(), n);
+  for (int i = 0; i < n; i++) {
+    void* val = pool.get();
+    ASSERT_NE(val, nullptr);
+    uint64_t idx = reinterpret_cast<uint64_t>(val) - 1;
+    ASSERT_EQ(flags[idx], false);
+    flags[idx] = true;
+  }
+  ASSERT_EQ(pool.get(), nullptr);
+  lci::global_finalize();
+}
+
+// the packet size classes of a packet pool
+TEST(PACKET_POOL, size_classes)
+{
+  lci::global_initialize();
+  lci::packet_pool_t::attr_t attr = {};
+  attr.packet_size = 8192;
+  attr.npackets = 16;
+  attr.min_packet_size = 256;
+  attr.numa_aware = false;
+  attr.huge_page = false;
+  lci::packet_pool_impl_t pool(attr);
+  // 512, 2048 and 8192 bytes
+  ASSERT_EQ(pool.get_nclasses(), 3);
+  // 5, 5 and 6 packets
+  ASSERT_EQ(pool.get_size(), attr.npackets);
+  ASSERT_EQ(pool.get_npackets(0), 5u);
+  ASSERT_EQ(pool.get_npackets(), 6u);
+  ASSERT_EQ(pool.get_payload_size(), 8192 - LCI_CACHE_LINE);
+  const size_t sizes[] = {8, 512 - LCI_CACHE_LINE, 1000, 8192 - LCI_CACHE_LINE};
+  const int expected_classes[] = {0, 0, 1, 2};
+  for (int i = 0; i < 4; i++) {
+    lci::packet_t* packet = pool.get_for_size(sizes[i]);
+    ASSERT_NE(packet, nullptr);
+    ASSERT_EQ(pool.get_size_class(packet), expected_classes[i]);
+    ASSERT_GE(pool.get_payload_size(packet), sizes[i]);
+    ASSERT_TRUE(pool.is_packet(packet->get_payload_address()));
+    ASSERT_FALSE(pool.is_packet((char*)packet->get_payload_address() + 8));
+    memset(packet->get_payload_address(), 'a', sizes[i]);
+    pool.put(packet);
+  }
+  // fall back to the larger classes once the smallest one is empty
+  std::vector<lci::packet_t*> packets(pool.get_npackets(0));
+  ASSERT_EQ(pool.get_n(packets.size(), packets.data(), false, 0),
+            packets.size());
+  lci::packet_t* packet = pool.get_for_size(8);
+  ASSERT_NE(packet, nullptr);
+  ASSERT_EQ(pool.get_size_class(packet), 1);
+  packets.push_back(packet);
+  for (auto p : packets) pool.put(p);
+  ASSERT_EQ(pool.get_size(), attr.npackets);
+  lci::global_finalize();
+}
+
+// a packet pool grows by slabs and returns them once they are idle
+TEST(PACKET_POOL, growth)
+{
+  lci::global_initialize();
+  lci::packet_pool_t::attr_t attr = {};
+  attr.packet_size = 8192;
+  attr.npackets = 16;
+  attr.min_packet_size = 2048;
+  attr.numa_aware = false;
+  attr.huge_page = false;
+  attr.npackets_max = 64;
+  attr.slab_cooldown = 0;
+  lci::packet_pool_impl_t pool(attr);
+  ASSERT_EQ(pool.get_nclasses(), 2);
+  ASSERT_EQ(pool.get_nslabs(), 1);
+  // take all packets the pool can grow to
+  std::vector<lci::packet_t*> packets;
+  while (true) {
+    lci::packet_t* packet = pool.get();
+    if (!packet) break;
+    ASSERT_TRUE(pool.is_packet(packet->get_payload_address()));
+    ASSERT_EQ(pool.get_size_class(packet), 1);
+    memset(packet->get_payload_address(), 'a', pool.get_payload_size());
+    packets.push_back(packet);
+  }
+  // 4 slabs of 8 packets per class
+  ASSERT_EQ(pool.get_nslabs(), 4);
+  ASSERT_EQ(packets.size(), 4 * pool.get_npackets());
+  // the smaller class has grown with the larger one
+  lci::packet_t* packet = pool.get_for_size(8);
+  ASSERT_NE(packet, nullptr);
+  ASSERT_EQ(pool.get_size_class(packet), 0);
+  packets.push_back(packet);
+  for (auto p : packets) pool.put(p);
+  // the grown slabs are returned one by one
+  for (int i = 0; i < 1024 * 16 && pool.get_nslabs() > 1; i++) {
+    pool.maybe_shrink();
+  }
+  ASSERT_EQ(pool.get_nslabs(), 1);
+  ASSERT_EQ(pool.get_size(), attr.npackets);
+  // and can be added again
+  packets.clear();
+  for (size_t i = 0; i < 2 * pool.get_npackets(); i++) {
+    packets.push_back(pool.get());
+    ASSERT_NE(packets.back(), nullptr);
+  }
+  ASSERT_EQ(pool.get_nslabs(), 2);
+  for (auto p : packets) pool.put(p);
+  lci::global_finalize();
+}
 }  // namespace test_packet_pool
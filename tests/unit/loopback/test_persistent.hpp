@@ -0,0 +1,97 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+namespace test_comm_persistent
+{
+void wait(lci::comp_t cq, const lci::status_t& status)
+{
+  lci::status_t cq_status = status;
+  if (status.is_posted()) {
+    do {
+      lci::progress();
+      cq_status = lci::cq_pop(cq);
+    } while (cq_status.is_retry());
+  }
+}
+
+void test_persistent_sendrecv(size_t msg_size, int niters)
+{
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = 17;
+  lci::comp_t scq = lci::alloc_cq();
+  lci::comp_t rcq = lci::alloc_cq();
+  std::vector<char> send_buffer(msg_size);
+  std::vector<char> recv_buffer(msg_size);
+
+  lci::persistent_comm_t send = lci::alloc_persistent_comm_x(
+                                    lci::direction_t::OUT, rank,
+                                    send_buffer.data(), msg_size, scq)
+                                    .tag(tag)();
+  lci::persistent_comm_t recv = lci::alloc_persistent_comm_x(
+                                    lci::direction_t::IN, rank,
+                                    recv_buffer.data(), msg_size, rcq)
+                                    .tag(tag)();
+  for (int i = 0; i < niters; i++) {
+    util::write_buffer(send_buffer.data(), msg_size, 'a' + i % 26);
+    util::write_buffer(recv_buffer.data(), msg_size, 'z');
+    lci::status_t recv_status, send_status;
+    KEEP_RETRY(recv_status, lci::start(recv));
+    KEEP_RETRY(send_status, lci::start(send));
+    ASSERT_EQ(send_status.tag, tag);
+    ASSERT_EQ(send_status.size, msg_size);
+    wait(scq, send_status);
+    wait(rcq, recv_status);
+    util::check_buffer(recv_buffer.data(), msg_size, 'a' + i % 26);
+  }
+  lci::free_persistent_comm(&send);
+  lci::free_persistent_comm(&recv);
+  ASSERT_TRUE(send.is_empty());
+  lci::free_comp(&rcq);
+  lci::free_comp(&scq);
+}
+
+void test_persistent_putget(size_t msg_size, int niters)
+{
+  int rank = lci::get_rank_me();
+  std::vector<char> local_buffer(msg_size);
+  std::vector<char> remote_buffer(msg_size);
+  lci::mr_t mr = lci::register_memory(remote_buffer.data(), msg_size);
+  lci::rmr_t rmr = lci::get_rmr(mr);
+
+  // blocking operations
+  lci::persistent_comm_t put =
+      lci::alloc_persistent_comm_x(lci::direction_t::OUT, rank,
+                                   local_buffer.data(), msg_size,
+                                   lci::COMP_NULL)
+          .rmr(rmr)();
+  lci::persistent_comm_t get =
+      lci::alloc_persistent_comm_x(lci::direction_t::IN, rank,
+                                   local_buffer.data(), msg_size,
+                                   lci::COMP_NULL)
+          .rmr(rmr)();
+  for (int i = 0; i < niters; i++) {
+    util::write_buffer(local_buffer.data(), msg_size, 'a' + i % 26);
+    ASSERT_TRUE(lci::start(put).is_done());
+    util::check_buffer(remote_buffer.data(), msg_size, 'a' + i % 26);
+    util::write_buffer(local_buffer.data(), msg_size, 'z');
+    ASSERT_TRUE(lci::start(get).is_done());
+    util::check_buffer(local_buffer.data(), msg_size, 'a' + i % 26);
+  }
+  lci::free_persistent_comm(&put);
+  lci::free_persistent_comm(&get);
+  lci::deregister_memory(&mr);
+}
+
+TEST(COMM_PERSISTENT, persistent)
+{
+  lci::g_runtime_init();
+  const size_t max_bcopy_size = lci::get_max_bcopy_size();
+  const int niters = 100;
+  // the inject, eager and rendezvous protocols
+  for (size_t msg_size : {size_t(8), max_bcopy_size, max_bcopy_size * 4}) {
+    test_persistent_sendrecv(msg_size, niters);
+    test_persistent_putget(msg_size, niters);
+  }
+  lci::g_runtime_fina();
+}
+}  // namespace test_comm_persistent
@@ -71,10 +71,69 @@ void exercise_large_sendrecv()
   lci::free_comp(&send_cq);
 }
 
+// A zero-byte message only takes the rendezvous protocol if its eager
+// metadata does not fit in a zero eager threshold.
+void exercise_empty_sendrecv()
+{
+  const lci::tag_t tag = lci::get_g_runtime().get_attr_max_imm_tag() + 1;
+  const int rank = lci::get_rank_me();
+
+  lci::comp_t send_cq = lci::alloc_cq();
+  lci::comp_t recv_cq = lci::alloc_cq();
+
+  lci::status_t status;
+  bool poll_recv = false;
+  KEEP_RETRY(status, lci::post_recv_x(rank, nullptr, 0, tag, recv_cq)());
+  if (status.is_posted()) {
+    poll_recv = true;
+  } else {
+    ASSERT_TRUE(status.is_done());
+  }
+
+  bool poll_send = false;
+  KEEP_RETRY(status, lci::post_send_x(rank, nullptr, 0, tag, send_cq)());
+  if (status.is_posted()) {
+    poll_send = true;
+  } else {
+    ASSERT_TRUE(status.is_done());
+  }
+
+  if (poll_send) {
+    do {
+      status = lci::cq_pop(send_cq);
+      if (status.is_retry()) {
+        lci::progress();
+      }
+    } while (status.is_retry());
+    ASSERT_TRUE(status.is_done());
+  }
+
+  if (poll_recv) {
+    do {
+      status = lci::cq_pop(recv_cq);
+      if (status.is_retry()) {
+        lci::progress();
+      }
+    } while (status.is_retry());
+    ASSERT_TRUE(status.is_done());
+    ASSERT_EQ(status.size, 0u);
+  }
+
+  lci::free_comp(&recv_cq);
+  lci::free_comp(&send_cq);
+}
+
 void run_protocol_case(lci::attr_rdv_protocol_t protocol,
-                       bool requires_putimm_support)
+                       bool requires_putimm_support,
+                       size_t rdv_read_threshold = 262144,
+                       bool rdv_pipeline = false)
 {
-  auto runtime = lci::g_runtime_init_x().rdv_protocol(protocol)();
+  // A small chunk size splits the test message into several chunks.
+  auto runtime = lci::g_runtime_init_x()
+                     .rdv_protocol(protocol)
+                     .rdv_read_threshold(rdv_read_threshold)
+                     .rdv_pipeline(rdv_pipeline)
+                     .rdv_pipeline_chunk_size(4096)();
   (void)runtime;
 
   auto actual_protocol = lci::get_g_runtime().get_attr_rdv_protocol();
@@ -105,4 +164,41 @@ TEST(RDV_PROTOCOL, WriteImm)
   run_protocol_case(lci::attr_rdv_protocol_t::writeimm, true);
 }
 
+TEST(RDV_PROTOCOL, Read)
+{
+  run_protocol_case(lci::attr_rdv_protocol_t::read, false);
+}
+
+TEST(RDV_PROTOCOL, ReadEmpty)
+{
+  auto runtime = lci::g_runtime_init_x()
+                     .rdv_protocol(lci::attr_rdv_protocol_t::read)
+                     .eager_threshold(0)();
+  (void)runtime;
+  exercise_empty_sendrecv();
+  lci::g_runtime_fina();
+}
+
+TEST(RDV_PROTOCOL, AutoSelectRead)
+{
+  // the message size is always below the threshold
+  run_protocol_case(lci::attr_rdv_protocol_t::auto_select, false, SIZE_MAX);
+}
+
+TEST(RDV_PROTOCOL, AutoSelectWrite)
+{
+  // the message size is always above the threshold
+  run_protocol_case(lci::attr_rdv_protocol_t::auto_select, false, 0);
+}
+
+TEST(RDV_PROTOCOL, WritePipeline)
+{
+  run_protocol_case(lci::attr_rdv_protocol_t::write, false, 262144, true);
+}
+
+TEST(RDV_PROTOCOL, WriteImmPipeline)
+{
+  run_protocol_case(lci::attr_rdv_protocol_t::writeimm, true, 262144, true);
+}
+
 }  // namespace test_rdv_protocol
@@ -125,4 +125,201 @@ TEST(COMM_SENDRECV, sendrecv)
   lci::g_runtime_fina();
 }
 
+void test_sendrecv_eager_rdma_worker_fn(int thread_id, int nmsgs,
+                                        size_t msg_size, lci::device_t device)
+{
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = thread_id;
+  lci::comp_t rcq = lci::alloc_cq();
+
+  std::vector<char> send_buffer(msg_size + 1);
+  std::vector<char> recv_buffer(msg_size + 1);
+  for (int i = 0; i < nmsgs; i++) {
+    util::write_buffer(send_buffer.data(), msg_size, 'a' + i % 26);
+    util::write_buffer(recv_buffer.data(), msg_size, 'b');
+    lci::status_t status;
+    do {
+      status = lci::post_recv_x(rank, recv_buffer.data(), msg_size, tag, rcq)
+                   .device(device)();
+      lci::progress_x().device(device)();
+    } while (status.is_retry());
+    bool poll_recv = status.is_posted();
+    do {
+      status = lci::post_send_x(rank, send_buffer.data(), msg_size, tag,
+                                lci::COMP_NULL)
+                   .device(device)();
+      lci::progress_x().device(device)();
+    } while (status.is_retry());
+    while (poll_recv) {
+      lci::progress_x().device(device)();
+      status = lci::cq_pop(rcq);
+      poll_recv = status.is_retry();
+    }
+    util::check_buffer(recv_buffer.data(), msg_size, 'a' + i % 26);
+  }
+  lci::free_comp(&rcq);
+}
+
+TEST(COMM_SENDRECV, sendrecv_eager_rdma)
+{
+  lci::g_runtime_init();
+  // Set up the ring after the first message and use a small ring so that
+  // the credits have to be returned several times.
+  lci::device_t device = lci::alloc_device_x()
+                             .eager_rdma_threshold(1)
+                             .eager_rdma_nslots(8)
+                             .eager_rdma_slot_size(256)();
+
+  const int nmsgs_total = util::NITERS_SMALL;
+  // The last two sizes do not fit into a slot.
+  std::vector<size_t> msg_sizes = {0, 8, 252, 253, lci::get_max_bcopy_size()};
+  std::vector<int> nthreads = {1, util::NTHREADS};
+  for (auto& nthread : nthreads) {
+    for (auto& msg_size : msg_sizes) {
+      int nmsgs = nmsgs_total / nthread;
+      util::spawn_threads(nthread, test_sendrecv_eager_rdma_worker_fn, nmsgs,
+                          msg_size, device);
+    }
+  }
+
+  lci::wait_drained_x().device(device)();
+  lci::free_device(&device);
+  lci::g_runtime_fina();
+}
+
+void test_sendrecv_zero_copy_worker_fn(int thread_id, int nmsgs,
+                                       size_t msg_size, bool expected_msg)
+{
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = thread_id;
+  lci::comp_t rcq = lci::alloc_cq();
+
+  std::vector<char> send_buffer(msg_size);
+  for (int i = 0; i < nmsgs; i++) {
+    util::write_buffer(send_buffer.data(), msg_size, 'a' + i % 26);
+    lci::status_t status;
+    bool poll_recv = false;
+    for (int j = 0; j < 2; j++) {
+      if ((j == 0) == expected_msg) {
+        // eager messages only need a buffer for the rendezvous fallback
+        KEEP_RETRY(status, lci::post_recv_x(rank, nullptr, msg_size, tag, rcq)
+                               .zero_copy(true)());
+        poll_recv = status.is_posted();
+      } else {
+        KEEP_RETRY(status, lci::post_send(rank, send_buffer.data(), msg_size,
+                                          tag, lci::COMP_NULL));
+      }
+    }
+    if (poll_recv) {
+      do {
+        lci::progress();
+        status = lci::cq_pop(rcq);
+      } while (status.is_retry());
+    }
+    ASSERT_EQ(status.size, msg_size);
+    ASSERT_NE(status.buffer, nullptr);
+    util::check_buffer(status.buffer, msg_size, 'a' + i % 26);
+    lci::put_upacket(status.buffer);
+  }
+  lci::free_comp(&rcq);
+}
+
+TEST(COMM_SENDRECV, sendrecv_zero_copy)
+{
+  lci::g_runtime_init();
+  const int nmsgs_total = util::NITERS_SMALL;
+  std::vector<size_t> msg_sizes = {8, lci::get_max_bcopy_size()};
+  std::vector<int> nthreads = {1, util::NTHREADS};
+  for (bool expected_msg : {true, false}) {
+    for (auto& nthread : nthreads) {
+      for (auto& msg_size : msg_sizes) {
+        int nmsgs = nmsgs_total / nthread;
+        util::spawn_threads(nthread, test_sendrecv_zero_copy_worker_fn, nmsgs,
+                            msg_size, expected_msg);
+      }
+    }
+  }
+  lci::g_runtime_fina();
+}
+
+void test_sendrecv_offload_worker_fn(int thread_id, int nmsgs,
+                                     size_t msg_size,
+                                     lci::matching_engine_t matching_engine,
+                                     bool register_memory, bool any_tag)
+{
+  int rank = lci::get_rank_me();
+  lci::tag_t tag = thread_id + 1;
+  lci::comp_t rcq = lci::alloc_cq();
+  // a recv of ANY_TAG matches the sends of the rank_only policy
+  lci::matching_policy_t policy = any_tag ? lci::matching_policy_t::rank_only
+                                          : lci::matching_policy_t::rank_tag;
+
+  std::vector<char> send_buffer(msg_size);
+  std::vector<char> recv_buffer(msg_size);
+  lci::mr_t send_mr, recv_mr;
+  if (register_memory) {
+    send_mr = lci::register_memory(send_buffer.data(), msg_size);
+    recv_mr = lci::register_memory(recv_buffer.data(), msg_size);
+  }
+  for (int i = 0; i < nmsgs; i++) {
+    util::write_buffer(send_buffer.data(), msg_size, 'a' + i % 26);
+    util::write_buffer(recv_buffer.data(), msg_size, 'z');
+    lci::status_t status;
+    KEEP_RETRY(status, lci::post_recv_x(rank, recv_buffer.data(), msg_size,
+                                        any_tag ? lci::ANY_TAG : tag, rcq)
+                           .matching_engine(matching_engine)
+                           .matching_policy(policy)
+                           .mr(recv_mr)());
+    bool poll_recv = status.is_posted();
+    KEEP_RETRY(status, lci::post_send_x(rank, send_buffer.data(), msg_size,
+                                        tag, lci::COMP_NULL)
+                           .matching_engine(matching_engine)
+                           .matching_policy(policy)
+                           .mr(send_mr)());
+    if (poll_recv) {
+      do {
+        lci::progress();
+        status = lci::cq_pop(rcq);
+      } while (status.is_retry());
+    }
+    ASSERT_EQ(status.rank, rank);
+    ASSERT_EQ(status.tag, tag);
+    ASSERT_EQ(status.size, msg_size);
+    util::check_buffer(recv_buffer.data(), msg_size, 'a' + i % 26);
+  }
+  if (register_memory) {
+    lci::deregister_memory(&send_mr);
+    lci::deregister_memory(&recv_mr);
+  }
+  lci::free_comp(&rcq);
+}
+
+// The offload matching engine lets a network with tagged messages match
+// send-recv, and matches them in software otherwise.
+TEST(COMM_SENDRECV, sendrecv_offload)
+{
+  lci::g_runtime_init();
+  lci::matching_engine_t matching_engine =
+      lci::alloc_matching_engine_x()
+          .matching_engine_type(lci::attr_matching_engine_type_t::offload)();
+  const int nmsgs_total = util::NITERS_SMALL;
+  const size_t max_bcopy_size = lci::get_max_bcopy_size();
+  std::vector<size_t> msg_sizes = {0, 8, max_bcopy_size, max_bcopy_size + 1,
+                                   65536};
+  for (bool any_tag : {false, true}) {
+    for (bool register_memory : {false, true}) {
+      // a recv of ANY_TAG may match the message of another thread
+      for (int nthread : {1, any_tag ? 1 : util::NTHREADS}) {
+        for (auto& msg_size : msg_sizes) {
+          util::spawn_threads(nthread, test_sendrecv_offload_worker_fn,
+                              nmsgs_total / nthread, msg_size,
+                              matching_engine, register_memory, any_tag);
+        }
+      }
+    }
+  }
+  lci::free_matching_engine(&matching_engine);
+  lci::g_runtime_fina();
+}
+
 }  // namespace test_comm_sendrecv
\ No newline at end of file
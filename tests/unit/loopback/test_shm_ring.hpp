@@ -684,6 +684,33 @@ TEST(SHM_POSIX_RING, repeated_owner_attach_unlink_and_message_lifecycle)
   }
 }
 
+TEST(SHM_POSIX_RING, huge_page_mappings_keep_the_geometry)
+{
+  // a ring of one huge page; the kernel may or may not honor the hint
+  const size_t slot_count = 16384;
+  const std::string name = unique_shm_name("hugepage", 0);
+  const auto expected =
+      expected_ring(name, 2, UINT64_C(0x12345678), slot_count, 128, 64);
+  std::string error;
+  auto owner = lci::shm::posix_owner_mapping_t::create(
+      name, 2, UINT64_C(0x12345678), slot_count, 128, 64, 4, 1, &error, true);
+  ASSERT_NE(owner, nullptr) << error;
+  EXPECT_EQ(owner->handle().mapping_size, expected.mapping_size);
+  auto peer = lci::shm::posix_peer_mapping_t::attach(
+      owner->handle(), expected, 4, 1, &error, true);
+  ASSERT_NE(peer, nullptr) << error;
+  EXPECT_TRUE(owner->unlink_name(&error)) << error;
+
+  for (uint64_t value = 0; value < 2 * slot_count; ++value) {
+    ASSERT_TRUE(
+        peer->ring().post_send(5, &value, sizeof(value), 0).is_done());
+    lci::shm::recv_slot_t view;
+    ASSERT_TRUE(owner->ring().poll(&view));
+    EXPECT_EQ(*static_cast<const uint64_t*>(view.payload), value);
+    EXPECT_TRUE(owner->ring().release(&view));
+  }
+}
+
 TEST(SHM_POSIX_RING, generated_object_names_are_compact_and_identity_based)
 {
   EXPECT_LE(sizeof(lci::shm::posix_ring_handle_t),
@@ -85,4 +85,36 @@ TEST(SYNC, multithread0)
   lci::g_runtime_fina();
 }
 
+// the consumer sleeps until the producers are done
+TEST(SYNC, blocking)
+{
+  lci::g_runtime_init();
+  const int threshold = util::NTHREADS;
+
+  lci::comp_t comp = lci::alloc_sync_x().threshold(threshold).blocking(true)();
+  for (bool do_progress : {false, true}) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threshold; i++) {
+      std::thread t([=]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        my_sync_signal(comp, i);
+      });
+      threads.push_back(std::move(t));
+    }
+    std::vector<lci::status_t> statuses(threshold);
+    lci::sync_wait_x(comp, statuses.data()).do_progress(do_progress)();
+    std::vector<bool> flags(threshold, false);
+    for (int i = 0; i < threshold; i++) {
+      uint64_t idx = reinterpret_cast<uint64_t>(statuses[i].user_context) - 1;
+      ASSERT_EQ(flags[idx], false);
+      flags[idx] = true;
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+  lci::free_comp(&comp);
+  lci::g_runtime_fina();
+}
+
 }  // namespace test_sync
\ No newline at end of file
@@ -0,0 +1,342 @@
+// Copyright (c) 2025 The LCI Project Authors
+// SPDX-License-Identifier: NCSA
+
+// Measure the send/recv latency of every protocol over a range of message
+// sizes and write the crossovers into a tuning profile, to be loaded through
+// the `tuning_profile` runtime attribute (LCI_ATTR_TUNING_PROFILE).
+//
+// Each protocol is forced by allocating a runtime with the thresholds that
+// leave only this protocol for the measured sizes. Rank i measures a
+// ping-pong with rank i + nranks / 2 (or with itself if there is only one
+// rank), and rank 0 writes the profile.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lci.hpp"
+
+namespace
+{
+enum class protocol_t {
+  inject,
+  eager_bcopy,
+  eager_zcopy,
+  rdv_write,
+  rdv_read,
+};
+
+const char* protocol_str[] = {"inject", "eager_bcopy", "eager_zcopy",
+                              "rdv_write", "rdv_read"};
+
+const int nprotocols = 5;
+
+struct config_t {
+  std::string output = "lci_tuning_profile.txt";
+  size_t max_size = 1 << 22;
+  int niters = 100;
+} g_config;
+
+// The latency (in seconds) of every protocol at every size. A negative value
+// means that the protocol cannot send this size.
+struct result_t {
+  std::vector<size_t> sizes;
+  std::vector<double> latency[nprotocols];
+};
+
+void print_help()
+{
+  std::cout << "Usage: lci_tune [options]\n";
+  std::cout << "Options:\n";
+  std::cout << "  -o, --output <file>    The tuning profile to write "
+               "(default: lci_tuning_profile.txt)\n";
+  std::cout << "  -m, --max-size <size>  The max message size to measure "
+               "(default: 4194304)\n";
+  std::cout << "  -n, --niters <n>       The number of ping-pongs per size "
+               "(default: 100)\n";
+  std::cout << "  -h, --help             Print this help\n";
+}
+
+bool parse_args(int argc, char** argv)
+{
+  for (int i = 1; i < argc; i++) {
+    std::string arg(argv[i]);
+    if (arg == "-h" || arg == "--help") {
+      print_help();
+      exit(0);
+    }
+    if (i + 1 >= argc) {
+      std::cerr << "Unknown option or missing value: " << arg << "\n";
+      return false;
+    }
+    std::string value(argv[++i]);
+    if (arg == "-o" || arg == "--output") {
+      g_config.output = value;
+    } else if (arg == "-m" || arg == "--max-size") {
+      g_config.max_size = std::stoull(value);
+    } else if (arg == "-n" || arg == "--niters") {
+      g_config.niters = std::stoi(value);
+    } else {
+      std::cerr << "Unknown option: " << arg << "\n";
+      return false;
+    }
+  }
+  return g_config.max_size > 0 && g_config.niters > 0;
+}
+
+lci::runtime_t alloc_runtime_for(protocol_t protocol)
+{
+  // ignore any existing tuning profile
+  auto alloc_runtime =
+      lci::alloc_runtime_x().tuning_profile("").zcopy_threshold(0);
+  switch (protocol) {
+    case protocol_t::inject:
+      return alloc_runtime();
+    case protocol_t::eager_bcopy:
+    case protocol_t::eager_zcopy:
+      return alloc_runtime.inject_threshold(0)();
+    case protocol_t::rdv_write:
+      return alloc_runtime.eager_threshold(0)
+          .rdv_protocol(lci::attr_rdv_protocol_t::auto_select)
+          .rdv_read_threshold(0)();
+    case protocol_t::rdv_read:
+      return alloc_runtime.eager_threshold(0)
+          .rdv_protocol(lci::attr_rdv_protocol_t::read)();
+  }
+  return lci::runtime_t();
+}
+
+void wait(lci::runtime_t runtime, lci::comp_t cq, int n)
+{
+  while (n > 0) {
+    lci::progress_x().runtime(runtime)();
+    if (!lci::cq_pop_x(cq).runtime(runtime)().is_retry()) --n;
+  }
+}
+
+void post(lci::runtime_t runtime, lci::direction_t direction, int rank,
+          void* buffer, size_t size, lci::comp_t cq, lci::mr_t mr, int* n)
+{
+  lci::status_t status;
+  do {
+    status = lci::post_comm_x(direction, rank, buffer, size, cq)
+                 .runtime(runtime)
+                 .mr(mr)();
+    if (status.is_retry()) lci::progress_x().runtime(runtime)();
+  } while (status.is_retry());
+  if (status.is_posted()) ++*n;
+}
+
+// The half round-trip time of a message
+double pingpong(lci::runtime_t runtime, int peer, bool is_initiator,
+                char* send_buffer, char* recv_buffer, size_t size,
+                lci::comp_t cq, lci::mr_t send_mr, lci::mr_t recv_mr)
+{
+  const int nwarmups = 10;
+  std::chrono::high_resolution_clock::time_point start;
+  for (int i = 0; i < nwarmups + g_config.niters; i++) {
+    if (i == nwarmups) start = std::chrono::high_resolution_clock::now();
+    int n = 0;
+    if (is_initiator) {
+      post(runtime, lci::direction_t::IN, peer, recv_buffer, size, cq, recv_mr,
+           &n);
+      post(runtime, lci::direction_t::OUT, peer, send_buffer, size, cq,
+           send_mr, &n);
+      wait(runtime, cq, n);
+    } else {
+      post(runtime, lci::direction_t::IN, peer, recv_buffer, size, cq, recv_mr,
+           &n);
+      wait(runtime, cq, n);
+      n = 0;
+      post(runtime, lci::direction_t::OUT, peer, send_buffer, size, cq,
+           send_mr, &n);
+      wait(runtime, cq, n);
+    }
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count() / g_config.niters / 2;
+}
+
+void measure(protocol_t protocol, result_t* result)
+{
+  int rank = lci::get_rank_me();
+  int nranks = lci::get_rank_n();
+  bool is_initiator = nranks == 1 || rank < nranks / 2;
+  int peer = is_initiator ? rank + nranks / 2 : rank - nranks / 2;
+  if (nranks == 1 || (nranks % 2 == 1 && rank == nranks - 1)) {
+    // the odd rank out talks to itself
+    peer = rank;
+    is_initiator = true;
+  }
+
+  lci::runtime_t runtime = alloc_runtime_for(protocol);
+  lci::net_context_t net_context =
+      lci::get_default_net_context_x().runtime(runtime)();
+  const size_t max_inject_size = net_context.get_attr_max_inject_size();
+  const size_t max_bcopy_size = lci::get_max_bcopy_size_x().runtime(runtime)();
+  lci::comp_t cq = lci::alloc_cq_x().runtime(runtime)();
+  std::vector<char> send_buffer(g_config.max_size, 'a');
+  std::vector<char> recv_buffer(g_config.max_size, 'b');
+  lci::mr_t send_mr, recv_mr;
+  if (protocol == protocol_t::eager_zcopy) {
+    send_mr = lci::register_memory_x(send_buffer.data(), g_config.max_size)
+                  .runtime(runtime)();
+    recv_mr = lci::register_memory_x(recv_buffer.data(), g_config.max_size)
+                  .runtime(runtime)();
+  }
+
+  auto& latency = result->latency[static_cast<int>(protocol)];
+  latency.assign(result->sizes.size(), -1);
+  for (size_t i = 0; i < result->sizes.size(); i++) {
+    size_t size = result->sizes[i];
+    size_t max_size = g_config.max_size;
+    if (protocol == protocol_t::inject) {
+      max_size = max_inject_size;
+    } else if (protocol == protocol_t::eager_bcopy ||
+               protocol == protocol_t::eager_zcopy) {
+      max_size = max_bcopy_size;
+    }
+    if (size > max_size) continue;
+    lci::barrier_x().runtime(runtime)();
+    latency[i] = pingpong(runtime, peer, is_initiator, send_buffer.data(),
+                          recv_buffer.data(), size, cq, send_mr, recv_mr);
+  }
+  lci::barrier_x().runtime(runtime)();
+
+  if (protocol == protocol_t::eager_zcopy) {
+    lci::deregister_memory_x(&send_mr).runtime(runtime)();
+    lci::deregister_memory_x(&recv_mr).runtime(runtime)();
+  }
+  lci::free_comp_x(&cq).runtime(runtime)();
+  lci::free_runtime(&runtime);
+}
+
+double get_latency(const result_t& result, protocol_t protocol, size_t i)
+{
+  return result.latency[static_cast<int>(protocol)][i];
+}
+
+double get_min_latency(const result_t& result, protocol_t a, protocol_t b,
+                       size_t i)
+{
+  double la = get_latency(result, a, i);
+  double lb = get_latency(result, b, i);
+  if (la < 0) return lb;
+  if (lb < 0) return la;
+  return std::min(la, lb);
+}
+
+// The largest measured size up to which `winner` is not slower than `loser`
+// at any size `loser` can send. 0 if `winner` loses at the smallest size.
+template <typename winner_fn_t, typename loser_fn_t>
+size_t find_crossover(const result_t& result, winner_fn_t winner,
+                      loser_fn_t loser)
+{
+  size_t threshold = 0;
+  for (size_t i = 0; i < result.sizes.size(); i++) {
+    double w = winner(i);
+    double l = loser(i);
+    if (w < 0) break;
+    if (l >= 0 && w > l) break;
+    threshold = result.sizes[i];
+  }
+  return threshold;
+}
+
+void write_profile(const result_t& result)
+{
+  auto latency_of = [&](protocol_t protocol) {
+    return [&result, protocol](size_t i) {
+      return get_latency(result, protocol, i);
+    };
+  };
+  auto eager_latency = [&](size_t i) {
+    return get_min_latency(result, protocol_t::eager_bcopy,
+                           protocol_t::eager_zcopy, i);
+  };
+  auto rdv_latency = [&](size_t i) {
+    return get_min_latency(result, protocol_t::rdv_write, protocol_t::rdv_read,
+                           i);
+  };
+  size_t inject_threshold =
+      find_crossover(result, latency_of(protocol_t::inject), eager_latency);
+  // a registered buffer is copied as long as the copy is faster
+  size_t zcopy_threshold =
+      find_crossover(result, latency_of(protocol_t::eager_bcopy),
+                     latency_of(protocol_t::eager_zcopy)) +
+      1;
+  size_t eager_threshold = find_crossover(result, eager_latency, rdv_latency);
+  size_t rdv_read_threshold =
+      find_crossover(result, latency_of(protocol_t::rdv_read),
+                     latency_of(protocol_t::rdv_write));
+
+  std::ofstream file(g_config.output);
+  if (!file) {
+    std::cerr << "Cannot open " << g_config.output << "\n";
+    exit(1);
+  }
+  file << "# LCI tuning profile written by lci_tune\n";
+  file << "# size";
+  for (int p = 0; p < nprotocols; p++) file << " " << protocol_str[p];
+  file << " (half round-trip latency in us)\n";
+  for (size_t i = 0; i < result.sizes.size(); i++) {
+    file << "# " << result.sizes[i];
+    for (int p = 0; p < nprotocols; p++) {
+      double l = result.latency[p][i];
+      if (l < 0)
+        file << " -";
+      else
+        file << " " << l * 1e6;
+    }
+    file << "\n";
+  }
+  file << "inject_threshold = " << inject_threshold << "\n";
+  file << "zcopy_threshold = " << zcopy_threshold << "\n";
+  file << "eager_threshold = " << eager_threshold << "\n";
+  file << "rdv_read_threshold = " << rdv_read_threshold << "\n";
+  std::cout << "inject_threshold = " << inject_threshold << "\n";
+  std::cout << "zcopy_threshold = " << zcopy_threshold << "\n";
+  std::cout << "eager_threshold = " << eager_threshold << "\n";
+  std::cout << "rdv_read_threshold = " << rdv_read_threshold << "\n";
+  std::cout << "The tuning profile has been written to " << g_config.output
+            << "\n";
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (!parse_args(argc, argv)) {
+    print_help();
+    return 1;
+  }
+  lci::g_runtime_init();
+
+  // the powers of two and the static limits
+  result_t result;
+  const size_t max_inject_size =
+      lci::get_default_net_context().get_attr_max_inject_size();
+  const size_t max_bcopy_size = lci::get_max_bcopy_size();
+  for (size_t size = 1; size <= g_config.max_size; size *= 2) {
+    if (max_inject_size < size && max_inject_size > size / 2)
+      result.sizes.push_back(max_inject_size);
+    if (max_bcopy_size < size && max_bcopy_size > size / 2)
+      result.sizes.push_back(max_bcopy_size);
+    result.sizes.push_back(size);
+  }
+
+  for (int p = 0; p < nprotocols; p++) {
+    if (lci::get_rank_me() == 0)
+      std::cout << "Measuring " << protocol_str[p] << "\n";
+    measure(static_cast<protocol_t>(p), &result);
+  }
+  if (lci::get_rank_me() == 0) write_profile(result);
+
+  lci::g_runtime_fina();
+  return 0;
+}